@@ -0,0 +1,227 @@
+/*
+ * File:   BinaryFormatBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ *  Create a grid graph with the given number of rows and columns.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] rows             The number of rows of the grid.
+ *  @param[in] columns          The number of columns of the grid.
+ *
+ *  @return The grid graph.
+ */
+htd::MultiHypergraph * createGridGraph(const htd::LibraryInstance * const libraryInstance, std::size_t rows, std::size_t columns)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance);
+
+    ret->addVertices(rows * columns);
+
+    for (std::size_t column = 0; column < columns; ++column)
+    {
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            htd::vertex_t vertex = static_cast<htd::vertex_t>(column * rows + row + htd::Vertex::FIRST);
+
+            if (row + 1 < rows)
+            {
+                ret->addEdge(vertex, vertex + 1);
+            }
+
+            if (column + 1 < columns)
+            {
+                ret->addEdge(vertex, static_cast<htd::vertex_t>(vertex + rows));
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Check whether the given view contains exactly the given decomposition.
+ *
+ *  @param[in] decomposition    The decomposition which was exported.
+ *  @param[in] view             The view of the exported decomposition.
+ *
+ *  @return True if the view contains exactly the given decomposition, false otherwise.
+ */
+bool equals(const htd::ITreeDecomposition & decomposition, const htd_io::BinaryDecompositionView & view)
+{
+    if (!view.isOpen() || view.vertexCount() != decomposition.vertexCount() || view.root() != decomposition.root() ||
+        view.maximumBagSize() != decomposition.maximumBagSize() || view.labelCount() != decomposition.labelCount() ||
+        !(view.vertices() == decomposition.vertices()))
+    {
+        return false;
+    }
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        if (view.parent(node) != (decomposition.isRoot(node) ? htd::Vertex::UNKNOWN : decomposition.parent(node)) ||
+            !(view.children(node) == decomposition.children(node)) ||
+            !(view.bagContent(node) == htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(node))) ||
+            view.inducedHyperedgeCount(node) != decomposition.inducedHyperedges(node).size())
+        {
+            return false;
+        }
+
+        htd::index_t index = 0;
+
+        for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+        {
+            if (view.inducedHyperedgeAtPosition(node, index) != hyperedge)
+            {
+                return false;
+            }
+
+            ++index;
+        }
+
+        for (const std::string & labelName : decomposition.labelNames())
+        {
+            if (view.isLabeledVertex(labelName, node) != decomposition.isLabeledVertex(labelName, node))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t columns = argc > 1 ? std::stoul(argv[1]) : 20000;
+
+    std::string path = argc > 2 ? argv[2] : "BinaryFormatBenchmark.htdb";
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(createGridGraph(libraryInstance.get(), 8, columns));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::ITreeDecomposition> computedDecomposition(algorithm.computeDecomposition(*graph));
+
+    std::chrono::steady_clock::time_point computed = std::chrono::steady_clock::now();
+
+    htd::TreeDecomposition decomposition(*computedDecomposition);
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        if (decomposition.isLeaf(node))
+        {
+            decomposition.setVertexLabel("Leaf", node, new htd::Label<std::size_t>(decomposition.bagSize(node)));
+        }
+    }
+
+    htd_io::BinaryFormatExporter exporter;
+
+    std::chrono::steady_clock::time_point prepared = std::chrono::steady_clock::now();
+
+    {
+        std::ofstream outputStream(path, std::ios::out | std::ios::binary);
+
+        exporter.write(decomposition, *graph, outputStream);
+    }
+
+    std::chrono::steady_clock::time_point written = std::chrono::steady_clock::now();
+
+    htd_io::BinaryDecompositionView view(path);
+
+    std::size_t rootBagSize = view.isOpen() ? view.bagSize(view.root()) : 0;
+
+    std::chrono::steady_clock::time_point opened = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::IMutableTreeDecomposition> loadedDecomposition(view.createTreeDecomposition(libraryInstance.get()));
+
+    std::chrono::steady_clock::time_point loaded = std::chrono::steady_clock::now();
+
+    htd::TreeDecompositionVerifier verifier;
+
+    bool ok = equals(decomposition, view) && rootBagSize == decomposition.bagSize(decomposition.root()) &&
+              loadedDecomposition && loadedDecomposition->vertexCount() == decomposition.vertexCount() &&
+              loadedDecomposition->maximumBagSize() == decomposition.maximumBagSize() &&
+              loadedDecomposition->leafCount() == decomposition.leafCount() &&
+              loadedDecomposition->labelCount() == 1 && verifier.verify(*graph, *loadedDecomposition);
+
+    if (ok)
+    {
+        for (htd::vertex_t node : loadedDecomposition->leaves())
+        {
+            ok = ok && htd::accessLabel<std::string>(loadedDecomposition->vertexLabel("Leaf", node)) == std::to_string(loadedDecomposition->bagSize(node));
+        }
+    }
+
+    std::unique_ptr<htd::IMultiHypergraph> smallGraph(createGridGraph(libraryInstance.get(), 4, 50));
+
+    std::unique_ptr<htd::IPathDecompositionAlgorithm> pathDecompositionAlgorithm(libraryInstance->pathDecompositionAlgorithmFactory().createInstance());
+
+    std::unique_ptr<htd::IPathDecomposition> pathDecomposition(pathDecompositionAlgorithm->computeDecomposition(*smallGraph));
+
+    {
+        std::ofstream outputStream(path, std::ios::out | std::ios::binary);
+
+        exporter.write(*pathDecomposition, *smallGraph, outputStream);
+    }
+
+    htd_io::BinaryDecompositionView pathView(path);
+
+    std::unique_ptr<htd::IMutablePathDecomposition> loadedPathDecomposition(pathView.createPathDecomposition(libraryInstance.get()));
+
+    ok = ok && pathView.isPathDecomposition() && equals(*pathDecomposition, pathView) && loadedPathDecomposition &&
+         loadedPathDecomposition->vertexCount() == pathDecomposition->vertexCount() && verifier.verify(*smallGraph, *loadedPathDecomposition);
+
+    std::remove(path.c_str());
+
+    std::cout << "Vertices of the graph:      " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Nodes of the decomposition: " << std::setw(12) << decomposition.vertexCount() << std::endl;
+    std::cout << "Computing the decomposition:" << std::setw(12) << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(computed - start).count() << " ms" << std::endl;
+    std::cout << "Writing the binary file:    " << std::setw(12) << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(written - prepared).count() << " ms" << std::endl;
+    std::cout << "Opening the binary file:    " << std::setw(12) << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(opened - written).count() << " ms" << std::endl;
+    std::cout << "Creating a decomposition:   " << std::setw(12) << std::fixed << std::setprecision(3) << std::chrono::duration<double, std::milli>(loaded - opened).count() << " ms" << std::endl;
+
+    if (!ok)
+    {
+        std::cerr << "ERROR: The loaded decomposition differs from the exported decomposition!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * File:   ComponentDecompositionBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  Create a graph consisting of the given number of random connected components.
+ *
+ *  Each component is a random spanning tree to which the given number of additional random edges is added.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] componentCount   The number of connected components of the graph.
+ *  @param[in] componentSize    The number of vertices of each component.
+ *  @param[in] extraEdgeCount   The number of additional random edges of each component.
+ *
+ *  @return The random graph.
+ */
+htd::MultiHypergraph * createRandomForest(const htd::LibraryInstance * const libraryInstance, std::size_t componentCount, std::size_t componentSize, std::size_t extraEdgeCount)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance);
+
+    std::mt19937 generator(42);
+
+    for (std::size_t component = 0; component < componentCount; ++component)
+    {
+        htd::vertex_t firstVertex = ret->addVertices(componentSize);
+
+        for (std::size_t index = 1; index < componentSize; ++index)
+        {
+            ret->addEdge(static_cast<htd::vertex_t>(firstVertex + index), static_cast<htd::vertex_t>(firstVertex + generator() % index));
+        }
+
+        for (std::size_t index = 0; index < extraEdgeCount; ++index)
+        {
+            htd::vertex_t vertex1 = static_cast<htd::vertex_t>(firstVertex + generator() % componentSize);
+            htd::vertex_t vertex2 = static_cast<htd::vertex_t>(firstVertex + generator() % componentSize);
+
+            if (vertex1 != vertex2)
+            {
+                ret->addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Decompose the given graph with the given number of threads and measure the time needed.
+ *
+ *  @param[in] libraryInstance  The management instance to use.
+ *  @param[in] graph            The graph.
+ *  @param[in] threadCount      The number of threads used for decomposing the connected components.
+ *  @param[out] maximumBagSize  The maximum bag size of the computed decomposition.
+ *
+ *  @return The duration of the computation in milliseconds.
+ */
+double decompose(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph, std::size_t threadCount, std::size_t & maximumBagSize)
+{
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setComputeInducedEdgesEnabled(false);
+
+    algorithm.setThreadCount(threadCount);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    double ret = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    maximumBagSize = decomposition->maximumBagSize();
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t componentCount = argc > 1 ? std::stoul(argv[1]) : 200;
+
+    std::size_t componentSize = argc > 2 ? std::stoul(argv[2]) : 500;
+
+    std::size_t threadCount = argc > 3 ? std::stoul(argv[3]) : 4;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(createRandomForest(libraryInstance.get(), componentCount, componentSize, componentSize));
+
+    std::size_t sequentialBagSize = 0;
+    std::size_t parallelBagSize = 0;
+
+    double sequentialDuration = decompose(libraryInstance.get(), *graph, 1, sequentialBagSize);
+
+    double parallelDuration = decompose(libraryInstance.get(), *graph, threadCount, parallelBagSize);
+
+    std::cout << "Vertices:              " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Edges:                 " << std::setw(12) << graph->edgeCount() << std::endl;
+    std::cout << "Components:            " << std::setw(12) << componentCount << std::endl;
+    std::cout << "Maximum bag size:      " << std::setw(12) << sequentialBagSize << " / " << parallelBagSize << std::endl;
+    std::cout << "Sequential:            " << std::setw(12) << std::fixed << std::setprecision(3) << sequentialDuration << " ms" << std::endl;
+    std::cout << "Parallel (" << std::setw(2) << threadCount << " threads): " << std::setw(12) << std::fixed << std::setprecision(3) << parallelDuration << " ms" << std::endl;
+
+    return 0;
+}
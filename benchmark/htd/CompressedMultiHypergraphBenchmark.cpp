@@ -0,0 +1,155 @@
+/*
+ * File:   CompressedMultiHypergraphBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+/**
+ *  Get the peak resident set size of the current process.
+ *
+ *  @return The peak resident set size of the current process in megabytes or 0 if it is not available.
+ */
+double peakMemoryUsage(void)
+{
+    double ret = 0;
+
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#ifdef __APPLE__
+        ret = usage.ru_maxrss / (1024.0 * 1024.0);
+#else
+        ret = usage.ru_maxrss / 1024.0;
+#endif
+    }
+#endif
+
+    return ret;
+}
+
+/**
+ *  Visit all neighborhoods of the given graph.
+ *
+ *  @param[in] graph        The input graph.
+ *  @param[in] repetitions  The number of times the neighborhoods shall be visited.
+ *  @param[out] checksum    The sum of all visited neighbors, used to prevent the compiler from removing the traversal.
+ *
+ *  @return The duration of the traversal in milliseconds.
+ */
+double traverseNeighborhoods(const htd::IMultiHypergraph & graph, std::size_t repetitions, std::size_t & checksum)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    checksum = 0;
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        for (htd::vertex_t vertex : graph.vertices())
+        {
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                checksum += neighbor;
+            }
+        }
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ *  Import the given file and report the memory usage and the traversal time of the imported graph.
+ *
+ *  Because the peak resident set size cannot be reset, the representation is selected by the command line so
+ *  that each process measures exactly one of them.
+ */
+int main(int argc, const char * const * const argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "USAGE: " << argv[0] << " <gr file> mutable|compressed [repetitions]" << std::endl;
+
+        return 1;
+    }
+
+    std::string path(argv[1]);
+    std::string representation(argv[2]);
+
+    std::size_t repetitions = argc > 3 ? std::stoul(argv[3]) : 10;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd_io::GrFormatImporter importer(libraryInstance.get());
+
+    double baseMemoryUsage = peakMemoryUsage();
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::IMultiHypergraph> graph;
+
+    if (representation == "compressed")
+    {
+        graph.reset(importer.importCompressed(path));
+    }
+    else
+    {
+        graph.reset(importer.import(path));
+    }
+
+    double importDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    if (!graph)
+    {
+        std::cerr << "COULD NOT IMPORT GRAPH: " << path << std::endl;
+
+        return 1;
+    }
+
+    std::size_t checksum = 0;
+
+    double traversalDuration = traverseNeighborhoods(*graph, repetitions, checksum);
+
+    std::cout << "Representation:        " << std::setw(12) << representation << std::endl;
+    std::cout << "Vertices:              " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Edges:                 " << std::setw(12) << graph->edgeCount() << std::endl;
+    std::cout << "Import:                " << std::setw(12) << std::fixed << std::setprecision(3) << importDuration << " ms" << std::endl;
+    std::cout << "Traversal:             " << std::setw(12) << std::fixed << std::setprecision(3) << traversalDuration / repetitions << " ms" << std::endl;
+    std::cout << "Peak memory increase:  " << std::setw(12) << std::fixed << std::setprecision(3) << peakMemoryUsage() - baseMemoryUsage << " MB" << std::endl;
+    std::cout << "Checksum:              " << std::setw(12) << checksum << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * File:   GrFormatImporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ *  Write a random graph with the given number of vertices and edges in format 'gr' to the given file.
+ *
+ *  @param[in] path         The path to the output file.
+ *  @param[in] vertexCount  The number of vertices of the random graph.
+ *  @param[in] edgeCount    The number of edges of the random graph.
+ */
+void writeRandomGraph(const std::string & path, std::size_t vertexCount, std::size_t edgeCount)
+{
+    std::ofstream stream(path);
+
+    std::mt19937 generator(42);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    stream << "p tw " << vertexCount << " " << edgeCount << "\n";
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        stream << vertexDistribution(generator) << " " << vertexDistribution(generator) << "\n";
+    }
+}
+
+/**
+ *  Import the graph stored in the given file either via the memory-mapped or via the stream-based parser.
+ *
+ *  @param[in] libraryInstance  The management instance to which the imported graph shall belong.
+ *  @param[in] path             The path to the input file.
+ *  @param[in] memoryMapped     A boolean flag indicating whether the memory-mapped parser shall be used.
+ *  @param[out] edgeCount       The number of edges of the imported graph.
+ *
+ *  @return The duration of the import in milliseconds.
+ */
+double importGraph(const htd::LibraryInstance * const libraryInstance, const std::string & path, bool memoryMapped, std::size_t & edgeCount)
+{
+    htd_io::GrFormatImporter importer(libraryInstance);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::IMultiGraph> graph;
+
+    if (memoryMapped)
+    {
+        graph.reset(importer.import(path));
+    }
+    else
+    {
+        std::ifstream stream(path);
+
+        graph.reset(importer.import(stream));
+    }
+
+    double ret = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    edgeCount = graph ? graph->edgeCount() : 0;
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::string path = "GrFormatImporterBenchmark.gr";
+
+    if (argc > 1)
+    {
+        path = argv[1];
+    }
+    else
+    {
+        writeRandomGraph(path, 200000, 1000000);
+    }
+
+    std::size_t streamEdgeCount = 0;
+    std::size_t memoryMappedEdgeCount = 0;
+
+    double streamDuration = importGraph(libraryInstance.get(), path, false, streamEdgeCount);
+    double memoryMappedDuration = importGraph(libraryInstance.get(), path, true, memoryMappedEdgeCount);
+
+    if (argc <= 1)
+    {
+        std::remove(path.c_str());
+    }
+
+    std::cout << "Edges:                 " << std::setw(12) << memoryMappedEdgeCount << std::endl;
+    std::cout << "Stream-based parser:   " << std::setw(12) << std::fixed << std::setprecision(3) << streamDuration << " ms" << std::endl;
+    std::cout << "Memory-mapped parser:  " << std::setw(12) << std::fixed << std::setprecision(3) << memoryMappedDuration << " ms" << std::endl;
+
+    if (streamEdgeCount != memoryMappedEdgeCount || memoryMappedEdgeCount == 0)
+    {
+        std::cerr << "ERROR: The graphs imported by the two parsers differ!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,187 @@
+/*
+ * File:   MaxFlowBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ *  Create the adjacency lists of a random connected graph with the given number of vertices and edges.
+ *
+ *  The vertices are connected by a path in random order, the remaining edges are chosen randomly.
+ *
+ *  @param[in] vertexCount  The number of vertices of the random graph.
+ *  @param[in] edgeCount    The number of edges of the random graph.
+ *
+ *  @return The adjacency lists of the random graph, indexed by the vertex position.
+ */
+std::vector<std::vector<htd::index_t>> createRandomGraph(std::size_t vertexCount, std::size_t edgeCount)
+{
+    std::vector<std::vector<htd::index_t>> ret(vertexCount);
+
+    std::mt19937 generator(42);
+
+    std::vector<htd::index_t> order(vertexCount);
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        order[index] = index;
+    }
+
+    std::shuffle(order.begin(), order.end(), generator);
+
+    for (htd::index_t index = 1; index < vertexCount; ++index)
+    {
+        ret[order[index - 1]].push_back(order[index]);
+        ret[order[index]].push_back(order[index - 1]);
+    }
+
+    std::uniform_int_distribution<htd::index_t> vertexDistribution(0, vertexCount - 1);
+
+    for (std::size_t index = vertexCount; index < edgeCount; ++index)
+    {
+        htd::index_t vertex1 = vertexDistribution(generator);
+        htd::index_t vertex2 = vertexDistribution(generator);
+
+        if (vertex1 != vertex2 && std::find(ret[vertex1].begin(), ret[vertex1].end(), vertex2) == ret[vertex1].end())
+        {
+            ret[vertex1].push_back(vertex2);
+            ret[vertex2].push_back(vertex1);
+        }
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 300;
+
+    std::size_t pairCount = argc > 2 ? std::stoul(argv[2]) : 200;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::vector<std::vector<htd::index_t>> neighbors = createRandomGraph(vertexCount, vertexCount * 3);
+
+    /* The vertex-split network used by htd::MinimumSeparatorAlgorithm: in-node k, out-node k + n. */
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> arcs;
+
+    std::vector<std::size_t> capacities;
+
+    htd::FlowNetworkStructure flowNetworkStructure(vertexCount * 2);
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        arcs.emplace_back(index, index + vertexCount);
+
+        capacities.push_back(1);
+
+        flowNetworkStructure.updateCapacity(index, index + vertexCount, 1);
+
+        for (htd::index_t neighbor : neighbors[index])
+        {
+            arcs.emplace_back(index + vertexCount, neighbor);
+
+            capacities.push_back((std::size_t)-1);
+
+            flowNetworkStructure.updateCapacity(index + vertexCount, neighbor, (std::size_t)-1);
+        }
+    }
+
+    std::vector<std::pair<htd::index_t, htd::index_t>> pairs;
+
+    std::mt19937 generator(1234);
+
+    std::uniform_int_distribution<htd::index_t> vertexDistribution(0, vertexCount - 1);
+
+    while (pairs.size() < pairCount)
+    {
+        htd::index_t vertex1 = vertexDistribution(generator);
+        htd::index_t vertex2 = vertexDistribution(generator);
+
+        if (vertex1 != vertex2 && std::find(neighbors[vertex1].begin(), neighbors[vertex1].end(), vertex2) == neighbors[vertex1].end())
+        {
+            pairs.emplace_back(vertex1, vertex2);
+        }
+    }
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::vector<std::size_t> flowValues;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (const std::pair<htd::index_t, htd::index_t> & pair : pairs)
+    {
+        std::unique_ptr<htd::IFlow> flow(algorithm.determineMaximumFlow(flowNetworkStructure, pair.first + vertexCount, pair.second));
+
+        flowValues.push_back(flow->value());
+    }
+
+    double flowStructureDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+
+    htd::CompressedFlowNetwork flowNetwork(vertexCount * 2, arcs, capacities);
+
+    double constructionDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<std::size_t> compressedFlowValues;
+
+    start = std::chrono::steady_clock::now();
+
+    for (const std::pair<htd::index_t, htd::index_t> & pair : pairs)
+    {
+        flowNetwork.reset();
+
+        compressedFlowValues.push_back(algorithm.determineMaximumFlow(flowNetwork, pair.first + vertexCount, pair.second));
+    }
+
+    double compressedDuration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Vertices:              " << std::setw(12) << vertexCount << std::endl;
+    std::cout << "Network arcs:          " << std::setw(12) << flowNetwork.arcCount() << std::endl;
+    std::cout << "Solves:                " << std::setw(12) << pairs.size() << std::endl;
+    std::cout << "IFlow per solve:       " << std::setw(12) << std::fixed << std::setprecision(4) << flowStructureDuration / pairs.size() << " ms" << std::endl;
+    std::cout << "CSR construction:      " << std::setw(12) << std::fixed << std::setprecision(4) << constructionDuration << " ms" << std::endl;
+    std::cout << "CSR per solve:         " << std::setw(12) << std::fixed << std::setprecision(4) << compressedDuration / pairs.size() << " ms" << std::endl;
+
+    if (flowValues != compressedFlowValues)
+    {
+        std::cerr << "ERROR: The flow values computed via both interfaces differ!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * File:   MinFillOrderingBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  Create a random graph in which each pair of vertices is connected with the given probability.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] vertexCount      The number of vertices of the random graph.
+ *  @param[in] density          The probability that two vertices are connected.
+ *
+ *  @return The random graph.
+ */
+htd::IMultiGraph * createRandomGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount, double density)
+{
+    htd::IMutableMultiGraph * ret = libraryInstance->multiGraphFactory().createInstance(vertexCount);
+
+    std::mt19937 generator(42);
+
+    std::bernoulli_distribution edgeDistribution(density);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+        {
+            if (edgeDistribution(generator))
+            {
+                ret->addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute a min-fill ordering of the given graph using the given density threshold.
+ *
+ *  @param[in] libraryInstance  The management instance to which the algorithm shall belong.
+ *  @param[in] graph            The input graph.
+ *  @param[in] densityThreshold The density threshold above which the bitset-based neighborhoods shall be used.
+ *  @param[out] ordering        The computed ordering.
+ *
+ *  @return The duration of the computation in milliseconds.
+ */
+double computeOrdering(const htd::LibraryInstance * const libraryInstance, const htd::IMultiGraph & graph, double densityThreshold, std::vector<htd::vertex_t> & ordering)
+{
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setDensityThreshold(densityThreshold);
+
+    libraryInstance->randomNumberGenerator().seed(1234);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<htd::IVertexOrdering> result(algorithm.computeOrdering(graph));
+
+    double ret = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    ordering = result->sequence();
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMultiGraph> graph;
+
+    if (argc > 1 && std::string(argv[1]) != "-")
+    {
+        htd_io::GrFormatImporter importer(libraryInstance.get());
+
+        graph.reset(importer.import(argv[1]));
+
+        if (!graph)
+        {
+            std::cerr << "COULD NOT IMPORT GRAPH: " << argv[1] << std::endl;
+
+            return 1;
+        }
+    }
+    else
+    {
+        graph.reset(createRandomGraph(libraryInstance.get(), 1000, argc > 2 ? std::stod(argv[2]) : 0.3));
+    }
+
+    std::vector<htd::vertex_t> vectorOrdering;
+    std::vector<htd::vertex_t> bitsetOrdering;
+
+    double vectorDuration = computeOrdering(libraryInstance.get(), *graph, 2.0, vectorOrdering);
+    double bitsetDuration = computeOrdering(libraryInstance.get(), *graph, 0.0, bitsetOrdering);
+
+    std::cout << "Vertices:              " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Edges:                 " << std::setw(12) << graph->edgeCount() << std::endl;
+    std::cout << "Vector neighborhoods:  " << std::setw(12) << std::fixed << std::setprecision(3) << vectorDuration << " ms" << std::endl;
+    std::cout << "Bitset neighborhoods:  " << std::setw(12) << std::fixed << std::setprecision(3) << bitsetDuration << " ms" << std::endl;
+
+    if (vectorOrdering != bitsetOrdering)
+    {
+        std::cerr << "ERROR: The orderings computed by the two engines differ!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * File:   MinimumSeparatorBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  Create a random connected graph with the given number of vertices and edges.
+ *
+ *  The vertices are connected by a path in random order, the remaining edges are chosen randomly.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] vertexCount      The number of vertices of the random graph.
+ *  @param[in] edgeCount        The number of edges of the random graph.
+ *
+ *  @return The random graph.
+ */
+htd::Graph * createRandomGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount, std::size_t edgeCount)
+{
+    htd::Graph * ret = new htd::Graph(libraryInstance);
+
+    ret->addVertices(vertexCount);
+
+    std::mt19937 generator(42);
+
+    std::vector<htd::vertex_t> order(vertexCount);
+
+    for (htd::index_t index = 0; index < vertexCount; ++index)
+    {
+        order[index] = static_cast<htd::vertex_t>(index + htd::Vertex::FIRST);
+    }
+
+    std::shuffle(order.begin(), order.end(), generator);
+
+    for (htd::index_t index = 1; index < vertexCount; ++index)
+    {
+        ret->addEdge(order[index - 1], order[index]);
+    }
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    for (std::size_t index = vertexCount; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = vertexDistribution(generator);
+        htd::vertex_t vertex2 = vertexDistribution(generator);
+
+        if (vertex1 != vertex2 && !ret->isNeighbor(vertex1, vertex2))
+        {
+            ret->addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute a separator of the given graph and measure the time needed.
+ *
+ *  @param[in] algorithm    The separator algorithm.
+ *  @param[in] graph        The graph.
+ *  @param[out] separator   The computed separator.
+ *
+ *  @return The duration of the computation in milliseconds.
+ */
+double computeSeparator(const htd::MinimumSeparatorAlgorithm & algorithm, const htd::IGraphStructure & graph, std::vector<htd::vertex_t> & separator)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::unique_ptr<std::vector<htd::vertex_t>> result(algorithm.computeSeparator(graph));
+
+    double ret = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    separator = *result;
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t vertexCount = argc > 1 ? std::stoul(argv[1]) : 500;
+
+    std::size_t threadCount = argc > 2 ? std::stoul(argv[2]) : 4;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::Graph> graph(createRandomGraph(libraryInstance.get(), vertexCount, vertexCount * 3));
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::vector<htd::vertex_t> sequentialSeparator;
+    std::vector<htd::vertex_t> parallelSeparator;
+
+    double sequentialDuration = computeSeparator(algorithm, *graph, sequentialSeparator);
+
+    algorithm.setThreadCount(threadCount);
+
+    double parallelDuration = computeSeparator(algorithm, *graph, parallelSeparator);
+
+    std::cout << "Vertices:              " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Edges:                 " << std::setw(12) << graph->edgeCount() << std::endl;
+    std::cout << "Separator size:        " << std::setw(12) << sequentialSeparator.size() << std::endl;
+    std::cout << "Sequential:            " << std::setw(12) << std::fixed << std::setprecision(3) << sequentialDuration << " ms" << std::endl;
+    std::cout << "Parallel (" << std::setw(2) << threadCount << " threads): " << std::setw(12) << std::fixed << std::setprecision(3) << parallelDuration << " ms" << std::endl;
+
+    if (sequentialSeparator != parallelSeparator)
+    {
+        std::cerr << "ERROR: The separators computed sequentially and in parallel differ!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * File:   NormalizationBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+
+/**
+ *  Create a grid graph with the given number of rows and columns.
+ *
+ *  Grid graphs with few rows have a small treewidth, so their tree decompositions consist of many small bags, which
+ *  makes the time for normalizing them dominated by the operations on the tree structure and the bag contents.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] rows             The number of rows of the grid.
+ *  @param[in] columns          The number of columns of the grid.
+ *
+ *  @return The grid graph.
+ */
+htd::MultiHypergraph * createGridGraph(const htd::LibraryInstance * const libraryInstance, std::size_t rows, std::size_t columns)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance);
+
+    ret->addVertices(rows * columns);
+
+    for (std::size_t column = 0; column < columns; ++column)
+    {
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            htd::vertex_t vertex = static_cast<htd::vertex_t>(column * rows + row + htd::Vertex::FIRST);
+
+            if (row + 1 < rows)
+            {
+                ret->addEdge(vertex, vertex + 1);
+            }
+
+            if (column + 1 < columns)
+            {
+                ret->addEdge(vertex, static_cast<htd::vertex_t>(vertex + rows));
+            }
+        }
+    }
+
+    return ret;
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t columns = argc > 1 ? std::stoul(argv[1]) : 50000;
+
+    std::size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 3;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(createGridGraph(libraryInstance.get(), 4, columns));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    htd::NormalizationOperation operation(libraryInstance.get());
+
+    double copyDuration = 0;
+    double normalizationDuration = 0;
+
+    std::size_t nodeCount = 0;
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        htd::TreeDecomposition normalizedDecomposition(*decomposition);
+
+        std::chrono::steady_clock::time_point copied = std::chrono::steady_clock::now();
+
+        operation.apply(*graph, normalizedDecomposition);
+
+        std::chrono::steady_clock::time_point normalized = std::chrono::steady_clock::now();
+
+        copyDuration += std::chrono::duration<double, std::milli>(copied - start).count();
+        normalizationDuration += std::chrono::duration<double, std::milli>(normalized - copied).count();
+
+        nodeCount = normalizedDecomposition.vertexCount();
+    }
+
+    std::cout << "Vertices of the graph:     " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Nodes before normalizing:  " << std::setw(12) << decomposition->vertexCount() << std::endl;
+    std::cout << "Nodes after normalizing:   " << std::setw(12) << nodeCount << std::endl;
+    std::cout << "Repetitions:               " << std::setw(12) << repetitions << std::endl;
+    std::cout << "Copying the decomposition: " << std::setw(12) << std::fixed << std::setprecision(3) << copyDuration / repetitions << " ms" << std::endl;
+    std::cout << "Normalization:             " << std::setw(12) << std::fixed << std::setprecision(3) << normalizationDuration / repetitions << " ms" << std::endl;
+
+    return 0;
+}
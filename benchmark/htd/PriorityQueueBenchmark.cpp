@@ -0,0 +1,200 @@
+/*
+ * File:   PriorityQueueBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ *  Compute the adjacency lists of a random graph with the given number of vertices and edges.
+ *
+ *  @param[in] vertexCount  The number of vertices of the random graph.
+ *  @param[in] edgeCount    The number of edges of the random graph.
+ *
+ *  @return The adjacency lists of the random graph, indexed by the vertex identifier.
+ */
+std::vector<std::vector<htd::vertex_t>> createRandomGraph(std::size_t vertexCount, std::size_t edgeCount)
+{
+    std::vector<std::vector<htd::vertex_t>> ret(vertexCount + 1);
+
+    std::mt19937 generator(42);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = vertexDistribution(generator);
+        htd::vertex_t vertex2 = vertexDistribution(generator);
+
+        if (vertex1 != vertex2)
+        {
+            ret[vertex1].push_back(vertex2);
+            ret[vertex2].push_back(vertex1);
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute the adjacency lists of the graph stored in the given file in format 'gr'.
+ *
+ *  @param[in] path The path to the input file.
+ *
+ *  @return The adjacency lists of the graph, indexed by the vertex identifier.
+ */
+std::vector<std::vector<htd::vertex_t>> importGraph(const std::string & path)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd_io::GrFormatImporter importer(libraryInstance.get());
+
+    std::unique_ptr<htd::IMultiGraph> graph(importer.import(path));
+
+    if (!graph)
+    {
+        std::cerr << "COULD NOT IMPORT GRAPH: " << path << std::endl;
+
+        std::exit(1);
+    }
+
+    std::vector<std::vector<htd::vertex_t>> ret(graph->vertexCount() + 1);
+
+    for (htd::vertex_t vertex : graph->vertices())
+    {
+        const htd::ConstCollection<htd::vertex_t> & neighbors = graph->neighbors(vertex);
+
+        ret[vertex].assign(neighbors.begin(), neighbors.end());
+    }
+
+    return ret;
+}
+
+/**
+ *  Simulate the priority queue operations of a minimum-degree elimination on the given graph.
+ *
+ *  After selecting and removing a vertex of minimum degree, the priority of each remaining neighbor is decreased
+ *  by one. The elimination does not add fill edges, so the measured time is dominated by the priority queue.
+ *
+ *  @param[in] adjacencyLists   The adjacency lists of the input graph.
+ *  @param[out] ordering        The vertices in the order in which they were removed from the priority queue.
+ *
+ *  @return The duration of the simulation in milliseconds.
+ */
+template < typename PriorityQueueType >
+double simulateElimination(const std::vector<std::vector<htd::vertex_t>> & adjacencyLists, std::vector<htd::vertex_t> & ordering)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    std::size_t vertexCount = adjacencyLists.size() - 1;
+
+    std::vector<std::size_t> degrees(vertexCount + 1);
+
+    std::vector<bool> eliminated(vertexCount + 1, false);
+
+    PriorityQueueType priorityQueue;
+
+    for (htd::vertex_t vertex = 1; vertex <= vertexCount; ++vertex)
+    {
+        degrees[vertex] = adjacencyLists[vertex].size();
+
+        priorityQueue.push(vertex, degrees[vertex]);
+    }
+
+    ordering.clear();
+
+    while (!priorityQueue.empty())
+    {
+        htd::vertex_t selectedVertex = priorityQueue.top();
+
+        priorityQueue.pop();
+
+        eliminated[selectedVertex] = true;
+
+        ordering.push_back(selectedVertex);
+
+        for (htd::vertex_t neighbor : adjacencyLists[selectedVertex])
+        {
+            if (!eliminated[neighbor])
+            {
+                priorityQueue.updatePriority(neighbor, degrees[neighbor], degrees[neighbor] - 1);
+
+                --degrees[neighbor];
+            }
+        }
+    }
+
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::vector<std::vector<htd::vertex_t>> adjacencyLists;
+
+    if (argc > 1)
+    {
+        adjacencyLists = importGraph(argv[1]);
+    }
+    else
+    {
+        adjacencyLists = createRandomGraph(100000, 500000);
+    }
+
+    std::size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 5;
+
+    std::vector<htd::vertex_t> heapOrdering;
+    std::vector<htd::vertex_t> bucketOrdering;
+
+    double heapDuration = 0;
+    double bucketDuration = 0;
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        heapDuration += simulateElimination<htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>, std::equal_to<std::size_t>, false>>(adjacencyLists, heapOrdering);
+
+        bucketDuration += simulateElimination<htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>, std::equal_to<std::size_t>, true>>(adjacencyLists, bucketOrdering);
+    }
+
+    std::cout << "Vertices:              " << std::setw(12) << adjacencyLists.size() - 1 << std::endl;
+    std::cout << "Repetitions:           " << std::setw(12) << repetitions << std::endl;
+    std::cout << "Heap-based queue:      " << std::setw(12) << std::fixed << std::setprecision(3) << heapDuration / repetitions << " ms" << std::endl;
+    std::cout << "Bucket-based queue:    " << std::setw(12) << std::fixed << std::setprecision(3) << bucketDuration / repetitions << " ms" << std::endl;
+
+    if (heapOrdering.size() != bucketOrdering.size())
+    {
+        std::cerr << "ERROR: The orderings computed by the two priority queues differ in size!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * File:   TdFormatExporterBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <chrono>
+#include <fcntl.h>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <unordered_map>
+
+/**
+ *  Create a grid graph with the given number of rows and columns.
+ *
+ *  Grid graphs with few rows have a small treewidth, so they can be decomposed quickly into decompositions with
+ *  many nodes, which makes the time for writing them dominated by formatting the bags and the edges.
+ *
+ *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+ *  @param[in] rows             The number of rows of the grid.
+ *  @param[in] columns          The number of columns of the grid.
+ *
+ *  @return The grid graph.
+ */
+htd::MultiHypergraph * createGridGraph(const htd::LibraryInstance * const libraryInstance, std::size_t rows, std::size_t columns)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance);
+
+    ret->addVertices(rows * columns);
+
+    for (std::size_t column = 0; column < columns; ++column)
+    {
+        for (std::size_t row = 0; row < rows; ++row)
+        {
+            htd::vertex_t vertex = static_cast<htd::vertex_t>(column * rows + row + htd::Vertex::FIRST);
+
+            if (row + 1 < rows)
+            {
+                ret->addEdge(vertex, vertex + 1);
+            }
+
+            if (column + 1 < columns)
+            {
+                ret->addEdge(vertex, static_cast<htd::vertex_t>(vertex + rows));
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Write the given tree decomposition in format 'td' the way the exporter did before it used a streaming writer.
+ *
+ *  The output of this function serves as reference for checking that the streaming writer produces identical output.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be written.
+ *  @param[in] graph            The graph which was decomposed.
+ *  @param[in] outputStream     The output stream to which the decomposition shall be written.
+ */
+void writeReference(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream)
+{
+    std::size_t edgeCount = decomposition.edgeCount();
+
+    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+
+    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+
+    htd::index_t index = 1;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        std::stringstream bagContent;
+
+        for (htd::vertex_t vertex : decomposition.bagContent(node))
+        {
+            bagContent << vertex << " ";
+        }
+
+        outputStream << "b " << index << " " << bagContent.str() << "\n";
+
+        indices[node] = index;
+
+        ++index;
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+
+    auto it = hyperedgeCollection.begin();
+
+    for (index = 0; index < edgeCount; ++index)
+    {
+        outputStream << indices.at((*it)[0]) << " " << indices.at((*it)[1]) << "\n";
+
+        ++it;
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t columns = argc > 1 ? std::stoul(argv[1]) : 20000;
+
+    std::size_t repetitions = argc > 2 ? std::stoul(argv[2]) : 5;
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(createGridGraph(libraryInstance.get(), 8, columns));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    htd_io::TdFormatExporter exporter;
+
+    std::string expectedOutput;
+    std::string actualOutput;
+
+    double referenceDuration = 0;
+    double streamDuration = 0;
+    double fileDescriptorDuration = 0;
+    double compressedDuration = 0;
+
+    int fileDescriptor = open("/dev/null", O_WRONLY);
+
+    for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+    {
+        std::ostringstream referenceStream;
+        std::ostringstream stream;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        writeReference(*decomposition, *graph, referenceStream);
+
+        std::chrono::steady_clock::time_point referenceFinished = std::chrono::steady_clock::now();
+
+        exporter.write(*decomposition, *graph, stream);
+
+        std::chrono::steady_clock::time_point streamFinished = std::chrono::steady_clock::now();
+
+        {
+            htd_io::StreamingWriter writer(fileDescriptor);
+
+            exporter.write(*decomposition, *graph, writer);
+        }
+
+        std::chrono::steady_clock::time_point fileDescriptorFinished = std::chrono::steady_clock::now();
+
+        if (htd_io::StreamingWriter::supportsCompression())
+        {
+            htd_io::StreamingWriter writer(fileDescriptor, true);
+
+            exporter.write(*decomposition, *graph, writer);
+        }
+
+        std::chrono::steady_clock::time_point compressedFinished = std::chrono::steady_clock::now();
+
+        referenceDuration += std::chrono::duration<double, std::milli>(referenceFinished - start).count();
+        streamDuration += std::chrono::duration<double, std::milli>(streamFinished - referenceFinished).count();
+        fileDescriptorDuration += std::chrono::duration<double, std::milli>(fileDescriptorFinished - streamFinished).count();
+        compressedDuration += std::chrono::duration<double, std::milli>(compressedFinished - fileDescriptorFinished).count();
+
+        expectedOutput = referenceStream.str();
+        actualOutput = stream.str();
+    }
+
+    if (fileDescriptor >= 0)
+    {
+        close(fileDescriptor);
+    }
+
+    std::cout << "Vertices of the graph:     " << std::setw(12) << graph->vertexCount() << std::endl;
+    std::cout << "Nodes of the decomposition:" << std::setw(12) << decomposition->vertexCount() << std::endl;
+    std::cout << "Output size:               " << std::setw(12) << expectedOutput.size() << " bytes" << std::endl;
+    std::cout << "Repetitions:               " << std::setw(12) << repetitions << std::endl;
+    std::cout << "Per-bag string streams:    " << std::setw(12) << std::fixed << std::setprecision(3) << referenceDuration / repetitions << " ms" << std::endl;
+    std::cout << "Streaming writer (stream): " << std::setw(12) << std::fixed << std::setprecision(3) << streamDuration / repetitions << " ms" << std::endl;
+    std::cout << "Streaming writer (fd):     " << std::setw(12) << std::fixed << std::setprecision(3) << fileDescriptorDuration / repetitions << " ms" << std::endl;
+
+    if (htd_io::StreamingWriter::supportsCompression())
+    {
+        std::cout << "Streaming writer (gzip):   " << std::setw(12) << std::fixed << std::setprecision(3) << compressedDuration / repetitions << " ms" << std::endl;
+    }
+
+    if (expectedOutput != actualOutput)
+    {
+        std::cerr << "ERROR: The output of the streaming writer differs from the reference output!" << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
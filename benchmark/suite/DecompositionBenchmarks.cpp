@@ -0,0 +1,104 @@
+/*
+ * File:   DecompositionBenchmarks.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceGenerators.hpp"
+
+#include <memory>
+
+/**
+ *  Measure the time for computing a tree decomposition of the selected instance via bucket elimination.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+void benchmarkBucketElimination(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(htd_benchmark::createInstance(libraryInstance.get(), state.range(0), static_cast<std::size_t>(state.range(1))));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::size_t maximumBagSize = 0;
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+        maximumBagSize = decomposition->maximumBagSize();
+    }
+
+    htd_benchmark::reportInstance(state, *graph);
+
+    state.counters["width"] = static_cast<double>(maximumBagSize) - 1;
+}
+
+/**
+ *  Measure the time for applying the given manipulation operation to a tree decomposition of the selected instance.
+ *
+ *  The copy of the input decomposition which is created before each application of the operation is not included
+ *  in the measured time.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+template < typename ManipulationOperationType >
+void benchmarkManipulationOperation(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(htd_benchmark::createInstance(libraryInstance.get(), state.range(0), static_cast<std::size_t>(state.range(1))));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    ManipulationOperationType operation(libraryInstance.get());
+
+    std::size_t nodeCount = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+
+        htd::TreeDecomposition manipulatedDecomposition(*decomposition);
+
+        state.ResumeTiming();
+
+        operation.apply(*graph, manipulatedDecomposition);
+
+        nodeCount = manipulatedDecomposition.vertexCount();
+    }
+
+    htd_benchmark::reportInstance(state, *graph);
+
+    state.counters["nodes_before"] = static_cast<double>(decomposition->vertexCount());
+    state.counters["nodes_after"] = static_cast<double>(nodeCount);
+}
+
+BENCHMARK(benchmarkBucketElimination)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(benchmarkManipulationOperation, htd::JoinNodeNormalizationOperation)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkManipulationOperation, htd::JoinNodeComplexityReductionOperation)->Apply(htd_benchmark::smallInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkManipulationOperation, htd::WeakNormalizationOperation)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkManipulationOperation, htd::SemiNormalizationOperation)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkManipulationOperation, htd::NormalizationOperation)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
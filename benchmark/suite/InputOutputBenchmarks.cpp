@@ -0,0 +1,110 @@
+/*
+ * File:   InputOutputBenchmarks.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceGenerators.hpp"
+
+#include <htd_io/main.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+/**
+ *  Measure the time for importing an Erdős–Rényi random graph with the selected number of edges in format 'gr'.
+ *
+ *  The number of vertices is a quarter of the number of edges, i.e., the average degree of the graph is eight.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+template < bool Compressed >
+void benchmarkGrFormatImporter(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::size_t edgeCount = static_cast<std::size_t>(state.range(0));
+
+    std::string input = htd_benchmark::writeGrFormat(edgeCount / 4, htd_benchmark::createErdosRenyiEdges(edgeCount / 4, edgeCount));
+
+    htd_io::GrFormatImporter importer(libraryInstance.get());
+
+    for (auto _ : state)
+    {
+        std::istringstream stream(input);
+
+        if (Compressed)
+        {
+            std::unique_ptr<htd::CompressedMultiHypergraph> graph(importer.importCompressed(stream));
+
+            benchmark::DoNotOptimize(graph->edgeCount());
+        }
+        else
+        {
+            std::unique_ptr<htd::IMultiGraph> graph(importer.import(stream));
+
+            benchmark::DoNotOptimize(graph->edgeCount());
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+
+    state.counters["edges"] = static_cast<double>(edgeCount);
+}
+
+/**
+ *  Measure the time for writing a tree decomposition of the selected instance in format 'td'.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+void benchmarkTdFormatExporter(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(htd_benchmark::createInstance(libraryInstance.get(), state.range(0), static_cast<std::size_t>(state.range(1))));
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+    htd_io::TdFormatExporter exporter;
+
+    std::size_t outputSize = 0;
+
+    for (auto _ : state)
+    {
+        std::ostringstream stream;
+
+        exporter.write(*decomposition, *graph, stream);
+
+        outputSize = static_cast<std::size_t>(stream.tellp());
+    }
+
+    htd_benchmark::reportInstance(state, *graph);
+
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * outputSize));
+}
+
+BENCHMARK_TEMPLATE(benchmarkGrFormatImporter, false)->ArgName("edges")->Arg(1000000)->Arg(4000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkGrFormatImporter, true)->ArgName("edges")->Arg(1000000)->Arg(4000000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(benchmarkTdFormatExporter)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,399 @@
+/* 
+ * File:   InstanceGenerators.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_BENCHMARK_INSTANCEGENERATORS_HPP
+#define HTD_BENCHMARK_INSTANCEGENERATORS_HPP
+
+#include <htd/main.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace htd_benchmark
+{
+    /**
+     *  Identifier of the family of grid graphs with 16 rows.
+     */
+    constexpr std::int64_t GRID = 0;
+
+    /**
+     *  Identifier of the family of random 8-trees.
+     */
+    constexpr std::int64_t K_TREE = 1;
+
+    /**
+     *  Identifier of the family of Erdős–Rényi random graphs with average degree four.
+     */
+    constexpr std::int64_t ERDOS_RENYI = 2;
+
+    /**
+     *  Identifier of the family of power-law graphs created by preferential attachment.
+     */
+    constexpr std::int64_t POWER_LAW = 3;
+
+    /**
+     *  The seed of all random instance generators.
+     *
+     *  The generators only use the raw output of std::mt19937_64, which is fully specified by the C++ standard, so
+     *  that the same instances are created on every platform and by every standard library implementation.
+     */
+    constexpr std::uint_fast64_t SEED = 20170101;
+
+    /**
+     *  Access the name of the given instance family.
+     *
+     *  @param[in] family   The identifier of the instance family.
+     *
+     *  @return The name of the given instance family.
+     */
+    inline const char * familyName(std::int64_t family)
+    {
+        switch (family)
+        {
+            case GRID:
+                return "grid";
+            case K_TREE:
+                return "k_tree";
+            case ERDOS_RENYI:
+                return "erdos_renyi";
+            default:
+                return "power_law";
+        }
+    }
+
+    /**
+     *  Compute the edges of a grid graph with the given number of rows and columns.
+     *
+     *  @param[in] rows     The number of rows of the grid.
+     *  @param[in] columns  The number of columns of the grid.
+     *
+     *  @return The edges of the grid graph.
+     */
+    inline std::vector<std::pair<htd::vertex_t, htd::vertex_t>> createGridEdges(std::size_t rows, std::size_t columns)
+    {
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+        for (std::size_t column = 0; column < columns; ++column)
+        {
+            for (std::size_t row = 0; row < rows; ++row)
+            {
+                htd::vertex_t vertex = static_cast<htd::vertex_t>(column * rows + row + htd::Vertex::FIRST);
+
+                if (row + 1 < rows)
+                {
+                    ret.emplace_back(vertex, vertex + 1);
+                }
+
+                if (column + 1 < columns)
+                {
+                    ret.emplace_back(vertex, static_cast<htd::vertex_t>(vertex + rows));
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the edges of a random k-tree with the given number of vertices.
+     *
+     *  The construction starts with a clique of size k + 1. Each further vertex is connected to all vertices of a
+     *  k-clique which is chosen uniformly at random among the k-cliques contained in the (k + 1)-clique formed by an
+     *  earlier vertex and the clique it was attached to.
+     *
+     *  @param[in] vertexCount  The number of vertices of the k-tree.
+     *  @param[in] k            The treewidth of the k-tree.
+     *
+     *  @return The edges of the random k-tree.
+     */
+    inline std::vector<std::pair<htd::vertex_t, htd::vertex_t>> createKTreeEdges(std::size_t vertexCount, std::size_t k)
+    {
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+        std::mt19937_64 generator(SEED);
+
+        std::size_t initialSize = std::min(vertexCount, k + 1);
+
+        for (htd::vertex_t vertex1 = 1; vertex1 <= initialSize; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= initialSize; ++vertex2)
+            {
+                ret.emplace_back(vertex1, vertex2);
+            }
+        }
+
+        if (vertexCount > k + 1)
+        {
+            std::vector<htd::vertex_t> cliques((vertexCount + 1) * k);
+
+            for (std::size_t index = 0; index < k; ++index)
+            {
+                cliques[(k + 1) * k + index] = static_cast<htd::vertex_t>(index + 1);
+            }
+
+            for (htd::vertex_t vertex = static_cast<htd::vertex_t>(k + 2); vertex <= vertexCount; ++vertex)
+            {
+                htd::vertex_t parent = static_cast<htd::vertex_t>(k + 1 + generator() % (vertex - k - 1));
+
+                std::size_t replacedPosition = static_cast<std::size_t>(generator() % (k + 1));
+
+                for (std::size_t index = 0; index < k; ++index)
+                {
+                    htd::vertex_t neighbor = index == replacedPosition ? parent : cliques[parent * k + index];
+
+                    cliques[vertex * k + index] = neighbor;
+
+                    ret.emplace_back(neighbor, vertex);
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the edges of an Erdős–Rényi random graph G(n, m) without self-loops and duplicate edges.
+     *
+     *  @param[in] vertexCount  The number of vertices of the random graph.
+     *  @param[in] edgeCount    The number of edges of the random graph.
+     *
+     *  @return The edges of the random graph.
+     */
+    inline std::vector<std::pair<htd::vertex_t, htd::vertex_t>> createErdosRenyiEdges(std::size_t vertexCount, std::size_t edgeCount)
+    {
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+        std::unordered_set<std::uint64_t> existingEdges;
+
+        std::mt19937_64 generator(SEED);
+
+        ret.reserve(edgeCount);
+
+        existingEdges.reserve(edgeCount);
+
+        while (ret.size() < edgeCount && vertexCount > 1)
+        {
+            htd::vertex_t vertex1 = static_cast<htd::vertex_t>(generator() % vertexCount + 1);
+            htd::vertex_t vertex2 = static_cast<htd::vertex_t>(generator() % vertexCount + 1);
+
+            if (vertex1 > vertex2)
+            {
+                std::swap(vertex1, vertex2);
+            }
+
+            if (vertex1 != vertex2 && existingEdges.insert((static_cast<std::uint64_t>(vertex1) << 32) | vertex2).second)
+            {
+                ret.emplace_back(vertex1, vertex2);
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the edges of a power-law graph using the preferential attachment model of Barabási and Albert.
+     *
+     *  Each new vertex is connected to the given number of earlier vertices, each of which is chosen with a
+     *  probability proportional to its current degree.
+     *
+     *  @param[in] vertexCount      The number of vertices of the power-law graph.
+     *  @param[in] attachmentCount  The number of edges created for each new vertex.
+     *
+     *  @return The edges of the power-law graph.
+     */
+    inline std::vector<std::pair<htd::vertex_t, htd::vertex_t>> createPowerLawEdges(std::size_t vertexCount, std::size_t attachmentCount)
+    {
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> ret;
+
+        std::vector<htd::vertex_t> endpoints;
+
+        std::mt19937_64 generator(SEED);
+
+        for (htd::vertex_t vertex = 2; vertex <= vertexCount; ++vertex)
+        {
+            for (std::size_t index = 0; index < attachmentCount; ++index)
+            {
+                htd::vertex_t target = endpoints.empty() ? 1 : endpoints[generator() % endpoints.size()];
+
+                ret.emplace_back(target, vertex);
+
+                endpoints.push_back(target);
+                endpoints.push_back(vertex);
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the edges of the instance of the given family with the given number of vertices.
+     *
+     *  @param[in] family       The identifier of the instance family.
+     *  @param[in] vertexCount  The number of vertices of the instance.
+     *
+     *  @return The edges of the instance.
+     */
+    inline std::vector<std::pair<htd::vertex_t, htd::vertex_t>> createEdges(std::int64_t family, std::size_t vertexCount)
+    {
+        switch (family)
+        {
+            case GRID:
+                return createGridEdges(16, vertexCount / 16);
+            case K_TREE:
+                return createKTreeEdges(vertexCount, 8);
+            case ERDOS_RENYI:
+                return createErdosRenyiEdges(vertexCount, 2 * vertexCount);
+            default:
+                return createPowerLawEdges(vertexCount, 2);
+        }
+    }
+
+    /**
+     *  Create the instance of the given family with the given number of vertices.
+     *
+     *  @param[in] libraryInstance  The management instance to which the new graph shall belong.
+     *  @param[in] family           The identifier of the instance family.
+     *  @param[in] vertexCount      The number of vertices of the instance.
+     *
+     *  @return The instance of the given family with the given number of vertices.
+     */
+    inline htd::MultiHypergraph * createInstance(const htd::LibraryInstance * const libraryInstance, std::int64_t family, std::size_t vertexCount)
+    {
+        htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance);
+
+        if (family == GRID)
+        {
+            vertexCount = vertexCount / 16 * 16;
+        }
+
+        ret->addVertices(vertexCount);
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : createEdges(family, vertexCount))
+        {
+            ret->addEdge(edge.first, edge.second);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute the textual representation of the given graph in format 'gr'.
+     *
+     *  @param[in] vertexCount  The number of vertices of the graph.
+     *  @param[in] edges        The edges of the graph.
+     *
+     *  @return The textual representation of the given graph in format 'gr'.
+     */
+    inline std::string writeGrFormat(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+    {
+        std::ostringstream stream;
+
+        stream << "p tw " << vertexCount << " " << edges.size() << "\n";
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            stream << edge.first << " " << edge.second << "\n";
+        }
+
+        return stream.str();
+    }
+
+    /**
+     *  Add the size and the name of the instance family of the given graph to the counters of the given state.
+     *
+     *  @param[in] state    The state of the running benchmark.
+     *  @param[in] graph    The input graph of the benchmark.
+     */
+    inline void reportInstance(benchmark::State & state, const htd::IMultiHypergraph & graph)
+    {
+        state.SetLabel(familyName(state.range(0)));
+
+        state.counters["vertices"] = static_cast<double>(graph.vertexCount());
+        state.counters["edges"] = static_cast<double>(graph.edgeCount());
+
+        state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * graph.vertexCount()));
+    }
+
+    /**
+     *  Register the instances of all families at the given scales as arguments of the given benchmark.
+     *
+     *  Erdős–Rényi graphs have a treewidth which grows linearly in the number of vertices, so only the two smallest
+     *  scales are used for them.
+     *
+     *  @param[in] benchmark    The benchmark which shall be run on the instances.
+     *  @param[in] scales       The numbers of vertices of the instances.
+     */
+    inline void registerInstances(benchmark::internal::Benchmark * benchmark, const std::vector<std::int64_t> & scales)
+    {
+        benchmark->ArgNames({ "family", "vertices" });
+
+        for (std::int64_t family = GRID; family <= POWER_LAW; ++family)
+        {
+            for (std::size_t index = 0; index < scales.size() && (family != ERDOS_RENYI || index < 2); ++index)
+            {
+                benchmark->Args({ family, scales[index] });
+            }
+        }
+    }
+
+    /**
+     *  Register the standard instances with 1,000, 10,000 and 100,000 vertices as arguments of the given benchmark.
+     *
+     *  @param[in] benchmark    The benchmark which shall be run on the instances.
+     */
+    inline void standardInstances(benchmark::internal::Benchmark * benchmark)
+    {
+        registerInstances(benchmark, { 1000, 10000, 100000 });
+    }
+
+    /**
+     *  Register the small instances with 250, 1,000 and 4,000 vertices as arguments of the given benchmark.
+     *
+     *  @param[in] benchmark    The benchmark which shall be run on the instances.
+     */
+    inline void smallInstances(benchmark::internal::Benchmark * benchmark)
+    {
+        registerInstances(benchmark, { 250, 1000, 4000 });
+    }
+
+    /**
+     *  Register the tiny instances with 25, 50 and 100 vertices as arguments of the given benchmark.
+     *
+     *  @param[in] benchmark    The benchmark which shall be run on the instances.
+     */
+    inline void tinyInstances(benchmark::internal::Benchmark * benchmark)
+    {
+        registerInstances(benchmark, { 25, 50, 100 });
+    }
+}
+
+#endif /* HTD_BENCHMARK_INSTANCEGENERATORS_HPP */
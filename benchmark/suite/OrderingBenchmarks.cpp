@@ -0,0 +1,58 @@
+/*
+ * File:   OrderingBenchmarks.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceGenerators.hpp"
+
+#include <memory>
+
+/**
+ *  Measure the time for computing a vertex elimination ordering of the selected instance.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+template < typename OrderingAlgorithmType >
+void benchmarkOrdering(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(htd_benchmark::createInstance(libraryInstance.get(), state.range(0), static_cast<std::size_t>(state.range(1))));
+
+    OrderingAlgorithmType algorithm(libraryInstance.get());
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<htd::IVertexOrdering> ordering(algorithm.computeOrdering(*graph));
+
+        benchmark::DoNotOptimize(ordering->sequence().data());
+    }
+
+    htd_benchmark::reportInstance(state, *graph);
+}
+
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::MinFillOrderingAlgorithm)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::MinDegreeOrderingAlgorithm)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::ApproximateMinDegreeOrderingAlgorithm)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::MaximumCardinalitySearchOrderingAlgorithm)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm)->Apply(htd_benchmark::smallInstances)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(benchmarkOrdering, htd::TriangulationMinimizationOrderingAlgorithm)->Apply(htd_benchmark::smallInstances)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,75 @@
+/*
+ * File:   PreprocessingBenchmarks.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceGenerators.hpp"
+
+#include <memory>
+
+/**
+ *  Measure the time for preprocessing the selected instance with the selected preprocessing strategy.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+void benchmarkGraphPreprocessor(benchmark::State & state)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::MultiHypergraph> graph(htd_benchmark::createInstance(libraryInstance.get(), state.range(0), static_cast<std::size_t>(state.range(1))));
+
+    htd::GraphPreprocessor preprocessor(libraryInstance.get());
+
+    preprocessor.setPreprocessingStrategy(static_cast<std::size_t>(state.range(2)));
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<htd::IPreprocessedGraph> preprocessedGraph(preprocessor.prepare(*graph));
+
+        benchmark::DoNotOptimize(preprocessedGraph->vertexCount());
+    }
+
+    htd_benchmark::reportInstance(state, *graph);
+}
+
+/**
+ *  Register the standard instances combined with each preprocessing level as arguments of the given benchmark.
+ *
+ *  @param[in] benchmark    The benchmark which shall be run on the instances.
+ */
+void preprocessingInstances(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->ArgNames({ "family", "vertices", "level" });
+
+    for (std::int64_t family = htd_benchmark::GRID; family <= htd_benchmark::POWER_LAW; ++family)
+    {
+        for (std::int64_t scale : { 1000, 10000, 100000 })
+        {
+            for (std::int64_t level = 0; level <= 3 && (family != htd_benchmark::ERDOS_RENYI || scale < 100000); ++level)
+            {
+                benchmark->Args({ family, scale, level });
+            }
+        }
+    }
+}
+
+BENCHMARK(benchmarkGraphPreprocessor)->Apply(preprocessingInstances)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,158 @@
+/*
+ * File:   SetOperationBenchmarks.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "InstanceGenerators.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+/**
+ *  Compute the sorted neighborhoods of the vertices of the selected instance.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ *
+ *  @return The sorted neighborhoods of the vertices of the selected instance, indexed by the vertex identifier.
+ */
+std::vector<std::vector<htd::vertex_t>> createNeighborhoods(benchmark::State & state)
+{
+    std::size_t vertexCount = static_cast<std::size_t>(state.range(1));
+
+    std::vector<std::vector<htd::vertex_t>> ret(vertexCount + 1);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : htd_benchmark::createEdges(state.range(0), vertexCount))
+    {
+        ret[edge.first].push_back(edge.second);
+        ret[edge.second].push_back(edge.first);
+    }
+
+    for (std::vector<htd::vertex_t> & neighborhood : ret)
+    {
+        std::sort(neighborhood.begin(), neighborhood.end());
+
+        neighborhood.erase(std::unique(neighborhood.begin(), neighborhood.end()), neighborhood.end());
+    }
+
+    return ret;
+}
+
+/**
+ *  Measure the time for counting the common neighbors of the endpoints of all edges of the selected instance, which
+ *  resembles the set operations performed by the elimination ordering algorithms.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+template < bool Vectorized >
+void benchmarkCommonNeighbors(benchmark::State & state)
+{
+    std::vector<std::vector<htd::vertex_t>> neighborhoods = createNeighborhoods(state);
+
+    std::size_t operations = 0;
+
+    for (auto _ : state)
+    {
+        std::size_t ret = 0;
+
+        for (const std::vector<htd::vertex_t> & neighborhood : neighborhoods)
+        {
+            for (htd::vertex_t neighbor : neighborhood)
+            {
+                const std::vector<htd::vertex_t> & otherNeighborhood = neighborhoods[neighbor];
+
+                ret += htd::set_intersection_size(neighborhood.begin(), neighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(),
+                                                  std::integral_constant<bool, Vectorized>());
+            }
+
+            operations += neighborhood.size();
+        }
+
+        benchmark::DoNotOptimize(ret);
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(operations));
+}
+
+/**
+ *  Measure the time for intersecting two random sets of the selected sizes.
+ *
+ *  @param[in] state    The state of the running benchmark.
+ */
+template < bool Vectorized >
+void benchmarkRandomSetIntersection(benchmark::State & state)
+{
+    std::mt19937_64 generator(htd_benchmark::SEED);
+
+    std::size_t size1 = static_cast<std::size_t>(state.range(0));
+    std::size_t size2 = static_cast<std::size_t>(state.range(1));
+
+    std::vector<htd::vertex_t> set1;
+    std::vector<htd::vertex_t> set2;
+
+    for (std::size_t index = 0; index < size1; ++index)
+    {
+        set1.push_back(static_cast<htd::vertex_t>(generator() % (4 * std::max(size1, size2))));
+    }
+
+    for (std::size_t index = 0; index < size2; ++index)
+    {
+        set2.push_back(static_cast<htd::vertex_t>(generator() % (4 * std::max(size1, size2))));
+    }
+
+    std::sort(set1.begin(), set1.end());
+    std::sort(set2.begin(), set2.end());
+
+    set1.erase(std::unique(set1.begin(), set1.end()), set1.end());
+    set2.erase(std::unique(set2.begin(), set2.end()), set2.end());
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(htd::set_intersection_size(set1.begin(), set1.end(), set2.begin(), set2.end(), std::integral_constant<bool, Vectorized>()));
+    }
+
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * (set1.size() + set2.size())));
+}
+
+/**
+ *  Register pairs of set sizes typical for the neighborhoods of sparse and dense graphs, including skewed pairs.
+ *
+ *  @param[in] benchmark    The benchmark which shall be run on the set sizes.
+ */
+void setSizes(benchmark::internal::Benchmark * benchmark)
+{
+    benchmark->ArgNames({ "size1", "size2" });
+
+    for (std::int64_t size : { 4, 16, 64, 256, 1024 })
+    {
+        benchmark->Args({ size, size });
+    }
+
+    benchmark->Args({ 16, 1024 });
+    benchmark->Args({ 8, 16384 });
+}
+
+BENCHMARK_TEMPLATE(benchmarkCommonNeighbors, false)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(benchmarkCommonNeighbors, true)->Apply(htd_benchmark::standardInstances)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(benchmarkRandomSetIntersection, false)->Apply(setSizes);
+BENCHMARK_TEMPLATE(benchmarkRandomSetIntersection, true)->Apply(setSizes);
@@ -33,6 +33,7 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
 
+#include <atomic>
 #include <vector>
 #include <functional>
 
@@ -282,6 +283,26 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  @return The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound is used.
+             */
+            HTD_API const std::atomic<std::size_t> * sharedMaximumBagSize(void) const HTD_OVERRIDE;
+
+            /**
+             *  Set the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  The shared bound is applied when the most promising algorithm is a bucket elimination algorithm: Before each
+             *  of its iterations, the limit passed to it is tightened so that only decompositions with a maximum bag size
+             *  strictly below both the best decomposition found so far and the shared bound are searched for.
+             *
+             *  @note The shared bound is not owned by the algorithm and it is not copied when the algorithm is cloned.
+             *
+             *  @param[in] sharedMaximumBagSize The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound shall be used.
+             */
+            HTD_API void setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize) HTD_OVERRIDE;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
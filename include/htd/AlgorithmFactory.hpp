@@ -26,6 +26,7 @@
 #define HTD_HTD_ALGORITHMFACTORY_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/ConcurrentConstructionTemplate.hpp>
 #include <htd/LibraryInstance.hpp>
 
 namespace htd
@@ -70,7 +71,7 @@ namespace htd
              */
             virtual ~AlgorithmFactory()
             {
-                delete constructionTemplate_;
+
             }
 
             /**
@@ -87,17 +88,19 @@ namespace htd
              *  is transferred to the factory class. Deleting the object instance provided to this method outside the factory class or
              *  assigning the same object instance multiple times will lead to undefined behavior.
              *
+             *  @note The method may be called while other threads create new objects via the factory. The previous default
+             *  implementation is released as soon as no other thread clones it anymore. If too many replaced default
+             *  implementations are still in use, the method waits until all concurrent calls of createInstance() are finished.
+             *
              *  @param[in] original The new default implementation of the interface AlgorithmType.
              */
             void setConstructionTemplate(AlgorithmType * original)
             {
                 HTD_ASSERT(original != nullptr)
 
-                delete constructionTemplate_;
-
-                constructionTemplate_ = original;
+                original->setManagementInstance(managementInstance_);
 
-                constructionTemplate_->setManagementInstance(managementInstance_);
+                constructionTemplate_.set(original);
             }
 
         protected:
@@ -107,9 +110,23 @@ namespace htd
             const htd::LibraryInstance * managementInstance_;
 
             /**
-             *  A pointer to a clean instance of the default implementation.
+             *  Access the current default implementation.
+             *
+             *  @note The returned reference keeps the default implementation alive even if it is replaced concurrently,
+             *  hence objects may be created via the factory from any number of threads while setConstructionTemplate() is
+             *  called. Accessing the default implementation does not take a lock.
+             *
+             *  @return A reference to a clean instance of the default implementation.
+             */
+            typename htd::ConcurrentConstructionTemplate<AlgorithmType>::Reference constructionTemplate(void) const
+            {
+                return constructionTemplate_.get();
+            }
+
+            /**
+             *  A clean instance of the default implementation.
              */
-            AlgorithmType * constructionTemplate_;
+            htd::ConcurrentConstructionTemplate<AlgorithmType> constructionTemplate_;
     };
 }
 
@@ -0,0 +1,98 @@
+/* 
+ * File:   ApproximateMinDegreeOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP
+#define HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IWidthLimitableOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface based on the approximate minimum-degree elimination ordering
+     *  algorithm (AMD).
+     *
+     *  In contrast to MinDegreeOrderingAlgorithm, fill edges are never materialized. Each eliminated vertex becomes
+     *  an element of a quotient graph whose variables are the neighbors of the vertex at the time of its elimination.
+     *  The ordering algorithm merges indistinguishable vertices into supervariables, eliminates vertices whose
+     *  neighborhood is covered by the new element together with it (mass elimination) and absorbs elements which are
+     *  covered by the new element (aggressive absorption). It selects the vertex of minimum approximate external
+     *  degree in each step, so the memory consumption stays linear in the size of the input graph. Vertices whose
+     *  degree exceeds 10 * sqrt(n) are postponed to the end of the ordering and eliminated according to their exact
+     *  degree in the elimination graph induced by them.
+     *
+     *  @note The maximum bag size reported by the resulting ordering is exact, only the selection of the vertices is
+     *  based on approximate degrees.
+     */
+    class ApproximateMinDegreeOrderingAlgorithm : public virtual htd::IWidthLimitableOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type ApproximateMinDegreeOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API ApproximateMinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager);
+            
+            HTD_API virtual ~ApproximateMinDegreeOrderingAlgorithm();
+            
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API ApproximateMinDegreeOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API ApproximateMinDegreeOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitableOrderingAlgorithm * cloneWidthLimitableOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ApproximateMinDegreeOrderingAlgorithm & operator=(const ApproximateMinDegreeOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_HPP */
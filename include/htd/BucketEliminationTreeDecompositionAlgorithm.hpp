@@ -36,6 +36,10 @@ namespace htd
 {
     /**
      *  Default implementation of the ITreeDecompositionAlgorithm interface based on bucket elimination.
+     *
+     *  @note If the thread count is greater than one, the connected components of the input graph are decomposed in
+     *  parallel (see htd::BucketEliminationGraphDecompositionAlgorithm) before the decompositions of the components
+     *  are joined to a single tree decomposition.
      */
     class BucketEliminationTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
     {
@@ -222,6 +226,41 @@ namespace htd
              */
             HTD_API void setCompressionEnabled(bool compressionEnabled);
 
+            /**
+             *  Check whether the hyperedges induced by the bags of the computed decompositions are computed on first access.
+             *
+             *  @return A boolean flag indicating whether the hyperedges induced by the bags of the computed decompositions are computed on first access.
+             */
+            HTD_API bool isLazyInducedEdgeComputationEnabled(void) const;
+
+            /**
+             *  Set whether the hyperedges induced by the bags of the computed decompositions shall be computed on first access.
+             *
+             *  @note If lazy computation is enabled (default: disabled), the decomposition algorithm attaches an instance of
+             *  htd::InducedHyperedgeIndex to each computed decomposition and the induced hyperedges of a bag are determined
+             *  and cached when they are requested for the first time. The setting has no effect if the computation of
+             *  induced hyperedges is disabled.
+             *
+             *  @param[in] lazyInducedEdgeComputationEnabled    A boolean flag indicating whether the hyperedges induced by the bags of the computed decompositions shall be computed on first access.
+             */
+            HTD_API void setLazyInducedEdgeComputationEnabled(bool lazyInducedEdgeComputationEnabled);
+
+            /**
+             *  Getter for the number of threads which shall be used to decompose the connected components of the input graph.
+             *
+             *  @return The number of threads which shall be used to decompose the connected components of the input graph.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to decompose the connected components of the input graph.
+             *
+             *  @note If the thread count is set to 1 (default), the input graph is decomposed as a whole in the calling thread.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to decompose the connected components of the input graph.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API BucketEliminationTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
 
         protected:
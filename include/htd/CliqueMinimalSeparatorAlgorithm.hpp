@@ -49,6 +49,22 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> * computeSeparator(const htd::IGraphStructure & graph) const HTD_OVERRIDE;
 
+            /**
+             *  Decompose the given graph into its atoms, i.e., its maximal connected subgraphs without a clique separator.
+             *
+             *  The atoms are determined by a single run of MCS-M followed by one pass over the clique minimal separators
+             *  generated by the resulting minimal triangulation, which requires O(n * m) time in total. Each atom is split
+             *  off by a clique minimal separator (or by the empty set, if the atom forms a connected component on its own)
+             *  which is contained in one of the subsequent atoms.
+             *
+             *  @note Only the subgraph induced by the vertices of the given graph is decomposed, i.e., neighbors which are not vertices of the graph are ignored.
+             *
+             *  @param[in] graph        The graph which shall be decomposed.
+             *  @param[out] atoms       The vector to which the atoms of the graph, each sorted in ascending order, shall be appended.
+             *  @param[out] separators  The vector to which the separator which split off the respective atom shall be appended. The separator of the last atom is empty.
+             */
+            HTD_API void determineAtoms(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & atoms, std::vector<std::vector<htd::vertex_t>> & separators) const;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
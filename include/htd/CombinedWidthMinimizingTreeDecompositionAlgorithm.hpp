@@ -50,6 +50,13 @@ namespace htd
      *  by a call to htd::LibraryInstance::terminate().
      *
      *  @note The base algorithms must be assigned before the optional manipulation operations!
+     *
+     *  @note If parallel execution is enabled, the base algorithms are run concurrently as a portfolio. Each base
+     *  algorithm is then executed in its own thread on a copy of the base algorithm which is associated with its own
+     *  management instance (see htd::LibraryInstance::copyFactoryConfiguration()). Base algorithms implementing the
+     *  htd::IWidthMinimizingTreeDecompositionAlgorithm interface are started with the lowest maximum bag size known
+     *  so far as upper bound and the remaining workers are terminated as soon as a decomposition with a maximum bag
+     *  size of at most targetMaximumBagSize() is found.
      */
     class CombinedWidthMinimizingTreeDecompositionAlgorithm : public htd::IWidthMinimizingTreeDecompositionAlgorithm
     {
@@ -81,6 +88,38 @@ namespace htd
              */
             HTD_API void addDecompositionAlgorithm(htd::ITreeDecompositionAlgorithm * algorithm);
 
+            /**
+             *  Check whether the base algorithms are run concurrently.
+             *
+             *  @return True if the base algorithms are run concurrently, false otherwise.
+             */
+            HTD_API bool isParallelExecutionEnabled(void) const;
+
+            /**
+             *  Set whether the base algorithms shall be run concurrently, each of them in its own thread.
+             *
+             *  @param[in] parallelExecutionEnabled A boolean flag indicating whether the base algorithms shall be run concurrently.
+             */
+            HTD_API void setParallelExecutionEnabled(bool parallelExecutionEnabled);
+
+            /**
+             *  Getter for the target maximum bag size.
+             *
+             *  @return The maximum bag size which is considered good enough to stop the computation.
+             */
+            HTD_API std::size_t targetMaximumBagSize(void) const;
+
+            /**
+             *  Set the maximum bag size which is considered good enough to stop the computation.
+             *
+             *  As soon as a decomposition with a maximum bag size less than or equal to the given
+             *  value is found, no further base algorithms are started and, if parallel execution
+             *  is enabled, the base algorithms which are still running are terminated.
+             *
+             *  @param[in] targetMaximumBagSize The maximum bag size which is considered good enough to stop the computation.
+             */
+            HTD_API void setTargetMaximumBagSize(std::size_t targetMaximumBagSize);
+
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
 
             HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph,
@@ -0,0 +1,580 @@
+/* 
+ * File:   CompressedFlowNetwork.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_COMPRESSEDFLOWNETWORK_HPP
+#define HTD_HTD_COMPRESSEDFLOWNETWORK_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Flow network in compressed sparse row format which is designed for repeated maximum flow computations.
+     *
+     *  The arcs leaving a vertex are stored contiguously and are addressed by their index. For each arc of the
+     *  network, a paired reverse arc with capacity zero is stored, so that the residual network can be traversed
+     *  without any lookup. Besides the residual capacities, the flow network holds the level of each vertex and the
+     *  current arc of each vertex which are used by the blocking flow computation of Dinitz's algorithm (see
+     *  htd::DinitzMaxFlowAlgorithm). All buffers are allocated when the arcs are assigned, hence reset() allows to
+     *  run an arbitrary number of flow computations on the same network without any further allocation. The cost of
+     *  reset() and of the level computation is proportional to the number of arcs and vertices touched by the
+     *  previous computation, not to the size of the network.
+     */
+    class CompressedFlowNetwork
+    {
+        public:
+            /**
+             *  Constructor for an empty flow network.
+             */
+            CompressedFlowNetwork(void) : vertexCount_(0), offsets_(1, 0), heads_(), pairedArcs_(), capacities_(), residualCapacities_(), modified_(), modifiedArcs_(), levels_(), currentArcs_(), reachedVertices_(), path_()
+            {
+
+            }
+
+            /**
+             *  Constructor for a flow network.
+             *
+             *  @param[in] vertexCount  The number of vertices of the flow network. The vertices are identified by the values 0 to vertexCount - 1.
+             *  @param[in] arcs         The arcs of the flow network given as pairs of source and target vertex.
+             *  @param[in] capacities   The capacities of the arcs in the same order as the arcs.
+             */
+            CompressedFlowNetwork(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & arcs, const std::vector<std::size_t> & capacities) : CompressedFlowNetwork()
+            {
+                assign(vertexCount, arcs, capacities);
+            }
+
+            /**
+             *  Destructor of a flow network.
+             */
+            ~CompressedFlowNetwork()
+            {
+
+            }
+
+            /**
+             *  Replace the content of the flow network. The buffers of the flow network are re-used if they are large enough.
+             *
+             *  @param[in] vertexCount  The number of vertices of the flow network. The vertices are identified by the values 0 to vertexCount - 1.
+             *  @param[in] arcs         The arcs of the flow network given as pairs of source and target vertex.
+             *  @param[in] capacities   The capacities of the arcs in the same order as the arcs.
+             */
+            void assign(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & arcs, const std::vector<std::size_t> & capacities)
+            {
+                HTD_ASSERT(arcs.size() == capacities.size())
+
+                vertexCount_ = vertexCount;
+
+                offsets_.assign(vertexCount + 1, 0);
+
+                for (const std::pair<htd::vertex_t, htd::vertex_t> & arc : arcs)
+                {
+                    HTD_ASSERT(arc.first < vertexCount && arc.second < vertexCount)
+
+                    ++offsets_[arc.first + 1];
+                    ++offsets_[arc.second + 1];
+                }
+
+                for (htd::index_t index = 0; index < vertexCount; ++index)
+                {
+                    offsets_[index + 1] += offsets_[index];
+                }
+
+                std::size_t arcCount = arcs.size() * 2;
+
+                heads_.resize(arcCount);
+                pairedArcs_.resize(arcCount);
+                capacities_.resize(arcCount);
+
+                currentArcs_.assign(offsets_.begin(), offsets_.end() - 1);
+
+                for (htd::index_t index = 0; index < arcs.size(); ++index)
+                {
+                    htd::vertex_t source = arcs[index].first;
+                    htd::vertex_t target = arcs[index].second;
+
+                    htd::index_t forwardArc = currentArcs_[source]++;
+                    htd::index_t reverseArc = currentArcs_[target]++;
+
+                    heads_[forwardArc] = target;
+                    heads_[reverseArc] = source;
+
+                    pairedArcs_[forwardArc] = reverseArc;
+                    pairedArcs_[reverseArc] = forwardArc;
+
+                    capacities_[forwardArc] = capacities[index];
+                    capacities_[reverseArc] = 0;
+                }
+
+                residualCapacities_.assign(capacities_.begin(), capacities_.end());
+
+                modified_.assign(arcCount, false);
+
+                modifiedArcs_.clear();
+
+                levels_.assign(vertexCount, (std::size_t)-1);
+
+                currentArcs_.assign(offsets_.begin(), offsets_.end() - 1);
+
+                reachedVertices_.clear();
+            }
+
+            /**
+             *  Getter for the number of vertices of the flow network.
+             *
+             *  @return The number of vertices of the flow network.
+             */
+            std::size_t vertexCount(void) const
+            {
+                return vertexCount_;
+            }
+
+            /**
+             *  Getter for the number of arcs of the flow network, including the paired reverse arcs.
+             *
+             *  @return The number of arcs of the flow network, including the paired reverse arcs.
+             */
+            std::size_t arcCount(void) const
+            {
+                return heads_.size();
+            }
+
+            /**
+             *  Getter for the index of the first arc leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The index of the first arc leaving the given vertex.
+             */
+            htd::index_t beginArc(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount_)
+
+                return offsets_[vertex];
+            }
+
+            /**
+             *  Getter for the index following the last arc leaving the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The index following the last arc leaving the given vertex.
+             */
+            htd::index_t endArc(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount_)
+
+                return offsets_[vertex + 1];
+            }
+
+            /**
+             *  Getter for the vertex to which the given arc points.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The vertex to which the given arc points.
+             */
+            htd::vertex_t head(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return heads_[arc];
+            }
+
+            /**
+             *  Getter for the vertex from which the given arc leaves.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The vertex from which the given arc leaves.
+             */
+            htd::vertex_t tail(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return heads_[pairedArcs_[arc]];
+            }
+
+            /**
+             *  Getter for the index of the arc paired with the given arc.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The index of the arc paired with the given arc.
+             */
+            htd::index_t pairedArc(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return pairedArcs_[arc];
+            }
+
+            /**
+             *  Getter for the capacity of the given arc.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The capacity of the given arc. The capacity of the paired reverse arcs is zero.
+             */
+            std::size_t capacity(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return capacities_[arc];
+            }
+
+            /**
+             *  Getter for the residual capacity of the given arc.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The residual capacity of the given arc.
+             */
+            std::size_t residualCapacity(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return residualCapacities_[arc];
+            }
+
+            /**
+             *  Getter for the flow along the given arc.
+             *
+             *  @param[in] arc  The index of the arc.
+             *
+             *  @return The flow along the given arc. The flow along a paired reverse arc is the negated flow along its counterpart.
+             */
+            long long flow(htd::index_t arc) const
+            {
+                HTD_ASSERT(arc < heads_.size())
+
+                return static_cast<long long>(capacities_[arc] - residualCapacities_[arc]);
+            }
+
+            /**
+             *  Getter for the net flow between two vertices.
+             *
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *
+             *  @return The flow from the source vertex to the target vertex minus the flow in the opposite direction.
+             */
+            long long flow(htd::vertex_t source, htd::vertex_t target) const
+            {
+                HTD_ASSERT(source < vertexCount_ && target < vertexCount_)
+
+                long long ret = 0;
+
+                for (htd::index_t arc = offsets_[source]; arc < offsets_[source + 1]; ++arc)
+                {
+                    if (heads_[arc] == target)
+                    {
+                        ret += flow(arc);
+                    }
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Send the given amount of flow along the given arc.
+             *
+             *  @param[in] arc      The index of the arc.
+             *  @param[in] amount   The amount of flow. It must not exceed the residual capacity of the arc.
+             */
+            void push(htd::index_t arc, std::size_t amount)
+            {
+                HTD_ASSERT(arc < heads_.size() && amount <= residualCapacities_[arc])
+
+                htd::index_t reverseArc = pairedArcs_[arc];
+
+                if (!modified_[arc])
+                {
+                    modified_[arc] = true;
+                    modified_[reverseArc] = true;
+
+                    modifiedArcs_.push_back(arc);
+                }
+
+                residualCapacities_[arc] -= amount;
+                residualCapacities_[reverseArc] += amount;
+            }
+
+            /**
+             *  Remove all flow from the network, i.e., restore the capacities of all arcs modified since the last reset and clear the levels of all vertices.
+             */
+            void reset(void)
+            {
+                for (htd::index_t arc : modifiedArcs_)
+                {
+                    htd::index_t reverseArc = pairedArcs_[arc];
+
+                    residualCapacities_[arc] = capacities_[arc];
+                    residualCapacities_[reverseArc] = capacities_[reverseArc];
+
+                    modified_[arc] = false;
+                    modified_[reverseArc] = false;
+                }
+
+                modifiedArcs_.clear();
+
+                clearLevels();
+            }
+
+            /**
+             *  Getter for the level of the given vertex, i.e., its distance from the source vertex in the residual network as determined by the last call of computeLevels().
+             *
+             *  If the target vertex was not reachable in the last call of computeLevels(), exactly the vertices reachable from the source vertex have a level assigned.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The level of the given vertex or (std::size_t)-1 if no level was assigned to the vertex.
+             */
+            std::size_t level(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount_)
+
+                return levels_[vertex];
+            }
+
+            /**
+             *  Getter for the current arc of the given vertex, i.e., the first arc leaving the vertex which was not yet found to be useless during the current blocking flow computation.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The current arc of the given vertex.
+             */
+            htd::index_t currentArc(htd::vertex_t vertex) const
+            {
+                HTD_ASSERT(vertex < vertexCount_)
+
+                return currentArcs_[vertex];
+            }
+
+            /**
+             *  Determine the levels of the vertices via breadth-first search from the source vertex in the residual network and reset the current arcs of all reached vertices.
+             *
+             *  The search stops as soon as the target vertex is reached.
+             *
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *
+             *  @return True if the target vertex is reachable from the source vertex in the residual network, false otherwise.
+             */
+            bool computeLevels(htd::vertex_t source, htd::vertex_t target)
+            {
+                HTD_ASSERT(source < vertexCount_ && target < vertexCount_)
+
+                clearLevels();
+
+                levels_[source] = 0;
+
+                currentArcs_[source] = offsets_[source];
+
+                reachedVertices_.push_back(source);
+
+                for (htd::index_t index = 0; index < reachedVertices_.size(); ++index)
+                {
+                    htd::vertex_t vertex = reachedVertices_[index];
+
+                    std::size_t nextLevel = levels_[vertex] + 1;
+
+                    for (htd::index_t arc = offsets_[vertex]; arc < offsets_[vertex + 1]; ++arc)
+                    {
+                        htd::vertex_t neighbor = heads_[arc];
+
+                        if (residualCapacities_[arc] > 0 && levels_[neighbor] == (std::size_t)-1)
+                        {
+                            levels_[neighbor] = nextLevel;
+
+                            currentArcs_[neighbor] = offsets_[neighbor];
+
+                            reachedVertices_.push_back(neighbor);
+
+                            if (neighbor == target)
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                }
+
+                return false;
+            }
+
+            /**
+             *  Augment the flow along shortest paths in the level graph defined by the last call of computeLevels() until the flow between the source and the target vertex is blocking or the given limit is reached.
+             *
+             *  @param[in] source   The source vertex.
+             *  @param[in] target   The target vertex.
+             *  @param[in] limit    The maximum amount of flow which shall be added.
+             *
+             *  @return The amount of flow which was added.
+             */
+            std::size_t augmentBlockingFlow(htd::vertex_t source, htd::vertex_t target, std::size_t limit)
+            {
+                HTD_ASSERT(source < vertexCount_ && target < vertexCount_ && levels_[source] == 0)
+
+                std::size_t ret = 0;
+
+                while (ret < limit)
+                {
+                    htd::vertex_t vertex = source;
+
+                    path_.clear();
+
+                    while (vertex != target)
+                    {
+                        htd::index_t & arc = currentArcs_[vertex];
+
+                        htd::index_t lastArc = offsets_[vertex + 1];
+
+                        std::size_t nextLevel = levels_[vertex] + 1;
+
+                        while (arc < lastArc && (residualCapacities_[arc] == 0 || levels_[heads_[arc]] != nextLevel))
+                        {
+                            ++arc;
+                        }
+
+                        if (arc < lastArc)
+                        {
+                            path_.push_back(arc);
+
+                            vertex = heads_[arc];
+                        }
+                        else
+                        {
+                            /* The vertex is a dead end, hence the arc leading to it is useless for the rest of the phase. */
+                            if (path_.empty())
+                            {
+                                return ret;
+                            }
+
+                            vertex = heads_[pairedArcs_[path_.back()]];
+
+                            path_.pop_back();
+
+                            ++currentArcs_[vertex];
+                        }
+                    }
+
+                    std::size_t amount = limit - ret;
+
+                    for (htd::index_t arc : path_)
+                    {
+                        amount = std::min(amount, residualCapacities_[arc]);
+                    }
+
+                    for (htd::index_t arc : path_)
+                    {
+                        push(arc, amount);
+                    }
+
+                    ret += amount;
+                }
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  Clear the levels of all vertices reached by the last call of computeLevels().
+             */
+            void clearLevels(void)
+            {
+                for (htd::vertex_t vertex : reachedVertices_)
+                {
+                    levels_[vertex] = (std::size_t)-1;
+                }
+
+                reachedVertices_.clear();
+            }
+
+            /**
+             *  The number of vertices of the flow network.
+             */
+            std::size_t vertexCount_;
+
+            /**
+             *  The index of the first arc leaving each vertex, followed by the total number of arcs.
+             */
+            std::vector<htd::index_t> offsets_;
+
+            /**
+             *  The vertex to which each arc points.
+             */
+            std::vector<htd::vertex_t> heads_;
+
+            /**
+             *  The index of the arc paired with each arc.
+             */
+            std::vector<htd::index_t> pairedArcs_;
+
+            /**
+             *  The capacity of each arc.
+             */
+            std::vector<std::size_t> capacities_;
+
+            /**
+             *  The residual capacity of each arc.
+             */
+            std::vector<std::size_t> residualCapacities_;
+
+            /**
+             *  A boolean flag for each arc indicating whether its residual capacity was modified since the last reset.
+             */
+            std::vector<bool> modified_;
+
+            /**
+             *  One arc of each pair of arcs whose residual capacities were modified since the last reset.
+             */
+            std::vector<htd::index_t> modifiedArcs_;
+
+            /**
+             *  The level of each vertex.
+             */
+            std::vector<std::size_t> levels_;
+
+            /**
+             *  The current arc of each vertex.
+             */
+            std::vector<htd::index_t> currentArcs_;
+
+            /**
+             *  The vertices reached by the last call of computeLevels() in the order in which they were reached.
+             */
+            std::vector<htd::vertex_t> reachedVertices_;
+
+            /**
+             *  The arcs of the path which is currently explored by the blocking flow computation.
+             */
+            std::vector<htd::index_t> path_;
+    };
+}
+
+#endif /* HTD_HTD_COMPRESSEDFLOWNETWORK_HPP */
@@ -0,0 +1,205 @@
+/* 
+ * File:   CompressedMultiHypergraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_HPP
+#define HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_HPP
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable implementation of the IMultiHypergraph interface based on the compressed sparse row (CSR) format.
+     *
+     *  The neighborhoods of all vertices, the endpoints of all hyperedges and the hyperedges incident to each vertex
+     *  are stored in flat, contiguous arrays which are built once during construction. Copies of a compressed
+     *  multi-hypergraph share these arrays, so copying and cloning is cheap.
+     *
+     *  @note Because the interface exposes hyperedges as htd::Hyperedge objects, the corresponding objects are
+     *  created on first access of a function returning hyperedges and are shared by all copies afterwards.
+     *  Algorithms which only access vertices and neighborhoods never create them.
+     */
+    class CompressedMultiHypergraph : public virtual htd::IMultiHypergraph
+    {
+        public:
+            /**
+             *  Constructor for a compressed multi-hypergraph with vertices 1, ..., vertexCount.
+             *
+             *  The edges get the IDs 1, ..., edges.size() in the order in which they appear in the given collection.
+             *
+             *  @param[in] manager      The management instance to which the new multi-hypergraph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new multi-hypergraph.
+             *  @param[in] edges        The endpoints of the edges of the new multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
+            /**
+             *  Constructor for a compressed multi-hypergraph with vertices 1, ..., vertexCount.
+             *
+             *  The hyperedges get the IDs 1, ..., edges.size() in the order in which they appear in the given collection.
+             *
+             *  @param[in] manager      The management instance to which the new multi-hypergraph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new multi-hypergraph.
+             *  @param[in] edges        The endpoints of the hyperedges of the new multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::vector<htd::vertex_t>> & edges);
+
+            /**
+             *  Copy constructor for a compressed multi-hypergraph.
+             *
+             *  @param[in] original  The original compressed multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph(const CompressedMultiHypergraph & original);
+
+            /**
+             *  Constructor for a compressed multi-hypergraph containing the same vertices and hyperedges as the given multi-hypergraph.
+             *
+             *  @param[in] original  The original multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph(const htd::IMultiHypergraph & original);
+
+            HTD_API virtual ~CompressedMultiHypergraph();
+
+            HTD_API std::size_t vertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
+
+            HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(void) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
+
+            HTD_API std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(std::vector<htd::index_t> && indices) const HTD_OVERRIDE;
+
+            /**
+             *  Access the endpoints of the hyperedge at the specific position without creating htd::Hyperedge objects.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *
+             *  @return The endpoints of the hyperedge at the specific position in the order in which they were provided.
+             */
+            HTD_API htd::ConstCollection<htd::vertex_t> hyperedgeElementsAtPosition(htd::index_t index) const;
+
+            /**
+             *  Getter for the ID of the hyperedge at the specific position.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *
+             *  @return The ID of the hyperedge at the specific position.
+             */
+            HTD_API htd::id_t hyperedgeIdAtPosition(htd::index_t index) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompressedMultiHypergraph * clone(void) const HTD_OVERRIDE;
+#else
+            /**
+             *  Create a copy of the current compressed multi-hypergraph sharing its immutable storage.
+             *
+             *  @return A new CompressedMultiHypergraph object identical to the current compressed multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph * clone(void) const;
+
+            HTD_API htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const HTD_OVERRIDE;
+#endif
+
+            /**
+             *  Copy assignment operator for a compressed multi-hypergraph.
+             *
+             *  @note Compressed multi-hypergraphs are immutable, hence assignment is not supported.
+             *
+             *  @param[in] original  The original compressed multi-hypergraph.
+             */
+            HTD_API CompressedMultiHypergraph & operator=(const CompressedMultiHypergraph & original) = delete;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_HPP */
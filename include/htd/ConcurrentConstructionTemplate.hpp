@@ -0,0 +1,226 @@
+/*
+ * File:   ConcurrentConstructionTemplate.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONCURRENTCONSTRUCTIONTEMPLATE_HPP
+#define HTD_HTD_CONCURRENTCONSTRUCTIONTEMPLATE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Holder for the construction template of a factory class which can be replaced while other threads access it.
+     *
+     *  Accessing the construction template is lock-free: A reader announces itself via an atomic reader count and then
+     *  loads the atomic pointer to the current construction template. Replaced construction templates are retired and
+     *  deleted as soon as no reader is active. If more than RETIRED_INSTANCE_LIMIT construction templates are retired,
+     *  the replacing thread waits until all active readers are finished, hence only replacing the construction template
+     *  may block.
+     */
+    template <typename Type>
+    class ConcurrentConstructionTemplate
+    {
+        public:
+            /**
+             *  The maximum number of replaced construction templates which are kept alive for active readers.
+             */
+            static const std::size_t RETIRED_INSTANCE_LIMIT = 16;
+
+            /**
+             *  Reference to a construction template which keeps the construction template alive while the reference exists.
+             */
+            class Reference
+            {
+                public:
+                    /**
+                     *  Constructor for a reference to the current construction template of the given holder.
+                     *
+                     *  @param[in] owner    The holder of the construction template.
+                     */
+                    Reference(const ConcurrentConstructionTemplate<Type> & owner) : owner_(&owner), instance_(nullptr)
+                    {
+                        owner.readerCount_.fetch_add(1);
+
+                        instance_ = owner.instance_.load();
+                    }
+
+                    /**
+                     *  Move constructor for a reference to a construction template.
+                     *
+                     *  @param[in] original The original reference.
+                     */
+                    Reference(Reference && original) : owner_(original.owner_), instance_(original.instance_)
+                    {
+                        original.owner_ = nullptr;
+                    }
+
+                    Reference(const Reference & original) = delete;
+
+                    Reference & operator=(const Reference & original) = delete;
+
+                    /**
+                     *  Destructor of a reference to a construction template.
+                     */
+                    ~Reference()
+                    {
+                        if (owner_ != nullptr)
+                        {
+                            owner_->readerCount_.fetch_sub(1);
+                        }
+                    }
+
+                    /**
+                     *  Access the referenced construction template.
+                     *
+                     *  @return A pointer to the referenced construction template.
+                     */
+                    Type * operator->() const
+                    {
+                        return instance_;
+                    }
+
+                    /**
+                     *  Access the referenced construction template.
+                     *
+                     *  @return The referenced construction template.
+                     */
+                    Type & operator*() const
+                    {
+                        return *instance_;
+                    }
+
+                private:
+                    /**
+                     *  The holder of the construction template or nullptr if the reference was moved.
+                     */
+                    const ConcurrentConstructionTemplate<Type> * owner_;
+
+                    /**
+                     *  A pointer to the referenced construction template.
+                     */
+                    Type * instance_;
+            };
+
+            /**
+             *  Constructor for the holder of a construction template.
+             *
+             *  @note When calling this method the control over the memory region of the construction template is transferred to the holder.
+             *
+             *  @param[in] instance The initial construction template.
+             */
+            ConcurrentConstructionTemplate(Type * instance) : instance_(instance), readerCount_(0), mutex_(), retiredInstances_()
+            {
+
+            }
+
+            ConcurrentConstructionTemplate(const ConcurrentConstructionTemplate<Type> & original) = delete;
+
+            ConcurrentConstructionTemplate & operator=(const ConcurrentConstructionTemplate<Type> & original) = delete;
+
+            /**
+             *  Destructor of the holder of a construction template.
+             */
+            ~ConcurrentConstructionTemplate()
+            {
+                delete instance_.load();
+
+                for (Type * instance : retiredInstances_)
+                {
+                    delete instance;
+                }
+            }
+
+            /**
+             *  Access the current construction template.
+             *
+             *  @return A reference to the current construction template.
+             */
+            Reference get(void) const
+            {
+                return Reference(*this);
+            }
+
+            /**
+             *  Replace the current construction template.
+             *
+             *  @note When calling this method the control over the memory region of the construction template is transferred to the holder.
+             *
+             *  @param[in] instance The new construction template.
+             */
+            void set(Type * instance)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                retiredInstances_.push_back(instance_.exchange(instance));
+
+                std::size_t readerCount = readerCount_.load();
+
+                while (readerCount > 0 && retiredInstances_.size() > RETIRED_INSTANCE_LIMIT)
+                {
+                    std::this_thread::yield();
+
+                    readerCount = readerCount_.load();
+                }
+
+                /* Readers starting after the exchange above cannot see any of the retired construction templates. */
+                if (readerCount == 0)
+                {
+                    for (Type * retiredInstance : retiredInstances_)
+                    {
+                        delete retiredInstance;
+                    }
+
+                    retiredInstances_.clear();
+                }
+            }
+
+        private:
+            /**
+             *  The current construction template.
+             */
+            std::atomic<Type *> instance_;
+
+            /**
+             *  The number of active readers.
+             */
+            mutable std::atomic<std::size_t> readerCount_;
+
+            /**
+             *  The mutex serializing the replacements of the construction template.
+             */
+            std::mutex mutex_;
+
+            /**
+             *  The replaced construction templates which may still be accessed by active readers.
+             */
+            std::vector<Type *> retiredInstances_;
+    };
+}
+
+#endif /* HTD_HTD_CONCURRENTCONSTRUCTIONTEMPLATE_HPP */
@@ -0,0 +1,320 @@
+/* 
+ * File:   DenseVertexMap.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_DENSEVERTEXMAP_HPP
+#define HTD_HTD_DENSEVERTEXMAP_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Vertex.hpp>
+
+#include <deque>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Associative container mapping vertices to values which stores the values in a dense array indexed by the vertex ID minus htd::Vertex::FIRST.
+     *
+     *  The container is a drop-in replacement for std::unordered_map<htd::vertex_t, T> in classes whose vertex identifiers are assigned
+     *  consecutively and are never reused, e.g., the nodes of trees and paths. Lookups do neither require hashing nor a pointer dereference.
+     *
+     *  Like for std::unordered_map, references to the stored values remain valid when further vertices are inserted, because the
+     *  values are kept in a std::deque which is only ever extended at its end.
+     *
+     *  @note The memory consumption of the container is linear in the largest vertex ID stored in it and not in the number of stored entries.
+     */
+    template < typename T >
+    class DenseVertexMap
+    {
+        public:
+            /**
+             *  Constructor for an empty map.
+             */
+            DenseVertexMap(void) : size_(0), values_(), present_()
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a map.
+             *
+             *  @param[in] original  The original map.
+             */
+            DenseVertexMap(const DenseVertexMap<T> & original) = default;
+
+            /**
+             *  Move constructor for a map.
+             *
+             *  @param[in] original  The original map.
+             */
+            DenseVertexMap(DenseVertexMap<T> && original) : size_(original.size_), values_(std::move(original.values_)), present_(std::move(original.present_))
+            {
+                original.size_ = 0;
+            }
+
+            /**
+             *  Destructor of a map.
+             */
+            ~DenseVertexMap()
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a map.
+             *
+             *  @param[in] original  The original map.
+             *
+             *  @return A reference to the modified map.
+             */
+            DenseVertexMap<T> & operator=(const DenseVertexMap<T> & original) = default;
+
+            /**
+             *  Getter for the number of vertices stored in the map.
+             *
+             *  @return The number of vertices stored in the map.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the map is empty.
+             *
+             *  @return True if the map is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Get the number of entries for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return 1 if the vertex is stored in the map, 0 otherwise.
+             */
+            std::size_t count(htd::vertex_t vertex) const
+            {
+                return contains(vertex) ? 1 : 0;
+            }
+
+            /**
+             *  Access the value associated with the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @throws std::out_of_range   If the vertex is not stored in the map.
+             *
+             *  @return The value associated with the given vertex.
+             */
+            T & at(htd::vertex_t vertex)
+            {
+                if (!contains(vertex))
+                {
+                    throw std::out_of_range("T & htd::DenseVertexMap<T>::at(htd::vertex_t)");
+                }
+
+                return values_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Access the value associated with the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @throws std::out_of_range   If the vertex is not stored in the map.
+             *
+             *  @return The value associated with the given vertex.
+             */
+            const T & at(htd::vertex_t vertex) const
+            {
+                if (!contains(vertex))
+                {
+                    throw std::out_of_range("const T & htd::DenseVertexMap<T>::at(htd::vertex_t) const");
+                }
+
+                return values_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Access the value associated with the given vertex. If the vertex is not yet stored in the map, it is inserted with a default-constructed value.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The value associated with the given vertex.
+             */
+            T & operator[](htd::vertex_t vertex)
+            {
+                HTD_ASSERT(vertex >= htd::Vertex::FIRST)
+
+                std::size_t index = vertex - htd::Vertex::FIRST;
+
+                allocate(index);
+
+                if (!present_[index])
+                {
+                    present_[index] = true;
+
+                    ++size_;
+                }
+
+                return values_[index];
+            }
+
+            /**
+             *  Insert a new value for the given vertex. If the vertex is already stored in the map, the existing value is kept.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[in] value    The value which shall be associated with the vertex.
+             *
+             *  @return True if the value was inserted, false if the vertex was already stored in the map.
+             */
+            template < typename ValueType >
+            bool emplace(htd::vertex_t vertex, ValueType && value)
+            {
+                HTD_ASSERT(vertex >= htd::Vertex::FIRST)
+
+                std::size_t index = vertex - htd::Vertex::FIRST;
+
+                allocate(index);
+
+                bool ret = !present_[index];
+
+                if (ret)
+                {
+                    values_[index] = std::forward<ValueType>(value);
+
+                    present_[index] = true;
+
+                    ++size_;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Remove the given vertex and its associated value from the map.
+             *
+             *  @param[in] vertex   The vertex which shall be removed.
+             *
+             *  @return The number of removed entries.
+             */
+            std::size_t erase(htd::vertex_t vertex)
+            {
+                std::size_t ret = 0;
+
+                if (contains(vertex))
+                {
+                    std::size_t index = vertex - htd::Vertex::FIRST;
+
+                    /* Release the memory held by the removed value. */
+                    values_[index] = T();
+
+                    present_[index] = false;
+
+                    --size_;
+
+                    ret = 1;
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Remove all entries from the map.
+             */
+            void clear(void)
+            {
+                values_.clear();
+
+                present_.clear();
+
+                size_ = 0;
+            }
+
+            /**
+             *  Allocate storage for all vertices up to the given vertex.
+             *
+             *  @param[in] maximumVertex    The largest vertex for which storage shall be reserved.
+             */
+            void reserve(htd::vertex_t maximumVertex)
+            {
+                if (maximumVertex >= htd::Vertex::FIRST)
+                {
+                    allocate(maximumVertex - htd::Vertex::FIRST);
+                }
+            }
+
+        private:
+            /**
+             *  The number of vertices stored in the map.
+             */
+            std::size_t size_;
+
+            /**
+             *  The values of the map, indexed by the vertex ID minus htd::Vertex::FIRST.
+             */
+            std::deque<T> values_;
+
+            /**
+             *  Information whether a vertex is stored in the map, indexed by the vertex ID minus htd::Vertex::FIRST.
+             */
+            std::vector<bool> present_;
+
+            /**
+             *  Check whether the given vertex is stored in the map.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the vertex is stored in the map, false otherwise.
+             */
+            bool contains(htd::vertex_t vertex) const
+            {
+                return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < present_.size() && present_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Ensure that storage for the given index is available.
+             *
+             *  @param[in] index    The index.
+             */
+            void allocate(std::size_t index)
+            {
+                if (index >= present_.size())
+                {
+                    values_.resize(index + 1);
+
+                    present_.resize(index + 1, false);
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_DENSEVERTEXMAP_HPP */
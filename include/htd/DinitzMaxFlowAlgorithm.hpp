@@ -26,11 +26,20 @@
 #define HTD_HTD_DINITZMAXFLOWALGORITHM_HPP
 
 #include <htd/IMaxFlowAlgorithm.hpp>
+#include <htd/CompressedFlowNetwork.hpp>
 
 namespace htd
 {
     /**
      *  Implementation of the IMaxFlowAlgorithm interface based on Yefim Dinitz's algorithm.
+     *
+     *  The flow is computed on a htd::CompressedFlowNetwork. In each phase, the levels of the vertices are determined
+     *  via breadth-first search in the residual network and a blocking flow in the resulting level graph is added.
+     *  The residual network contains a reverse arc for each arc, so flow added in an earlier phase can be cancelled
+     *  and the result is always a maximum flow. Versions of htd before the compressed flow network did not cancel
+     *  flow and could return flows which are not maximum.
+     *  Callers which compute many flows on the same network should use the overloads operating directly on a
+     *  htd::CompressedFlowNetwork, which neither allocate memory nor create a htd::IFlow object.
      */
     class DinitzMaxFlowAlgorithm : public htd::IMaxFlowAlgorithm
     {
@@ -50,6 +59,36 @@ namespace htd
 
             HTD_API htd::IFlow * determineMaximumFlow(const htd::IFlowNetworkStructure & flowNetwork, htd::vertex_t source, htd::vertex_t target) const HTD_OVERRIDE;
 
+            /**
+             *  Augment the flow stored in the given flow network until it is a maximum flow between the given vertices.
+             *
+             *  @note The computation starts from the flow currently stored in the flow network. Call htd::CompressedFlowNetwork::reset() beforehand to compute a new flow from scratch.
+             *
+             *  @param[in] flowNetwork  The flow network.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             *
+             *  @return The amount of flow which was added to the flow network.
+             */
+            HTD_API std::size_t determineMaximumFlow(htd::CompressedFlowNetwork & flowNetwork, htd::vertex_t source, htd::vertex_t target) const;
+
+            /**
+             *  Augment the flow stored in the given flow network until it is a maximum flow between the given vertices or the given amount of flow was added.
+             *
+             *  If less than the given amount of flow was added and the management instance was not terminated, the flow is maximal and the vertices having a level in the flow network (see htd::CompressedFlowNetwork::level())
+             *  are exactly the vertices reachable from the source vertex in the residual network, i.e., they form the source side of a minimum cut.
+             *
+             *  @note The computation starts from the flow currently stored in the flow network. Call htd::CompressedFlowNetwork::reset() beforehand to compute a new flow from scratch.
+             *
+             *  @param[in] flowNetwork  The flow network.
+             *  @param[in] source       The source vertex.
+             *  @param[in] target       The target vertex.
+             *  @param[in] limit        The maximum amount of flow which shall be added.
+             *
+             *  @return The amount of flow which was added to the flow network.
+             */
+            HTD_API std::size_t determineMaximumFlow(htd::CompressedFlowNetwork & flowNetwork, htd::vertex_t source, htd::vertex_t target, std::size_t limit) const;
+
             HTD_API DinitzMaxFlowAlgorithm * clone(void) const HTD_OVERRIDE;
 
         private:
@@ -32,6 +32,9 @@ namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the MCS-M elimination ordering algorithm.
+     *
+     *  Each step performs a single search over the unnumbered vertices which processes the vertices in buckets of
+     *  increasing path weight, so the ordering is computed in O(n * m) time for a graph with n vertices and m edges.
      */
     class EnhancedMaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
     {
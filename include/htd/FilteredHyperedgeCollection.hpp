@@ -282,6 +282,14 @@ namespace htd
              */
             HTD_API FilteredHyperedgeCollection(std::shared_ptr<htd::IHyperedgeCollection> baseCollection, std::vector<htd::index_t> && relevantIndices);
 
+            /**
+             *  Constructor for a FilteredHyperedgeCollection which shares the underlying hyperedge collection with another FilteredHyperedgeCollection.
+             *
+             *  @param[in] original         The FilteredHyperedgeCollection whose underlying hyperedge collection shall be shared.
+             *  @param[in] relevantIndices  The relevant indices within the underlying hyperedge collection.
+             */
+            HTD_API FilteredHyperedgeCollection(const FilteredHyperedgeCollection & original, std::vector<htd::index_t> && relevantIndices);
+
             /**
              *  Copy constructor for a FilteredHyperedgeCollection object.
              *
@@ -322,6 +330,15 @@ namespace htd
              */
             HTD_API FilteredHyperedgeCollectionConstIterator end(void) const HTD_NOEXCEPT;
 
+            /**
+             *  Access the hyperedge at the specific position within the collection.
+             *
+             *  @param[in] index    The position of the hyperedge.
+             *
+             *  @return The hyperedge at the specific position within the collection.
+             */
+            HTD_API const htd::Hyperedge & at(htd::index_t index) const;
+
             /**
              *  Copy assignment operator for a FilteredHyperedgeCollection object.
              *
@@ -31,6 +31,8 @@
 #include <htd/LabeledMultiHypergraph.hpp>
 
 #include <unordered_map>
+#include <memory>
+#include <mutex>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -100,6 +102,10 @@ namespace htd
 
             HTD_API const htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
 
+            HTD_API void evictInducedHyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index) HTD_OVERRIDE;
+
             HTD_API std::size_t minimumBagSize(void) const HTD_OVERRIDE;
 
             HTD_API std::size_t maximumBagSize(void) const HTD_OVERRIDE;
@@ -152,7 +158,21 @@ namespace htd
         private:
             std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            mutable std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+
+            std::shared_ptr<htd::InducedHyperedgeIndex> inducedHyperedgeIndex_;
+
+            mutable std::mutex inducedEdgesMutex_;
+
+            /**
+             *  Access the hyperedges induced by the bag content of a specific vertex and compute them via the index of
+             *  induced hyperedges if they are not cached yet.
+             *
+             *  @param[in] vertex   The vertex for which the induced hyperedges shall be returned.
+             *
+             *  @return The collection of hyperedges induced by the bag content of the specific vertex.
+             */
+            htd::FilteredHyperedgeCollection & lazyInducedHyperedges(htd::vertex_t vertex) const;
     };
 }
 
@@ -43,6 +43,13 @@ namespace htd
              *  @param[in] manager   The management instance to which the new preprocessor belongs.
              */
             HTD_API GraphPreprocessor(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a graph preprocessor.
+             *
+             *  @param[in] original  The original graph preprocessor.
+             */
+            HTD_API GraphPreprocessor(const GraphPreprocessor & original);
             
             HTD_API virtual ~GraphPreprocessor();
 
@@ -51,7 +58,7 @@ namespace htd
             /**
              *  Set the preprocessing strategy which shall be used.
              *
-             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + retain only largest biconnected component)
+             *  @param[in] level    The level of preprocessing which shall be applied. (0: none, 1: simple, 2: advanced, 3: full, 4 or more: full + decomposition into atoms, all atoms but the largest one are eliminated)
              */
             HTD_API void setPreprocessingStrategy(std::size_t level);
 
@@ -91,10 +98,27 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which shall be used to detect simplicial and almost simplicial vertices and to process the atoms.
+             *
+             *  @return The number of threads which shall be used to detect simplicial and almost simplicial vertices and to process the atoms.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to detect simplicial and almost simplicial vertices and to process the atoms.
+             *
+             *  @note The vertices are still eliminated in the same order by the calling thread and each atom is processed
+             *  with its own seed, hence the preprocessed graph does not depend on the thread count. If the thread count is
+             *  set to 1 (default), all candidate vertices and atoms are processed in the calling thread.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to detect simplicial and almost simplicial vertices and to process the atoms.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             /**
              *  Set the ordering algorithm which shall be used to compute the vertex elimination
-             *  ordering of the remainder of the input graph when only the largest biconnected
-             *  component is retained.
+             *  orderings of the atoms which are eliminated when the graph is decomposed into atoms.
              *
              *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination ordering.
              *
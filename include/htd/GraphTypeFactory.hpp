@@ -26,6 +26,7 @@
 #define HTD_HTD_GRAPHTYPEFACTORY_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/ConcurrentConstructionTemplate.hpp>
 #include <htd/LibraryInstance.hpp>
 
 namespace htd
@@ -70,7 +71,7 @@ namespace htd
              */
             virtual ~GraphTypeFactory()
             {
-                delete constructionTemplate_;
+
             }
 
             /**
@@ -107,18 +108,21 @@ namespace htd
              *  is transferred to the factory class. Deleting the object instance provided to this method outside the factory class or
              *  assigning the same object instance multiple times will lead to undefined behavior.
              *
+             *  @note The method may be called while other threads create new objects via the factory. The previous default
+             *  implementation is released as soon as no other thread clones it anymore. If too many replaced default
+             *  implementations are still in use, the method waits until all concurrent calls of createInstance() are finished.
+             *
              *  @param[in] original The new default implementation of the interface MutableGraphType.
              */
             void setConstructionTemplate(MutableGraphType * original)
             {
                 HTD_ASSERT(original != nullptr)
-                HTD_ASSERT(original->vertexCount() == 0)
 
-                delete constructionTemplate_;
+                HTD_ASSERT(original->vertexCount() == 0)
 
-                constructionTemplate_ = original;
+                original->setManagementInstance(managementInstance_);
 
-                constructionTemplate_->setManagementInstance(managementInstance_);
+                constructionTemplate_.set(original);
             }
 
             /**
@@ -152,9 +156,23 @@ namespace htd
             const htd::LibraryInstance * managementInstance_;
 
             /**
-             *  A pointer to a clean instance of the default implementation.
+             *  Access the current default implementation.
+             *
+             *  @note The returned reference keeps the default implementation alive even if it is replaced concurrently,
+             *  hence objects may be created via the factory from any number of threads while setConstructionTemplate() is
+             *  called. Accessing the default implementation does not take a lock.
+             *
+             *  @return A reference to a clean instance of the default implementation.
+             */
+            typename htd::ConcurrentConstructionTemplate<MutableGraphType>::Reference constructionTemplate(void) const
+            {
+                return constructionTemplate_.get();
+            }
+
+            /**
+             *  A clean instance of the default implementation.
              */
-            MutableGraphType * constructionTemplate_;
+            htd::ConcurrentConstructionTemplate<MutableGraphType> constructionTemplate_;
     };
 }
 
@@ -33,12 +33,15 @@
 #include <htd/Label.hpp>
 #include <htd/FilteredHyperedgeCollection.hpp>
 #include <htd/LibraryInstance.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 #include <htd/ITreeDecomposition.hpp>
 
 #include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <functional>
 #include <chrono>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -46,6 +49,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -61,6 +65,43 @@ namespace htd
      */
     HTD_API htd::LibraryInstance * createManagementInstance(htd::id_t id);
 
+    /**
+     *  Create a new management instance which is configured like the given management instance.
+     *
+     *  The new management instance has the same ID, factory classes creating the same types of objects, a random number
+     *  generator in the same state and the same remaining time and memory budgets as the original management instance.
+     *  Apart from the attached statistics, it does not share any mutable state with the original,
+     *  hence it can be handed to another thread which runs algorithms independently of the original management instance.
+     *
+     *  @note The construction templates of the original management instance may be replaced concurrently, in which case the
+     *  new management instance uses either the previous or the new construction template of the respective factory class.
+     *  Apart from that, the original management instance must not be reconfigured or used to run algorithms while it is
+     *  cloned. Re-seed the random number generator of the new management instance if its random choices shall differ from
+     *  the original.
+     *
+     *  @param[in] original The management instance which shall be cloned.
+     *
+     *  @return A pointer to the new management instance.
+     */
+    HTD_API htd::LibraryInstance * cloneManagementInstance(const htd::LibraryInstance & original);
+
+    /**
+     *  Determine the peak memory usage of the current process.
+     *
+     *  @note The peak memory usage never decreases during the lifetime of the process. Use htd::currentMemoryUsage() to
+     *  determine the memory which is actually in use.
+     *
+     *  @return The peak resident set size of the current process in bytes or 0 if the information is not available on the current platform.
+     */
+    HTD_API std::size_t peakMemoryUsage(void);
+
+    /**
+     *  Determine the current memory usage of the current process.
+     *
+     *  @return The current resident set size of the current process in bytes or 0 if the information is not available on the current platform.
+     */
+    HTD_API std::size_t currentMemoryUsage(void);
+
     template < typename T >
     void print(const T & input, std::ostream & stream)
     {
@@ -337,6 +378,24 @@ namespace htd
         return *position;
     }
 
+    /**
+     *  Select a pseudo-random element of a non-empty collection.
+     *
+     *  @param[in] collection   The collection from which an element shall be selected.
+     *  @param[in] generator    The random number generator which shall be used.
+     *
+     *  @return A reference to the selected element.
+     */
+    template < typename T, typename Collection >
+    const T & selectRandomElement(const Collection & collection, htd::RandomNumberGenerator & generator)
+    {
+        auto position = collection.begin();
+
+        std::advance(position, generator.nextIndex(collection.size()));
+
+        return *position;
+    }
+
     /**
      *  Check whether a collection is sorted in ascending order and free of duplicates.
      *
@@ -393,6 +452,46 @@ namespace htd
 
     HTD_API std::pair<std::size_t, std::size_t> symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
+    /**
+     *  Compute the number of elements in the intersection of two sets represented as packed bitsets.
+     *
+     *  @note Depending on the capabilities of the processor, the population count is computed using AVX-512, AVX2 or a portable scalar implementation.
+     *
+     *  @param[in] bitset1      The words of the first bitset.
+     *  @param[in] bitset2      The words of the second bitset.
+     *  @param[in] wordCount    The number of words of each bitset.
+     *
+     *  @return The number of elements in the intersection of the two sets.
+     */
+    HTD_API std::size_t bitset_intersection_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, std::size_t wordCount) HTD_NOEXCEPT;
+
+    /**
+     *  Compute the number of elements which are found in the first but not in the second set, both represented as packed bitsets.
+     *
+     *  @note Depending on the capabilities of the processor, the population count is computed using AVX-512, AVX2 or a portable scalar implementation.
+     *
+     *  @param[in] bitset1      The words of the first bitset.
+     *  @param[in] bitset2      The words of the second bitset.
+     *  @param[in] wordCount    The number of words of each bitset.
+     *
+     *  @return The number of elements which are found in the first but not in the second set.
+     */
+    HTD_API std::size_t bitset_difference_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, std::size_t wordCount) HTD_NOEXCEPT;
+
+    /**
+     *  Compute the number of elements which are found in the first and the second but not in the third set, all represented as packed bitsets.
+     *
+     *  @note Depending on the capabilities of the processor, the population count is computed using AVX-512, AVX2 or a portable scalar implementation.
+     *
+     *  @param[in] bitset1      The words of the first bitset.
+     *  @param[in] bitset2      The words of the second bitset.
+     *  @param[in] bitset3      The words of the third bitset.
+     *  @param[in] wordCount    The number of words of each bitset.
+     *
+     *  @return The number of elements which are found in the first and the second but not in the third set.
+     */
+    HTD_API std::size_t bitset_intersection_difference_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, const std::uint64_t * bitset3, std::size_t wordCount) HTD_NOEXCEPT;
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
@@ -431,10 +530,58 @@ namespace htd
         return ret + std::distance(first2, last2);
     }
     
+    /**
+     *  Compute the number of vertices which are found in both of the given sets.
+     *
+     *  @note Depending on the capabilities of the processor and on the sizes of the sets, the intersection is computed using
+     *  AVX2, SSSE3, exponential search within the larger set or a portable scalar implementation.
+     *
+     *  @param[in] set1     A pointer to the first vertex of the first set, sorted in ascending order and free of duplicates.
+     *  @param[in] size1    The number of vertices in the first set.
+     *  @param[in] set2     A pointer to the first vertex of the second set, sorted in ascending order and free of duplicates.
+     *  @param[in] size2    The number of vertices in the second set.
+     *
+     *  @return The number of vertices which are found in both of the given sets.
+     */
+    HTD_API std::size_t vertex_set_intersection_size(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2) HTD_NOEXCEPT;
+
+    /**
+     *  Append the vertices which are found in both of the given sets to the given result vector.
+     *
+     *  @note Depending on the capabilities of the processor and on the sizes of the sets, the intersection is computed using
+     *  AVX2, SSSE3, exponential search within the larger set or a portable scalar implementation.
+     *
+     *  @param[in] set1     A pointer to the first vertex of the first set, sorted in ascending order and free of duplicates.
+     *  @param[in] size1    The number of vertices in the first set.
+     *  @param[in] set2     A pointer to the first vertex of the second set, sorted in ascending order and free of duplicates.
+     *  @param[in] size2    The number of vertices in the second set.
+     *  @param[out] result  The vector to which the vertices found in both sets are appended in ascending order.
+     */
+    HTD_API void vertex_set_intersection(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2, std::vector<htd::vertex_t> & result);
+
+    /**
+     *  Type trait indicating whether the given iterator type refers to a contiguous sequence of 32-bit vertex identifiers.
+     *
+     *  The set operations below forward ranges of such iterators to the vectorized implementations.
+     */
+    template < class Iterator >
+    struct is_contiguous_vertex_iterator : public std::integral_constant<bool, std::is_same<htd::vertex_t, std::uint32_t>::value &&
+                                                                               (std::is_same<Iterator, std::vector<htd::vertex_t>::const_iterator>::value ||
+                                                                                std::is_same<Iterator, std::vector<htd::vertex_t>::iterator>::value ||
+                                                                                std::is_same<Iterator, const htd::vertex_t *>::value ||
+                                                                                std::is_same<Iterator, htd::vertex_t *>::value)>
+    {
+
+    };
+
+    /**
+     *  Compute the number of elements which are found in both of the given sorted ranges by merging them element by element.
+     */
     template < class InputIterator1,
                class InputIterator2 >
-    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
-                                    InputIterator2 first2, InputIterator2 last2)
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::false_type)
     {
         std::size_t ret = 0;
 
@@ -442,14 +589,14 @@ namespace htd
         {
             if (*first1 < *first2)
             {
-                ++ret;
-
                 ++first1;
             } 
             else
             {
                 if (*first1 == *first2)
                 {
+                    ++ret;
+
                     ++first1;
                 }
 
@@ -457,13 +604,60 @@ namespace htd
             }
         }
         
-        return ret + std::distance(first1, last1);
+        return ret;
+    }
+
+    /**
+     *  Compute the number of vertices which are found in both of the given contiguous ranges using htd::vertex_set_intersection_size.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::true_type)
+    {
+        std::size_t size1 = static_cast<std::size_t>(last1 - first1);
+        std::size_t size2 = static_cast<std::size_t>(last2 - first2);
+
+        /* The first element of an empty range must not be dereferenced. */
+        if (size1 == 0 || size2 == 0)
+        {
+            return 0;
+        }
+
+        /* For small sets, the inlined merge is faster than the call of the vectorized implementation. */
+        if (size1 + size2 < 48)
+        {
+            return htd::set_intersection_size(first1, last1, first2, last2, std::false_type());
+        }
+
+        return htd::vertex_set_intersection_size(&(*first1), size1, &(*first2), size2);
     }
 
+    /**
+     *  Compute the number of elements which are found in both of the given sets, both sorted in ascending order.
+     *
+     *  @note For contiguous ranges of 32-bit vertex identifiers the size is computed by htd::vertex_set_intersection_size,
+     *  which requires both ranges to be free of duplicates.
+     */
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
                                       InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_intersection_size(first1, last1, first2, last2,
+                                          std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                       htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
+    }
+
+    /**
+     *  Compute the number of elements which are found in the first but not in the second sorted range by merging them element by element.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::false_type)
     {
         std::size_t ret = 0;
 
@@ -471,14 +665,14 @@ namespace htd
         {
             if (*first1 < *first2)
             {
+                ++ret;
+
                 ++first1;
             } 
             else
             {
                 if (*first1 == *first2)
                 {
-                    ++ret;
-
                     ++first1;
                 }
 
@@ -486,7 +680,35 @@ namespace htd
             }
         }
         
-        return ret;
+        return ret + std::distance(first1, last1);
+    }
+
+    /**
+     *  Compute the number of vertices which are found in the first but not in the second contiguous range using htd::vertex_set_intersection_size.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::true_type)
+    {
+        return static_cast<std::size_t>(last1 - first1) - htd::set_intersection_size(first1, last1, first2, last2, std::true_type());
+    }
+
+    /**
+     *  Compute the number of elements which are found in the first but not in the second set, both sorted in ascending order.
+     *
+     *  @note For contiguous ranges of 32-bit vertex identifiers the size is derived from htd::vertex_set_intersection_size,
+     *  which requires both ranges to be free of duplicates.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2)
+    {
+        return htd::set_difference_size(first1, last1, first2, last2,
+                                        std::integral_constant<bool, htd::is_contiguous_vertex_iterator<InputIterator1>::value &&
+                                                                     htd::is_contiguous_vertex_iterator<InputIterator2>::value>());
     }
 
     template < class InputIterator1,
@@ -38,6 +38,9 @@ namespace htd
 {
     /**
      *  Default implementation of the IHypertreeDecompositionAlgorithm interface.
+     *
+     *  @note If the management instance is terminated before the hyperedges covering all bags are determined, a
+     *  null-pointer is returned instead of a decomposition in which some of the bags lack their covering hyperedges.
      */
     class HypertreeDecompositionAlgorithm : public htd::IHypertreeDecompositionAlgorithm
     {
@@ -116,6 +119,22 @@ namespace htd
 
             HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which shall be used to determine the hyperedges covering the bags of the decomposition.
+             *
+             *  @return The number of threads which shall be used to determine the hyperedges covering the bags of the decomposition.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to determine the hyperedges covering the bags of the decomposition.
+             *
+             *  @note If the thread count is set to 1 (default), the set-cover problems of all bags are solved in the calling thread.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to determine the hyperedges covering the bags of the decomposition.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
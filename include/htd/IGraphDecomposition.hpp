@@ -68,6 +68,17 @@ namespace htd
              */
             virtual const htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex) const = 0;
 
+            /**
+             *  Discard the cached hyperedges induced by the bag content of a specific vertex.
+             *
+             *  If the induced hyperedges are computed lazily, they are recomputed on the next access, otherwise this
+             *  method has no effect. References to the induced hyperedges of the vertex which were obtained before
+             *  are invalidated.
+             *
+             *  @param[in] vertex   The vertex for which the cached induced hyperedges shall be discarded.
+             */
+            virtual void evictInducedHyperedges(htd::vertex_t vertex) const = 0;
+
             /**
              *  Getter for the minimum bag size of the decomposition.
              *
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,19 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add a collection of new edges to the multi-graph.
+             *
+             *  The resulting multi-graph is identical to the one obtained by adding the edges one after another via addEdge(vertex1, vertex2),
+             *  i.e., the edges get consecutive IDs in the order in which they appear in the given collection. Adding the edges at once avoids
+             *  re-sorting the neighborhoods of the affected vertices after each single edge.
+             *
+             *  @note The default implementation adds the edges one after another via addEdge(vertex1, vertex2).
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             */
+            virtual void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
             /**
              *  Remove an edge from the multi-graph.
              *
@@ -131,6 +147,14 @@ namespace htd
     };
 
     inline htd::IMutableMultiGraph::~IMutableMultiGraph() { }
+
+    inline void htd::IMutableMultiGraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+    {
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            addEdge(edge.first, edge.second);
+        }
+    }
 }
 
 #endif /* HTD_HTD_IMUTABLEMULTIGRAPH_HPP */
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiHypergraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,32 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add a collection of new edges to the multi-hypergraph.
+             *
+             *  The resulting multi-hypergraph is identical to the one obtained by adding the edges one after another via addEdge(vertex1, vertex2),
+             *  i.e., the edges get consecutive IDs in the order in which they appear in the given collection. Adding the edges at once avoids
+             *  re-sorting the neighborhoods of the affected vertices after each single edge.
+             *
+             *  @note The default implementation adds the edges one after another via addEdge(vertex1, vertex2).
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             */
+            virtual void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges);
+
+            /**
+             *  Add a collection of new hyperedges to the multi-hypergraph.
+             *
+             *  The resulting multi-hypergraph is identical to the one obtained by adding the hyperedges one after another via addEdge(elements),
+             *  i.e., the hyperedges get consecutive IDs in the order in which they appear in the given collection. Adding the hyperedges at once
+             *  avoids re-sorting the neighborhoods of the affected vertices after each single hyperedge.
+             *
+             *  @note The default implementation adds the hyperedges one after another via addEdge(elements).
+             *
+             *  @param[in] edges    The endpoints of the new hyperedges.
+             */
+            virtual void addEdges(std::vector<std::vector<htd::vertex_t>> && edges);
+
             /**
              *  Add a new edge to the multi-hypergraph.
              *
@@ -176,6 +205,22 @@ namespace htd
     };
 
     inline htd::IMutableMultiHypergraph::~IMutableMultiHypergraph() { }
+
+    inline void htd::IMutableMultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+    {
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+        {
+            addEdge(edge.first, edge.second);
+        }
+    }
+
+    inline void htd::IMutableMultiHypergraph::addEdges(std::vector<std::vector<htd::vertex_t>> && edges)
+    {
+        for (std::vector<htd::vertex_t> & edge : edges)
+        {
+            addEdge(std::move(edge));
+        }
+    }
 }
 
 #endif /* HTD_HTD_IMUTABLEMULTIHYPERGRAPH_HPP */
@@ -29,6 +29,9 @@
 #include <htd/IMutableLabeledPath.hpp>
 #include <htd/IPathDecomposition.hpp>
 #include <htd/Label.hpp>
+#include <htd/InducedHyperedgeIndex.hpp>
+
+#include <memory>
 
 namespace htd
 {
@@ -141,6 +144,18 @@ namespace htd
              */
             virtual htd::FilteredHyperedgeCollection & mutableInducedHyperedges(htd::vertex_t vertex) = 0;
 
+            /**
+             *  Set the index which shall be used to compute the hyperedges induced by the bag contents lazily.
+             *
+             *  If an index is provided, the previously computed induced hyperedges of all vertices are discarded and
+             *  the induced hyperedges of each vertex are computed on the first access and cached afterwards. If the
+             *  null pointer is provided, the induced hyperedges of all vertices which were not accessed so far are
+             *  computed immediately.
+             *
+             *  @param[in] index    The index which shall be used to compute the induced hyperedges on demand.
+             */
+            virtual void setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index) = 0;
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             /**
              *  Create a deep copy of the current mutable path decomposition.
@@ -116,9 +116,48 @@ namespace htd
              *  @return The lower bound of the treewidth of the input graph.
              */
             virtual std::size_t minTreeWidth(void) const HTD_NOEXCEPT = 0;
+
+            /**
+             *  Getter for the maximum bag size induced by the partial vertex elimination ordering computed during the preprocessing phase.
+             *
+             *  In contrast to minTreeWidth(), the value is not a lower bound for the treewidth: It also covers the bags
+             *  of vertices which were eliminated heuristically, e.g., the vertices of the atoms which were eliminated
+             *  during the preprocessing phase. The value is at least minTreeWidth() + 1, so that it can be used as the
+             *  initial maximum bag size of an ordering which completes the partial vertex elimination ordering.
+             *
+             *  @note The default implementation returns minTreeWidth() + 1.
+             *
+             *  @return The maximum bag size induced by the partial vertex elimination ordering computed during the preprocessing phase.
+             */
+            virtual std::size_t eliminationSequenceBagSize(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the atoms (with 0-based IDs) of the graph which remained after the reduction rules of the preprocessing phase were applied.
+             *
+             *  An atom is a maximal connected subgraph without a clique separator. The atoms are listed in the order in
+             *  which their vertices were appended to the elimination sequence, the last atom corresponds to the set of
+             *  remaining vertices. If no atom decomposition was computed, the collection is empty.
+             *
+             *  @note The default implementation returns an empty collection.
+             *
+             *  @return The atoms (with 0-based IDs) of the graph which remained after the reduction rules of the preprocessing phase were applied.
+             */
+            virtual const std::vector<std::vector<htd::vertex_t>> & atoms(void) const HTD_NOEXCEPT;
     };
 
     inline htd::IPreprocessedGraph::~IPreprocessedGraph() { }
+
+    inline std::size_t htd::IPreprocessedGraph::eliminationSequenceBagSize(void) const HTD_NOEXCEPT
+    {
+        return minTreeWidth() + 1;
+    }
+
+    inline const std::vector<std::vector<htd::vertex_t>> & htd::IPreprocessedGraph::atoms(void) const HTD_NOEXCEPT
+    {
+        static const std::vector<std::vector<htd::vertex_t>> noAtoms;
+
+        return noAtoms;
+    }
 }
 
 #endif /* HTD_HTD_IPREPROCESSEDGRAPH_HPP */
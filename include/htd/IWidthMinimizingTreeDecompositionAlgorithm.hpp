@@ -32,6 +32,8 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
 
+#include <atomic>
+#include <cstddef>
 #include <vector>
 #include <functional>
 
@@ -192,10 +194,42 @@ namespace htd
                                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                            const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const = 0;
 
+            /**
+             *  Getter for the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  @return The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound is used.
+             */
+            virtual const std::atomic<std::size_t> * sharedMaximumBagSize(void) const;
+
+            /**
+             *  Set the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  The shared bound holds the smallest maximum bag size found so far by any of the algorithms. Algorithms
+             *  supporting a shared bound tighten the limits of their iterations so that only decompositions with a
+             *  maximum bag size strictly below the shared bound are searched for.
+             *
+             *  @note The default implementation ignores the shared bound.
+             *
+             *  @note The shared bound is not owned by the algorithm and it is not copied when the algorithm is cloned.
+             *
+             *  @param[in] sharedMaximumBagSize The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound shall be used.
+             */
+            virtual void setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize);
+
             virtual IWidthMinimizingTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE = 0;
     };
 
     inline htd::IWidthMinimizingTreeDecompositionAlgorithm::~IWidthMinimizingTreeDecompositionAlgorithm() { }
+
+    inline const std::atomic<std::size_t> * htd::IWidthMinimizingTreeDecompositionAlgorithm::sharedMaximumBagSize(void) const
+    {
+        return nullptr;
+    }
+
+    inline void htd::IWidthMinimizingTreeDecompositionAlgorithm::setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize)
+    {
+        HTD_UNUSED(sharedMaximumBagSize)
+    }
 }
 
 #endif /* HTD_HTD_IWIDTHMINIMIZINGTREEDECOMPOSITIONALGORITHM_HPP */
@@ -0,0 +1,90 @@
+/* 
+ * File:   InducedHyperedgeIndex.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDUCEDHYPEREDGEINDEX_HPP
+#define HTD_HTD_INDUCEDHYPEREDGEINDEX_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/FilteredHyperedgeCollection.hpp>
+#include <htd/IMultiHypergraph.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Index which allows to compute the hyperedges induced by an arbitrary set of vertices on demand.
+     *
+     *  Each hyperedge of the graph is registered at its smallest endpoint, so determining the hyperedges induced by a
+     *  bag only requires to inspect the hyperedges registered at the vertices of the bag. The index shares the
+     *  hyperedges with the graph, hence it remains valid after the graph was destroyed.
+     */
+    class InducedHyperedgeIndex
+    {
+        public:
+            /**
+             *  Constructor for a new index of the hyperedges of the given graph.
+             *
+             *  @param[in] graph    The graph whose hyperedges shall be indexed.
+             */
+            HTD_API InducedHyperedgeIndex(const htd::IMultiHypergraph & graph);
+
+            /**
+             *  Copy constructor for an index of induced hyperedges.
+             *
+             *  @param[in] original The original index of induced hyperedges.
+             */
+            HTD_API InducedHyperedgeIndex(const InducedHyperedgeIndex & original) = delete;
+
+            /**
+             *  Copy assignment operator for an index of induced hyperedges.
+             *
+             *  @param[in] original The original index of induced hyperedges.
+             */
+            HTD_API InducedHyperedgeIndex & operator=(const InducedHyperedgeIndex & original) = delete;
+
+            /**
+             *  Destructor of an index of induced hyperedges.
+             */
+            HTD_API virtual ~InducedHyperedgeIndex();
+
+            /**
+             *  Compute the hyperedges whose endpoints are a subset of the given vertices.
+             *
+             *  @param[in] vertices The vertices, e.g., the content of a bag, which act as a filter for the hyperedges.
+             *
+             *  @return The hyperedges whose endpoints are a subset of the given vertices, in the order of their
+             *  positions within the indexed graph.
+             */
+            HTD_API htd::FilteredHyperedgeCollection inducedHyperedges(const std::vector<htd::vertex_t> & vertices) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_INDUCEDHYPEREDGEINDEX_HPP */
@@ -48,6 +48,16 @@ namespace htd
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithm and the given manipulations (or nullptr) also if it was interrupted
      *  by a call to htd::LibraryInstance::terminate().
+     *
+     *  @note If the thread count is greater than one, the iterations are distributed among the given number of
+     *  threads. Each thread works on a copy of the base algorithm, the fitness function and the manipulation
+     *  operations which is associated with its own management instance (see htd::LibraryInstance::copyFactoryConfiguration())
+     *  and each iteration draws its random numbers from the generator of that management instance, re-seeded with
+     *  a value which only depends on the iteration index and a base seed drawn from the random number generator of
+     *  the algorithm's management instance (see htd::LibraryInstance::randomNumberGenerator()). The results
+     *  of the iterations are evaluated strictly in the order of their iteration index, hence the progress callback,
+     *  the non-improvement limit and the selection of the best decomposition behave as if the iterations were
+     *  performed sequentially and the result for a fixed seed does not depend on the number of threads.
      */
     class IterativeImprovementTreeDecompositionAlgorithm : public htd::ICustomizedTreeDecompositionAlgorithm
     {
@@ -187,6 +197,22 @@ namespace htd
              */
             HTD_API void setNonImprovementLimit(std::size_t nonImprovementLimit);
 
+            /**
+             *  Getter for the number of threads which shall be used to perform the iterations.
+             *
+             *  @return The number of threads which shall be used to perform the iterations.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to perform the iterations.
+             *
+             *  @note If the thread count is set to 1 (default), all iterations are performed in the calling thread.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to perform the iterations.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
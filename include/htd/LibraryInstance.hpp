@@ -26,11 +26,17 @@
 #define HTD_HTD_LIBRARYINSTANCE_HPP
 
 #include <htd/Id.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 
 #include <memory>
 
 namespace htd
 {
+    /**
+     *  Forward declaration of class htd::Statistics.
+     */
+    class Statistics;
+
     /**
      *  Forward declaration of factory class htd::ConnectedComponentAlgorithmFactory.
      */
@@ -173,6 +179,15 @@ namespace htd
 
     /**
      *  Central management class of a library instance.
+     *
+     *  Thread safety: The methods id(), isTerminated(), terminate() and reset() may be called from any thread at any time.
+     *  The factory classes of a management instance may be used concurrently from any number of threads to create new
+     *  objects, even while another thread replaces their construction templates. All other state which is modified when
+     *  running algorithms, in particular the random number generator, belongs to a single thread. Hence, each thread which
+     *  runs algorithms should use its own management instance, which can be obtained from a shared, fully configured
+     *  management instance via htd::cloneManagementInstance(). Objects created via the factories of the shared management
+     *  instance can be moved to the management instance of the current thread via setManagementInstance(). The library
+     *  does not use any global mutable state, hence independent management instances never interfere with each other.
      */
     class LibraryInstance
     {
@@ -196,6 +211,20 @@ namespace htd
              */
             HTD_API void initializeFactoryClasses(const htd::LibraryInstance * const manager);
 
+            /**
+             *  Replace the construction templates of all factory classes of the management instance
+             *  by copies of the construction templates used by the factory classes of the given
+             *  management instance.
+             *
+             *  This allows to set up an independent management instance, e.g. for a worker thread,
+             *  which creates the same types of objects as the original management instance.
+             *
+             *  @param[in] original The management instance from which the factory configuration shall be copied.
+             *
+             *  @note The factory classes of the current management instance must be initialized before calling this method.
+             */
+            HTD_API void copyFactoryConfiguration(const htd::LibraryInstance & original);
+
             /**
              *  Getter for the ID of the management instance.
              *
@@ -204,9 +233,14 @@ namespace htd
             HTD_API htd::id_t id(void) const;
 
             /**
-             *  Check whether the terminate(int) function was called.
+             *  Check whether the terminate(int) function was called or one of the budgets of the management instance is exhausted.
              *
-             *  @return True if the terminate(int) function was called, false otherwise.
+             *  If a time limit or a memory limit is set, every 16th call compares the elapsed time and every 1024th call compares
+             *  the current memory usage of the process against the respective limit. When a budget is exhausted, the management
+             *  instance is terminated just like by a call to terminate(), so that running algorithms stop and return the best
+             *  complete result found so far, if any.
+             *
+             *  @return True if the terminate(int) function was called or a budget is exhausted, false otherwise.
              */
             HTD_API bool isTerminated(void) const;
 
@@ -219,6 +253,9 @@ namespace htd
              *  @note After calling this method, no further algorithms from the library associated
              *  with the current library instance shall be run until the reset() method is called,
              *  otherwise the outcome of the algorithms is undefined!
+             *
+             *  @note The termination flag is stored atomically, hence this method may be called
+             *  from another thread (or a signal handler) while algorithms are running.
              */
             HTD_API void terminate(void);
 
@@ -228,9 +265,97 @@ namespace htd
              *  Calling this method sets the value of isTerminated() back to false.
              *  This allows to re-run the library's algorithms after terminate()
              *  was called.
+             *
+             *  @note The time limit and the memory limit are not affected by this method, i.e., an exhausted budget
+             *  terminates the management instance again at the next check unless a new limit is set.
              */
             HTD_API void reset(void);
 
+            /**
+             *  Getter for the time limit of the management instance.
+             *
+             *  @return The number of milliseconds which were granted by the last call to setTimeLimit() or (std::size_t)-1 if no time limit is set.
+             */
+            HTD_API std::size_t timeLimit(void) const;
+
+            /**
+             *  Getter for the remaining time of the management instance.
+             *
+             *  @return The number of milliseconds until the time limit is reached (rounded up), 0 if the time limit was already reached or (std::size_t)-1 if no time limit is set.
+             */
+            HTD_API std::size_t remainingTime(void) const;
+
+            /**
+             *  Set the wall-clock time which may be spent by the algorithms of the management instance, starting from now.
+             *
+             *  @param[in] milliseconds The time limit in milliseconds or (std::size_t)-1 if no time limit shall be used.
+             *
+             *  @note The limits must not be changed while algorithms associated with the management instance are running.
+             */
+            HTD_API void setTimeLimit(std::size_t milliseconds);
+
+            /**
+             *  Getter for the memory limit of the management instance.
+             *
+             *  @return The maximum memory usage of the process in bytes or (std::size_t)-1 if no memory limit is set.
+             */
+            HTD_API std::size_t memoryLimit(void) const;
+
+            /**
+             *  Set the current memory usage of the process (see htd::currentMemoryUsage()) above which the algorithms of the management instance shall stop.
+             *
+             *  The current memory usage decreases again when memory is released, hence a memory spike of an earlier computation
+             *  does not exhaust the budget of later computations.
+             *
+             *  @param[in] bytes    The memory limit in bytes or (std::size_t)-1 if no memory limit shall be used.
+             *
+             *  @note The limits must not be changed while algorithms associated with the management instance are running.
+             *
+             *  @note The memory usage is only available on POSIX systems. On other platforms, the memory limit has no effect.
+             */
+            HTD_API void setMemoryLimit(std::size_t bytes);
+
+            /**
+             *  Check whether the management instance was terminated because its time limit or its memory limit was exhausted.
+             *
+             *  @return True if the management instance was terminated because of an exhausted budget, false otherwise.
+             */
+            HTD_API bool isBudgetExhausted(void) const;
+
+            /**
+             *  Access the random number generator of the management instance.
+             *
+             *  All random choices made by the algorithms of the library associated with the management instance are taken
+             *  from this generator, so that the results of the algorithms are reproducible after re-seeding the generator
+             *  and independent of algorithms running concurrently on other management instances. Initially, the generator
+             *  is seeded with the ID of the management instance.
+             *
+             *  @note The generator is not thread-safe, hence algorithms sharing a management instance must not run concurrently.
+             *
+             *  @return The random number generator of the management instance.
+             */
+            HTD_API htd::RandomNumberGenerator & randomNumberGenerator(void) const;
+
+            /**
+             *  Access the statistics attached to the management instance.
+             *
+             *  @return The statistics attached to the management instance or nullptr if no statistics shall be collected.
+             */
+            HTD_API htd::Statistics * statistics(void) const;
+
+            /**
+             *  Attach statistics to the management instance.
+             *
+             *  The algorithms associated with the management instance record the resources spent in the different
+             *  phases of the decomposition process and the values of their performance counters in the given statistics.
+             *
+             *  @note The management instance does not take ownership of the statistics, so that they can be shared with
+             *  clones of the management instance. The statistics must outlive all algorithms using them.
+             *
+             *  @param[in] statistics   The statistics which shall be attached or nullptr if no statistics shall be collected.
+             */
+            HTD_API void setStatistics(htd::Statistics * statistics);
+
             /**
              *  Access the factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
              */
@@ -32,6 +32,11 @@ namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the maximum-cardinality search elimination ordering algorithm.
+     *
+     *  The vertices are kept in buckets indexed by their weight and the neighborhoods of the preprocessed graph are
+     *  never modified, so the ordering is computed in O(n + m) time for a graph with n vertices and m edges as long
+     *  as no weight reaches htd::BucketPriorityQueue::denseLimit(). Weights beyond that limit, i.e., vertices with
+     *  that many numbered neighbors, are kept in a heap, which adds a logarithmic factor to their updates.
      */
     class MaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
     {
@@ -32,6 +32,11 @@ namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the minimum-fill elimination ordering algorithm.
+     *
+     *  @note For dense graphs, i.e., graphs whose density is at least densityThreshold(), the sizes of the intersections
+     *  and differences of neighborhoods required for updating the fill values are computed based on an additional
+     *  representation of the neighborhoods as packed bitsets. Because the bitset representation only affects how the
+     *  fill values are computed, the resulting ordering is identical to the one obtained without it for the same seed.
      */
     class MinFillOrderingAlgorithm : public htd::IWidthLimitableOrderingAlgorithm
     {
@@ -53,6 +58,24 @@ namespace htd
 
             HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Getter for the minimum density of the preprocessed input graph for which the fill values are computed based on packed bitsets.
+             *
+             *  @return The minimum density of the preprocessed input graph for which the fill values are computed based on packed bitsets.
+             */
+            HTD_API double densityThreshold(void) const;
+
+            /**
+             *  Set the minimum density of the preprocessed input graph for which the fill values are computed based on packed bitsets.
+             *
+             *  The density of a graph with n vertices and m edges is defined as 2m / (n * (n - 1)) and the default threshold is 0.1. A value greater than 1 disables
+             *  the bitset representation. Independent of the given threshold, the bitset representation is only used for graphs with
+             *  at most 16384 vertices in order to limit the memory consumption.
+             *
+             *  @param[in] densityThreshold The minimum density of the preprocessed input graph for which the fill values are computed based on packed bitsets.
+             */
+            HTD_API void setDensityThreshold(double densityThreshold);
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -31,6 +31,22 @@ namespace htd
 {
     /**
      *  Implementation of the IGraphSeparatorAlgorithm interface which computes minimimal separating vertex sets.
+     *
+     *  For each pair of non-adjacent vertices, a maximum flow in the vertex-split flow network is computed and the
+     *  vertices of the minimum cut closest to the first vertex of the pair form a candidate. The smallest candidate
+     *  is returned, ties are broken in favor of the pair which comes first. Flow computations which cannot lead to a
+     *  smaller candidate than the best one found so far are aborted early and, following Even's algorithm for vertex
+     *  connectivity, only the pairs whose first vertex is among the first k + 1 vertices are considered, where k is
+     *  the size of the best candidate found so far.
+     *
+     *  If the common neighbors of some pair of non-adjacent vertices separate the pair and their number equals the
+     *  size of the smallest candidate, the common neighbors of the first such pair are returned instead. These are
+     *  the separators which the previous implementation returned whenever its result was a minimum separator. Where
+     *  the previous implementation returned a set of vertices which is not a minimum separator, the minimum cut is
+     *  returned instead.
+     *
+     *  @note If the thread count is greater than one, the vertex pairs are distributed among the given number of
+     *  threads. The result does not depend on the number of threads.
      */
     class MinimumSeparatorAlgorithm : public htd::IGraphSeparatorAlgorithm
     {
@@ -53,6 +69,22 @@ namespace htd
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
 
+            /**
+             *  Getter for the number of threads which shall be used to process the vertex pairs.
+             *
+             *  @return The number of threads which shall be used to process the vertex pairs.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the number of threads which shall be used to process the vertex pairs.
+             *
+             *  @note If the thread count is set to 1 (default), all vertex pairs are processed in the calling thread.
+             *
+             *  @param[in] threadCount  The number of threads which shall be used to process the vertex pairs.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
             HTD_API MinimumSeparatorAlgorithm * clone(void) const HTD_OVERRIDE;
 
         private:
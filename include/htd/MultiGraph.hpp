@@ -145,6 +145,8 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_OVERRIDE;
 
+            HTD_API void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) HTD_OVERRIDE;
+
             HTD_API void removeEdge(htd::id_t edgeId) HTD_OVERRIDE;
 
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
@@ -163,6 +163,10 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::Hyperedge && hyperedge) HTD_OVERRIDE;
 
+            HTD_API void addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) HTD_OVERRIDE;
+
+            HTD_API void addEdges(std::vector<std::vector<htd::vertex_t>> && edges) HTD_OVERRIDE;
+
             HTD_API void removeEdge(htd::id_t edgeId) HTD_OVERRIDE;
 
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
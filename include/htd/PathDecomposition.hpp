@@ -26,11 +26,13 @@
 #define HTD_HTD_PATHDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/DenseVertexMap.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/IMutablePathDecomposition.hpp>
 #include <htd/LabeledPath.hpp>
 
-#include <unordered_map>
+#include <memory>
+#include <mutex>
 
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
@@ -154,6 +156,10 @@ namespace htd
 
             HTD_API const htd::FilteredHyperedgeCollection & inducedHyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
 
+            HTD_API void evictInducedHyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index) HTD_OVERRIDE;
+
             HTD_API std::size_t forgottenVertexCount(htd::vertex_t vertex) const HTD_OVERRIDE;
 
             HTD_API std::size_t forgottenVertexCount(htd::vertex_t vertex, htd::vertex_t child) const HTD_OVERRIDE;
@@ -293,9 +299,23 @@ namespace htd
 #endif
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
+            htd::DenseVertexMap<std::vector<htd::vertex_t>> bagContent_;
+
+            mutable htd::DenseVertexMap<htd::FilteredHyperedgeCollection> inducedEdges_;
+
+            std::shared_ptr<htd::InducedHyperedgeIndex> inducedHyperedgeIndex_;
+
+            mutable std::mutex inducedEdgesMutex_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            /**
+             *  Access the hyperedges induced by the bag content of a specific vertex and compute them via the index of
+             *  induced hyperedges if they are not cached yet.
+             *
+             *  @param[in] vertex   The vertex for which the induced hyperedges shall be returned.
+             *
+             *  @return The collection of hyperedges induced by the bag content of the specific vertex.
+             */
+            htd::FilteredHyperedgeCollection & lazyInducedHyperedges(htd::vertex_t vertex) const;
     };
 }
 
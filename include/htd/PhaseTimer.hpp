@@ -0,0 +1,134 @@
+/* 
+ * File:   PhaseTimer.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_PHASETIMER_HPP
+#define HTD_HTD_PHASETIMER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/LibraryInstance.hpp>
+#include <htd/Statistics.hpp>
+
+#include <cstdint>
+
+namespace htd
+{
+    /**
+     *  Scope guard measuring the resources spent in a phase of the decomposition process.
+     *
+     *  On construction, the timer captures the wall-clock time as well as the CPU time and the number of reported memory
+     *  allocations of the calling thread. When the timer is stopped or destroyed, the differences are recorded for the phase
+     *  in the statistics attached to the management instance. If no statistics are attached, the timer does nothing.
+     *
+     *  Timers of the same thread may be nested. The resources spent in a nested timer are only recorded for the phase
+     *  of the nested timer, so that the phases add up to the total resources spent.
+     *
+     *  @note The timers of a thread must be stopped in reverse order of their construction.
+     */
+    class PhaseTimer
+    {
+        public:
+            /**
+             *  Constructor for a new phase timer.
+             *
+             *  @param[in] instance The management instance whose statistics shall be updated.
+             *  @param[in] phase    The phase which shall be measured.
+             */
+            HTD_API PhaseTimer(const htd::LibraryInstance & instance, std::size_t phase);
+
+            /**
+             *  Destructor of the phase timer which stops the timer if it is still running.
+             */
+            HTD_API virtual ~PhaseTimer();
+
+            /**
+             *  Copy constructor for a phase timer.
+             *
+             *  @param[in] original The original phase timer which shall be copied.
+             */
+            PhaseTimer(const PhaseTimer & original) = delete;
+
+            /**
+             *  Copy assignment operator for a phase timer.
+             *
+             *  @param[in] original The original phase timer which shall be copied.
+             */
+            PhaseTimer & operator=(const PhaseTimer & original) = delete;
+
+            /**
+             *  Stop the timer and record the measured resources.
+             *
+             *  Subsequent calls have no effect.
+             */
+            HTD_API void stop(void);
+
+        private:
+            /**
+             *  The statistics which shall be updated or nullptr if the timer is not running.
+             */
+            htd::Statistics * statistics_;
+
+            /**
+             *  The measured phase.
+             */
+            std::size_t phase_;
+
+            /**
+             *  The timer of the enclosing phase on the same thread or nullptr if there is no enclosing phase.
+             */
+            PhaseTimer * parent_;
+
+            /**
+             *  The wall-clock time at the start of the phase in nanoseconds.
+             */
+            std::uint64_t wallTime_;
+
+            /**
+             *  The CPU time of the calling thread at the start of the phase in nanoseconds.
+             */
+            std::uint64_t cpuTime_;
+
+            /**
+             *  The number of reported memory allocations at the start of the phase.
+             */
+            std::size_t allocationCount_;
+
+            /**
+             *  The wall-clock time spent in nested phases in nanoseconds.
+             */
+            std::uint64_t nestedWallTime_;
+
+            /**
+             *  The CPU time spent in nested phases in nanoseconds.
+             */
+            std::uint64_t nestedCpuTime_;
+
+            /**
+             *  The number of memory allocations performed in nested phases.
+             */
+            std::size_t nestedAllocationCount_;
+    };
+}
+
+#endif /* HTD_HTD_PHASETIMER_HPP */
@@ -191,6 +191,26 @@ namespace htd
 
             HTD_API std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            HTD_API std::size_t eliminationSequenceBagSize(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Set the maximum bag size induced by the partial vertex elimination ordering computed during the preprocessing phase.
+             *
+             *  @note Values smaller than minTreeWidth() + 1 have no effect on the result of eliminationSequenceBagSize().
+             *
+             *  @param[in] bagSize  The maximum bag size induced by the partial vertex elimination ordering computed during the preprocessing phase.
+             */
+            HTD_API void setEliminationSequenceBagSize(std::size_t bagSize);
+
+            HTD_API const std::vector<std::vector<htd::vertex_t>> & atoms(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Set the atoms (with 0-based IDs) of the graph which remained after the reduction rules of the preprocessing phase were applied.
+             *
+             *  @param[in] atoms    The atoms (with 0-based IDs) of the graph which remained after the reduction rules of the preprocessing phase were applied.
+             */
+            HTD_API void setAtoms(std::vector<std::vector<htd::vertex_t>> && atoms);
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API PreprocessedGraph * clone(void) const HTD_OVERRIDE;
 #else
@@ -29,15 +29,74 @@
 
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
 namespace htd
 {
+    /**
+     *  Traits deciding at compile time whether a priority queue with the given priority type and comparison operator can be based on an array of buckets.
+     *
+     *  Bucket-based storage is only possible if the priorities are unsigned integers and the order of the priorities is known, i.e., if the
+     *  comparison operator is either std::less (largest priority on top) or std::greater (smallest priority on top).
+     */
+    template < typename PriorityType, typename Compare >
+    struct PriorityQueueTraits
+    {
+        /**
+         *  A boolean flag indicating whether the priority queue can be based on an array of buckets.
+         */
+        static constexpr bool denseBuckets = false;
+
+        /**
+         *  A boolean flag indicating whether the largest priority is on top of the priority queue.
+         */
+        static constexpr bool topIsMaximum = false;
+    };
+
+    /**
+     *  Traits of a priority queue which keeps the elements with the largest priority on top.
+     */
+    template < typename PriorityType >
+    struct PriorityQueueTraits<PriorityType, std::less<PriorityType>>
+    {
+        /**
+         *  A boolean flag indicating whether the priority queue can be based on an array of buckets.
+         */
+        static constexpr bool denseBuckets = std::is_integral<PriorityType>::value && std::is_unsigned<PriorityType>::value;
+
+        /**
+         *  A boolean flag indicating whether the largest priority is on top of the priority queue.
+         */
+        static constexpr bool topIsMaximum = true;
+    };
+
+    /**
+     *  Traits of a priority queue which keeps the elements with the smallest priority on top.
+     */
+    template < typename PriorityType >
+    struct PriorityQueueTraits<PriorityType, std::greater<PriorityType>>
+    {
+        /**
+         *  A boolean flag indicating whether the priority queue can be based on an array of buckets.
+         */
+        static constexpr bool denseBuckets = std::is_integral<PriorityType>::value && std::is_unsigned<PriorityType>::value;
+
+        /**
+         *  A boolean flag indicating whether the largest priority is on top of the priority queue.
+         */
+        static constexpr bool topIsMaximum = false;
+    };
+
     /**
      *  Flexible priority queue allowing to efficiently access values of identical priority.
+     *
+     *  @note The primary template is based on a binary heap of collections of elements with identical priority.
+     *  Callers which satisfy the preconditions of the bucket-based specialization can opt in to it by setting
+     *  DenseBuckets to true (see htd::BucketPriorityQueue).
      */
-    template < typename ValueType, typename PriorityType, typename Compare = std::less<PriorityType>, typename Equality = std::equal_to<PriorityType> >
+    template < typename ValueType, typename PriorityType, typename Compare = std::less<PriorityType>, typename Equality = std::equal_to<PriorityType>, bool DenseBuckets = false >
     class PriorityQueue
     {
         public:
@@ -576,6 +635,437 @@ namespace htd
                 return ret;
             }
     };
+
+    /**
+     *  Flexible priority queue allowing to efficiently access values of identical priority.
+     *
+     *  This specialization is intended for integral elements with unsigned integral priorities, e.g., vertices and their
+     *  fill-in values or degrees as used by the elimination ordering algorithms. Each priority below denseLimit() is
+     *  mapped directly to its own bucket and the position of each element within its bucket is stored in a vector
+     *  indexed by the element, so that push(), pop(), topCollection(), erase(value, priority) and updatePriority()
+     *  run in constant time (amortized, and apart from advancing the top priority over empty buckets). Elements with
+     *  larger priorities are stored in a heap-based priority queue to keep the memory consumption of the bucket array
+     *  bounded.
+     *
+     *  The specialization is opt-in and requires the following preconditions, which are checked by assertions where
+     *  this is possible in constant time:
+     *
+     *  - Each element is contained in the priority queue at most once.
+     *  - The elements are small non-negative integers, because the memory consumption is proportional to the largest element.
+     *  - The priorities are compared by value, i.e., the Equality parameter is ignored.
+     *
+     *  Operations on elements with priorities of at least denseLimit() take logarithmic time, so bounds relying on
+     *  constant-time updates only hold as long as the priorities stay below that limit.
+     *
+     *  @note In contrast to the heap-based priority queue, removing an element from a collection of elements with
+     *  identical priority moves the last element of the collection to the position of the removed element.
+     */
+    template < typename ValueType, typename PriorityType, typename Compare, typename Equality >
+    class PriorityQueue<ValueType, PriorityType, Compare, Equality, true>
+    {
+        static_assert(std::is_integral<ValueType>::value && htd::PriorityQueueTraits<PriorityType, Compare>::denseBuckets,
+                      "The bucket-based priority queue requires integral elements and unsigned integral priorities compared via std::less or std::greater.");
+
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             */
+            PriorityQueue(void) : buckets_(), positions_(), topPriority_(0), denseSize_(0), overflow_()
+            {
+
+            }
+
+            /**
+             *  Destructor of a priority queue.
+             */
+            ~PriorityQueue(void)
+            {
+
+            }
+
+            /**
+             *  Getter for the smallest priority which is stored in the heap-based part of the priority queue.
+             *
+             *  @return The smallest priority which is stored in the heap-based part of the priority queue.
+             */
+            static constexpr std::size_t denseLimit(void)
+            {
+                return 65536;
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return denseSize_ == 0 && overflow_.empty();
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return denseSize_ + overflow_.size();
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(!empty())
+
+                return topCollection()[0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            const PriorityType & topPriority(void) const
+            {
+                HTD_ASSERT(!empty())
+
+                return isTopDense() ? topPriority_ : overflow_.topPriority();
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(!empty())
+
+                return isTopDense() ? buckets_[topPriority_] : overflow_.topCollection();
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, const PriorityType & priority)
+            {
+                if (priority < denseLimit())
+                {
+                    HTD_ASSERT(static_cast<std::size_t>(value) >= positions_.size() || positions_[static_cast<std::size_t>(value)] == (std::size_t)-1)
+
+                    insertIntoBucket(value, priority);
+                }
+                else
+                {
+                    overflow_.push(value, priority);
+                }
+            }
+
+            /**
+             *  Remove the top element.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(!empty())
+
+                if (isTopDense())
+                {
+                    removeFromBucket(0, topPriority_);
+                }
+                else
+                {
+                    overflow_.pop();
+                }
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                bool ret = false;
+
+                for (std::size_t priority = 0; !ret && priority < buckets_.size(); ++priority)
+                {
+                    ret = eraseFromBucket(value, priority);
+                }
+
+                if (!ret)
+                {
+                    ret = overflow_.erase(value);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the collection of elements with the given priority.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *  @param[in] priority The priority of the element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the collection of elements with the given priority, false otherwise.
+             */
+            bool erase(const ValueType & value, const PriorityType & priority)
+            {
+                bool ret = false;
+
+                if (priority < denseLimit())
+                {
+                    if (priority < buckets_.size())
+                    {
+                        ret = eraseFromBucket(value, priority);
+                    }
+                }
+                else
+                {
+                    ret = overflow_.erase(value, priority);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                HTD_ASSERT(!empty())
+
+                return isTopDense() ? eraseFromBucket(value, topPriority_) : overflow_.eraseFromTopCollection(value);
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] oldPriority  The old priority of the element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, const PriorityType & oldPriority, const PriorityType & newPriority)
+            {
+                if (oldPriority != newPriority)
+                {
+                    if (oldPriority < denseLimit() && newPriority < denseLimit())
+                    {
+                        HTD_ASSERT(isInBucket(value, oldPriority))
+
+                        /* Insert the element into the new bucket first so that the top priority never needs to be searched for if the old bucket becomes empty. */
+                        std::size_t oldPosition = positions_[static_cast<std::size_t>(value)];
+
+                        insertIntoBucket(value, newPriority);
+
+                        std::size_t newPosition = positions_[static_cast<std::size_t>(value)];
+
+                        removeFromBucket(oldPosition, oldPriority);
+
+                        positions_[static_cast<std::size_t>(value)] = newPosition;
+                    }
+                    else if (oldPriority >= denseLimit() && newPriority >= denseLimit())
+                    {
+                        overflow_.updatePriority(value, oldPriority, newPriority);
+                    }
+                    else
+                    {
+                        if (oldPriority < denseLimit())
+                        {
+                            eraseFromBucket(value, oldPriority);
+                        }
+                        else
+                        {
+                            overflow_.erase(value, oldPriority);
+                        }
+
+                        push(value, newPriority);
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  The collections of elements with identical priority, indexed by the priority.
+             */
+            std::vector<std::vector<ValueType>> buckets_;
+
+            /**
+             *  The position of each element stored in the bucket array within its bucket, indexed by the element. Elements which are not stored in the bucket array have position (std::size_t)-1.
+             */
+            std::vector<std::size_t> positions_;
+
+            /**
+             *  The top priority among the elements stored in the bucket array.
+             */
+            PriorityType topPriority_;
+
+            /**
+             *  The number of elements stored in the bucket array.
+             */
+            std::size_t denseSize_;
+
+            /**
+             *  The heap-based priority queue storing the elements with a priority of at least denseLimit().
+             */
+            htd::PriorityQueue<ValueType, PriorityType, Compare, Equality, false> overflow_;
+
+            /**
+             *  Check whether the first priority shall be placed above the second priority.
+             *
+             *  @param[in] priority1    The first priority.
+             *  @param[in] priority2    The second priority.
+             *
+             *  @return True if the first priority shall be placed above the second priority, false otherwise.
+             */
+            static bool isPreferred(const PriorityType & priority1, const PriorityType & priority2)
+            {
+                return htd::PriorityQueueTraits<PriorityType, Compare>::topIsMaximum ? priority1 > priority2 : priority1 < priority2;
+            }
+
+            /**
+             *  Check whether the top collection is stored in the bucket array.
+             *
+             *  @return True if the top collection is stored in the bucket array, false otherwise.
+             */
+            bool isTopDense(void) const
+            {
+                return denseSize_ > 0 && (overflow_.empty() || !htd::PriorityQueueTraits<PriorityType, Compare>::topIsMaximum);
+            }
+
+            /**
+             *  Check whether the given element is stored in the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be checked.
+             *  @param[in] priority The priority of the bucket.
+             *
+             *  @return True if the given element is stored in the bucket of the given priority, false otherwise.
+             */
+            bool isInBucket(const ValueType & value, std::size_t priority) const
+            {
+                std::size_t index = static_cast<std::size_t>(value);
+
+                return priority < buckets_.size() && index < positions_.size() && positions_[index] < buckets_[priority].size() && buckets_[priority][positions_[index]] == value;
+            }
+
+            /**
+             *  Insert the given element into the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the bucket into which the element shall be inserted.
+             */
+            void insertIntoBucket(const ValueType & value, std::size_t priority)
+            {
+                std::size_t index = static_cast<std::size_t>(value);
+
+                if (priority >= buckets_.size())
+                {
+                    buckets_.resize(priority + 1);
+                }
+
+                if (index >= positions_.size())
+                {
+                    positions_.resize(index + 1, (std::size_t)-1);
+                }
+
+                std::vector<ValueType> & bucket = buckets_[priority];
+
+                positions_[index] = bucket.size();
+
+                bucket.push_back(value);
+
+                if (denseSize_ == 0 || isPreferred(static_cast<PriorityType>(priority), topPriority_))
+                {
+                    topPriority_ = static_cast<PriorityType>(priority);
+                }
+
+                ++denseSize_;
+            }
+
+            /**
+             *  Remove the element at the given position from the bucket of the given priority.
+             *
+             *  @param[in] position The position of the element within the bucket.
+             *  @param[in] priority The priority of the bucket from which the element shall be removed.
+             */
+            void removeFromBucket(std::size_t position, std::size_t priority)
+            {
+                std::vector<ValueType> & bucket = buckets_[priority];
+
+                positions_[static_cast<std::size_t>(bucket[position])] = (std::size_t)-1;
+
+                if (position + 1 < bucket.size())
+                {
+                    bucket[position] = bucket.back();
+
+                    positions_[static_cast<std::size_t>(bucket[position])] = position;
+                }
+
+                bucket.pop_back();
+
+                --denseSize_;
+
+                if (denseSize_ > 0 && bucket.empty() && priority == topPriority_)
+                {
+                    /* All non-empty buckets are placed below the current top priority, hence the search only needs to visit the buckets in one direction. */
+                    if (htd::PriorityQueueTraits<PriorityType, Compare>::topIsMaximum)
+                    {
+                        while (buckets_[topPriority_].empty())
+                        {
+                            --topPriority_;
+                        }
+                    }
+                    else
+                    {
+                        while (buckets_[topPriority_].empty())
+                        {
+                            ++topPriority_;
+                        }
+                    }
+                }
+            }
+
+            /**
+             *  Erase the specific element from the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *  @param[in] priority The priority of the bucket from which the element shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the given bucket, false otherwise.
+             */
+            bool eraseFromBucket(const ValueType & value, std::size_t priority)
+            {
+                bool ret = isInBucket(value, priority);
+
+                if (ret)
+                {
+                    removeFromBucket(positions_[static_cast<std::size_t>(value)], priority);
+                }
+
+                return ret;
+            }
+    };
+
+    /**
+     *  Bucket-based priority queue for integral elements with unsigned integral priorities.
+     *
+     *  @note See the documentation of the DenseBuckets specialization of htd::PriorityQueue for the preconditions.
+     */
+    template < typename ValueType, typename PriorityType, typename Compare = std::less<PriorityType> >
+    using BucketPriorityQueue = htd::PriorityQueue<ValueType, PriorityType, Compare, std::equal_to<PriorityType>, true>;
 }
 
 #endif /* HTD_HTD_PRIORITYQUEUE_HPP */
@@ -0,0 +1,224 @@
+/* 
+ * File:   RandomNumberGenerator.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+#define HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace htd
+{
+    /**
+     *  Fast pseudo-random number generator implementing the xoshiro256** algorithm by Blackman and Vigna.
+     *
+     *  The generator satisfies the requirements of a uniform random bit generator, hence it can be passed to the
+     *  algorithms and distributions of the standard library. The state is derived from a single 64-bit seed via the
+     *  SplitMix64 algorithm, so that generators seeded with consecutive numbers produce unrelated sequences. Independent
+     *  streams can be obtained either by seeding copies of the generator with different seeds or by calling split(),
+     *  which hands out non-overlapping subsequences of length 2^128 of the current sequence.
+     *
+     *  @note A generator is not thread-safe. Each thread must use its own generator, e.g. the one of its own
+     *  htd::LibraryInstance.
+     */
+    class RandomNumberGenerator
+    {
+        public:
+            /**
+             *  The type of the numbers produced by the generator.
+             */
+            typedef std::uint64_t result_type;
+
+            /**
+             *  Constructor for a new random number generator.
+             *
+             *  @param[in] seed The seed of the new random number generator.
+             */
+            explicit RandomNumberGenerator(std::uint64_t seed = 0)
+            {
+                this->seed(seed);
+            }
+
+            /**
+             *  Reset the state of the random number generator so that it produces the sequence determined by the given seed.
+             *
+             *  @param[in] seed The new seed of the random number generator.
+             */
+            void seed(std::uint64_t seed)
+            {
+                for (std::uint64_t & word : state_)
+                {
+                    seed += 0x9E3779B97F4A7C15ULL;
+
+                    std::uint64_t value = seed;
+
+                    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+                    word = value ^ (value >> 31);
+                }
+            }
+
+            /**
+             *  Getter for the smallest number the random number generator produces.
+             *
+             *  @return The smallest number the random number generator produces.
+             */
+            static constexpr result_type min(void)
+            {
+                return 0;
+            }
+
+            /**
+             *  Getter for the largest number the random number generator produces.
+             *
+             *  @return The largest number the random number generator produces.
+             */
+            static constexpr result_type max(void)
+            {
+                return std::numeric_limits<result_type>::max();
+            }
+
+            /**
+             *  Compute the next number of the pseudo-random sequence.
+             *
+             *  @return The next number of the pseudo-random sequence.
+             */
+            result_type operator()(void)
+            {
+                result_type ret = rotateLeft(state_[1] * 5, 7) * 9;
+
+                std::uint64_t temporary = state_[1] << 17;
+
+                state_[2] ^= state_[0];
+                state_[3] ^= state_[1];
+                state_[1] ^= state_[2];
+                state_[0] ^= state_[3];
+
+                state_[2] ^= temporary;
+
+                state_[3] = rotateLeft(state_[3], 45);
+
+                return ret;
+            }
+
+            /**
+             *  Compute a pseudo-random number which is uniformly distributed in the range [0, bound).
+             *
+             *  @param[in] bound    The exclusive upper bound of the number. The bound must be greater than zero.
+             *
+             *  @return A pseudo-random number which is uniformly distributed in the range [0, bound).
+             */
+            std::size_t nextIndex(std::size_t bound)
+            {
+                HTD_ASSERT(bound > 0)
+
+                std::uint64_t range = static_cast<std::uint64_t>(bound);
+
+                std::uint64_t threshold = (0 - range) % range;
+
+                std::uint64_t value = (*this)();
+
+                while (value < threshold)
+                {
+                    value = (*this)();
+                }
+
+                return static_cast<std::size_t>(value % range);
+            }
+
+            /**
+             *  Advance the state of the random number generator by 2^128 steps.
+             */
+            void jump(void)
+            {
+                static const std::uint64_t polynomial[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+                std::uint64_t newState[4] = { 0, 0, 0, 0 };
+
+                for (std::uint64_t word : polynomial)
+                {
+                    for (unsigned int bit = 0; bit < 64; ++bit)
+                    {
+                        if ((word & (1ULL << bit)) != 0)
+                        {
+                            for (std::size_t index = 0; index < 4; ++index)
+                            {
+                                newState[index] ^= state_[index];
+                            }
+                        }
+
+                        (*this)();
+                    }
+                }
+
+                for (std::size_t index = 0; index < 4; ++index)
+                {
+                    state_[index] = newState[index];
+                }
+            }
+
+            /**
+             *  Create an independent random number generator.
+             *
+             *  The returned generator produces the next 2^128 numbers of the current sequence while the current generator
+             *  continues after them, so the sequences of both generators do not overlap.
+             *
+             *  @return An independent random number generator.
+             */
+            RandomNumberGenerator split(void)
+            {
+                RandomNumberGenerator ret(*this);
+
+                jump();
+
+                return ret;
+            }
+
+        private:
+            /**
+             *  The state of the random number generator.
+             */
+            std::uint64_t state_[4];
+
+            /**
+             *  Rotate the bits of the given word to the left.
+             *
+             *  @param[in] word     The word which shall be rotated.
+             *  @param[in] distance The number of positions by which the bits shall be rotated.
+             *
+             *  @return The rotated word.
+             */
+            static std::uint64_t rotateLeft(std::uint64_t word, unsigned int distance)
+            {
+                return (word << distance) | (word >> (64 - distance));
+            }
+    };
+}
+
+#endif /* HTD_HTD_RANDOMNUMBERGENERATOR_HPP */
@@ -34,6 +34,10 @@ namespace htd
 {
     /**
      * Implementation of the ISetCoverAlgorithm interface based on exhaustive search via a branch-and-bound approach.
+     *
+     * The elements and containers are represented as bitsets. Containers dominated by other containers are discarded, containers
+     * which are the only ones covering an element are selected upfront and the search is bounded by a greedy initial solution
+     * and by lower bounds derived from the remaining elements.
      */
     class SetCoverAlgorithm : public virtual htd::ISetCoverAlgorithm
     {
@@ -0,0 +1,289 @@
+/* 
+ * File:   Statistics.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_STATISTICS_HPP
+#define HTD_HTD_STATISTICS_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+namespace htd
+{
+    /**
+     *  Forward declaration of class htd::LibraryInstance.
+     */
+    class LibraryInstance;
+
+    /**
+     *  Class for collecting performance statistics of the algorithms of the library.
+     *
+     *  For each phase of the decomposition process, the statistics record the number of invocations, the wall-clock time,
+     *  the CPU time of the calling thread, the number of memory allocations and the memory usage of the process at the
+     *  end of the phase. Additionally, counters for events in hot loops, like the number of fill edges added by an
+     *  ordering algorithm, are maintained.
+     *
+     *  A statistics object is attached to a management instance via htd::LibraryInstance::setStatistics(). The hooks in
+     *  the algorithms are only compiled if the library is built with HTD_ENABLE_STATISTICS, otherwise all values stay 0.
+     *  The statistics are updated lock-free, hence they can be shared by algorithms running concurrently.
+     */
+    class Statistics
+    {
+        public:
+            /**
+             *  The phase in which input graphs are imported.
+             */
+            HTD_API static constexpr std::size_t IMPORT_PHASE = 0;
+
+            /**
+             *  The phase in which input graphs are preprocessed.
+             */
+            HTD_API static constexpr std::size_t PREPROCESSING_PHASE = 1;
+
+            /**
+             *  The phase in which vertex elimination orderings are computed.
+             */
+            HTD_API static constexpr std::size_t ORDERING_PHASE = 2;
+
+            /**
+             *  The phase in which decompositions are constructed from vertex elimination orderings.
+             */
+            HTD_API static constexpr std::size_t BUCKET_ELIMINATION_PHASE = 3;
+
+            /**
+             *  The phase in which the hyperedges induced by the bags of decompositions are computed.
+             */
+            HTD_API static constexpr std::size_t INDUCED_EDGES_PHASE = 4;
+
+            /**
+             *  The phase in which manipulation operations and labeling functions are applied to decompositions.
+             */
+            HTD_API static constexpr std::size_t MANIPULATION_PHASE = 5;
+
+            /**
+             *  The phase in which decompositions are exported.
+             */
+            HTD_API static constexpr std::size_t EXPORT_PHASE = 6;
+
+            /**
+             *  The number of phases distinguished by the statistics.
+             */
+            HTD_API static constexpr std::size_t PHASE_COUNT = 7;
+
+            /**
+             *  The counter for the number of vertices eliminated during the construction of decompositions.
+             */
+            HTD_API static constexpr std::size_t ELIMINATED_VERTICES = 0;
+
+            /**
+             *  The counter for the number of fill edges added by ordering algorithms.
+             */
+            HTD_API static constexpr std::size_t FILL_EDGES = 1;
+
+            /**
+             *  The counter for the number of priority updates performed by ordering algorithms.
+             */
+            HTD_API static constexpr std::size_t PRIORITY_QUEUE_UPDATES = 2;
+
+            /**
+             *  The number of counters maintained by the statistics.
+             */
+            HTD_API static constexpr std::size_t COUNTER_COUNT = 3;
+
+            /**
+             *  Constructor for new, empty statistics.
+             */
+            HTD_API Statistics(void);
+
+            /**
+             *  Destructor of the statistics.
+             */
+            HTD_API virtual ~Statistics();
+
+            /**
+             *  Copy constructor for statistics.
+             *
+             *  @param[in] original The original statistics which shall be copied.
+             */
+            Statistics(const Statistics & original) = delete;
+
+            /**
+             *  Copy assignment operator for statistics.
+             *
+             *  @param[in] original The original statistics which shall be copied.
+             */
+            Statistics & operator=(const Statistics & original) = delete;
+
+            /**
+             *  Getter for the name of a phase.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The name of the given phase.
+             */
+            HTD_API static const char * phaseName(std::size_t phase);
+
+            /**
+             *  Getter for the name of a counter.
+             *
+             *  @param[in] counter  The counter.
+             *
+             *  @return The name of the given counter.
+             */
+            HTD_API static const char * counterName(std::size_t counter);
+
+            /**
+             *  Getter for the number of times a phase was completed.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The number of times the given phase was completed.
+             */
+            HTD_API std::size_t invocationCount(std::size_t phase) const;
+
+            /**
+             *  Getter for the wall-clock time spent in a phase.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The wall-clock time spent in the given phase in milliseconds, accumulated over all threads.
+             */
+            HTD_API double wallTime(std::size_t phase) const;
+
+            /**
+             *  Getter for the CPU time spent in a phase.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The CPU time spent in the given phase in milliseconds, accumulated over all threads.
+             */
+            HTD_API double cpuTime(std::size_t phase) const;
+
+            /**
+             *  Getter for the number of memory allocations performed in a phase.
+             *
+             *  @note Allocations are only counted if the application reports them via recordAllocation(). Because
+             *  the allocations are counted per thread, only the allocations of the thread running a phase are included.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The number of memory allocations performed in the given phase.
+             */
+            HTD_API std::size_t allocationCount(std::size_t phase) const;
+
+            /**
+             *  Getter for the peak memory usage of the process at the end of a phase.
+             *
+             *  @param[in] phase    The phase.
+             *
+             *  @return The maximum of the current memory usage in bytes (see htd::currentMemoryUsage()) observed at the end of the given phase.
+             */
+            HTD_API std::size_t peakMemoryUsage(std::size_t phase) const;
+
+            /**
+             *  Getter for the value of a counter.
+             *
+             *  @param[in] counter  The counter.
+             *
+             *  @return The value of the given counter.
+             */
+            HTD_API std::size_t counter(std::size_t counter) const;
+
+            /**
+             *  Record the completion of a phase.
+             *
+             *  @param[in] phase        The phase.
+             *  @param[in] wallTime     The wall-clock time spent in the phase in nanoseconds.
+             *  @param[in] cpuTime      The CPU time spent in the phase in nanoseconds.
+             *  @param[in] allocations  The number of memory allocations performed in the phase.
+             */
+            HTD_API void recordPhase(std::size_t phase, std::uint64_t wallTime, std::uint64_t cpuTime, std::size_t allocations);
+
+            /**
+             *  Increase the value of a counter.
+             *
+             *  @param[in] counter  The counter.
+             *  @param[in] amount   The amount by which the counter shall be increased.
+             */
+            HTD_API void increment(std::size_t counter, std::size_t amount);
+
+            /**
+             *  Increase the value of a counter of the statistics attached to the given management instance.
+             *
+             *  If no statistics are attached to the management instance, the call has no effect.
+             *
+             *  @param[in] instance The management instance.
+             *  @param[in] counter  The counter.
+             *  @param[in] amount   The amount by which the counter shall be increased.
+             */
+            HTD_API static void increment(const htd::LibraryInstance & instance, std::size_t counter, std::size_t amount);
+
+            /**
+             *  Reset all phases and counters to 0.
+             *
+             *  @note This method must not be called while algorithms update the statistics.
+             */
+            HTD_API void reset(void);
+
+            /**
+             *  Write a human-readable report of the statistics to the given output stream.
+             *
+             *  @param[in] stream   The output stream.
+             */
+            HTD_API void print(std::ostream & stream) const;
+
+            /**
+             *  Write the statistics as JSON object to the given output stream.
+             *
+             *  @param[in] stream   The output stream.
+             */
+            HTD_API void writeJson(std::ostream & stream) const;
+
+            /**
+             *  Report a memory allocation.
+             *
+             *  Applications which want allocation counts to be part of the statistics call this function from their
+             *  replacement of the global operator new. The allocations are counted separately for each thread, so that
+             *  no counter is shared between threads.
+             */
+            HTD_API static void recordAllocation(void) HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the number of memory allocations reported so far by the calling thread.
+             *
+             *  @return The number of memory allocations reported by the calling thread via recordAllocation().
+             */
+            HTD_API static std::size_t totalAllocationCount(void) HTD_NOEXCEPT;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_STATISTICS_HPP */
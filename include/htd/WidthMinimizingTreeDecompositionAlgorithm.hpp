@@ -32,6 +32,7 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/ITreeDecompositionFitnessFunction.hpp>
 
+#include <atomic>
 #include <vector>
 #include <functional>
 
@@ -265,6 +266,26 @@ namespace htd
              */
             HTD_API void setCompressionEnabled(bool compressionEnabled);
 
+            /**
+             *  Getter for the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  @return The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound is used.
+             */
+            HTD_API const std::atomic<std::size_t> * sharedMaximumBagSize(void) const HTD_OVERRIDE;
+
+            /**
+             *  Set the maximum bag size bound which is shared with concurrently running algorithms.
+             *
+             *  The shared bound holds the smallest maximum bag size found so far by any of the algorithms. Before each
+             *  iteration, the limit passed to the underlying algorithm is tightened so that only decompositions with a
+             *  maximum bag size strictly below the shared bound are accepted.
+             *
+             *  @note The shared bound is not owned by the algorithm and it is not copied when the algorithm is cloned.
+             *
+             *  @param[in] sharedMaximumBagSize The maximum bag size bound which is shared with concurrently running algorithms or nullptr if no shared bound shall be used.
+             */
+            HTD_API void setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize) HTD_OVERRIDE;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
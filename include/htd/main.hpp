@@ -30,6 +30,7 @@
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
 #include <htd/Algorithm.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
 #include <htd/AssemblyInfo.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
@@ -39,13 +40,17 @@
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompressedFlowNetwork.hpp>
+#include <htd/CompressedMultiHypergraph.hpp>
 #include <htd/CompressionOperation.hpp>
+#include <htd/ConcurrentConstructionTemplate.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
 #include <htd/ConstCollection.hpp>
 #include <htd/ConstIteratorBase.hpp>
 #include <htd/ConstIterator.hpp>
 #include <htd/ConstIteratorWrapper.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/DenseVertexMap.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
@@ -139,6 +144,7 @@
 #include <htd/IMutablePath.hpp>
 #include <htd/IMutableTreeDecomposition.hpp>
 #include <htd/IMutableTree.hpp>
+#include <htd/InducedHyperedgeIndex.hpp>
 #include <htd/InducedSubgraphLabelingOperation.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 #include <htd/IPathDecompositionAlgorithm.hpp>
@@ -215,12 +221,14 @@
 #include <htd/PathDecompositionFactory.hpp>
 #include <htd/PathDecomposition.hpp>
 #include <htd/Path.hpp>
+#include <htd/PhaseTimer.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/PostProcessingPathDecompositionAlgorithm.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/PreprocessorDefinitions.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
@@ -229,6 +237,7 @@
 #include <htd/SetCoverAlgorithm.hpp>
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
 #include <htd/State.hpp>
+#include <htd/Statistics.hpp>
 #include <htd/StronglyConnectedComponentAlgorithmFactory.hpp>
 #include <htd/TarjanStronglyConnectedComponentAlgorithm.hpp>
 #include <htd/TreeDecompositionAlgorithmFactory.hpp>
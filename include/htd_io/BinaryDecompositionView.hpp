@@ -0,0 +1,457 @@
+/*
+ * File:   BinaryDecompositionView.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYDECOMPOSITIONVIEW_HPP
+#define HTD_IO_BINARYDECOMPOSITIONVIEW_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/ConstCollection.hpp>
+#include <htd/Hyperedge.hpp>
+#include <htd/IMutablePathDecomposition.hpp>
+#include <htd/IMutableTreeDecomposition.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Read-only view of a decomposition stored in the binary decomposition format.
+     *
+     *  The file is mapped into memory and all queries are answered directly from the flat arrays stored in the file,
+     *  hence opening a view does not depend on the size of the decomposition. The identifiers of the nodes are the
+     *  same as in the decomposition which was exported. Whenever a mutable decomposition is needed, e.g., for
+     *  applying manipulation operations, it can be created via createTreeDecomposition() or
+     *  createPathDecomposition().
+     *
+     *  A file in the binary decomposition format consists of a header followed by the sections listed below. Each
+     *  section starts at an offset which is a multiple of 8 bytes and integers are stored in the byte order of the
+     *  machine which wrote the file.
+     *
+     *  - nodes:                  uint32[nodeCount], the identifiers of the nodes in ascending order
+     *  - positions:              uint32[maximumNodeId + 1], the position of each node within 'nodes' (or 0xFFFFFFFF)
+     *  - parents:                uint32[nodeCount], the parent of each node (htd::Vertex::UNKNOWN for the root)
+     *  - child offsets:          uint64[nodeCount + 1], the range of each node within 'children'
+     *  - children:               uint32[nodeCount - 1], the children of all nodes
+     *  - bag offsets:            uint64[nodeCount + 1], the range of each node within 'bag contents'
+     *  - bag contents:           uint32[bagEntryCount], the bag contents of all nodes
+     *  - hyperedge identifiers:  uint32[hyperedgeCount], the identifiers of all induced hyperedges
+     *  - hyperedge offsets:      uint64[hyperedgeCount + 1], the range of each hyperedge within 'hyperedge vertices'
+     *  - hyperedge vertices:     uint32[hyperedgeVertexEntryCount], the end-points of all induced hyperedges
+     *  - induced offsets:        uint64[nodeCount + 1], the range of each node within 'induced hyperedges'
+     *  - induced hyperedges:     uint32[inducedEntryCount], the positions of the hyperedges induced by each bag
+     *  - labels:                 LabelRecord[labelCount]
+     *  - label entries:          LabelEntry[labelEntryCount], sorted by the labeled node within each label
+     *  - text:                   char[textLength], the names of the labels and the textual representations of the labels
+     */
+    class BinaryDecompositionView
+    {
+        public:
+            /**
+             *  The version of the binary decomposition format written by htd_io::BinaryFormatExporter.
+             */
+            static const std::uint32_t FORMAT_VERSION = 1;
+
+            /**
+             *  The constant used for detecting files which were written on a machine with different endianness.
+             */
+            static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+            /**
+             *  The flag indicating that the stored decomposition is a path decomposition.
+             */
+            static const std::uint32_t PATH_DECOMPOSITION_FLAG = 1;
+
+            /**
+             *  The header of a file in the binary decomposition format.
+             */
+            struct Header
+            {
+                /**
+                 *  The magic bytes identifying the file format.
+                 */
+                char magic[8];
+
+                /**
+                 *  The version of the file format.
+                 */
+                std::uint32_t version;
+
+                /**
+                 *  The byte order mark which must be equal to BYTE_ORDER_MARK.
+                 */
+                std::uint32_t byteOrderMark;
+
+                /**
+                 *  The flags describing the stored decomposition.
+                 */
+                std::uint32_t flags;
+
+                /**
+                 *  Reserved for future use, always 0.
+                 */
+                std::uint32_t reserved;
+
+                /**
+                 *  The number of vertices of the decomposed graph.
+                 */
+                std::uint64_t graphVertexCount;
+
+                /**
+                 *  The number of nodes of the decomposition.
+                 */
+                std::uint64_t nodeCount;
+
+                /**
+                 *  The largest identifier of a node of the decomposition.
+                 */
+                std::uint64_t maximumNodeId;
+
+                /**
+                 *  The root of the decomposition.
+                 */
+                std::uint64_t root;
+
+                /**
+                 *  The total number of entries in the bags of the decomposition.
+                 */
+                std::uint64_t bagEntryCount;
+
+                /**
+                 *  The number of distinct hyperedges induced by the bags of the decomposition.
+                 */
+                std::uint64_t hyperedgeCount;
+
+                /**
+                 *  The total number of end-points of the distinct hyperedges.
+                 */
+                std::uint64_t hyperedgeVertexEntryCount;
+
+                /**
+                 *  The total number of entries in the induced hyperedge lists of the nodes.
+                 */
+                std::uint64_t inducedEntryCount;
+
+                /**
+                 *  The number of labels.
+                 */
+                std::uint64_t labelCount;
+
+                /**
+                 *  The total number of labeled nodes over all labels.
+                 */
+                std::uint64_t labelEntryCount;
+
+                /**
+                 *  The size of the text section in bytes.
+                 */
+                std::uint64_t textLength;
+
+                /**
+                 *  The minimum bag size of the decomposition.
+                 */
+                std::uint64_t minimumBagSize;
+
+                /**
+                 *  The maximum bag size of the decomposition.
+                 */
+                std::uint64_t maximumBagSize;
+            };
+
+            /**
+             *  The description of a label in the binary decomposition format.
+             */
+            struct LabelRecord
+            {
+                /**
+                 *  The offset of the name of the label within the text section.
+                 */
+                std::uint64_t nameOffset;
+
+                /**
+                 *  The length of the name of the label.
+                 */
+                std::uint64_t nameLength;
+
+                /**
+                 *  The position of the first entry of the label within the label entries.
+                 */
+                std::uint64_t firstEntry;
+
+                /**
+                 *  The number of nodes labeled with the label.
+                 */
+                std::uint64_t entryCount;
+            };
+
+            /**
+             *  The label of a single node in the binary decomposition format.
+             */
+            struct LabelEntry
+            {
+                /**
+                 *  The labeled node.
+                 */
+                std::uint32_t vertex;
+
+                /**
+                 *  Reserved for future use, always 0.
+                 */
+                std::uint32_t reserved;
+
+                /**
+                 *  The offset of the textual representation of the label within the text section.
+                 */
+                std::uint64_t textOffset;
+
+                /**
+                 *  The length of the textual representation of the label.
+                 */
+                std::uint64_t textLength;
+            };
+
+            /**
+             *  The magic bytes at the beginning of each file in the binary decomposition format.
+             */
+            HTD_IO_API static const char * magic(void);
+
+            /**
+             *  Constructor for a new view of a decomposition stored in the binary decomposition format.
+             *
+             *  @param[in] path The path to the file which contains the decomposition.
+             */
+            HTD_IO_API BinaryDecompositionView(const std::string & path);
+
+            /**
+             *  Destructor of a view of a decomposition stored in the binary decomposition format.
+             */
+            HTD_IO_API virtual ~BinaryDecompositionView();
+
+            /**
+             *  Check whether the file was successfully opened and contains a decomposition in a supported version of
+             *  the binary decomposition format.
+             *
+             *  Only the header and the sizes of the sections are validated, the content of the sections is expected
+             *  to be written by htd_io::BinaryFormatExporter.
+             *
+             *  @return True if the file was successfully opened and it contains a valid decomposition, false otherwise.
+             */
+            HTD_IO_API bool isOpen(void) const;
+
+            /**
+             *  Check whether the stored decomposition is a path decomposition.
+             *
+             *  @return True if the stored decomposition is a path decomposition, false otherwise.
+             */
+            HTD_IO_API bool isPathDecomposition(void) const;
+
+            /**
+             *  Getter for the number of vertices of the decomposed graph.
+             *
+             *  @return The number of vertices of the decomposed graph.
+             */
+            HTD_IO_API std::size_t graphVertexCount(void) const;
+
+            /**
+             *  Getter for the number of nodes of the decomposition.
+             *
+             *  @return The number of nodes of the decomposition.
+             */
+            HTD_IO_API std::size_t vertexCount(void) const;
+
+            /**
+             *  Getter for the nodes of the decomposition.
+             *
+             *  @return A collection containing the nodes of the decomposition in ascending order.
+             */
+            HTD_IO_API htd::ConstCollection<htd::vertex_t> vertices(void) const;
+
+            /**
+             *  Check whether a given vertex is a node of the decomposition.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if the given vertex is a node of the decomposition, false otherwise.
+             */
+            HTD_IO_API bool isVertex(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the root of the decomposition.
+             *
+             *  @return The root of the decomposition or htd::Vertex::UNKNOWN if the decomposition is empty.
+             */
+            HTD_IO_API htd::vertex_t root(void) const;
+
+            /**
+             *  Getter for the parent of a node.
+             *
+             *  @param[in] vertex   The node for which the parent shall be returned.
+             *
+             *  @return The parent of the given node or htd::Vertex::UNKNOWN if the node is the root.
+             */
+            HTD_IO_API htd::vertex_t parent(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the number of children of a node.
+             *
+             *  @param[in] vertex   The node for which the number of children shall be returned.
+             *
+             *  @return The number of children of the given node.
+             */
+            HTD_IO_API std::size_t childCount(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the children of a node.
+             *
+             *  @param[in] vertex   The node for which the children shall be returned.
+             *
+             *  @return A collection containing the children of the given node.
+             */
+            HTD_IO_API htd::ConstCollection<htd::vertex_t> children(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the size of the bag of a node.
+             *
+             *  @param[in] vertex   The node for which the size of the bag shall be returned.
+             *
+             *  @return The size of the bag of the given node.
+             */
+            HTD_IO_API std::size_t bagSize(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the bag content of a node.
+             *
+             *  @param[in] vertex   The node for which the bag content shall be returned.
+             *
+             *  @return A collection containing the bag content of the given node.
+             */
+            HTD_IO_API htd::ConstCollection<htd::vertex_t> bagContent(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the minimum bag size of the decomposition.
+             *
+             *  @return The minimum bag size of the decomposition.
+             */
+            HTD_IO_API std::size_t minimumBagSize(void) const;
+
+            /**
+             *  Getter for the maximum bag size of the decomposition.
+             *
+             *  @return The maximum bag size of the decomposition.
+             */
+            HTD_IO_API std::size_t maximumBagSize(void) const;
+
+            /**
+             *  Getter for the number of hyperedges induced by the bag of a node.
+             *
+             *  @param[in] vertex   The node for which the number of induced hyperedges shall be returned.
+             *
+             *  @return The number of hyperedges induced by the bag of the given node.
+             */
+            HTD_IO_API std::size_t inducedHyperedgeCount(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the hyperedge induced by the bag of a node at the specific position.
+             *
+             *  @param[in] vertex   The node for which the induced hyperedge shall be returned.
+             *  @param[in] index    The position of the induced hyperedge.
+             *
+             *  @return The hyperedge induced by the bag of the given node at the specific position.
+             */
+            HTD_IO_API htd::Hyperedge inducedHyperedgeAtPosition(htd::vertex_t vertex, htd::index_t index) const;
+
+            /**
+             *  Getter for the number of labels of the decomposition.
+             *
+             *  @return The number of labels of the decomposition.
+             */
+            HTD_IO_API std::size_t labelCount(void) const;
+
+            /**
+             *  Access the name of the label at the specific position.
+             *
+             *  @param[in] index    The position of the label.
+             *
+             *  @return The name of the label at the specific position.
+             */
+            HTD_IO_API std::string labelNameAtPosition(htd::index_t index) const;
+
+            /**
+             *  Check whether a node is labeled with a given label.
+             *
+             *  @param[in] labelName    The name of the label.
+             *  @param[in] vertex       The node.
+             *
+             *  @return True if the given node is labeled with the given label, false otherwise.
+             */
+            HTD_IO_API bool isLabeledVertex(const std::string & labelName, htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the textual representation of the label of a node.
+             *
+             *  @param[in] labelName    The name of the label.
+             *  @param[in] vertex       The node.
+             *
+             *  @return The textual representation of the label of the given node, as written by htd::ILabel::print().
+             */
+            HTD_IO_API std::string vertexLabel(const std::string & labelName, htd::vertex_t vertex) const;
+
+            /**
+             *  Create a mutable tree decomposition containing the stored decomposition.
+             *
+             *  The nodes of the new decomposition are created in breadth-first order, hence their identifiers may differ from
+             *  the identifiers in the file. The labels are restored as instances of htd::Label<std::string> holding
+             *  the textual representation of the original labels.
+             *
+             *  @param[in] manager  The management instance to which the new decomposition shall belong.
+             *
+             *  @return A new tree decomposition containing the stored decomposition or nullptr if the view is not open.
+             */
+            HTD_IO_API htd::IMutableTreeDecomposition * createTreeDecomposition(const htd::LibraryInstance * const manager) const;
+
+            /**
+             *  Create a mutable path decomposition containing the stored decomposition.
+             *
+             *  The nodes of the new decomposition are created from the root to the leaf, hence their identifiers may
+             *  differ from the identifiers in the file. The labels are restored as instances of
+             *  htd::Label<std::string> holding the textual representation of the original labels.
+             *
+             *  @param[in] manager  The management instance to which the new decomposition shall belong.
+             *
+             *  @return A new path decomposition containing the stored decomposition or nullptr if the view is not open
+             *  or the stored decomposition is not a path decomposition.
+             */
+            HTD_IO_API htd::IMutablePathDecomposition * createPathDecomposition(const htd::LibraryInstance * const manager) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_BINARYDECOMPOSITIONVIEW_HPP */
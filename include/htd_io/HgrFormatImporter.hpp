@@ -28,6 +28,7 @@
 #include <htd_io/PreprocessorDefinitions.hpp>
 
 #include <htd/IMultiHypergraph.hpp>
+#include <htd/CompressedMultiHypergraph.hpp>
 
 #include <string>
 #include <iostream>
@@ -55,6 +56,9 @@ namespace htd_io
             /**
              *  Create a new IMultiHypergraph instance based on the information stored in a given file.
              *
+             *  If the given path refers to a regular file, the file is mapped into memory and parsed in place.
+             *  Otherwise, e.g., for named pipes, the file is read via a stream.
+             *
              *  @param[in] path The path to the file from which the information can be read.
              *
              *  @return A new IMultiHypergraph instance based on the information stored in the given file.
@@ -70,6 +74,27 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
 
+            /**
+             *  Create a new CompressedMultiHypergraph instance based on the information stored in a given file.
+             *
+             *  In contrast to import(), the hyperedges are stored directly in the compact, immutable representation
+             *  of htd::CompressedMultiHypergraph without creating an intermediate mutable hypergraph.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new CompressedMultiHypergraph instance based on the information stored in the given file.
+             */
+            HTD_IO_API htd::CompressedMultiHypergraph * importCompressed(const std::string & path) const;
+
+            /**
+             *  Create a new CompressedMultiHypergraph instance based on the information from a given stream.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new CompressedMultiHypergraph instance based on the information from the given stream.
+             */
+            HTD_IO_API htd::CompressedMultiHypergraph * importCompressed(std::istream & stream) const;
+
         private:
             struct Implementation;
 
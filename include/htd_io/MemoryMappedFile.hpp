@@ -0,0 +1,88 @@
+/*
+ * File:   MemoryMappedFile.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_MEMORYMAPPEDFILE_HPP
+#define HTD_IO_MEMORYMAPPEDFILE_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/PreprocessorDefinitions.hpp>
+
+#include <memory>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Read-only view of the content of a regular file which is mapped into memory.
+     *
+     *  The content of the file is accessible as a contiguous range of characters without copying it into
+     *  a separate buffer. If the file cannot be mapped into memory, e.g., because it does not exist, it is
+     *  empty, it is not a regular file (like a pipe) or the platform does not support memory-mapped files,
+     *  the view is not open and the file has to be read via a stream instead.
+     */
+    class MemoryMappedFile
+    {
+        public:
+            /**
+             *  Constructor for a new memory-mapped file.
+             *
+             *  @param[in] path The path to the file which shall be mapped into memory.
+             */
+            HTD_IO_API MemoryMappedFile(const std::string & path);
+
+            /**
+             *  Destructor of a memory-mapped file.
+             */
+            HTD_IO_API virtual ~MemoryMappedFile();
+
+            /**
+             *  Check whether the file was successfully mapped into memory.
+             *
+             *  @return True if the file was successfully mapped into memory, false otherwise.
+             */
+            HTD_IO_API bool isOpen(void) const;
+
+            /**
+             *  Getter for the content of the file.
+             *
+             *  @return A pointer to the first character of the file or nullptr if the file is not open.
+             */
+            HTD_IO_API const char * data(void) const;
+
+            /**
+             *  Getter for the size of the file.
+             *
+             *  @return The size of the file in bytes or 0 if the file is not open.
+             */
+            HTD_IO_API std::size_t size(void) const;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_IO_MEMORYMAPPEDFILE_HPP */
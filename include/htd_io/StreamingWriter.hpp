@@ -0,0 +1,219 @@
+/*
+ * File:   StreamingWriter.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_STREAMINGWRITER_HPP
+#define HTD_IO_STREAMINGWRITER_HPP
+
+#include <htd_io/PreprocessorDefinitions.hpp>
+
+#include <htd/PreprocessorDefinitions.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace htd_io
+{
+    /**
+     *  Buffered writer which collects the output in a large, pre-allocated buffer and passes it to the target in big chunks.
+     *
+     *  The target of the writer is either an output stream or a file descriptor. Unsigned integers are formatted directly into the
+     *  buffer, so writing does not perform any heap allocations after construction. Optionally, the output can be compressed in
+     *  gzip format on the fly (see supportsCompression()).
+     *
+     *  The remaining content of the buffer is written to the target when flush() is called and when the writer is destroyed.
+     */
+    class StreamingWriter
+    {
+        public:
+            /**
+             *  The default size of the write buffer in bytes.
+             */
+            static const std::size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+            /**
+             *  Constructor for a writer with an output stream as target.
+             *
+             *  @param[in] outputStream The output stream to which the output shall be written.
+             *  @param[in] compress     A boolean flag whether the output shall be compressed in gzip format.
+             *  @param[in] bufferSize   The size of the write buffer in bytes.
+             */
+            HTD_IO_API StreamingWriter(std::ostream & outputStream, bool compress = false, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+            /**
+             *  Constructor for a writer with a file descriptor as target.
+             *
+             *  @note The file descriptor is not closed by the writer.
+             *
+             *  @param[in] fileDescriptor   The file descriptor to which the output shall be written.
+             *  @param[in] compress         A boolean flag whether the output shall be compressed in gzip format.
+             *  @param[in] bufferSize       The size of the write buffer in bytes.
+             */
+            HTD_IO_API StreamingWriter(int fileDescriptor, bool compress = false, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+            /**
+             *  Destructor of a writer. The remaining content of the buffer is written to the target.
+             */
+            HTD_IO_API virtual ~StreamingWriter();
+
+            /**
+             *  Check whether the library was built with support for compressed output.
+             *
+             *  @return True if the library was built with support for compressed output, false otherwise.
+             */
+            HTD_IO_API static bool supportsCompression(void);
+
+            /**
+             *  Check whether all output so far was written successfully.
+             *
+             *  @return True if no error occurred so far, false otherwise. If compression was requested but is not supported, false is returned.
+             */
+            HTD_IO_API bool good(void) const;
+
+            /**
+             *  Write the content of the buffer to the target.
+             *
+             *  @note When compression is enabled, the compressed stream is not finished by this function, i.e., further output can be written.
+             */
+            HTD_IO_API void flush(void);
+
+            /**
+             *  Write a single character.
+             *
+             *  @param[in] character    The character which shall be written.
+             */
+            inline void write(char character)
+            {
+                if (position_ == capacity_)
+                {
+                    flushBuffer();
+                }
+
+                buffer_[position_++] = character;
+            }
+
+            /**
+             *  Write a sequence of characters.
+             *
+             *  @param[in] data     A pointer to the first character of the sequence.
+             *  @param[in] length   The number of characters which shall be written.
+             */
+            inline void write(const char * data, std::size_t length)
+            {
+                if (capacity_ - position_ >= length)
+                {
+                    std::memcpy(buffer_ + position_, data, length);
+
+                    position_ += length;
+                }
+                else
+                {
+                    writeLarge(data, length);
+                }
+            }
+
+            /**
+             *  Write a string.
+             *
+             *  @param[in] text The string which shall be written.
+             */
+            inline void write(const std::string & text)
+            {
+                write(text.data(), text.size());
+            }
+
+            /**
+             *  Write the decimal representation of an unsigned integer.
+             *
+             *  @param[in] value    The value which shall be written.
+             */
+            inline void writeUnsigned(std::size_t value)
+            {
+                /* The decimal representation of a 64-bit unsigned integer has at most 20 digits. */
+                if (capacity_ - position_ < 20)
+                {
+                    flushBuffer();
+                }
+
+                char digits[20];
+
+                std::size_t length = 0;
+
+                do
+                {
+                    digits[length++] = static_cast<char>('0' + value % 10);
+
+                    value /= 10;
+                }
+                while (value > 0);
+
+                while (length > 0)
+                {
+                    buffer_[position_++] = digits[--length];
+                }
+            }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+
+            /**
+             *  The write buffer.
+             */
+            char * buffer_;
+
+            /**
+             *  The size of the write buffer.
+             */
+            std::size_t capacity_;
+
+            /**
+             *  The number of characters currently stored in the write buffer.
+             */
+            std::size_t position_;
+
+            /**
+             *  Pass the content of the write buffer to the target and reset the buffer.
+             */
+            HTD_IO_API void flushBuffer(void);
+
+            /**
+             *  Write a sequence of characters which does not fit into the remaining space of the write buffer.
+             *
+             *  @param[in] data     A pointer to the first character of the sequence.
+             *  @param[in] length   The number of characters which shall be written.
+             */
+            HTD_IO_API void writeLarge(const char * data, std::size_t length);
+
+            StreamingWriter(const StreamingWriter & original) = delete;
+
+            StreamingWriter & operator=(const StreamingWriter & original) = delete;
+    };
+}
+
+#endif /* HTD_IO_STREAMINGWRITER_HPP */
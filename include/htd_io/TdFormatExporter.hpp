@@ -28,6 +28,7 @@
 #include <htd_io/PreprocessorDefinitions.hpp>
 
 #include <htd_io/ITreeDecompositionExporter.hpp>
+#include <htd_io/StreamingWriter.hpp>
 
 #include <iostream>
 
@@ -48,6 +49,24 @@ namespace htd_io
             HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const HTD_OVERRIDE;
 
             HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const HTD_OVERRIDE;
+
+            /**
+             *  Write the given decomposition using the given writer, e.g., directly to a file descriptor or as compressed stream.
+             *
+             *  @param[in] decomposition    The decomposition which shall be written.
+             *  @param[in] graph            The graph which was decomposed.
+             *  @param[in] writer           The writer which shall be used for the output.
+             */
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, htd_io::StreamingWriter & writer) const;
+
+            /**
+             *  Write the given decomposition using the given writer, e.g., directly to a file descriptor or as compressed stream.
+             *
+             *  @param[in] decomposition    The decomposition which shall be written.
+             *  @param[in] graph            The graph which was decomposed.
+             *  @param[in] writer           The writer which shall be used for the output.
+             */
+            HTD_IO_API void write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, htd_io::StreamingWriter & writer) const;
     };
 }
 
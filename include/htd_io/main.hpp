@@ -25,6 +25,8 @@
 #ifndef HTD_IO_MAIN_HPP
 #define HTD_IO_MAIN_HPP
 
+#include <htd_io/BinaryDecompositionView.hpp>
+#include <htd_io/BinaryFormatExporter.hpp>
 #include <htd_io/GrFormatGraphProcessor.hpp>
 #include <htd_io/GrFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/GrFormatImporter.hpp>
@@ -38,7 +40,9 @@
 #include <htd_io/ITreeDecompositionExporter.hpp>
 #include <htd_io/LpFormatGraphToTreeDecompositionProcessor.hpp>
 #include <htd_io/LpFormatImporter.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
 #include <htd_io/ParsingResult.hpp>
+#include <htd_io/StreamingWriter.hpp>
 #include <htd_io/TdFormatExporter.hpp>
 #include <htd_io/WidthExporter.hpp>
 
@@ -44,7 +44,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), filters_(), decisionRounds_(1), iterationCount_(1), nonImprovementLimit_(-1), computeInducedEdges_(true), sharedMaximumBagSize_(nullptr)
     {
 
     }
@@ -54,7 +54,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), filters_(original.filters_), decisionRounds_(original.decisionRounds_), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), computeInducedEdges_(original.computeInducedEdges_), sharedMaximumBagSize_(nullptr)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -105,6 +105,11 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The maximum bag size bound which is shared with concurrently running algorithms.
+     */
+    const std::atomic<std::size_t> * sharedMaximumBagSize_;
+
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
      *
@@ -446,7 +451,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool)];
+    htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool, implementation_->managementInstance_->randomNumberGenerator())];
 
     htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationTreeDecompositionAlgorithm = dynamic_cast<htd::BucketEliminationTreeDecompositionAlgorithm *>(selectedAlgorithm);
 
@@ -618,6 +623,11 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setManagementInstan
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    for (htd::ITreeDecompositionAlgorithm * algorithm : implementation_->algorithms_)
+    {
+        algorithm->setManagementInstance(manager);
+    }
 }
 
 std::size_t htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::iterationCount(void) const
@@ -640,6 +650,16 @@ void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setNonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+const std::atomic<std::size_t> * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::sharedMaximumBagSize(void) const
+{
+    return implementation_->sharedMaximumBagSize_;
+}
+
+void htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize)
+{
+    implementation_->sharedMaximumBagSize_ = sharedMaximumBagSize;
+}
+
 std::size_t htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::decisionRounds(void) const
 {
     return implementation_->decisionRounds_;
@@ -772,7 +792,14 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 #endif
         }
 
-        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, std::min(remainingIterations, nonImprovementLimit_));
+        std::size_t currentLimit = bestMaxBagSize - 1;
+
+        if (sharedMaximumBagSize_ != nullptr)
+        {
+            currentLimit = std::min(currentLimit, sharedMaximumBagSize_->load() - 1);
+        }
+
+        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, currentLimit, std::min(remainingIterations, nonImprovementLimit_));
 
         htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
 
@@ -0,0 +1,756 @@
+/* 
+ * File:   ApproximateMinDegreeOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+#define HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ApproximateMinDegreeOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+#include <htd/PriorityQueue.hpp>
+#include <htd/Statistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ApproximateMinDegreeOrderingAlgorithm.
+ */
+struct htd::ApproximateMinDegreeOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The possible states of a vertex of the quotient graph.
+     */
+    enum class Status : char
+    {
+        /**
+         *  The vertex was eliminated or absorbed and is no longer part of the quotient graph.
+         */
+        Dead,
+
+        /**
+         *  The vertex is the principal variable of a supervariable which is not yet eliminated.
+         */
+        Variable,
+
+        /**
+         *  The vertex is a non-principal member of a supervariable.
+         */
+        Merged,
+
+        /**
+         *  The vertex was eliminated and represents an element of the quotient graph.
+         */
+        Element
+    };
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+
+    /**
+     *  Eliminate the dense vertices which were postponed during the elimination of the quotient graph.
+     *
+     *  The elimination graph induced by the dense vertices consists of the edges between them in the input graph and
+     *  of the fill edges between all dense vertices adjacent to the same remaining element. It is stored as adjacency
+     *  matrix and the dense vertices are eliminated according to their exact degree.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] denseVertices        The dense vertices.
+     *  @param[in] denseIndices         The index of each dense vertex within the vector of dense vertices.
+     *  @param[in] status               The status of each vertex after the elimination of all other vertices.
+     *  @param[in] denseNeighbors       The indices of the dense vertices adjacent to each element.
+     *  @param[out] target              The target vector to which the ordering of the dense vertices shall be appended.
+     *
+     *  @return The maximum bag size induced by the elimination of the dense vertices.
+     */
+    std::size_t eliminateDenseVertices(const htd::IPreprocessedGraph & preprocessedGraph,
+                                       const std::vector<htd::vertex_t> & denseVertices,
+                                       const std::vector<htd::index_t> & denseIndices,
+                                       const std::vector<Status> & status,
+                                       const std::vector<std::vector<htd::index_t>> & denseNeighbors,
+                                       std::vector<htd::vertex_t> & target) const HTD_NOEXCEPT;
+};
+
+htd::ApproximateMinDegreeOrderingAlgorithm::ApproximateMinDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm::~ApproximateMinDegreeOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+std::size_t htd::ApproximateMinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = preprocessedGraph.eliminationSequenceBagSize();
+
+    std::size_t vertexCount = preprocessedGraph.inputGraphVertexCount();
+
+    std::size_t size = preprocessedGraph.remainingVertices().size();
+
+    const htd::vertex_t lastMemberMarker = static_cast<htd::vertex_t>(vertexCount);
+
+    /* Vertices of high degree are postponed to the end of the ordering, so that they do not dominate the cost of updating their neighbors. */
+    std::size_t denseThreshold = std::max((std::size_t)16, static_cast<std::size_t>(10 * std::sqrt(static_cast<double>(size))));
+
+    std::vector<htd::vertex_t> denseVertices;
+
+    std::vector<htd::index_t> denseIndices(vertexCount, (htd::index_t)-1);
+
+    /* The variables adjacent to each variable which are not yet covered by a common element. */
+    std::vector<std::vector<htd::vertex_t>> variables(vertexCount);
+
+    /* The elements adjacent to each variable. */
+    std::vector<std::vector<htd::vertex_t>> elements(vertexCount);
+
+    /* The variables of each element, i.e., the neighborhood of the eliminated vertex at the time of its elimination. */
+    std::vector<std::vector<htd::vertex_t>> elementVariables(vertexCount);
+
+    /* The indices of the dense vertices adjacent to each variable in the input graph and to each element in the elimination graph. */
+    std::vector<std::vector<htd::index_t>> denseNeighbors(vertexCount);
+
+    std::vector<Status> status(vertexCount, Status::Dead);
+
+    /* The number of vertices represented by each principal variable. */
+    std::vector<std::size_t> weights(vertexCount, 0);
+
+    /* The approximate external degree of each variable and the total weight of the variables of each element. */
+    std::vector<std::size_t> degrees(vertexCount, 0);
+
+    std::vector<std::size_t> priorities(vertexCount, 0);
+
+    /* The members of each supervariable form a linked list starting at the principal variable. */
+    std::vector<htd::vertex_t> nextMember(vertexCount, lastMemberMarker);
+    std::vector<htd::vertex_t> lastMember(vertexCount);
+
+    /* The stamps allow to reset the markers of all vertices in constant time. */
+    std::size_t stamp = 0;
+
+    std::vector<std::size_t> pivotMarker(vertexCount, 0);
+    std::vector<std::size_t> comparisonMarker(vertexCount, 0);
+    std::vector<std::size_t> externalWeightMarker(vertexCount, 0);
+
+    /* The weight of the variables of each element which are not part of the current pivot element. */
+    std::vector<std::size_t> externalWeights(vertexCount, 0);
+
+    /* The weight of the adjacent variables and of the adjacent elements apart from the pivot element of each variable. */
+    std::vector<std::size_t> partialDegrees(vertexCount, 0);
+
+    std::vector<htd::vertex_t> pivotVariables;
+
+    std::vector<std::pair<std::size_t, htd::vertex_t>> hashes;
+
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    HTD_STATISTICS(std::size_t priorityQueueUpdateCount = 0;)
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        if (preprocessedGraph.neighborhood(vertex).size() > denseThreshold)
+        {
+            denseIndices[vertex] = denseVertices.size();
+
+            denseVertices.push_back(vertex);
+        }
+    }
+
+    std::vector<std::size_t> denseMarker(denseVertices.size(), 0);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        if (denseIndices[vertex] == (htd::index_t)-1)
+        {
+            std::vector<htd::vertex_t> & currentVariables = variables[vertex];
+
+            for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+            {
+                if (denseIndices[neighbor] == (htd::index_t)-1)
+                {
+                    currentVariables.push_back(neighbor);
+                }
+                else
+                {
+                    denseNeighbors[vertex].push_back(denseIndices[neighbor]);
+                }
+            }
+
+            status[vertex] = Status::Variable;
+
+            weights[vertex] = 1;
+
+            degrees[vertex] = preprocessedGraph.neighborhood(vertex).size();
+
+            priorities[vertex] = degrees[vertex];
+
+            lastMember[vertex] = vertex;
+
+            priorityQueue.push(vertex, degrees[vertex]);
+        }
+    }
+
+    size -= denseVertices.size();
+
+    while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t pivot = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance_->randomNumberGenerator());
+
+        priorityQueue.eraseFromTopCollection(pivot);
+
+        /* Collect the variables of the new element, i.e., the neighborhood of the pivot in the elimination graph. */
+        std::size_t pivotStamp = ++stamp;
+
+        std::size_t pivotDegree = 0;
+
+        pivotMarker[pivot] = pivotStamp;
+
+        pivotVariables.clear();
+
+        std::vector<htd::index_t> & pivotDenseNeighbors = denseNeighbors[pivot];
+
+        for (htd::index_t denseIndex : pivotDenseNeighbors)
+        {
+            denseMarker[denseIndex] = pivotStamp;
+        }
+
+        for (htd::vertex_t variable : variables[pivot])
+        {
+            if (status[variable] == Status::Variable && pivotMarker[variable] != pivotStamp)
+            {
+                pivotMarker[variable] = pivotStamp;
+
+                pivotVariables.push_back(variable);
+
+                pivotDegree += weights[variable];
+            }
+        }
+
+        /* The elements adjacent to the pivot are absorbed by the new element. */
+        for (htd::vertex_t element : elements[pivot])
+        {
+            if (status[element] == Status::Element)
+            {
+                for (htd::vertex_t variable : elementVariables[element])
+                {
+                    if (status[variable] == Status::Variable && pivotMarker[variable] != pivotStamp)
+                    {
+                        pivotMarker[variable] = pivotStamp;
+
+                        pivotVariables.push_back(variable);
+
+                        pivotDegree += weights[variable];
+                    }
+                }
+
+                for (htd::index_t denseIndex : denseNeighbors[element])
+                {
+                    if (denseMarker[denseIndex] != pivotStamp)
+                    {
+                        denseMarker[denseIndex] = pivotStamp;
+
+                        pivotDenseNeighbors.push_back(denseIndex);
+                    }
+                }
+
+                status[element] = Status::Dead;
+
+                std::vector<htd::vertex_t>().swap(elementVariables[element]);
+                std::vector<htd::index_t>().swap(denseNeighbors[element]);
+            }
+        }
+
+        std::vector<htd::vertex_t>().swap(variables[pivot]);
+        std::vector<htd::vertex_t>().swap(elements[pivot]);
+
+        /* All members of the supervariable share their closed neighborhood, hence the first one induces the largest bag. */
+        if (weights[pivot] + pivotDegree + pivotDenseNeighbors.size() > ret)
+        {
+            ret = weights[pivot] + pivotDegree + pivotDenseNeighbors.size();
+        }
+
+        size -= weights[pivot];
+
+        for (htd::vertex_t member = pivot; member != lastMemberMarker; member = nextMember[member])
+        {
+            target.push_back(preprocessedGraph.vertexName(member));
+        }
+
+        status[pivot] = Status::Element;
+
+        weights[pivot] = 0;
+
+        /* Compute the weight of the variables of each adjacent element which are not covered by the new element. */
+        std::size_t externalStamp = ++stamp;
+
+        for (htd::vertex_t variable : pivotVariables)
+        {
+            for (htd::vertex_t element : elements[variable])
+            {
+                if (status[element] == Status::Element)
+                {
+                    if (externalWeightMarker[element] != externalStamp)
+                    {
+                        externalWeightMarker[element] = externalStamp;
+
+                        externalWeights[element] = degrees[element];
+                    }
+
+                    externalWeights[element] -= weights[variable];
+                }
+            }
+        }
+
+        /* Prune the adjacency lists of the variables of the new element, absorb covered elements and eliminate variables which are only adjacent to the new element. */
+        hashes.clear();
+
+        for (htd::vertex_t variable : pivotVariables)
+        {
+            std::size_t externalDegree = 0;
+
+            std::size_t hash = pivot;
+
+            std::vector<htd::vertex_t> & currentElements = elements[variable];
+
+            auto elementEnd = std::remove_if(currentElements.begin(), currentElements.end(), [&](htd::vertex_t element)
+            {
+                bool removed = status[element] != Status::Element;
+
+                if (!removed && externalWeights[element] == 0 &&
+                    std::all_of(denseNeighbors[element].begin(), denseNeighbors[element].end(), [&](htd::index_t denseIndex) { return denseMarker[denseIndex] == pivotStamp; }))
+                {
+                    /* Aggressive absorption: The element is covered by the new element. */
+                    status[element] = Status::Dead;
+
+                    std::vector<htd::vertex_t>().swap(elementVariables[element]);
+                    std::vector<htd::index_t>().swap(denseNeighbors[element]);
+
+                    removed = true;
+                }
+                else if (!removed)
+                {
+                    externalDegree += externalWeights[element] + denseNeighbors[element].size();
+
+                    hash += element;
+                }
+
+                return removed;
+            });
+
+            currentElements.erase(elementEnd, currentElements.end());
+
+            currentElements.push_back(pivot);
+
+            std::vector<htd::vertex_t> & currentVariables = variables[variable];
+
+            currentVariables.erase(std::remove_if(currentVariables.begin(), currentVariables.end(), [&](htd::vertex_t neighbor)
+            {
+                bool removed = status[neighbor] != Status::Variable || pivotMarker[neighbor] == pivotStamp;
+
+                if (!removed)
+                {
+                    externalDegree += weights[neighbor];
+
+                    hash += neighbor;
+                }
+
+                return removed;
+            }), currentVariables.end());
+
+            const std::vector<htd::index_t> & currentDenseNeighbors = denseNeighbors[variable];
+
+            if (currentVariables.empty() && currentElements.size() == 1 &&
+                std::all_of(currentDenseNeighbors.begin(), currentDenseNeighbors.end(), [&](htd::index_t denseIndex) { return denseMarker[denseIndex] == pivotStamp; }))
+            {
+                /* Mass elimination: The closed neighborhood of the variable is a subset of the bag of the pivot. */
+                priorityQueue.erase(variable, priorities[variable]);
+
+                pivotDegree -= weights[variable];
+
+                size -= weights[variable];
+
+                for (htd::vertex_t member = variable; member != lastMemberMarker; member = nextMember[member])
+                {
+                    target.push_back(preprocessedGraph.vertexName(member));
+                }
+
+                status[variable] = Status::Dead;
+
+                weights[variable] = 0;
+
+                std::vector<htd::vertex_t>().swap(currentVariables);
+                std::vector<htd::vertex_t>().swap(currentElements);
+                std::vector<htd::index_t>().swap(denseNeighbors[variable]);
+            }
+            else
+            {
+                for (htd::index_t denseIndex : currentDenseNeighbors)
+                {
+                    hash += denseIndex;
+                }
+
+                /* Store the part of the external degree which does not depend on the final weight of the new element. */
+                partialDegrees[variable] = externalDegree + currentDenseNeighbors.size();
+
+                hashes.emplace_back(hash, variable);
+            }
+        }
+
+        pivotVariables.erase(std::remove_if(pivotVariables.begin(), pivotVariables.end(), [&](htd::vertex_t variable) { return status[variable] != Status::Variable; }), pivotVariables.end());
+
+        /* Update the approximate external degrees of the remaining variables of the new element. */
+        for (htd::vertex_t variable : pivotVariables)
+        {
+            std::size_t weight = weights[variable];
+
+            degrees[variable] = std::min(std::min(partialDegrees[variable] + pivotDegree + pivotDenseNeighbors.size() - weight,
+                                                  degrees[variable] + pivotDegree + pivotDenseNeighbors.size() - weight),
+                                         size + denseVertices.size() - weight);
+        }
+
+        /* Merge indistinguishable variables, i.e., variables with identical adjacency lists in the quotient graph, into supervariables. */
+        std::sort(hashes.begin(), hashes.end());
+
+        for (auto it = hashes.begin(); it != hashes.end(); ++it)
+        {
+            htd::vertex_t variable1 = it->second;
+
+            for (auto it2 = it + 1; status[variable1] == Status::Variable && it2 != hashes.end() && it2->first == it->first; ++it2)
+            {
+                htd::vertex_t variable2 = it2->second;
+
+                if (status[variable2] == Status::Variable &&
+                    variables[variable1].size() == variables[variable2].size() &&
+                    elements[variable1].size() == elements[variable2].size() &&
+                    denseNeighbors[variable1] == denseNeighbors[variable2])
+                {
+                    std::size_t comparisonStamp = ++stamp;
+
+                    for (htd::vertex_t neighbor : variables[variable1])
+                    {
+                        comparisonMarker[neighbor] = comparisonStamp;
+                    }
+
+                    for (htd::vertex_t element : elements[variable1])
+                    {
+                        comparisonMarker[element] = comparisonStamp;
+                    }
+
+                    bool indistinguishable = std::all_of(variables[variable2].begin(), variables[variable2].end(), [&](htd::vertex_t neighbor) { return comparisonMarker[neighbor] == comparisonStamp; }) &&
+                                             std::all_of(elements[variable2].begin(), elements[variable2].end(), [&](htd::vertex_t element) { return comparisonMarker[element] == comparisonStamp; });
+
+                    if (indistinguishable)
+                    {
+                        priorityQueue.erase(variable2, priorities[variable2]);
+
+                        weights[variable1] += weights[variable2];
+
+                        degrees[variable1] -= std::min(degrees[variable1], weights[variable2]);
+
+                        nextMember[lastMember[variable1]] = variable2;
+
+                        lastMember[variable1] = lastMember[variable2];
+
+                        status[variable2] = Status::Merged;
+
+                        weights[variable2] = 0;
+
+                        std::vector<htd::vertex_t>().swap(variables[variable2]);
+                        std::vector<htd::vertex_t>().swap(elements[variable2]);
+                        std::vector<htd::index_t>().swap(denseNeighbors[variable2]);
+                    }
+                }
+            }
+        }
+
+        pivotVariables.erase(std::remove_if(pivotVariables.begin(), pivotVariables.end(), [&](htd::vertex_t variable) { return status[variable] != Status::Variable; }), pivotVariables.end());
+
+        for (htd::vertex_t variable : pivotVariables)
+        {
+            priorityQueue.updatePriority(variable, priorities[variable], degrees[variable]);
+
+            priorities[variable] = degrees[variable];
+
+            HTD_STATISTICS(++priorityQueueUpdateCount;)
+        }
+
+        degrees[pivot] = pivotDegree;
+
+        elementVariables[pivot] = pivotVariables;
+
+        /* An element without variables is only relevant for the dense vertices it connects. */
+        if (pivotVariables.empty() && pivotDenseNeighbors.empty())
+        {
+            status[pivot] = Status::Dead;
+        }
+    }
+
+    if (size == 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        std::size_t denseBagSize = eliminateDenseVertices(preprocessedGraph, denseVertices, denseIndices, status, denseNeighbors, target);
+
+        if (denseBagSize > ret)
+        {
+            ret = denseBagSize;
+        }
+    }
+
+    HTD_STATISTICS(htd::Statistics::increment(*managementInstance_, htd::Statistics::PRIORITY_QUEUE_UPDATES, priorityQueueUpdateCount);)
+
+    return ret;
+}
+
+std::size_t htd::ApproximateMinDegreeOrderingAlgorithm::Implementation::eliminateDenseVertices(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                              const std::vector<htd::vertex_t> & denseVertices,
+                                                                                              const std::vector<htd::index_t> & denseIndices,
+                                                                                              const std::vector<Status> & status,
+                                                                                              const std::vector<std::vector<htd::index_t>> & denseNeighbors,
+                                                                                              std::vector<htd::vertex_t> & target) const HTD_NOEXCEPT
+{
+    std::size_t ret = 0;
+
+    std::size_t denseCount = denseVertices.size();
+
+    std::size_t wordCount = (denseCount + 63) / 64;
+
+    /* The rows of the adjacency matrix of the elimination graph induced by the dense vertices. */
+    std::vector<std::uint64_t> adjacencyMatrix(denseCount * wordCount, 0);
+
+    std::vector<std::uint64_t> remainingVertices(wordCount, 0);
+
+    for (htd::index_t index = 0; index < denseCount; ++index)
+    {
+        remainingVertices[index / 64] |= (std::uint64_t)1 << (index % 64);
+
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(denseVertices[index]))
+        {
+            htd::index_t neighborIndex = denseIndices[neighbor];
+
+            if (neighborIndex != (htd::index_t)-1)
+            {
+                adjacencyMatrix[index * wordCount + neighborIndex / 64] |= (std::uint64_t)1 << (neighborIndex % 64);
+            }
+        }
+    }
+
+    /* Each remaining element connects all dense vertices which are adjacent to it. */
+    for (std::size_t vertex = 0; vertex < status.size(); ++vertex)
+    {
+        if (status[vertex] == Status::Element)
+        {
+            for (htd::index_t index1 : denseNeighbors[vertex])
+            {
+                for (htd::index_t index2 : denseNeighbors[vertex])
+                {
+                    if (index1 != index2)
+                    {
+                        adjacencyMatrix[index1 * wordCount + index2 / 64] |= (std::uint64_t)1 << (index2 % 64);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<htd::index_t> candidates;
+
+    for (std::size_t remainder = denseCount; remainder > 0 && !managementInstance_->isTerminated(); --remainder)
+    {
+        std::size_t minDegree = (std::size_t)-1;
+
+        candidates.clear();
+
+        for (htd::index_t index = 0; index < denseCount; ++index)
+        {
+            if ((remainingVertices[index / 64] >> (index % 64)) & 1)
+            {
+                std::size_t degree = htd::bitset_intersection_size(adjacencyMatrix.data() + index * wordCount, remainingVertices.data(), wordCount);
+
+                if (degree <= minDegree)
+                {
+                    if (degree < minDegree)
+                    {
+                        minDegree = degree;
+
+                        candidates.clear();
+                    }
+
+                    candidates.push_back(index);
+                }
+            }
+        }
+
+        htd::index_t selectedIndex = htd::selectRandomElement<htd::index_t>(candidates, managementInstance_->randomNumberGenerator());
+
+        if (minDegree + 1 > ret)
+        {
+            ret = minDegree + 1;
+        }
+
+        remainingVertices[selectedIndex / 64] &= ~((std::uint64_t)1 << (selectedIndex % 64));
+
+        const std::uint64_t * selectedRow = adjacencyMatrix.data() + selectedIndex * wordCount;
+
+        for (htd::index_t index = 0; index < denseCount; ++index)
+        {
+            if (((remainingVertices[index / 64] & selectedRow[index / 64]) >> (index % 64)) & 1)
+            {
+                std::uint64_t * row = adjacencyMatrix.data() + index * wordCount;
+
+                for (std::size_t word = 0; word < wordCount; ++word)
+                {
+                    row[word] |= selectedRow[word];
+                }
+
+                row[index / 64] &= ~((std::uint64_t)1 << (index % 64));
+            }
+        }
+
+        target.push_back(preprocessedGraph.vertexName(denseVertices[selectedIndex]));
+    }
+
+    return ret;
+}
+
+const htd::LibraryInstance * htd::ApproximateMinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ApproximateMinDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ApproximateMinDegreeOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::clone(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::ApproximateMinDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+#endif
+
+#endif /* HTD_HTD_APPROXIMATEMINDEGREEORDERINGALGORITHM_CPP */
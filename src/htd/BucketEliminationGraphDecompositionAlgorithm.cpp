@@ -34,12 +34,22 @@
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/IConnectedComponentAlgorithm.hpp>
+#include <htd/MultiHypergraphFactory.hpp>
+#include <htd/PreprocessedGraph.hpp>
+#include <htd/PhaseTimer.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <stack>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -56,7 +66,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), computeInducedEdges_(true), lazyInducedEdges_(false), threadCount_(1)
     {
 
     }
@@ -106,6 +116,16 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed on first access.
+     */
+    bool lazyInducedEdges_;
+
+    /**
+     *  The number of threads which shall be used to decompose the connected components of the input graph.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Compute a new mutable graph decompostion of the given graph.
      *
@@ -128,6 +148,48 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+    /**
+     *  Compute a new mutable graph decompostion of the given graph by decomposing its connected components separately using threadCount_ threads.
+     *
+     *  The preprocessed graph is split into one preprocessed graph per component, so that the components are ordered
+     *  based on the same preprocessing results as the graph as a whole.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] components           The connected components of the graph.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition.
+     *  @param[in] maxIterationCount    The maximum number of iterations resulting in a higher maximum bag size than maxBagSize after which a null-pointer is returned.
+     *
+     *  @return A pair consisting of a mutable graph decompostion of the given graph or a null-pointer in case that no decomposition of a component with a appropriate maximum bag size could be found after maxIterationCount iterations and the maximum number of iterations actually needed to find the decompositions of the components.
+     */
+    std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeParallelDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & components, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+
+    /**
+     *  Split a preprocessed graph into one preprocessed graph per connected component of the input graph.
+     *
+     *  The vertices of each component are renamed to their position within the component, starting at htd::Vertex::FIRST,
+     *  and the 0-based identifiers of the preprocessed graph of a component preserve the relative order of the original
+     *  identifiers. Preprocessing never connects different components, hence the neighborhoods, the elimination
+     *  sequence and the remaining vertices are distributed among the components without losing information. The atoms
+     *  are kept by the component containing the remaining vertices of the atom decomposition. The lower bound for the
+     *  treewidth and the bag size of the partial elimination ordering refer to the whole graph and they are therefore
+     *  passed on to each component unchanged, which can only increase the reported width of the ordering of a component
+     *  up to the width of the whole graph.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] componentIndices     The index of the component of each vertex of the input graph.
+     *  @param[in] localVertices        The identifier of each vertex of the input graph within its component.
+     *  @param[in] componentSizes       The number of vertices of each component.
+     *  @param[in] componentEdgeCounts  The number of edges of each component.
+     *
+     *  @return The preprocessed graphs of the components.
+     */
+    std::vector<std::unique_ptr<htd::PreprocessedGraph>> splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                 const std::vector<htd::index_t> & componentIndices,
+                                                                                 const std::vector<htd::vertex_t> & localVertices,
+                                                                                 const std::vector<std::size_t> & componentSizes,
+                                                                                 const std::vector<std::size_t> & componentEdgeCounts) const;
+
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
      *
@@ -392,6 +454,11 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
 
     if (decomposition != nullptr)
     {
+        if (implementation_->computeInducedEdges_ && implementation_->lazyInducedEdges_)
+        {
+            decomposition->setInducedHyperedgeIndex(std::make_shared<htd::InducedHyperedgeIndex>(graph));
+        }
+
         std::vector<htd::ILabelingFunction *> labelingFunctions;
 
         std::vector<htd::IGraphDecompositionManipulationOperation *> postProcessingOperations;
@@ -413,6 +480,8 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
             }
         }
 
+        HTD_STATISTICS(htd::PhaseTimer manipulationTimer(*(implementation_->managementInstance_), htd::Statistics::MANIPULATION_PHASE);)
+
         for (const auto & operation : implementation_->postProcessingOperations_)
         {
             operation->apply(graph, *decomposition);
@@ -451,6 +520,8 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
             }
         }
 
+        HTD_STATISTICS(manipulationTimer.stop();)
+
         for (auto & labelingFunction : labelingFunctions)
         {
             delete labelingFunction;
@@ -587,6 +658,18 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::setManagementInstance(co
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->orderingAlgorithm_->setManagementInstance(manager);
+
+    for (htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+    {
+        labelingFunction->setManagementInstance(manager);
+    }
+
+    for (htd::IGraphDecompositionManipulationOperation * postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        postProcessingOperation->setManagementInstance(manager);
+    }
 }
 
 bool htd::BucketEliminationGraphDecompositionAlgorithm::isCompressionEnabled(void) const
@@ -609,12 +692,36 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::setComputeInducedEdgesEn
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+bool htd::BucketEliminationGraphDecompositionAlgorithm::isLazyInducedEdgeComputationEnabled(void) const
+{
+    return implementation_->lazyInducedEdges_;
+}
+
+void htd::BucketEliminationGraphDecompositionAlgorithm::setLazyInducedEdgeComputationEnabled(bool lazyInducedEdgeComputationEnabled)
+{
+    implementation_->lazyInducedEdges_ = lazyInducedEdgeComputationEnabled;
+}
+
+std::size_t htd::BucketEliminationGraphDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::BucketEliminationGraphDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphDecompositionAlgorithm::clone(void) const
 {
     htd::BucketEliminationGraphDecompositionAlgorithm * ret = new htd::BucketEliminationGraphDecompositionAlgorithm(implementation_->managementInstance_);
 
     ret->setCompressionEnabled(implementation_->compressionEnabled_);
     ret->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
+    ret->setLazyInducedEdgeComputationEnabled(implementation_->lazyInducedEdges_);
+    ret->setThreadCount(implementation_->threadCount_);
 
     for (const auto & labelingFunction : implementation_->labelingFunctions_)
     {
@@ -645,6 +752,24 @@ htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphD
 
 std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const
 {
+    if (threadCount_ > 1 && graph.vertexCount() > 1)
+    {
+        std::vector<std::vector<htd::vertex_t>> components;
+
+        htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+
+        HTD_ASSERT(connectedComponentAlgorithm != nullptr)
+
+        connectedComponentAlgorithm->determineComponents(graph, components);
+
+        delete connectedComponentAlgorithm;
+
+        if (components.size() > 1)
+        {
+            return computeParallelDecomposition(graph, preprocessedGraph, components, maxBagSize, maxIterationCount);
+        }
+    }
+
     htd::IMutableGraphDecomposition * ret = nullptr;
 
     htd::IWidthLimitableOrderingAlgorithm * widthLimitableAlgorithm = dynamic_cast<htd::IWidthLimitableOrderingAlgorithm *>(orderingAlgorithm_);
@@ -657,8 +782,12 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
         do
         {
+            HTD_STATISTICS(htd::PhaseTimer orderingTimer(*managementInstance_, htd::Statistics::ORDERING_PHASE);)
+
             ordering = orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
 
+            HTD_STATISTICS(orderingTimer.stop();)
+
             if (ordering != nullptr)
             {
                 if (ordering->sequence().size() == graph.vertexCount())
@@ -684,8 +813,12 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
     }
     else
     {
+        HTD_STATISTICS(htd::PhaseTimer orderingTimer(*managementInstance_, htd::Statistics::ORDERING_PHASE);)
+
         htd::IWidthLimitedVertexOrdering * ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
 
+        HTD_STATISTICS(orderingTimer.stop();)
+
         if (ordering != nullptr)
         {
             if (ordering->sequence().size() == graph.vertexCount())
@@ -702,16 +835,401 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
     return std::make_pair(ret, iterations);
 }
 
+std::vector<std::unique_ptr<htd::PreprocessedGraph>> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::splitPreprocessedGraph(const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                                                                                  const std::vector<htd::index_t> & componentIndices,
+                                                                                                                                                  const std::vector<htd::vertex_t> & localVertices,
+                                                                                                                                                  const std::vector<std::size_t> & componentSizes,
+                                                                                                                                                  const std::vector<std::size_t> & componentEdgeCounts) const
+{
+    std::size_t componentCount = componentSizes.size();
+
+    const std::vector<htd::vertex_t> & vertexNames = preprocessedGraph.vertexNames();
+
+    std::size_t vertexCount = vertexNames.size();
+
+    std::vector<std::vector<htd::vertex_t>> names(componentCount);
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> neighborhoods(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> eliminationSequences(componentCount);
+
+    std::vector<std::vector<htd::vertex_t>> remainingVertices(componentCount);
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> atoms(componentCount);
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        names[componentIndex].reserve(componentSizes[componentIndex]);
+    }
+
+    /* The 0-based identifier of each vertex of the preprocessed graph within the preprocessed graph of its component. */
+    std::vector<htd::vertex_t> localIdentifiers(vertexCount);
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        htd::vertex_t vertexName = vertexNames[vertex];
+
+        std::vector<htd::vertex_t> & currentNames = names[componentIndices[vertexName]];
+
+        localIdentifiers[vertex] = static_cast<htd::vertex_t>(currentNames.size());
+
+        currentNames.push_back(localVertices[vertexName]);
+    }
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        neighborhoods[componentIndex].resize(names[componentIndex].size());
+    }
+
+    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhoods[componentIndices[vertexNames[vertex]]][localIdentifiers[vertex]];
+
+        const std::vector<htd::vertex_t> & originalNeighborhood = preprocessedGraph.neighborhood(vertex);
+
+        currentNeighborhood.reserve(originalNeighborhood.size());
+
+        for (htd::vertex_t neighbor : originalNeighborhood)
+        {
+            currentNeighborhood.push_back(localIdentifiers[neighbor]);
+        }
+    }
+
+    /* In contrast to the remaining vertices, the elimination sequence consists of the actual identifiers of the vertices. */
+    for (htd::vertex_t vertex : preprocessedGraph.eliminationSequence())
+    {
+        eliminationSequences[componentIndices[vertex]].push_back(localVertices[vertex]);
+    }
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        remainingVertices[componentIndices[vertexNames[vertex]]].push_back(localIdentifiers[vertex]);
+    }
+
+    const std::vector<std::vector<htd::vertex_t>> & originalAtoms = preprocessedGraph.atoms();
+
+    /* The last atom of a preprocessed graph consists of its remaining vertices, hence only the component containing the last atom keeps the atom decomposition. */
+    if (!originalAtoms.empty() && !originalAtoms.back().empty())
+    {
+        htd::index_t atomComponent = componentIndices[vertexNames[originalAtoms.back()[0]]];
+
+        for (const std::vector<htd::vertex_t> & atom : originalAtoms)
+        {
+            if (!atom.empty() && componentIndices[vertexNames[atom[0]]] == atomComponent)
+            {
+                std::vector<htd::vertex_t> localAtom;
+
+                localAtom.reserve(atom.size());
+
+                for (htd::vertex_t vertex : atom)
+                {
+                    localAtom.push_back(localIdentifiers[vertex]);
+                }
+
+                atoms[atomComponent].push_back(std::move(localAtom));
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<htd::PreprocessedGraph>> ret;
+
+    ret.reserve(componentCount);
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        ret.emplace_back(new htd::PreprocessedGraph(std::move(names[componentIndex]),
+                                                    std::move(neighborhoods[componentIndex]),
+                                                    std::move(eliminationSequences[componentIndex]),
+                                                    std::move(remainingVertices[componentIndex]),
+                                                    componentEdgeCounts[componentIndex],
+                                                    preprocessedGraph.minTreeWidth()));
+
+        ret.back()->setEliminationSequenceBagSize(preprocessedGraph.eliminationSequenceBagSize());
+
+        ret.back()->setAtoms(std::move(atoms[componentIndex]));
+    }
+
+    return ret;
+}
+
+std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeParallelDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & components, std::size_t maxBagSize, std::size_t maxIterationCount) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::size_t componentCount = components.size();
+
+    htd::vertex_t lastVertex = graph.vertexAtPosition(graph.vertexCount() - 1);
+
+    std::vector<htd::index_t> componentIndices(lastVertex + 1);
+
+    std::vector<htd::vertex_t> localVertices(lastVertex + 1);
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        std::vector<htd::vertex_t> & component = components[componentIndex];
+
+        std::sort(component.begin(), component.end());
+
+        /* The vertices of a component keep their relative order in the graph of the component, hence the bags stay sorted when they are translated back. */
+        htd::vertex_t localVertex = htd::Vertex::FIRST;
+
+        for (htd::vertex_t vertex : component)
+        {
+            componentIndices[vertex] = componentIndex;
+
+            localVertices[vertex] = localVertex++;
+        }
+    }
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> componentEdges(componentCount);
+
+    std::vector<std::vector<htd::index_t>> edgePositions(componentCount);
+
+    htd::index_t edgePosition = 0;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        const std::vector<htd::vertex_t> & elements = hyperedge.elements();
+
+        if (!elements.empty())
+        {
+            htd::index_t componentIndex = componentIndices[elements[0]];
+
+            std::vector<htd::vertex_t> localElements;
+
+            localElements.reserve(elements.size());
+
+            for (htd::vertex_t vertex : elements)
+            {
+                localElements.push_back(localVertices[vertex]);
+            }
+
+            componentEdges[componentIndex].push_back(std::move(localElements));
+
+            edgePositions[componentIndex].push_back(edgePosition);
+        }
+
+        ++edgePosition;
+    }
+
+    std::vector<std::size_t> componentSizes(componentCount);
+
+    std::vector<std::size_t> componentEdgeCounts(componentCount);
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        componentSizes[componentIndex] = components[componentIndex].size();
+
+        componentEdgeCounts[componentIndex] = componentEdges[componentIndex].size();
+    }
+
+    std::vector<std::unique_ptr<htd::PreprocessedGraph>> preprocessedComponents = splitPreprocessedGraph(preprocessedGraph, componentIndices, localVertices, componentSizes, componentEdgeCounts);
+
+    std::size_t workerCount = std::min(threadCount_, componentCount);
+
+    std::uint64_t baseSeed = managementInstance_->randomNumberGenerator()();
+
+    std::vector<std::unique_ptr<htd::LibraryInstance>> workerInstances;
+
+    for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        htd::LibraryInstance * workerInstance = htd::cloneManagementInstance(managementInstance);
+
+        workerInstances.emplace_back(workerInstance);
+    }
+
+    std::vector<htd::IMutableGraphDecomposition *> decompositions(componentCount, nullptr);
+
+    /* The positions of the hyperedges of the input graph induced by each bag of the decompositions of the components, indexed by the position of the bag. */
+    std::vector<std::vector<std::vector<htd::index_t>>> inducedEdgePositions(componentCount);
+
+    std::vector<std::size_t> iterations(componentCount, 0);
+
+    std::atomic<htd::index_t> nextComponent(0);
+
+    std::atomic<bool> failed(false);
+
+    std::mutex mutex;
+
+    std::condition_variable stateChanged;
+
+    std::size_t activeWorkerCount = workerCount;
+
+    auto runWorker = [&](htd::index_t workerIndex)
+    {
+        htd::LibraryInstance & workerInstance = *(workerInstances[workerIndex]);
+
+        Implementation implementation(&workerInstance);
+
+        delete implementation.orderingAlgorithm_;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        implementation.orderingAlgorithm_ = orderingAlgorithm_->clone();
+#else
+        implementation.orderingAlgorithm_ = orderingAlgorithm_->cloneOrderingAlgorithm();
+#endif
+
+        implementation.orderingAlgorithm_->setManagementInstance(&workerInstance);
+
+        implementation.compressionEnabled_ = compressionEnabled_;
+        implementation.computeInducedEdges_ = computeInducedEdges_;
+        implementation.lazyInducedEdges_ = lazyInducedEdges_;
+
+        for (htd::index_t componentIndex = nextComponent++; componentIndex < componentCount && !failed && !workerInstance.isTerminated(); componentIndex = nextComponent++)
+        {
+            workerInstance.randomNumberGenerator().seed(baseSeed + componentIndex);
+
+            const std::vector<htd::vertex_t> & component = components[componentIndex];
+
+            std::unique_ptr<htd::IMutableMultiHypergraph> componentGraph(workerInstance.multiHypergraphFactory().createInstance(component.size()));
+
+            componentGraph->addEdges(std::move(componentEdges[componentIndex]));
+
+            std::pair<htd::IMutableGraphDecomposition *, std::size_t> result = implementation.computeMutableDecomposition(*componentGraph, *(preprocessedComponents[componentIndex]), maxBagSize, maxIterationCount);
+
+            iterations[componentIndex] = result.second;
+
+            if (result.first != nullptr && !workerInstance.isTerminated())
+            {
+                htd::IMutableGraphDecomposition & decomposition = *(result.first);
+
+                std::vector<htd::index_t> edgePositionsById;
+
+                const std::vector<htd::index_t> & currentEdgePositions = edgePositions[componentIndex];
+
+                htd::index_t index = 0;
+
+                for (const htd::Hyperedge & hyperedge : componentGraph->hyperedges())
+                {
+                    if (hyperedge.id() >= edgePositionsById.size())
+                    {
+                        edgePositionsById.resize(hyperedge.id() + 1);
+                    }
+
+                    edgePositionsById[hyperedge.id()] = currentEdgePositions[index++];
+                }
+
+                std::vector<std::vector<htd::index_t>> & currentInducedEdgePositions = inducedEdgePositions[componentIndex];
+
+                currentInducedEdgePositions.resize(decomposition.vertexCount());
+
+                index = 0;
+
+                for (htd::vertex_t node : decomposition.vertices())
+                {
+                    for (htd::vertex_t & vertex : decomposition.mutableBagContent(node))
+                    {
+                        vertex = component[vertex - htd::Vertex::FIRST];
+                    }
+
+                    for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+                    {
+                        currentInducedEdgePositions[index].push_back(edgePositionsById[hyperedge.id()]);
+                    }
+
+                    ++index;
+                }
+
+                decompositions[componentIndex] = result.first;
+            }
+            else
+            {
+                delete result.first;
+
+                failed = true;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        --activeWorkerCount;
+
+        stateChanged.notify_all();
+    };
+
+    std::vector<std::thread> workers;
+
+    for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.emplace_back(runWorker, workerIndex);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (activeWorkerCount > 0)
+        {
+            stateChanged.wait_for(lock, std::chrono::milliseconds(10));
+
+            if (managementInstance.isTerminated())
+            {
+                for (const std::unique_ptr<htd::LibraryInstance> & workerInstance : workerInstances)
+                {
+                    workerInstance->terminate();
+                }
+            }
+        }
+    }
+
+    for (std::thread & worker : workers)
+    {
+        worker.join();
+    }
+
+    htd::IMutableGraphDecomposition * ret = nullptr;
+
+    if (!failed && !managementInstance.isTerminated())
+    {
+        ret = managementInstance.graphDecompositionFactory().createInstance();
+    }
+
+    std::vector<htd::vertex_t> decompositionVertices;
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        htd::IMutableGraphDecomposition * decomposition = decompositions[componentIndex];
+
+        if (ret != nullptr && decomposition != nullptr)
+        {
+            std::vector<std::vector<htd::index_t>> & currentInducedEdgePositions = inducedEdgePositions[componentIndex];
+
+            decompositionVertices.assign(decomposition->vertexCount() > 0 ? decomposition->vertexAtPosition(decomposition->vertexCount() - 1) + 1 : 0, htd::Vertex::UNKNOWN);
+
+            htd::index_t index = 0;
+
+            for (htd::vertex_t node : decomposition->vertices())
+            {
+                decompositionVertices[node] = ret->addVertex(std::move(decomposition->mutableBagContent(node)), graph.hyperedgesAtPositions(std::move(currentInducedEdgePositions[index])));
+
+                ++index;
+            }
+
+            for (const htd::Hyperedge & edge : decomposition->hyperedges())
+            {
+                ret->addEdge(decompositionVertices[edge[0]], decompositionVertices[edge[1]]);
+            }
+        }
+
+        delete decomposition;
+    }
+
+    return std::make_pair(ret, *std::max_element(iterations.begin(), iterations.end()));
+}
+
 htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const
 {
     const htd::LibraryInstance & managementInstance = *managementInstance_;
 
+    HTD_STATISTICS(htd::PhaseTimer phaseTimer(managementInstance, htd::Statistics::BUCKET_ELIMINATION_PHASE);)
+
     htd::IMutableGraphDecomposition * ret = managementInstance.graphDecompositionFactory().createInstance();
 
     std::size_t size = graph.vertexCount();
 
     HTD_ASSERT(ordering.size() == size)
 
+    HTD_STATISTICS(htd::Statistics::increment(managementInstance, htd::Statistics::ELIMINATED_VERTICES, size);)
+
     if (size > 0)
     {
         if (!managementInstance.isTerminated())
@@ -879,8 +1397,10 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
                 inducedEdges[vertex].clear();
             }
 
-            if (computeInducedEdges_)
+            if (computeInducedEdges_ && !lazyInducedEdges_)
             {
+                HTD_STATISTICS(htd::PhaseTimer inducedEdgesTimer(managementInstance, htd::Statistics::INDUCED_EDGES_PHASE);)
+
                 hyperedgePosition = hyperedges.begin();
 
                 std::vector<htd::id_t> lastAssignedEdge(buckets.size() + 1, (htd::id_t)-1);
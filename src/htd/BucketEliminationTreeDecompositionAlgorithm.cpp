@@ -40,6 +40,7 @@
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/PhaseTimer.hpp>
 
 #include <algorithm>
 #include <cstdarg>
@@ -231,6 +232,8 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
             }
         }
 
+        HTD_STATISTICS(htd::PhaseTimer manipulationTimer(*(implementation_->managementInstance_), htd::Statistics::MANIPULATION_PHASE);)
+
         for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
         {
             operation->apply(graph, *decomposition);
@@ -389,6 +392,18 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setManagementInstance(con
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->baseAlgorithm_->setManagementInstance(manager);
+
+    for (htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+    {
+        labelingFunction->setManagementInstance(manager);
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        postProcessingOperation->setManagementInstance(manager);
+    }
 }
 
 bool htd::BucketEliminationTreeDecompositionAlgorithm::isCompressionEnabled(void) const
@@ -401,6 +416,16 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setCompressionEnabled(boo
     implementation_->baseAlgorithm_->setCompressionEnabled(compressionEnabled);
 }
 
+std::size_t htd::BucketEliminationTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->baseAlgorithm_->threadCount();
+}
+
+void htd::BucketEliminationTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    implementation_->baseAlgorithm_->setThreadCount(threadCount);
+}
+
 bool htd::BucketEliminationTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
 {
     return implementation_->baseAlgorithm_->isComputeInducedEdgesEnabled();
@@ -411,6 +436,16 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setComputeInducedEdgesEna
     implementation_->baseAlgorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
 }
 
+bool htd::BucketEliminationTreeDecompositionAlgorithm::isLazyInducedEdgeComputationEnabled(void) const
+{
+    return implementation_->baseAlgorithm_->isLazyInducedEdgeComputationEnabled();
+}
+
+void htd::BucketEliminationTreeDecompositionAlgorithm::setLazyInducedEdgeComputationEnabled(bool lazyInducedEdgeComputationEnabled)
+{
+    implementation_->baseAlgorithm_->setLazyInducedEdgeComputationEnabled(lazyInducedEdgeComputationEnabled);
+}
+
 htd::BucketEliminationTreeDecompositionAlgorithm * htd::BucketEliminationTreeDecompositionAlgorithm::clone(void) const
 {
     return new htd::BucketEliminationTreeDecompositionAlgorithm(*this);
@@ -428,6 +463,8 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
         if (graphDecomposition.first != nullptr)
         {
+            HTD_STATISTICS(htd::PhaseTimer phaseTimer(*managementInstance_, htd::Statistics::BUCKET_ELIMINATION_PHASE);)
+
             htd::IMutableGraphDecomposition & mutableGraphDecomposition = managementInstance_->graphDecompositionFactory().accessMutableInstance(*(graphDecomposition.first));
 
             if (!managementInstance_->isTerminated())
@@ -453,13 +490,9 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = component1[managementInstance_->randomNumberGenerator().nextIndex(component1.size())];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = component2[managementInstance_->randomNumberGenerator().nextIndex(component2.size())];
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -470,28 +503,49 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 std::unordered_map<htd::vertex_t, htd::vertex_t> vertexMapping;
 
+                bool lazyInducedEdges = baseAlgorithm_->isComputeInducedEdgesEnabled() && baseAlgorithm_->isLazyInducedEdgeComputationEnabled();
+
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(managementInstance_->randomNumberGenerator().nextIndex(graphDecomposition.first->vertexCount())), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
                     if (predecessor == htd::Vertex::UNKNOWN)
                     {
-                        node = ret->insertRoot(std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
-                                               std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        if (lazyInducedEdges)
+                        {
+                            node = ret->insertRoot(std::move(mutableGraphDecomposition.mutableBagContent(vertex)), htd::FilteredHyperedgeCollection());
+                        }
+                        else
+                        {
+                            node = ret->insertRoot(std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
+                                                   std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        }
                     }
                     else
                     {
-                        node = ret->addChild(vertexMapping.at(predecessor),
-                                             std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
-                                             std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        if (lazyInducedEdges)
+                        {
+                            node = ret->addChild(vertexMapping.at(predecessor),
+                                                 std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
+                                                 htd::FilteredHyperedgeCollection());
+                        }
+                        else
+                        {
+                            node = ret->addChild(vertexMapping.at(predecessor),
+                                                 std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
+                                                 std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        }
                     }
 
                     vertexMapping.emplace(vertex, node);
                 });
+
+                if (lazyInducedEdges)
+                {
+                    ret->setInducedHyperedgeIndex(std::make_shared<htd::InducedHyperedgeIndex>(graph));
+                }
             }
             else
             {
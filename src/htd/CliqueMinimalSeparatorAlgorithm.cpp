@@ -27,15 +27,11 @@
 
 #include <htd/Helpers.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
-
-#include <htd/MultiGraphFactory.hpp>
-#include <htd/VectorAdapter.hpp>
+#include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
-#include <numeric>
-#include <stack>
+#include <functional>
 #include <unordered_map>
-#include <unordered_set>
 
 /**
  *  Private implementation details of class htd::CliqueMinimalSeparatorAlgorithm.
@@ -63,713 +59,327 @@ struct htd::CliqueMinimalSeparatorAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Internal data structure representing a triangulated graph.
+     *  Collect all unnumbered vertices which are connected to the selected vertex via a path whose inner vertices are
+     *  unnumbered and have a weight strictly less than the weight of the respective vertex.
+     *
+     *  @param[in] neighborhood     The neighborhood of each of the vertices.
+     *  @param[in] weights          A vector containing the weights associated with each of the vertices.
+     *  @param[in] numbered         A vector indicating for each of the vertices whether it is already numbered.
+     *  @param[in] selectedVertex   The selected vertex.
+     *  @param[in] maximumWeight    An upper bound for the weights of the unnumbered vertices.
+     *  @param[in] stamp            The stamp which marks the vertices reached during the current search.
+     *  @param[in,out] reached      A vector containing the stamp of the last search which reached the respective vertex.
+     *  @param[in,out] reachBuckets The buckets of reached vertices, indexed by the maximum weight on their path. The buckets are empty after the search.
+     *  @param[out] result          The vertices whose weight shall be incremented.
      */
-    class TriangulatedGraph : public htd::IGraphStructure
+    void collectReachableVertices(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                  const std::vector<std::size_t> & weights,
+                                  const std::vector<char> & numbered,
+                                  htd::vertex_t selectedVertex,
+                                  std::size_t maximumWeight,
+                                  std::size_t stamp,
+                                  std::vector<std::size_t> & reached,
+                                  std::vector<std::vector<htd::vertex_t>> & reachBuckets,
+                                  std::vector<htd::vertex_t> & result) const
     {
-        public:
-            /**
-             *  Constructor for a triangulated graph.
-             *
-             *  @param[in] graph    The graph which shall be triangulated.
-             */
-            TriangulatedGraph(const htd::IGraphStructure & graph) : names_(), internalNames_(), vertices_(graph.vertexCount()), neighborhood_(graph.vertexCount()), edgeCount_()
-            {
-                initialize(graph);
-
-                std::iota(vertices_.begin(), vertices_.end(), 0);
-            }
-
-            /**
-             *  Copy constructor for a triangulated graph.
-             *
-             *  @param[in] original The original triangulated graph.
-             */
-            TriangulatedGraph(const TriangulatedGraph & original) : names_(original.names_), internalNames_(original.internalNames_), vertices_(original.vertices_), neighborhood_(original.neighborhood_), edgeCount_(original.edgeCount_)
-            {
-
-            }
-
-            /**
-             *  Destructor for a triangulated graph.
-             */
-            virtual ~TriangulatedGraph()
-            {
-
-            }
+        if (reachBuckets.size() <= maximumWeight)
+        {
+            reachBuckets.resize(maximumWeight + 1);
+        }
 
-            std::size_t vertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return neighborhood_.size();
-            }
+        result.clear();
 
-            std::size_t edgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        for (htd::vertex_t neighbor : neighborhood[selectedVertex])
+        {
+            if (!numbered[neighbor])
             {
-                return edgeCount_;
-            }
+                reached[neighbor] = stamp;
 
-            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return neighborCount(vertex);
-            }
+                reachBuckets[weights[neighbor]].push_back(neighbor);
 
-            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
-            {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
+                result.push_back(neighbor);
             }
+        }
 
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                target.insert(target.end(), vertices_.begin(), vertices_.end());
-            }
-
-            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(index < vertices_.size())
-
-                return vertices_[index];
-            }
+        for (std::size_t currentWeight = 0; currentWeight <= maximumWeight; ++currentWeight)
+        {
+            std::vector<htd::vertex_t> & bucket = reachBuckets[currentWeight];
 
-            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
+            while (!bucket.empty())
             {
-                return vertex < vertexCount();
-            }
+                htd::vertex_t vertex = bucket.back();
 
-            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
+                bucket.pop_back();
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
+                for (htd::vertex_t neighbor : neighborhood[vertex])
                 {
-                    if (currentNeighborhood.empty())
+                    if (!numbered[neighbor] && reached[neighbor] != stamp)
                     {
-                        ret++;
-                    }
-                }
+                        reached[neighbor] = stamp;
 
-                return ret;
-            }
+                        std::size_t neighborWeight = weights[neighbor];
 
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
-            {
-                htd::VectorAdapter<htd::vertex_t> ret;
-
-                auto & result = ret.container();
+                        if (neighborWeight > currentWeight)
+                        {
+                            reachBuckets[neighborWeight].push_back(neighbor);
 
-                for (htd::vertex_t vertex : vertices_)
-                {
-                    if (neighborhood_[vertex].empty())
-                    {
-                        result.push_back(vertex);
+                            result.push_back(neighbor);
+                        }
+                        else
+                        {
+                            bucket.push_back(neighbor);
+                        }
                     }
                 }
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
-            }
-
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
-
-                HTD_ASSERT(index < isolatedVertexCollection.size())
-
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
-
-                std::advance(it, index);
-
-                return *it;
-            }
-
-            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return neighborhood_[vertex].empty();
-            }
-
-            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return neighborhood_[vertex].size();
-            }
-
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                return htd::ConstCollection<htd::vertex_t>::getInstance(neighborhood_[vertex]);
             }
+        }
+    }
 
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
-
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+    /**
+     *  Decompose the given graph into its atoms.
+     *
+     *  In a first step, MCS-M computes a minimal elimination ordering. Each vertex whose label was not larger than the label
+     *  of the vertex numbered before generates a minimal separator, namely the set of its higher neighbors in the computed
+     *  minimal triangulation. In a second step, the generators are processed in elimination order and each generated
+     *  separator which is a clique in the input graph splits off the component containing its generator from the
+     *  remaining graph.
+     *
+     *  @param[in] graph        The graph which shall be decomposed.
+     *  @param[out] atoms       The atoms of the given graph, each sorted in ascending order, in the order in which they were split off.
+     *  @param[out] separators  The clique minimal separator which split off the respective atom. The separator of the last atom is empty.
+     */
+    void decompose(const htd::IGraphStructure & graph,
+                   std::vector<std::vector<htd::vertex_t>> & atoms,
+                   std::vector<std::vector<htd::vertex_t>> & separators) const
+    {
+        std::vector<htd::vertex_t> names;
 
-                target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
-            }
+        graph.copyVerticesTo(names);
 
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+        std::sort(names.begin(), names.end());
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+        std::size_t size = names.size();
 
-                HTD_ASSERT(index < currentNeighborhood.size())
+        if (size == 0)
+        {
+            return;
+        }
 
-                return currentNeighborhood[index];
-            }
+        std::unordered_map<htd::vertex_t, htd::vertex_t> indices(size);
 
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            indices.emplace(names[index], static_cast<htd::vertex_t>(index));
+        }
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+        /* The internal identifiers preserve the order of the vertices, hence sorted sets of identifiers translate to sorted sets of vertices. */
+        std::vector<std::vector<htd::vertex_t>> neighborhood(size);
 
-                return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
-            }
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[index];
 
-            bool isConnected(void) const HTD_OVERRIDE
+            for (htd::vertex_t neighbor : graph.neighbors(names[index]))
             {
-                bool ret = true;
+                auto position = indices.find(neighbor);
 
-                if (!vertices_.empty())
+                if (position != indices.end() && position->second != index)
                 {
-                    std::stack<htd::vertex_t> originStack;
-
-                    std::unordered_set<htd::vertex_t> visitedVertices;
-
-                    htd::vertex_t currentVertex = vertices_[0];
-
-                    originStack.push(currentVertex);
-
-                    while (!originStack.empty())
-                    {
-                        currentVertex = originStack.top();
-
-                        if (visitedVertices.count(currentVertex) == 0)
-                        {
-                            visitedVertices.insert(currentVertex);
-
-                            originStack.pop();
-
-                            for (htd::vertex_t neighbor : neighborhood_[currentVertex])
-                            {
-                                if (visitedVertices.count(neighbor) == 0)
-                                {
-                                    originStack.push(neighbor);
-                                }
-                            }
-                        }
-                        else
-                        {
-                            originStack.pop();
-                        }
-                    }
-
-                    ret = visitedVertices.size() == vertices_.size();
+                    currentNeighborhood.push_back(position->second);
                 }
-                else
-                {
-                    ret = true;
-                }
-
-                return ret;
             }
 
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
 
-                bool ret = false;
+            currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+        }
 
-                if (vertex1 == vertex2)
-                {
-                    ret = true;
-                }
-                else
-                {
-                    std::vector<htd::vertex_t> newVertices;
-                    std::vector<htd::vertex_t> tmpVertices;
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-                    std::vector<bool> reachableVertices(vertices_.size());
+        htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
 
-                    reachableVertices[vertex1] = true;
+        std::vector<std::size_t> weights(size, 0);
 
-                    newVertices.push_back(vertex1);
+        std::vector<char> numbered(size, 0);
 
-                    while (!ret && !newVertices.empty())
-                    {
-                        std::swap(tmpVertices, newVertices);
+        std::vector<char> generatesSeparator(size, 0);
 
-                        newVertices.resize(0);
+        std::vector<std::size_t> reached(size, 0);
 
-                        for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
-                        {
-                            const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
+        std::vector<std::vector<htd::vertex_t>> reachBuckets;
 
-                            for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
-                            {
-                                htd::vertex_t neighbor = *it2;
+        std::vector<htd::vertex_t> reachableVertices;
 
-                                if (!reachableVertices[neighbor])
-                                {
-                                    reachableVertices[neighbor] = true;
+        /* The neighbors of each vertex in the minimal triangulation which are numbered before the vertex itself. */
+        std::vector<std::vector<htd::vertex_t>> higherNeighbors(size);
 
-                                    newVertices.push_back(neighbor);
+        std::vector<htd::vertex_t> ordering;
+        ordering.reserve(size);
 
-                                    if (neighbor == vertex2)
-                                    {
-                                        ret = true;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            priorityQueue.push(vertex, 0);
+        }
 
-                return ret;
-            }
+        std::size_t lastWeight = (std::size_t)-1;
 
-            /**
-             *  Getter for the actual identifiers of the vertices.
-             *
-             *  @return The actual identifiers of the vertices.
-             */
-            const std::vector<htd::vertex_t> & vertexNames(void) const HTD_NOEXCEPT
-            {
-                return names_;
-            }
+        while (ordering.size() < size && !managementInstance.isTerminated())
+        {
+            std::size_t maximumWeight = priorityQueue.topPriority();
 
-            /**
-             *  Getter for the actual identifier of the given vertex.
-             *
-             *  @param[in] vertex   The internal name of the vertex whose position shall be returned.
-             *
-             *  @return The actual identifier of the given vertex.
-             */
-            htd::vertex_t vertexName(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance.randomNumberGenerator());
 
-                return names_[vertex];
-            }
+            priorityQueue.eraseFromTopCollection(selectedVertex);
 
-            /**
-             *  Getter for the internal identifier of the given vertex.
-             *
-             *  @param[in] vertex   The name of the vertex whose internal identifier shall be returned.
-             *
-             *  @return The internal identifier of the given vertex.
-             */
-            htd::vertex_t internalVertexName(htd::vertex_t vertex) const
+            if (lastWeight != (std::size_t)-1 && maximumWeight <= lastWeight)
             {
-                return internalNames_.at(vertex);
+                generatesSeparator[selectedVertex] = 1;
             }
 
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> & neighborhood(void) HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
+            lastWeight = maximumWeight;
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
-
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex)
-            {
-                HTD_ASSERT(vertex < names_.size());
+            numbered[selectedVertex] = 1;
 
-                return neighborhood_[vertex];
-            }
+            collectReachableVertices(neighborhood, weights, numbered, selectedVertex, maximumWeight, ordering.size() + 1, reached, reachBuckets, reachableVertices);
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
+            for (htd::vertex_t vertex : reachableVertices)
             {
-                HTD_ASSERT(vertex < names_.size());
+                std::size_t & currentWeight = weights[vertex];
 
-                return neighborhood_[vertex];
-            }
+                priorityQueue.updatePriority(vertex, currentWeight, currentWeight + 1);
 
-            /**
-             *  Remove a vertex from the graph.
-             *
-             *  @param[in] vertex   The ID of the vertex which shall be removed.
-             */
-            void removeVertex(htd::vertex_t vertex)
-            {
-                HTD_ASSERT(vertex < names_.size());
-
-                std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood_[vertex];
-
-                edgeCount_ -= selectedNeighborhood.size();
-
-                for (htd::vertex_t neighbor : selectedNeighborhood)
-                {
-                    std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[neighbor];
+                ++currentWeight;
 
-                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'currentNeighborhood'. */
-                    // coverity[use_iterator]
-                    currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex));
-                }
-
-                std::vector<htd::vertex_t>().swap(selectedNeighborhood);
+                higherNeighbors[vertex].push_back(selectedVertex);
             }
 
-            /**
-             *  Add a new edge to the graph.
-             *
-             *  @param[in] vertex1  The first endpoint of the edge.
-             *  @param[in] vertex2  The second endpoint of the edge.
-             */
-            void addTriangulationEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
-            {
-                HTD_ASSERT(vertex1 != vertex2)
-                HTD_ASSERT(vertex1 < names_.size() && vertex2 < names_.size());
+            ordering.push_back(selectedVertex);
+        }
 
-                std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[vertex1];
+        if (managementInstance.isTerminated())
+        {
+            atoms.push_back(names);
 
-                auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2);
+            separators.emplace_back();
 
-                if (position == neighborhood1.end() || *position != vertex2)
-                {
-                    neighborhood1.insert(position, vertex2);
+            return;
+        }
 
-                    std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[vertex2];
+        std::vector<char> removed(size, 0);
 
-                    neighborhood2.insert(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1), vertex1);
-                }
+        std::vector<std::size_t> marks(size, 0);
 
-                ++edgeCount_;
-            }
+        std::size_t currentMark = 0;
 
-            /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
-            {
-                edgeCount_ = 0;
+        std::size_t remainingVertexCount = size;
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    edgeCount_ += currentNeighborhood.size();
-                }
+        std::vector<htd::vertex_t> component;
 
-                edgeCount_ = edgeCount_ >> 1;
-            }
+        for (auto it = ordering.rbegin(); it != ordering.rend() && !managementInstance.isTerminated(); ++it)
+        {
+            htd::vertex_t vertex = *it;
 
-#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            /**
-             *  Create a deep copy of the current graph structure.
-             *
-             *  @return A new TriangulatedGraph object identical to the current graph structure.
-             */
-            TriangulatedGraph * clone(void) const
+            if (generatesSeparator[vertex] && !removed[vertex])
             {
-                return new TriangulatedGraph(*this);
-            }
+                std::vector<htd::vertex_t> & separator = higherNeighbors[vertex];
 
-            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
-            {
-                return clone();
-            }
-#else
-            TriangulatedGraph * clone(void) const HTD_OVERRIDE
-            {
-                return new TriangulatedGraph(*this);
-            }
-#endif
-
-        private:
-            /**
-             *  The actual identifiers of the vertices.
-             */
-            std::vector<htd::vertex_t> names_;
-
-            /**
-             *  A map which maps to each vertex its internal counterpart.
-             */
-            std::unordered_map<htd::vertex_t, htd::vertex_t> internalNames_;
-
-            /**
-             *  The vertices of the triangulated graph.
-             */
-            std::vector<htd::vertex_t> vertices_;
-
-            /**
-             *  A vector containing the neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> neighborhood_;
-
-            /**
-             *  The number of edges in the triangulated graph.
-             */
-            std::size_t edgeCount_;
-
-            /**
-             *  Register a given vertex and return its index.
-             *
-             *  @param[in] vertex   The vertex which shall be registered.
-             *
-             *  @return The index of the vertex within the (updated) vector vertexNames.
-             */
-            htd::vertex_t registerVertex(htd::vertex_t vertex)
-            {
-                auto result = internalNames_.emplace(vertex, names_.size());
+                ++currentMark;
 
-                if (result.second)
-                {
-                    names_.push_back(vertex);
-                }
+                bool ok = true;
 
-                return result.first->second;
-            }
+                for (auto it2 = separator.begin(); ok && it2 != separator.end(); ++it2)
+                {
+                    ok = !removed[*it2];
 
-            /**
-             *  Inititialize the data structure.
-             *
-             *  @param[in] graph    The input graph.
-             */
-            void initialize(const htd::IGraphStructure & graph)
-            {
-                std::size_t size = graph.vertexCount();
+                    marks[*it2] = currentMark;
+                }
 
-                if (size > 0)
+                /* The separator is a clique if and only if each of its vertices is adjacent to all other vertices of the separator. */
+                for (auto it2 = separator.begin(); ok && it2 != separator.end(); ++it2)
                 {
-                    names_.reserve(size);
+                    std::size_t count = 0;
 
-                    if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size))
+                    for (htd::vertex_t neighbor : neighborhood[*it2])
                     {
-                        for (htd::index_t index = 0; index < size; ++index)
+                        if (marks[neighbor] == currentMark)
                         {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index) + 1;
-
-                            htd::vertex_t mappedVertex = static_cast<htd::vertex_t>(index);
-
-                            names_.push_back(vertex);
-
-                            internalNames_[vertex] = mappedVertex;
-
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
-
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
-
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
-
-                            if (position != currentNeighborhood.end() && *position == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position);
-                            }
-
-                            std::for_each(currentNeighborhood.begin(), currentNeighborhood.end(), [](htd::vertex_t & neighbor){ --neighbor; });
+                            ++count;
                         }
                     }
-                    else if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size - 1))
-                    {
-                        for (htd::index_t index = 0; index < size; ++index)
-                        {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index);
-
-                            names_.push_back(vertex);
 
-                            internalNames_[vertex] = vertex;
+                    ok = count + 1 == separator.size();
+                }
 
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+                if (ok)
+                {
+                    component.clear();
 
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
+                    component.push_back(vertex);
 
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+                    marks[vertex] = currentMark;
 
-                            if (position != currentNeighborhood.end() && *position == vertex)
+                    for (htd::index_t index = 0; index < component.size(); ++index)
+                    {
+                        for (htd::vertex_t neighbor : neighborhood[component[index]])
+                        {
+                            if (!removed[neighbor] && marks[neighbor] != currentMark)
                             {
-                                currentNeighborhood.erase(position);
+                                marks[neighbor] = currentMark;
+
+                                component.push_back(neighbor);
                             }
                         }
                     }
-                    else
-                    {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
-
-                        auto position = vertexCollection.begin();
 
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
-                        {
-                            htd::vertex_t vertex = *position;
+                    /* The separator only splits the graph if there is another component besides the component of the generator. */
+                    if (component.size() + separator.size() < remainingVertexCount)
+                    {
+                        std::sort(separator.begin(), separator.end());
 
-                            htd::vertex_t mappedVertex = registerVertex(vertex);
+                        std::vector<htd::vertex_t> atom;
 
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
+                        atom.reserve(component.size() + separator.size());
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
+                        for (htd::vertex_t componentVertex : component)
+                        {
+                            removed[componentVertex] = 1;
+                        }
 
-                            auto position2 = neighborCollection.begin();
+                        remainingVertexCount -= component.size();
 
-                            currentNeighborhood.reserve(neighborCollection.size() + 1);
+                        std::sort(component.begin(), component.end());
 
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
-                            {
-                                currentNeighborhood.push_back(registerVertex(*position2));
+                        std::merge(component.begin(), component.end(), separator.begin(), separator.end(), std::back_inserter(atom));
 
-                                ++position2;
-                            }
-
-                            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+                        for (htd::vertex_t & atomVertex : atom)
+                        {
+                            atomVertex = names[atomVertex];
+                        }
 
-                            auto position3 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), mappedVertex);
+                        atoms.push_back(std::move(atom));
 
-                            if (position3 != currentNeighborhood.end() && *position3 == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position3);
-                            }
+                        separators.emplace_back();
 
-                            ++position;
+                        for (htd::vertex_t separatorVertex : separator)
+                        {
+                            separators.back().push_back(names[separatorVertex]);
                         }
                     }
                 }
-
-                updateEdgeCount();
-            }
-    };
-
-    /**
-     *  Fill the pool of vertices having maximum weight.
-     *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
-     */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const HTD_NOEXCEPT
-    {
-        std::size_t max = 0;
-
-        pool.clear();
-
-        for (htd::vertex_t vertex : vertices)
-        {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
-            {
-                if (tmp > max)
-                {
-                    max = tmp;
-
-                    pool.clear();
-                }
-
-                pool.push_back(vertex);
             }
         }
-    }
-
-    /**
-     *  Check whether the given set of vertices forms a clique.
-     *
-     *  @param[in] graph    The graph.
-     *  @param[in] vertices The set of vertices.
-     *
-     *  @return True if the given set of vertices forms a clique, false otherwise.
-     */
-    bool isComplete(const TriangulatedGraph & graph, const std::vector<htd::vertex_t> & vertices) const
-    {
-        bool ret = true;
-
-        for (auto it = vertices.begin(); ret && it != vertices.end(); ++it)
-        {
-            const std::vector<htd::vertex_t> & currentNeighborhood = graph.neighborhood(*it);
-
-            ret = htd::set_intersection_size(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end()) >= vertices.size() - 1;
-        }
-
-        return ret;
-    }
-
-    /**
-     *  Determine the connected component of the graph separated by the provided separator which contains the given vertex.
-     *
-     *  @param[in] graph        The graph.
-     *  @param[in] separator    A set of vertices separating the given graph.
-     *  @param[in] vertex       The vertex.
-     *
-     *  @return The connected component of the graph separated by the provided separator which contains the given vertex.
-     */
-    std::vector<htd::vertex_t> * determineComponent(const TriangulatedGraph & graph, const std::vector<htd::vertex_t> & separator, htd::vertex_t vertex)
-    {
-        HTD_ASSERT(graph.isVertex(vertex))
-
-        std::vector<htd::vertex_t> * ret =
-            new std::vector<htd::vertex_t>();
 
-        std::stack<htd::vertex_t> originStack;
+        atoms.emplace_back();
 
-        std::unordered_set<htd::vertex_t> visitedVertices(separator.begin(), separator.end());
-
-        htd::vertex_t currentVertex = vertex;
-
-        originStack.push(currentVertex);
-
-        while (!originStack.empty() && !managementInstance_->isTerminated())
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
         {
-            currentVertex = originStack.top();
-
-            if (visitedVertices.count(currentVertex) == 0)
+            if (!removed[vertex])
             {
-                ret->push_back(currentVertex);
-
-                visitedVertices.insert(currentVertex);
-
-                originStack.pop();
-
-                for (htd::vertex_t neighbor : graph.neighborhood(currentVertex))
-                {
-                    if (visitedVertices.count(neighbor) == 0)
-                    {
-                        originStack.push(neighbor);
-                    }
-                }
-            }
-            else
-            {
-                originStack.pop();
+                atoms.back().push_back(names[vertex]);
             }
         }
 
-        std::sort(ret->begin(), ret->end());
-
-        return ret;
+        separators.emplace_back();
     }
 };
 
@@ -785,179 +395,33 @@ htd::CliqueMinimalSeparatorAlgorithm::~CliqueMinimalSeparatorAlgorithm(void)
 
 std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSeparator(const htd::IGraphStructure & graph) const
 {
-    std::size_t size = graph.vertexCount();
-
     std::vector<htd::vertex_t> * ret = new std::vector<htd::vertex_t>();
 
-    if (size > 0)
-    {
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph(graph);
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph eliminationGraph(referenceGraph);
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(referenceGraph);
-
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        htd::fillSet(eliminationGraph.vertices(), vertices);
-
-        std::vector<htd::vertex_t> pool;
+    std::vector<std::vector<htd::vertex_t>> atoms;
 
-        std::vector<std::size_t> labels(graph.vertexCount());
+    std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
 
-        std::unordered_set<htd::vertex_t> reached;
+    implementation_->decompose(graph, atoms, cliqueSeparators);
 
-        std::unordered_map<std::size_t, std::vector<htd::vertex_t>> reachable;
+    cliqueSeparators.erase(std::remove_if(cliqueSeparators.begin(), cliqueSeparators.end(), [](const std::vector<htd::vertex_t> & separator) { return separator.empty(); }), cliqueSeparators.end());
 
-        std::vector<htd::vertex_t> generators;
+    std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
 
-        const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+    cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
 
-        std::vector<htd::vertex_t> ordering;
-        ordering.reserve(graph.vertexCount());
-
-        std::size_t lastLabel = (std::size_t)-1;
-
-        for (htd::index_t index = 0; index < size; ++index)
-        {
-            labels[index] = 0;
-        }
-
-        while (size > 0 && !managementInstance.isTerminated())
-        {
-            implementation_->fillMaxCardinalityPool(vertices, labels, pool);
-
-            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
-
-            const std::vector<htd::vertex_t> & selectedNeighborhood = eliminationGraph.neighborhood(selectedVertex);
-
-            if (lastLabel != (std::size_t)-1 && labels[selectedVertex] <= lastLabel)
-            {
-                htd::insertSorted(generators, selectedVertex);
-            }
-
-            lastLabel = labels[selectedVertex];
-
-            std::vector<htd::vertex_t> triangulationNeighbors(eliminationGraph.neighborhood(selectedVertex));
-
-            ordering.push_back(selectedVertex);
-
-            vertices.erase(selectedVertex);
-
-            pool.clear();
-
-            --size;
-
-            reached.insert(selectedVertex);
-
-            for (htd::index_t index = 0; index <= size; ++index)
-            {
-                reachable[index].clear();
-            }
-
-            for (htd::vertex_t neighbor : selectedNeighborhood)
-            {
-                reached.insert(neighbor);
-
-                reachable[labels[neighbor]].push_back(neighbor);
-            }
-
-            for (htd::index_t index = 0; index <= size; ++index)
-            {
-                std::vector<htd::vertex_t> & currentlyReachableVertices = reachable[index];
-
-                while (!currentlyReachableVertices.empty())
-                {
-                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices);
-
-                    currentlyReachableVertices.erase(std::lower_bound(currentlyReachableVertices.begin(),
-                                                                      currentlyReachableVertices.end(),
-                                                                      reachableVertex));
-
-                    for (htd::vertex_t neighbor : eliminationGraph.neighborhood(reachableVertex))
-                    {
-                        if (reached.count(neighbor) == 0)
-                        {
-                            reached.insert(neighbor);
-
-                            if (labels[neighbor] > index)
-                            {
-                                triangulationNeighbors.push_back(neighbor);
-
-                                htd::insertSorted(reachable[labels[neighbor]], neighbor);
-                            }
-                            else
-                            {
-                                htd::insertSorted(currentlyReachableVertices, neighbor);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for (htd::vertex_t neighbor : triangulationNeighbors)
-            {
-                triangulatedGraph.addTriangulationEdge(selectedVertex, neighbor);
-
-                labels[neighbor]++;
-            }
-
-            eliminationGraph.removeVertex(selectedVertex);
-
-            reached.clear();
-        }
-
-        std::reverse(ordering.begin(), ordering.end());
-
-        htd::CliqueMinimalSeparatorAlgorithm::Implementation::TriangulatedGraph referenceGraph2(referenceGraph);
-
-        std::vector<std::vector<htd::vertex_t>> cliqueSeparators;
-
-        for (htd::vertex_t vertex : ordering)
-        {
-            if (std::binary_search(generators.begin(), generators.end(), vertex))
-            {
-                const std::vector<htd::vertex_t> & currentNeighborhood = triangulatedGraph.neighborhood(vertex);
-
-                if (!currentNeighborhood.empty())
-                {
-                    if (implementation_->isComplete(referenceGraph, currentNeighborhood))
-                    {
-                        std::vector<htd::vertex_t> * component = implementation_->determineComponent(referenceGraph2, currentNeighborhood, vertex);
-
-                        for (htd::vertex_t componentVertex : *component)
-                        {
-                            referenceGraph2.removeVertex(componentVertex);
-                        }
-
-                        cliqueSeparators.push_back(currentNeighborhood);
-
-                        delete component;
-                    }
-                }
-            }
-
-            triangulatedGraph.removeVertex(vertex);
-        }
-
-        std::sort(cliqueSeparators.begin(), cliqueSeparators.end());
-
-        cliqueSeparators.erase(std::unique(cliqueSeparators.begin(), cliqueSeparators.end()), cliqueSeparators.end());
-
-        if (!cliqueSeparators.empty())
-        {
-            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
-
-            for (htd::vertex_t vertex : separator)
-            {
-                ret->push_back(referenceGraph.vertexName(vertex));
-            }
-        }
+    if (!cliqueSeparators.empty())
+    {
+        *ret = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators, implementation_->managementInstance_->randomNumberGenerator());
     }
 
     return ret;
 }
 
+void htd::CliqueMinimalSeparatorAlgorithm::determineAtoms(const htd::IGraphStructure & graph, std::vector<std::vector<htd::vertex_t>> & atoms, std::vector<std::vector<htd::vertex_t>> & separators) const
+{
+    implementation_->decompose(graph, atoms, separators);
+}
+
 const htd::LibraryInstance * htd::CliqueMinimalSeparatorAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -29,9 +29,16 @@
 #include <htd/IWidthMinimizingTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::CombinedWidthMinimizingTreeDecompositionAlgorithm.
@@ -44,7 +51,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true)
+        : managementInstance_(manager), algorithms_(), computeInducedEdges_(true), parallelExecutionEnabled_(false), targetMaximumBagSize_(0)
     {
 
     }
@@ -54,7 +61,7 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithms_(), computeInducedEdges_(original.computeInducedEdges_), parallelExecutionEnabled_(original.parallelExecutionEnabled_), targetMaximumBagSize_(original.targetMaximumBagSize_)
     {
         for (const htd::ITreeDecompositionAlgorithm * algorithm : original.algorithms_)
         {
@@ -84,6 +91,230 @@ struct htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
     bool computeInducedEdges_;
+
+    /**
+     *  A boolean flag indicating whether the base algorithms shall be run concurrently.
+     */
+    bool parallelExecutionEnabled_;
+
+    /**
+     *  The maximum bag size which is considered good enough to stop the computation.
+     */
+    std::size_t targetMaximumBagSize_;
+
+    /**
+     *  Run all base algorithms concurrently, each of them in its own thread and with its own management instance.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each decomposition computed by the base algorithms.
+     *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *
+     *  @note The progress callback is never invoked concurrently.
+     *
+     *  @return The decomposition with the lowest maximum bag size found by any of the base algorithms or nullptr if no decomposition was found.
+     */
+    htd::ITreeDecomposition * computeParallelDecomposition(const htd::IMultiHypergraph & graph,
+                                                           const htd::IPreprocessedGraph & preprocessedGraph,
+                                                           const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                           std::size_t maxBagSize) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        std::size_t workerCount = algorithms_.size();
+
+        std::vector<std::unique_ptr<htd::LibraryInstance>> workerInstances;
+
+        std::vector<htd::ITreeDecompositionAlgorithm *> workerAlgorithms;
+
+        for (const htd::ITreeDecompositionAlgorithm * algorithm : algorithms_)
+        {
+            htd::LibraryInstance * workerInstance = htd::cloneManagementInstance(managementInstance);
+
+            workerInstance->randomNumberGenerator() = managementInstance.randomNumberGenerator().split();
+
+            htd::ITreeDecompositionAlgorithm * workerAlgorithm = algorithm->clone();
+
+            workerAlgorithm->setManagementInstance(workerInstance);
+
+            workerInstances.emplace_back(workerInstance);
+
+            workerAlgorithms.push_back(workerAlgorithm);
+        }
+
+        std::mutex mutex;
+
+        std::condition_variable workerFinished;
+
+        std::size_t activeWorkerCount = workerCount;
+
+        std::size_t bestMaxBagSize = maxBagSize;
+
+        /* The best maximum bag size found so far, readable without locking so that running workers can tighten their limits. */
+        std::atomic<std::size_t> sharedMaxBagSize(maxBagSize);
+
+        auto updateSharedMaxBagSize = [&](std::size_t currentMaxBagSize)
+        {
+            std::size_t expected = sharedMaxBagSize.load();
+
+            while (currentMaxBagSize < expected && !sharedMaxBagSize.compare_exchange_weak(expected, currentMaxBagSize))
+            {
+
+            }
+        };
+
+        for (htd::ITreeDecompositionAlgorithm * algorithm : workerAlgorithms)
+        {
+            htd::IWidthMinimizingTreeDecompositionAlgorithm * widthMinimizingTreeDecompositionAlgorithm = dynamic_cast<htd::IWidthMinimizingTreeDecompositionAlgorithm *>(algorithm);
+
+            if (widthMinimizingTreeDecompositionAlgorithm != nullptr)
+            {
+                widthMinimizingTreeDecompositionAlgorithm->setSharedMaximumBagSize(&sharedMaxBagSize);
+            }
+        }
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        auto terminateWorkers = [&](void)
+        {
+            for (const std::unique_ptr<htd::LibraryInstance> & workerInstance : workerInstances)
+            {
+                workerInstance->terminate();
+            }
+        };
+
+        auto runWorker = [&](htd::index_t workerIndex)
+        {
+            htd::LibraryInstance & workerInstance = *(workerInstances[workerIndex]);
+
+            htd::ITreeDecompositionAlgorithm * algorithm = workerAlgorithms[workerIndex];
+
+            std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+            for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                htd::IDecompositionManipulationOperation * clonedOperation = operation->clone();
+#else
+                htd::IDecompositionManipulationOperation * clonedOperation = operation->cloneDecompositionManipulationOperation();
+#endif
+
+                clonedOperation->setManagementInstance(&workerInstance);
+
+                clonedManipulationOperations.push_back(clonedOperation);
+            }
+
+            htd::ITreeDecomposition * currentDecomposition = nullptr;
+
+            htd::IWidthMinimizingTreeDecompositionAlgorithm * widthMinimizingTreeDecompositionAlgorithm = dynamic_cast<htd::IWidthMinimizingTreeDecompositionAlgorithm *>(algorithm);
+
+            if (widthMinimizingTreeDecompositionAlgorithm != nullptr)
+            {
+                currentDecomposition =
+                    widthMinimizingTreeDecompositionAlgorithm->computeImprovedDecomposition(graph, preprocessedGraph, clonedManipulationOperations, [&](const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition, const htd::FitnessEvaluation & fitness)
+                    {
+                        updateSharedMaxBagSize(decomposition.maximumBagSize());
+
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        progressCallback(graph, decomposition, fitness);
+
+                        if (decomposition.maximumBagSize() <= targetMaximumBagSize_)
+                        {
+                            terminateWorkers();
+                        }
+                    }, sharedMaxBagSize.load() - 1);
+            }
+            else
+            {
+                currentDecomposition = algorithm->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations);
+
+                if (currentDecomposition != nullptr)
+                {
+                    if (!workerInstance.isTerminated() || algorithm->isSafelyInterruptible())
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentDecomposition->maximumBagSize()))));
+                    }
+                    else
+                    {
+                        delete currentDecomposition;
+
+                        currentDecomposition = nullptr;
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (currentDecomposition != nullptr)
+            {
+                std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                updateSharedMaxBagSize(currentMaxBagSize);
+
+                if (currentMaxBagSize < bestMaxBagSize)
+                {
+                    delete ret;
+
+                    currentDecomposition->setManagementInstance(managementInstance_);
+
+                    ret = currentDecomposition;
+
+                    bestMaxBagSize = currentMaxBagSize;
+
+                    if (bestMaxBagSize <= targetMaximumBagSize_)
+                    {
+                        terminateWorkers();
+                    }
+                }
+                else
+                {
+                    delete currentDecomposition;
+                }
+            }
+
+            --activeWorkerCount;
+
+            workerFinished.notify_one();
+        };
+
+        std::vector<std::thread> workers;
+
+        for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+        {
+            workers.emplace_back(runWorker, workerIndex);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            while (activeWorkerCount > 0)
+            {
+                workerFinished.wait_for(lock, std::chrono::milliseconds(10));
+
+                if (managementInstance.isTerminated())
+                {
+                    terminateWorkers();
+                }
+            }
+        }
+
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+
+        for (htd::ITreeDecompositionAlgorithm * algorithm : workerAlgorithms)
+        {
+            delete algorithm;
+        }
+
+        return ret;
+    }
 };
 
 htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::CombinedWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -110,6 +341,26 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::addDecompositionAlg
     implementation_->algorithms_.push_back(algorithm);
 }
 
+bool htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::isParallelExecutionEnabled(void) const
+{
+    return implementation_->parallelExecutionEnabled_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setParallelExecutionEnabled(bool parallelExecutionEnabled)
+{
+    implementation_->parallelExecutionEnabled_ = parallelExecutionEnabled;
+}
+
+std::size_t htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::targetMaximumBagSize(void) const
+{
+    return implementation_->targetMaximumBagSize_;
+}
+
+void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setTargetMaximumBagSize(std::size_t targetMaximumBagSize)
+{
+    implementation_->targetMaximumBagSize_ = targetMaximumBagSize;
+}
+
 htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
 {
     return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>(), [](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){});
@@ -227,13 +478,25 @@ htd::ITreeDecomposition * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                                const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    if (implementation_->parallelExecutionEnabled_ && implementation_->algorithms_.size() > 1)
+    {
+        htd::ITreeDecomposition * ret = implementation_->computeParallelDecomposition(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize);
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
     std::size_t bestMaxBagSize = maxBagSize;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     htd::ITreeDecomposition * ret = nullptr;
 
-    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+    for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated() && (ret == nullptr || bestMaxBagSize > implementation_->targetMaximumBagSize_); ++it)
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -449,6 +712,11 @@ void htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::setManagementInstan
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    for (htd::ITreeDecompositionAlgorithm * algorithm : implementation_->algorithms_)
+    {
+        algorithm->setManagementInstance(manager);
+    }
 }
 
 htd::CombinedWidthMinimizingTreeDecompositionAlgorithm * htd::CombinedWidthMinimizingTreeDecompositionAlgorithm::clone(void) const
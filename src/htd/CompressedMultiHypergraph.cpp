@@ -0,0 +1,1013 @@
+/* 
+ * File:   CompressedMultiHypergraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_CPP
+#define HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/CompressedMultiHypergraph.hpp>
+#include <htd/VectorAdapter.hpp>
+#include <htd/HyperedgeVector.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Marker for vertex identifiers which are not part of the graph.
+     */
+    const htd::index_t UNUSED_POSITION = std::numeric_limits<htd::index_t>::max();
+
+    /**
+     *  Light-weight view on a contiguous range of a vector which can be wrapped by htd::ConstCollection without copying.
+     */
+    template <typename T>
+    struct VectorRange
+    {
+        /**
+         *  An iterator to the first element of the range.
+         */
+        typename std::vector<T>::const_iterator first;
+
+        /**
+         *  An iterator past the last element of the range.
+         */
+        typename std::vector<T>::const_iterator last;
+
+        /**
+         *  Getter for the iterator to the first element of the range.
+         *
+         *  @return An iterator to the first element of the range.
+         */
+        typename std::vector<T>::const_iterator begin(void) const
+        {
+            return first;
+        }
+
+        /**
+         *  Getter for the iterator past the last element of the range.
+         *
+         *  @return An iterator past the last element of the range.
+         */
+        typename std::vector<T>::const_iterator end(void) const
+        {
+            return last;
+        }
+
+        /**
+         *  Getter for the size of the range.
+         *
+         *  @return The size of the range.
+         */
+        std::size_t size(void) const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+    };
+}
+
+/**
+ *  Private implementation details of class htd::CompressedMultiHypergraph.
+ */
+struct htd::CompressedMultiHypergraph::Implementation
+{
+    /**
+     *  Immutable storage of the graph in compressed sparse row format. The storage is shared between copies.
+     */
+    struct Storage
+    {
+        /**
+         *  Constructor for the storage structure.
+         */
+        Storage(void) : vertices_(), vertexPositions_(), neighborOffsets_(), neighbors_(), isolatedVertices_(), edgeIds_(), edgeOffsets_(), edgeElements_(), incidenceOffsets_(), incidentEdges_(), edgePositionsById_(), hyperedgeCreationFlag_(), hyperedges_()
+        {
+
+        }
+
+        /**
+         *  The sorted collection of all vertices.
+         */
+        std::vector<htd::vertex_t> vertices_;
+
+        /**
+         *  The position of each vertex within vertices_, indexed by the vertex identifier. Unused identifiers map to
+         *  UNUSED_POSITION. The vector is empty if the vertices are exactly htd::Vertex::FIRST, htd::Vertex::FIRST + 1, ...
+         *  because the position of a vertex can then be computed directly.
+         */
+        std::vector<htd::index_t> vertexPositions_;
+
+        /**
+         *  The offsets of the neighborhoods within neighbors_, indexed by the position of the vertex.
+         */
+        std::vector<std::size_t> neighborOffsets_;
+
+        /**
+         *  The concatenated, sorted neighborhoods of all vertices.
+         */
+        std::vector<htd::vertex_t> neighbors_;
+
+        /**
+         *  The sorted collection of all isolated vertices.
+         */
+        std::vector<htd::vertex_t> isolatedVertices_;
+
+        /**
+         *  The identifiers of the hyperedges in the order of their insertion.
+         */
+        std::vector<htd::id_t> edgeIds_;
+
+        /**
+         *  The offsets of the hyperedges within edgeElements_, indexed by the position of the hyperedge.
+         */
+        std::vector<std::size_t> edgeOffsets_;
+
+        /**
+         *  The concatenated elements of all hyperedges in their original order.
+         */
+        std::vector<htd::vertex_t> edgeElements_;
+
+        /**
+         *  The offsets of the incidence lists within incidentEdges_, indexed by the position of the vertex.
+         */
+        std::vector<std::size_t> incidenceOffsets_;
+
+        /**
+         *  The concatenated, sorted positions of the hyperedges containing each vertex. The positions are stored using
+         *  the type of hyperedge identifiers because the number of hyperedges is bounded by the range of identifiers.
+         */
+        std::vector<htd::id_t> incidentEdges_;
+
+        /**
+         *  The positions of the hyperedges sorted by their identifiers. Empty if edgeIds_ is already sorted.
+         */
+        std::vector<htd::index_t> edgePositionsById_;
+
+        /**
+         *  Flag ensuring that the hyperedge objects are materialized exactly once.
+         */
+        std::once_flag hyperedgeCreationFlag_;
+
+        /**
+         *  The hyperedge objects, materialized on first access via the htd::Hyperedge based part of the interface.
+         */
+        std::shared_ptr<std::vector<htd::Hyperedge>> hyperedges_;
+
+        /**
+         *  Get the position of the given vertex within the compressed storage.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return The position of the given vertex.
+         */
+        htd::index_t position(htd::vertex_t vertex) const
+        {
+            return vertexPositions_.empty() ? vertex - htd::Vertex::FIRST : vertexPositions_[vertex];
+        }
+
+        /**
+         *  Check whether the given vertex is part of the graph.
+         *
+         *  @param[in] vertex   The vertex.
+         *
+         *  @return True if the given vertex is part of the graph, false otherwise.
+         */
+        bool contains(htd::vertex_t vertex) const
+        {
+            if (vertexPositions_.empty())
+            {
+                return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < vertices_.size();
+            }
+
+            return vertex < vertexPositions_.size() && vertexPositions_[vertex] != UNUSED_POSITION;
+        }
+
+        /**
+         *  Get the position of the hyperedge with the given identifier.
+         *
+         *  @param[in] edgeId   The identifier of the hyperedge.
+         *
+         *  @return The position of the hyperedge or edgeIds_.size() if no hyperedge with the given identifier exists.
+         */
+        htd::index_t edgePosition(htd::id_t edgeId) const
+        {
+            htd::index_t ret = edgeIds_.size();
+
+            if (edgePositionsById_.empty())
+            {
+                auto position = std::lower_bound(edgeIds_.begin(), edgeIds_.end(), edgeId);
+
+                if (position != edgeIds_.end() && *position == edgeId)
+                {
+                    ret = static_cast<htd::index_t>(std::distance(edgeIds_.begin(), position));
+                }
+            }
+            else
+            {
+                auto position = std::lower_bound(edgePositionsById_.begin(), edgePositionsById_.end(), edgeId, [&](htd::index_t index, htd::id_t id) { return edgeIds_[index] < id; });
+
+                if (position != edgePositionsById_.end() && edgeIds_[*position] == edgeId)
+                {
+                    ret = *position;
+                }
+            }
+
+            return ret;
+        }
+
+        /**
+         *  Check whether the elements of the hyperedge at the given position match the given sequence of vertices.
+         *
+         *  @param[in] index    The position of the hyperedge.
+         *  @param[in] begin    An iterator to the first vertex of the sequence.
+         *  @param[in] end      An iterator past the last vertex of the sequence.
+         *  @param[in] size     The length of the sequence.
+         *
+         *  @return True if the hyperedge contains exactly the given sequence of vertices, false otherwise.
+         */
+        template <typename Iterator>
+        bool matches(htd::index_t index, Iterator begin, Iterator end, std::size_t size) const
+        {
+            return edgeOffsets_[index + 1] - edgeOffsets_[index] == size && htd::equal(edgeElements_.begin() + edgeOffsets_[index], edgeElements_.begin() + edgeOffsets_[index + 1], begin, end);
+        }
+
+        /**
+         *  Get the positions of all hyperedges which contain exactly the given sequence of vertices.
+         *
+         *  @param[in] begin    An iterator to the first vertex of the sequence.
+         *  @param[in] end      An iterator past the last vertex of the sequence.
+         *  @param[in] size     The length of the sequence.
+         *  @param[out] target  The target vector to which the identifiers of the matching hyperedges shall be appended.
+         */
+        template <typename Iterator>
+        void findEdges(Iterator begin, Iterator end, std::size_t size, std::vector<htd::id_t> & target) const
+        {
+            if (size > 0 && contains(*begin))
+            {
+                htd::index_t vertexPosition = position(*begin);
+
+                for (std::size_t index = incidenceOffsets_[vertexPosition]; index < incidenceOffsets_[vertexPosition + 1]; ++index)
+                {
+                    if (matches(incidentEdges_[index], begin, end, size))
+                    {
+                        target.push_back(edgeIds_[incidentEdges_[index]]);
+                    }
+                }
+            }
+        }
+
+        /**
+         *  Compute the neighborhoods, the incidence lists and the isolated vertices from the vertices and hyperedges.
+         */
+        void build(void)
+        {
+            std::size_t vertexCount = vertices_.size();
+            std::size_t edgeCount = edgeIds_.size();
+
+            std::vector<std::size_t> neighborCounts(vertexCount, 0);
+            std::vector<std::size_t> incidenceCounts(vertexCount, 0);
+
+            std::vector<bool> selfLoops(vertexCount, false);
+
+            std::vector<htd::vertex_t> distinctElements;
+
+            for (htd::index_t edgeIndex = 0; edgeIndex < edgeCount; ++edgeIndex)
+            {
+                distinctElements.assign(edgeElements_.begin() + edgeOffsets_[edgeIndex], edgeElements_.begin() + edgeOffsets_[edgeIndex + 1]);
+
+                std::sort(distinctElements.begin(), distinctElements.end());
+
+                for (htd::index_t index = 1; index < distinctElements.size(); ++index)
+                {
+                    if (distinctElements[index] == distinctElements[index - 1])
+                    {
+                        selfLoops[position(distinctElements[index])] = true;
+                    }
+                }
+
+                distinctElements.erase(std::unique(distinctElements.begin(), distinctElements.end()), distinctElements.end());
+
+                for (htd::vertex_t vertex : distinctElements)
+                {
+                    htd::index_t vertexPosition = position(vertex);
+
+                    ++incidenceCounts[vertexPosition];
+
+                    neighborCounts[vertexPosition] += distinctElements.size() - 1;
+                }
+            }
+
+            neighborOffsets_.assign(vertexCount + 1, 0);
+            incidenceOffsets_.assign(vertexCount + 1, 0);
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                if (selfLoops[index])
+                {
+                    ++neighborCounts[index];
+                }
+
+                neighborOffsets_[index + 1] = neighborOffsets_[index] + neighborCounts[index];
+                incidenceOffsets_[index + 1] = incidenceOffsets_[index] + incidenceCounts[index];
+            }
+
+            neighbors_.resize(neighborOffsets_[vertexCount]);
+            incidentEdges_.resize(incidenceOffsets_[vertexCount]);
+
+            std::vector<std::size_t> & neighborCursors = neighborCounts;
+            std::vector<std::size_t> & incidenceCursors = incidenceCounts;
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                neighborCursors[index] = neighborOffsets_[index];
+                incidenceCursors[index] = incidenceOffsets_[index];
+
+                if (selfLoops[index])
+                {
+                    neighbors_[neighborCursors[index]++] = vertices_[index];
+                }
+            }
+
+            for (htd::index_t edgeIndex = 0; edgeIndex < edgeCount; ++edgeIndex)
+            {
+                distinctElements.assign(edgeElements_.begin() + edgeOffsets_[edgeIndex], edgeElements_.begin() + edgeOffsets_[edgeIndex + 1]);
+
+                std::sort(distinctElements.begin(), distinctElements.end());
+
+                distinctElements.erase(std::unique(distinctElements.begin(), distinctElements.end()), distinctElements.end());
+
+                for (htd::vertex_t vertex : distinctElements)
+                {
+                    htd::index_t vertexPosition = position(vertex);
+
+                    incidentEdges_[incidenceCursors[vertexPosition]++] = static_cast<htd::id_t>(edgeIndex);
+
+                    for (htd::vertex_t neighbor : distinctElements)
+                    {
+                        if (neighbor != vertex)
+                        {
+                            neighbors_[neighborCursors[vertexPosition]++] = neighbor;
+                        }
+                    }
+                }
+            }
+
+            /* Sort each neighborhood, remove duplicates and compact the rows in place. */
+            std::size_t writePosition = 0;
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                auto first = neighbors_.begin() + neighborOffsets_[index];
+                auto last = neighbors_.begin() + neighborOffsets_[index + 1];
+
+                std::sort(first, last);
+
+                last = std::unique(first, last);
+
+                neighborOffsets_[index] = writePosition;
+
+                writePosition = static_cast<std::size_t>(std::distance(neighbors_.begin(), std::move(first, last, neighbors_.begin() + writePosition)));
+
+                if (first == last)
+                {
+                    isolatedVertices_.push_back(vertices_[index]);
+                }
+            }
+
+            neighborOffsets_[vertexCount] = writePosition;
+
+            neighbors_.resize(writePosition);
+            neighbors_.shrink_to_fit();
+
+            if (!std::is_sorted(edgeIds_.begin(), edgeIds_.end()))
+            {
+                edgePositionsById_.resize(edgeCount);
+
+                for (htd::index_t index = 0; index < edgeCount; ++index)
+                {
+                    edgePositionsById_[index] = index;
+                }
+
+                std::stable_sort(edgePositionsById_.begin(), edgePositionsById_.end(), [&](htd::index_t lhs, htd::index_t rhs) { return edgeIds_[lhs] < edgeIds_[rhs]; });
+            }
+        }
+
+        /**
+         *  Initialize the vertex storage with the vertices 1, ..., vertexCount.
+         *
+         *  @param[in] vertexCount  The number of vertices.
+         */
+        void initializeVertices(std::size_t vertexCount)
+        {
+            vertices_.resize(vertexCount);
+
+            for (htd::index_t index = 0; index < vertexCount; ++index)
+            {
+                vertices_[index] = static_cast<htd::vertex_t>(index + htd::Vertex::FIRST);
+            }
+        }
+
+        /**
+         *  Access the materialized hyperedge objects, creating them on first access.
+         *
+         *  @return The materialized hyperedge objects.
+         */
+        const std::shared_ptr<std::vector<htd::Hyperedge>> & hyperedges(void)
+        {
+            std::call_once(hyperedgeCreationFlag_, [&]()
+            {
+                std::shared_ptr<std::vector<htd::Hyperedge>> result = std::make_shared<std::vector<htd::Hyperedge>>();
+
+                result->reserve(edgeIds_.size());
+
+                for (htd::index_t index = 0; index < edgeIds_.size(); ++index)
+                {
+                    std::vector<htd::vertex_t> elements(edgeElements_.begin() + edgeOffsets_[index], edgeElements_.begin() + edgeOffsets_[index + 1]);
+
+                    std::vector<htd::vertex_t> sortedElements(elements);
+
+                    std::sort(sortedElements.begin(), sortedElements.end());
+
+                    sortedElements.erase(std::unique(sortedElements.begin(), sortedElements.end()), sortedElements.end());
+
+                    result->emplace_back(edgeIds_[index], std::move(elements), std::move(sortedElements));
+                }
+
+                hyperedges_ = std::move(result);
+            });
+
+            return hyperedges_;
+        }
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     *  @param[in] storage   The compressed storage of the graph.
+     */
+    Implementation(const htd::LibraryInstance * const manager, const std::shared_ptr<Storage> & storage) : managementInstance_(manager), storage_(storage)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The compressed storage of the graph.
+     */
+    std::shared_ptr<Storage> storage_;
+};
+
+htd::CompressedMultiHypergraph::CompressedMultiHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) : implementation_(new Implementation(manager, std::make_shared<Implementation::Storage>()))
+{
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    storage.initializeVertices(vertexCount);
+
+    storage.edgeIds_.resize(edges.size());
+    storage.edgeOffsets_.resize(edges.size() + 1);
+    storage.edgeElements_.resize(2 * edges.size());
+
+    for (htd::index_t index = 0; index < edges.size(); ++index)
+    {
+        HTD_ASSERT(isVertex(edges[index].first) && isVertex(edges[index].second))
+
+        storage.edgeIds_[index] = static_cast<htd::id_t>(index + htd::Id::FIRST);
+
+        storage.edgeOffsets_[index] = 2 * index;
+
+        storage.edgeElements_[2 * index] = edges[index].first;
+        storage.edgeElements_[2 * index + 1] = edges[index].second;
+    }
+
+    storage.edgeOffsets_[edges.size()] = 2 * edges.size();
+
+    storage.build();
+}
+
+htd::CompressedMultiHypergraph::CompressedMultiHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, const std::vector<std::vector<htd::vertex_t>> & edges) : implementation_(new Implementation(manager, std::make_shared<Implementation::Storage>()))
+{
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    storage.initializeVertices(vertexCount);
+
+    std::size_t elementCount = 0;
+
+    for (const std::vector<htd::vertex_t> & edge : edges)
+    {
+        elementCount += edge.size();
+    }
+
+    storage.edgeIds_.resize(edges.size());
+    storage.edgeOffsets_.resize(edges.size() + 1);
+    storage.edgeElements_.reserve(elementCount);
+
+    for (htd::index_t index = 0; index < edges.size(); ++index)
+    {
+        HTD_ASSERT(!edges[index].empty())
+
+        storage.edgeIds_[index] = static_cast<htd::id_t>(index + htd::Id::FIRST);
+
+        storage.edgeOffsets_[index] = storage.edgeElements_.size();
+
+        for (htd::vertex_t vertex : edges[index])
+        {
+            HTD_ASSERT(isVertex(vertex))
+
+            storage.edgeElements_.push_back(vertex);
+        }
+    }
+
+    storage.edgeOffsets_[edges.size()] = storage.edgeElements_.size();
+
+    storage.build();
+}
+
+htd::CompressedMultiHypergraph::CompressedMultiHypergraph(const htd::CompressedMultiHypergraph & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::CompressedMultiHypergraph::CompressedMultiHypergraph(const htd::IMultiHypergraph & original) : implementation_(new Implementation(original.managementInstance(), std::make_shared<Implementation::Storage>()))
+{
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    original.copyVerticesTo(storage.vertices_);
+
+    std::sort(storage.vertices_.begin(), storage.vertices_.end());
+
+    if (!storage.vertices_.empty() && storage.vertices_.back() - htd::Vertex::FIRST + 1 != storage.vertices_.size())
+    {
+        storage.vertexPositions_.assign(storage.vertices_.back() + 1, UNUSED_POSITION);
+
+        for (htd::index_t index = 0; index < storage.vertices_.size(); ++index)
+        {
+            storage.vertexPositions_[storage.vertices_[index]] = index;
+        }
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = original.hyperedges();
+
+    storage.edgeIds_.reserve(hyperedgeCollection.size());
+    storage.edgeOffsets_.reserve(hyperedgeCollection.size() + 1);
+
+    for (const htd::Hyperedge & hyperedge : hyperedgeCollection)
+    {
+        storage.edgeIds_.push_back(hyperedge.id());
+
+        storage.edgeOffsets_.push_back(storage.edgeElements_.size());
+
+        storage.edgeElements_.insert(storage.edgeElements_.end(), hyperedge.begin(), hyperedge.end());
+    }
+
+    storage.edgeOffsets_.push_back(storage.edgeElements_.size());
+
+    storage.build();
+}
+
+htd::CompressedMultiHypergraph::~CompressedMultiHypergraph()
+{
+
+}
+
+std::size_t htd::CompressedMultiHypergraph::vertexCount(void) const
+{
+    return implementation_->storage_->vertices_.size();
+}
+
+std::size_t htd::CompressedMultiHypergraph::edgeCount(void) const
+{
+    return implementation_->storage_->edgeIds_.size();
+}
+
+std::size_t htd::CompressedMultiHypergraph::edgeCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    return storage.incidenceOffsets_[vertexPosition + 1] - storage.incidenceOffsets_[vertexPosition];
+}
+
+bool htd::CompressedMultiHypergraph::isVertex(htd::vertex_t vertex) const
+{
+    return implementation_->storage_->contains(vertex);
+}
+
+bool htd::CompressedMultiHypergraph::isEdge(htd::id_t edgeId) const
+{
+    return implementation_->storage_->edgePosition(edgeId) < implementation_->storage_->edgeIds_.size();
+}
+
+bool htd::CompressedMultiHypergraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    return isNeighbor(vertex1, vertex2) && isEdge(std::vector<htd::vertex_t> { vertex1, vertex2 });
+}
+
+bool htd::CompressedMultiHypergraph::isEdge(const std::vector<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->storage_->findEdges(elements.begin(), elements.end(), elements.size(), result);
+
+    return !result.empty();
+}
+
+bool htd::CompressedMultiHypergraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->storage_->findEdges(elements.begin(), elements.end(), elements.size(), result);
+
+    return !result.empty();
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedMultiHypergraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    if (isNeighbor(vertex1, vertex2))
+    {
+        std::array<htd::vertex_t, 2> elements { { vertex1, vertex2 } };
+
+        implementation_->storage_->findEdges(elements.begin(), elements.end(), elements.size(), ret.container());
+    }
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedMultiHypergraph::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->storage_->findEdges(elements.begin(), elements.end(), elements.size(), ret.container());
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompressedMultiHypergraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->storage_->findEdges(elements.begin(), elements.end(), elements.size(), ret.container());
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedMultiHypergraph::vertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->storage_->vertices_);
+}
+
+void htd::CompressedMultiHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
+{
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    target.insert(target.end(), storage.vertices_.begin(), storage.vertices_.end());
+}
+
+htd::vertex_t htd::CompressedMultiHypergraph::vertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->storage_->vertices_.size())
+
+    return implementation_->storage_->vertices_[index];
+}
+
+bool htd::CompressedMultiHypergraph::isConnected(void) const
+{
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    bool ret = true;
+
+    std::size_t vertexCount = storage.vertices_.size();
+
+    if (vertexCount > 1)
+    {
+        std::vector<bool> reachableVertices(vertexCount, false);
+
+        std::vector<htd::index_t> stack;
+
+        std::size_t reachableVertexCount = 1;
+
+        reachableVertices[0] = true;
+
+        stack.push_back(0);
+
+        while (!stack.empty())
+        {
+            htd::index_t vertexPosition = stack.back();
+
+            stack.pop_back();
+
+            for (std::size_t index = storage.neighborOffsets_[vertexPosition]; index < storage.neighborOffsets_[vertexPosition + 1]; ++index)
+            {
+                htd::index_t neighborPosition = storage.position(storage.neighbors_[index]);
+
+                if (!reachableVertices[neighborPosition])
+                {
+                    reachableVertices[neighborPosition] = true;
+
+                    ++reachableVertexCount;
+
+                    stack.push_back(neighborPosition);
+                }
+            }
+        }
+
+        ret = reachableVertexCount == vertexCount;
+    }
+
+    return ret;
+}
+
+bool htd::CompressedMultiHypergraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    bool ret = vertex1 == vertex2;
+
+    if (!ret)
+    {
+        std::vector<bool> reachableVertices(storage.vertices_.size(), false);
+
+        std::vector<htd::index_t> stack;
+
+        reachableVertices[storage.position(vertex1)] = true;
+
+        stack.push_back(storage.position(vertex1));
+
+        while (!ret && !stack.empty())
+        {
+            htd::index_t vertexPosition = stack.back();
+
+            stack.pop_back();
+
+            for (std::size_t index = storage.neighborOffsets_[vertexPosition]; !ret && index < storage.neighborOffsets_[vertexPosition + 1]; ++index)
+            {
+                htd::vertex_t neighbor = storage.neighbors_[index];
+
+                htd::index_t neighborPosition = storage.position(neighbor);
+
+                if (!reachableVertices[neighborPosition])
+                {
+                    reachableVertices[neighborPosition] = true;
+
+                    stack.push_back(neighborPosition);
+
+                    ret = neighbor == vertex2;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool htd::CompressedMultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+{
+    HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    return std::binary_search(storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition],
+                              storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition + 1],
+                              neighbor);
+}
+
+std::size_t htd::CompressedMultiHypergraph::neighborCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    return storage.neighborOffsets_[vertexPosition + 1] - storage.neighborOffsets_[vertexPosition];
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedMultiHypergraph::neighbors(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    VectorRange<htd::vertex_t> range { storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition],
+                                       storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition + 1] };
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(range);
+}
+
+void htd::CompressedMultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    target.insert(target.end(),
+                  storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition],
+                  storage.neighbors_.begin() + storage.neighborOffsets_[vertexPosition + 1]);
+}
+
+htd::vertex_t htd::CompressedMultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    HTD_ASSERT(index < storage.neighborOffsets_[vertexPosition + 1] - storage.neighborOffsets_[vertexPosition])
+
+    return storage.neighbors_[storage.neighborOffsets_[vertexPosition] + index];
+}
+
+std::size_t htd::CompressedMultiHypergraph::isolatedVertexCount(void) const
+{
+    return implementation_->storage_->isolatedVertices_.size();
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedMultiHypergraph::isolatedVertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->storage_->isolatedVertices_);
+}
+
+htd::vertex_t htd::CompressedMultiHypergraph::isolatedVertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->storage_->isolatedVertices_.size())
+
+    return implementation_->storage_->isolatedVertices_[index];
+}
+
+bool htd::CompressedMultiHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
+{
+    return neighborCount(vertex) == 0;
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompressedMultiHypergraph::hyperedges(void) const
+{
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->storage_->hyperedges()));
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompressedMultiHypergraph::hyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    const std::vector<htd::Hyperedge> & hyperedgeVector = *(storage.hyperedges());
+
+    htd::VectorAdapter<htd::Hyperedge> ret;
+
+    auto & result = ret.container();
+
+    htd::index_t vertexPosition = storage.position(vertex);
+
+    for (std::size_t index = storage.incidenceOffsets_[vertexPosition]; index < storage.incidenceOffsets_[vertexPosition + 1]; ++index)
+    {
+        result.push_back(hyperedgeVector[storage.incidentEdges_[index]]);
+    }
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+}
+
+const htd::Hyperedge & htd::CompressedMultiHypergraph::hyperedge(htd::id_t edgeId) const
+{
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    htd::index_t position = storage.edgePosition(edgeId);
+
+    HTD_ASSERT(position < storage.edgeIds_.size())
+
+    return (*(storage.hyperedges()))[position];
+}
+
+const htd::Hyperedge & htd::CompressedMultiHypergraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->storage_->edgeIds_.size())
+
+    return (*(implementation_->storage_->hyperedges()))[index];
+}
+
+const htd::Hyperedge & htd::CompressedMultiHypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
+{
+    Implementation::Storage & storage = *(implementation_->storage_);
+
+    if (isVertex(vertex))
+    {
+        htd::index_t vertexPosition = storage.position(vertex);
+
+        if (index < storage.incidenceOffsets_[vertexPosition + 1] - storage.incidenceOffsets_[vertexPosition])
+        {
+            return (*(storage.hyperedges()))[storage.incidentEdges_[storage.incidenceOffsets_[vertexPosition] + index]];
+        }
+    }
+
+    throw std::out_of_range("const htd::Hyperedge & htd::CompressedMultiHypergraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
+}
+
+htd::FilteredHyperedgeCollection htd::CompressedMultiHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->storage_->hyperedges()), indices);
+}
+
+htd::FilteredHyperedgeCollection htd::CompressedMultiHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->storage_->hyperedges()), std::move(indices));
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompressedMultiHypergraph::hyperedgeElementsAtPosition(htd::index_t index) const
+{
+    const Implementation::Storage & storage = *(implementation_->storage_);
+
+    HTD_ASSERT(index < storage.edgeIds_.size())
+
+    VectorRange<htd::vertex_t> range { storage.edgeElements_.begin() + storage.edgeOffsets_[index],
+                                       storage.edgeElements_.begin() + storage.edgeOffsets_[index + 1] };
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(range);
+}
+
+htd::id_t htd::CompressedMultiHypergraph::hyperedgeIdAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->storage_->edgeIds_.size())
+
+    return implementation_->storage_->edgeIds_[index];
+}
+
+const htd::LibraryInstance * htd::CompressedMultiHypergraph::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::CompressedMultiHypergraph::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::CompressedMultiHypergraph * htd::CompressedMultiHypergraph::clone(void) const
+{
+    return new htd::CompressedMultiHypergraph(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IGraphStructure * htd::CompressedMultiHypergraph::cloneGraphStructure(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::CompressedMultiHypergraph::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+#endif
+
+#endif /* HTD_HTD_COMPRESSEDMULTIHYPERGRAPH_CPP */
@@ -41,7 +41,7 @@ htd::ConnectedComponentAlgorithmFactory::~ConnectedComponentAlgorithmFactory()
 
 htd::IConnectedComponentAlgorithm * htd::ConnectedComponentAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_CONNECTEDCOMPONENTALGORITHMFACTORY_CPP */
@@ -42,9 +42,9 @@ htd::DirectedGraphFactory::~DirectedGraphFactory()
 htd::IMutableDirectedGraph * htd::DirectedGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableDirectedGraph();
+    return constructionTemplate()->cloneMutableDirectedGraph();
 #endif
 }
 
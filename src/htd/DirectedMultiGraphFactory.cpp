@@ -42,9 +42,9 @@ htd::DirectedMultiGraphFactory::~DirectedMultiGraphFactory()
 htd::IMutableDirectedMultiGraph * htd::DirectedMultiGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableDirectedMultiGraph();
+    return constructionTemplate()->cloneMutableDirectedMultiGraph();
 #endif
 }
 
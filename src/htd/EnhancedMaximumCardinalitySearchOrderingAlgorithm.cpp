@@ -31,10 +31,10 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
+#include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm.
@@ -62,94 +62,84 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
     const htd::LibraryInstance * managementInstance_;
 
     /**
-     *  Fill the pool of vertices having maximum weight.
+     *  Collect all unnumbered vertices which are connected to the selected vertex via a path whose inner vertices are
+     *  unnumbered and have a weight strictly less than the weight of the respective vertex.
      *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
+     *  The search visits each unnumbered vertex and each edge at most once. It processes the reached vertices in
+     *  order of the maximum weight encountered on the path via which they were reached, so a single search replaces
+     *  one path query per pair of vertices.
+     *
+     *  @param[in] neighborhood     The neighborhood of each of the vertices.
+     *  @param[in] weights          A vector containing the weights associated with each of the vertices.
+     *  @param[in] numbered         A vector indicating for each of the vertices whether it is already numbered.
+     *  @param[in] selectedVertex   The selected vertex.
+     *  @param[in] maximumWeight    An upper bound for the weights of the unnumbered vertices.
+     *  @param[in] stamp            The stamp which marks the vertices reached during the current search.
+     *  @param[in,out] reached      A vector containing the stamp of the last search which reached the respective vertex.
+     *  @param[in,out] reachBuckets The buckets of reached vertices, indexed by the maximum weight on their path. The buckets are empty after the search.
+     *  @param[out] result          The vertices whose weight shall be incremented.
      */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const HTD_NOEXCEPT
+    void collectReachableVertices(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                  const std::vector<std::size_t> & weights,
+                                  const std::vector<char> & numbered,
+                                  htd::vertex_t selectedVertex,
+                                  std::size_t maximumWeight,
+                                  std::size_t stamp,
+                                  std::vector<std::size_t> & reached,
+                                  std::vector<std::vector<htd::vertex_t>> & reachBuckets,
+                                  std::vector<htd::vertex_t> & result) const
     {
-        std::size_t max = 0;
+        if (reachBuckets.size() <= maximumWeight)
+        {
+            reachBuckets.resize(maximumWeight + 1);
+        }
 
-        pool.clear();
+        result.clear();
 
-        for (htd::vertex_t vertex : vertices)
+        for (htd::vertex_t neighbor : neighborhood[selectedVertex])
         {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
+            if (!numbered[neighbor])
             {
-                if (tmp > max)
-                {
-                    max = tmp;
+                reached[neighbor] = stamp;
 
-                    pool.clear();
-                }
+                reachBuckets[weights[neighbor]].push_back(neighbor);
 
-                pool.push_back(vertex);
+                result.push_back(neighbor);
             }
         }
-    }
-
-    /**
-     *  Check whether there exists a path between two vertices consisting of only
-     *  unnumbered vertices in the graph whose weight is strictly less than the
-     *  weight of the source vertex.
-     *
-     *  @param[in] graph    The graph.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] source   The source vertex.
-     *  @param[in] target   The target vertex.
-     *
-     *  @return True if a valid path between the two vertices exists, false otherwise.
-     */
-    bool hasValidPath(const htd::IPreprocessedGraph & graph, const std::vector<std::size_t> & weights, const std::unordered_set<htd::vertex_t> & vertices, htd::vertex_t source, htd::vertex_t target)
-    {
-        bool ret = false;
-
-        std::size_t currentWeight = weights[source];
-
-        std::deque<htd::vertex_t> originDeque;
-
-        std::unordered_set<htd::vertex_t> visitedVertices;
-
-        htd::vertex_t currentVertex = source;
 
-        originDeque.push_back(currentVertex);
-
-        while (!ret && !originDeque.empty() && !managementInstance_->isTerminated())
+        for (std::size_t currentWeight = 0; currentWeight <= maximumWeight; ++currentWeight)
         {
-            currentVertex = originDeque.front();
-
-            visitedVertices.insert(currentVertex);
-
-            ret = currentVertex == target;
+            std::vector<htd::vertex_t> & bucket = reachBuckets[currentWeight];
 
-            if (!ret)
+            while (!bucket.empty())
             {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
+                htd::vertex_t vertex = bucket.back();
 
-                auto it = neighborCollection.begin();
+                bucket.pop_back();
 
-                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
+                for (htd::vertex_t neighbor : neighborhood[vertex])
                 {
-                    htd::vertex_t neighbor = *it;
-
-                    if (visitedVertices.count(neighbor) == 0 && ((vertices.count(neighbor) == 1 && weights[neighbor] < currentWeight) || neighbor == target))
+                    if (!numbered[neighbor] && reached[neighbor] != stamp)
                     {
-                        originDeque.push_back(neighbor);
-                    }
+                        reached[neighbor] = stamp;
 
-                    ++it;
+                        std::size_t neighborWeight = weights[neighbor];
+
+                        if (neighborWeight > currentWeight)
+                        {
+                            reachBuckets[neighborWeight].push_back(neighbor);
+
+                            result.push_back(neighbor);
+                        }
+                        else
+                        {
+                            bucket.push_back(neighbor);
+                        }
+                    }
                 }
             }
-
-            originDeque.pop_front();
         }
-
-        return ret;
     }
 };
 
@@ -183,14 +173,20 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
-
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
 
-    std::vector<htd::vertex_t> pool;
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
 
     std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
 
+    std::vector<char> numbered(preprocessedGraph.inputGraphVertexCount(), 1);
+
+    std::vector<std::size_t> reached(preprocessedGraph.inputGraphVertexCount());
+
+    std::vector<std::vector<htd::vertex_t>> reachBuckets;
+
+    std::vector<htd::vertex_t> reachableVertices;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
@@ -200,23 +196,34 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
                     preprocessedGraph.eliminationSequence().begin(),
                     preprocessedGraph.eliminationSequence().end());
 
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        numbered[vertex] = 0;
+
+        priorityQueue.push(vertex, 0);
+    }
+
     while (size > 0 && !managementInstance.isTerminated())
     {
-        implementation_->fillMaxCardinalityPool(vertices, weights, pool);
+        std::size_t maximumWeight = priorityQueue.topPriority();
+
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance.randomNumberGenerator());
+
+        priorityQueue.eraseFromTopCollection(selectedVertex);
 
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+        numbered[selectedVertex] = 1;
 
-        vertices.erase(selectedVertex);
+        implementation_->collectReachableVertices(neighborhood, weights, numbered, selectedVertex, maximumWeight, size, reached, reachBuckets, reachableVertices);
 
-        for (htd::vertex_t vertex : vertices)
+        /* The weights are only updated after the search because all path conditions refer to the weights before the current step. */
+        for (htd::vertex_t vertex : reachableVertices)
         {
-            if (implementation_->hasValidPath(preprocessedGraph, weights, vertices, vertex, selectedVertex))
-            {
-                weights[vertex]++;
-            }
-        }
+            std::size_t & currentWeight = weights[vertex];
 
-        pool.clear();
+            priorityQueue.updatePriority(vertex, currentWeight, currentWeight + 1);
+
+            ++currentWeight;
+        }
 
         --size;
 
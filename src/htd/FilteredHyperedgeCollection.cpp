@@ -59,6 +59,11 @@ htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(std::shared_ptr<ht
 
 }
 
+htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(const htd::FilteredHyperedgeCollection & original, std::vector<htd::index_t> && relevantIndices) : baseCollection_(original.baseCollection_), relevantIndices_(std::make_shared<std::vector<htd::index_t>>(std::move(relevantIndices)))
+{
+
+}
+
 htd::FilteredHyperedgeCollection::FilteredHyperedgeCollection(const htd::FilteredHyperedgeCollection & original) HTD_NOEXCEPT : baseCollection_(original.baseCollection_), relevantIndices_(std::make_shared<std::vector<htd::index_t>>(*(original.relevantIndices_)))
 {
 
@@ -79,6 +84,13 @@ std::size_t htd::FilteredHyperedgeCollection::size(void) const HTD_NOEXCEPT
     return relevantIndices_->size();
 }
 
+const htd::Hyperedge & htd::FilteredHyperedgeCollection::at(htd::index_t index) const
+{
+    HTD_ASSERT(index < relevantIndices_->size())
+
+    return baseCollection_->at((*relevantIndices_)[index]);
+}
+
 htd::FilteredHyperedgeCollection & htd::FilteredHyperedgeCollection::operator=(const htd::FilteredHyperedgeCollection & original) HTD_NOEXCEPT
 {
     if (this != &original)
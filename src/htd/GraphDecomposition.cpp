@@ -38,7 +38,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::LibraryInstance * const m
 
 }
 
-htd::GraphDecomposition::GraphDecomposition(const htd::GraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::GraphDecomposition::GraphDecomposition(const htd::GraphDecomposition & original) : htd::LabeledMultiHypergraph::LabeledMultiHypergraph(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_), inducedHyperedgeIndex_(original.inducedHyperedgeIndex_), inducedEdgesMutex_()
 {
 
 }
@@ -159,6 +159,11 @@ htd::FilteredHyperedgeCollection & htd::GraphDecomposition::mutableInducedHypere
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
     return inducedEdges_.at(vertex);
 }
 
@@ -166,6 +171,64 @@ const htd::FilteredHyperedgeCollection & htd::GraphDecomposition::inducedHypered
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
+    return inducedEdges_.at(vertex);
+}
+
+void htd::GraphDecomposition::evictInducedHyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    if (inducedHyperedgeIndex_)
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        inducedEdges_.erase(vertex);
+    }
+}
+
+void htd::GraphDecomposition::setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index)
+{
+    if (index)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            inducedEdges_.erase(vertex);
+        }
+    }
+    else if (inducedHyperedgeIndex_)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            lazyInducedHyperedges(vertex);
+        }
+    }
+
+    inducedHyperedgeIndex_ = index;
+}
+
+htd::FilteredHyperedgeCollection & htd::GraphDecomposition::lazyInducedHyperedges(htd::vertex_t vertex) const
+{
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        if (inducedEdges_.count(vertex) > 0)
+        {
+            return inducedEdges_.at(vertex);
+        }
+    }
+
+    /* Compute the induced hyperedges without holding the lock, so that other vertices can be accessed concurrently. */
+    htd::FilteredHyperedgeCollection inducedEdges = inducedHyperedgeIndex_->inducedHyperedges(bagContent(vertex));
+
+    std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+    inducedEdges_.emplace(vertex, std::move(inducedEdges));
+
     return inducedEdges_.at(vertex);
 }
 
@@ -250,9 +313,13 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::GraphDec
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
+        inducedHyperedgeIndex_ = original.inducedHyperedgeIndex_;
+
         bagContent_.clear();
         inducedEdges_.clear();
 
+        std::lock_guard<std::mutex> lock(original.inducedEdgesMutex_);
+
         const htd::ConstCollection<htd::vertex_t> & vertices = htd::LabeledMultiHypergraph::vertices();
 
         auto it = vertices.begin();
@@ -263,7 +330,10 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::GraphDec
         {
             bagContent_[*it] = original.bagContent_.at(*it);
 
-            inducedEdges_[*it] = original.inducedEdges_.at(*it);
+            if (original.inducedEdges_.count(*it) > 0)
+            {
+                inducedEdges_[*it] = original.inducedEdges_.at(*it);
+            }
 
             ++it;
         }
@@ -278,6 +348,8 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IMultiHy
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         bagContent_.clear();
         inducedEdges_.clear();
 
@@ -306,6 +378,8 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::ILabeled
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         bagContent_.clear();
         inducedEdges_.clear();
 
@@ -334,6 +408,8 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IGraphDe
     {
         htd::LabeledMultiHypergraph::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         bagContent_.clear();
         inducedEdges_.clear();
 
@@ -41,7 +41,7 @@ htd::GraphDecompositionAlgorithmFactory::~GraphDecompositionAlgorithmFactory()
 
 htd::IGraphDecompositionAlgorithm * htd::GraphDecompositionAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_GRAPHDECOMPOSITIONALGORITHMFACTORY_CPP */
@@ -42,9 +42,9 @@ htd::GraphDecompositionFactory::~GraphDecompositionFactory()
 htd::IMutableGraphDecomposition * htd::GraphDecompositionFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableGraphDecomposition();
+    return constructionTemplate()->cloneMutableGraphDecomposition();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::GraphFactory::~GraphFactory()
 htd::IMutableGraph * htd::GraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableGraph();
+    return constructionTemplate()->cloneMutableGraph();
 #endif
 }
 
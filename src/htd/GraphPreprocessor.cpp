@@ -33,15 +33,22 @@
 #include <htd/PreprocessedGraph.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/MinFillOrderingAlgorithm.hpp>
-#include <htd/ConnectedComponentAlgorithmFactory.hpp>
-#include <htd/IConnectedComponentAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
+#include <htd/PhaseTimer.hpp>
+#include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
+#include <thread>
 
 namespace htd
 {
@@ -60,7 +67,7 @@ namespace htd
              */
             PreprocessedGraphComponent(const htd::IPreprocessedGraph & preprocessedGraph,
                                        std::vector<htd::vertex_t> && remainingVertices,
-                                       std::size_t minTreeWidth) : baseGraph_(preprocessedGraph), remainingVertices_(std::move(remainingVertices)), eliminationSequence_(), minTreeWidth_(minTreeWidth), edgeCount_(0)
+                                       std::size_t minTreeWidth) : baseGraph_(preprocessedGraph), remainingVertices_(std::move(remainingVertices)), eliminationSequence_(), atoms_(), minTreeWidth_(minTreeWidth), edgeCount_(0)
             {
                 updateEdgeCount();
             }
@@ -70,7 +77,7 @@ namespace htd
              *
              *  @param[in] original  The original preprocessed graph component data structure.
              */
-            PreprocessedGraphComponent(const htd::PreprocessedGraphComponent & original) : baseGraph_(original.baseGraph_), remainingVertices_(original.remainingVertices_), eliminationSequence_(original.eliminationSequence_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_)
+            PreprocessedGraphComponent(const htd::PreprocessedGraphComponent & original) : baseGraph_(original.baseGraph_), remainingVertices_(original.remainingVertices_), eliminationSequence_(original.eliminationSequence_), atoms_(original.atoms_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_)
             {
 
             }
@@ -273,6 +280,11 @@ namespace htd
                 return minTreeWidth_;
             }
 
+            const std::vector<std::vector<htd::vertex_t>> & atoms(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return atoms_;
+            }
+
     #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             PreprocessedGraphComponent * clone(void) const HTD_OVERRIDE
             {
@@ -311,6 +323,11 @@ namespace htd
              */
             std::vector<htd::vertex_t> eliminationSequence_;
 
+            /**
+             *  The atoms of the graph component.
+             */
+            std::vector<std::vector<htd::vertex_t>> atoms_;
+
             /**
              *  The lower bound of the treewidth of the input graph.
              */
@@ -353,13 +370,38 @@ struct htd::GraphPreprocessor::Implementation
                                                                  applyPreprocessing2_(false),
                                                                  applyPreprocessing3_(false),
                                                                  applyPreprocessing4_(false),
+                                                                 applyPreprocessing5_(false),
                                                                  iterationCount_(1),
                                                                  nonImprovementLimit_(0),
+                                                                 threadCount_(1),
                                                                  orderingAlgorithm_(new htd::MinFillOrderingAlgorithm(manager))
     {
 
     }
 
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_),
+                                                      applyPreprocessing1_(original.applyPreprocessing1_),
+                                                      applyPreprocessing2_(original.applyPreprocessing2_),
+                                                      applyPreprocessing3_(original.applyPreprocessing3_),
+                                                      applyPreprocessing4_(original.applyPreprocessing4_),
+                                                      applyPreprocessing5_(original.applyPreprocessing5_),
+                                                      iterationCount_(original.iterationCount_),
+                                                      nonImprovementLimit_(original.nonImprovementLimit_),
+                                                      threadCount_(original.threadCount_),
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                                                      orderingAlgorithm_(original.orderingAlgorithm_->clone())
+#else
+                                                      orderingAlgorithm_(original.orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm())
+#endif
+    {
+
+    }
+
     virtual ~Implementation()
     {
         delete orderingAlgorithm_;
@@ -399,6 +441,14 @@ struct htd::GraphPreprocessor::Implementation
      */
     bool applyPreprocessing4_;
 
+    /**
+     *  A boolean flag indicating whether the graph
+     *  remaining after the reduction rules should be
+     *  decomposed into its atoms so that all but the
+     *  largest atom can be eliminated independently.
+     */
+    bool applyPreprocessing5_;
+
     /**
      *  The number of iterations of the base ordering algorithm which shall be performed for each component.
      */
@@ -410,7 +460,12 @@ struct htd::GraphPreprocessor::Implementation
     std::size_t nonImprovementLimit_;
 
     /**
-     *  The base ordering algorithm which shall be used to eliminate all but the largest biconnected component.
+     *  The number of threads which shall be used to detect simplicial and almost simplicial vertices and to process the atoms.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The base ordering algorithm which shall be used to eliminate all but the largest atom.
      */
     htd::IWidthLimitableOrderingAlgorithm * orderingAlgorithm_;
 
@@ -572,6 +627,134 @@ struct htd::GraphPreprocessor::Implementation
         std::vector<std::vector<htd::vertex_t>> neighborhood;
     };
 
+    /**
+     *  Structure recording the modifications of the neighborhood relation during the preprocessing.
+     *
+     *  Whether a vertex is (almost) simplicial only depends on the subgraph induced by the vertex and its neighbors.
+     *  The reductions remove edges only by eliminating one of their endpoints, which modifies the neighborhood of all
+     *  neighbors of the eliminated vertex. Hence, a vertex whose test failed before has to be tested again only if its
+     *  own neighborhood was modified or if one of its neighbors gained a new neighbor after the test. Distinguishing
+     *  both kinds of modifications avoids re-testing all neighbors of a vertex of large degree whenever one of its
+     *  neighbors is eliminated.
+     */
+    struct ModificationTracker
+    {
+        /**
+         *  Constructor for the ModificationTracker data structure.
+         *
+         *  @param[in] size The number of vertices of the input graph.
+         */
+        ModificationTracker(std::size_t size) : modificationCount(1), lastModification(size, 1), lastExtension(size, 1), lastFailedTest(2, std::vector<std::size_t>(size, 0))
+        {
+
+        }
+
+        /**
+         *  The tests whose failures are recorded by the tracker.
+         */
+        enum Test
+        {
+            /**
+             *  The test whether all neighbors of a vertex form a clique.
+             */
+            SIMPLICIAL = 0,
+
+            /**
+             *  The test whether at least all but one of the neighbors of a vertex form a clique.
+             */
+            ALMOST_SIMPLICIAL = 1
+        };
+
+        /**
+         *  Record that the neighborhoods of the given vertices are modified by removing a neighbor.
+         *
+         *  @param[in] modifiedVertices The vertices whose neighborhood is modified.
+         */
+        void markModified(const std::vector<htd::vertex_t> & modifiedVertices)
+        {
+            ++modificationCount;
+
+            for (htd::vertex_t vertex : modifiedVertices)
+            {
+                lastModification[vertex] = modificationCount;
+            }
+        }
+
+        /**
+         *  Record that the given vertex gained at least one new neighbor.
+         *
+         *  @param[in] vertex   The vertex whose neighborhood was extended.
+         */
+        void markExtended(htd::vertex_t vertex)
+        {
+            ++modificationCount;
+
+            lastModification[vertex] = modificationCount;
+
+            lastExtension[vertex] = modificationCount;
+        }
+
+        /**
+         *  Record that the given test of the given vertex failed for the current neighborhood relation.
+         *
+         *  @param[in] vertex   The vertex whose test failed.
+         *  @param[in] test     The test which failed.
+         */
+        void recordFailedTest(htd::vertex_t vertex, Test test)
+        {
+            lastFailedTest[test][vertex] = modificationCount;
+        }
+
+        /**
+         *  Check whether the given test has to be performed (again) for the given vertex.
+         *
+         *  @param[in] vertex       The vertex which shall be checked.
+         *  @param[in] neighborhood The neighborhood relation of the remaining graph.
+         *  @param[in] test         The test which shall be performed.
+         *
+         *  @return True if the test was not performed yet for the vertex or if the neighborhood of the vertex changed or one of its neighbors gained a new neighbor since the last failed test, false otherwise.
+         */
+        bool isOutdated(htd::vertex_t vertex, const std::vector<std::vector<htd::vertex_t>> & neighborhood, Test test) const
+        {
+            std::size_t lastTest = lastFailedTest[test][vertex];
+
+            if (lastModification[vertex] > lastTest)
+            {
+                return true;
+            }
+
+            for (htd::vertex_t neighbor : neighborhood[vertex])
+            {
+                if (lastExtension[neighbor] > lastTest)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         *  The number of modifications recorded so far.
+         */
+        std::size_t modificationCount;
+
+        /**
+         *  The timestamp of the last modification of the neighborhood of each vertex.
+         */
+        std::vector<std::size_t> lastModification;
+
+        /**
+         *  The timestamp at which each vertex gained a new neighbor for the last time.
+         */
+        std::vector<std::size_t> lastExtension;
+
+        /**
+         *  The timestamp of the last failed test of each vertex, for each of the tests.
+         */
+        std::vector<std::vector<std::size_t>> lastFailedTest;
+    };
+
     /**
      *  Eliminate all vertices of degree less than 2 from the graph.
      *
@@ -579,13 +762,15 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
     static bool eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
                                                      std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                      std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                     std::vector<htd::vertex_t> & ordering);
+                                                     std::vector<htd::vertex_t> & ordering,
+                                                     ModificationTracker & tracker);
 
     /**
      *  Eliminate all vertices of degree 2 from the graph.
@@ -594,13 +779,15 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
     static bool contractPaths(std::unordered_set<htd::vertex_t> & vertices,
                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+                              std::vector<htd::vertex_t> & ordering,
+                              ModificationTracker & tracker);
 
     /**
      *  Eliminate all vertices of degree 3 from the graph in
@@ -610,13 +797,15 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
     static bool shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                 std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                std::vector<htd::vertex_t> & ordering);
+                                std::vector<htd::vertex_t> & ordering,
+                                ModificationTracker & tracker);
 
     /**
      *  If two vertices of degree 3 have exactly the same neighbors,
@@ -627,24 +816,32 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
     static bool handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                              std::vector<htd::vertex_t> & ordering);
+                              std::vector<htd::vertex_t> & ordering,
+                              ModificationTracker & tracker);
 
     /**
      *  Eliminate all vertices from the graph for which
      *  it holds that all its neighbors form a clique.
      *
+     *  @note Vertices for which the tracker guarantees that the outcome of their last test did not change are skipped.
+     *  If more than one thread is available, all remaining candidates are tested in parallel before the vertices are
+     *  eliminated sequentially, so the result does not depend on the number of threads.
+     *
      *  @param[in] vertices         The set of all available vertices.
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
      *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
+     *  @param[in] threadCount      The number of threads which shall be used to test the candidate vertices.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
@@ -653,18 +850,26 @@ struct htd::GraphPreprocessor::Implementation
                                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                             std::vector<htd::vertex_t> & ordering,
                                             std::size_t maxDegree,
-                                            std::size_t & minTreeWidth);
+                                            std::size_t & minTreeWidth,
+                                            ModificationTracker & tracker,
+                                            std::size_t threadCount);
 
     /**
      *  Eliminate all vertices from the graph for which it
      *  holds that at least all but one of its neighbors
      *  form a clique.
      *
+     *  @note Vertices for which the tracker guarantees that the outcome of their last test did not change are skipped.
+     *  If more than one thread is available, all remaining candidates are tested in parallel before the vertices are
+     *  eliminated sequentially, so the result does not depend on the number of threads.
+     *
      *  @param[in] vertices         The set of all available vertices.
      *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
+     *  @param[in] tracker          The tracker which records the modifications of the neighborhood relation.
+     *  @param[in] threadCount      The number of threads which shall be used to test the candidate vertices.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
@@ -672,7 +877,66 @@ struct htd::GraphPreprocessor::Implementation
                                                   std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                   std::vector<htd::vertex_t> & ordering,
-                                                  std::size_t & minTreeWidth);
+                                                  std::size_t & minTreeWidth,
+                                                  ModificationTracker & tracker,
+                                                  std::size_t threadCount);
+
+    /**
+     *  Check whether the neighbors of the given vertex form a clique.
+     *
+     *  @param[in] vertex       The vertex which shall be tested.
+     *  @param[in] neighborhood The neighborhood relation of the remaining graph.
+     *
+     *  @return True if the neighbors of the given vertex form a clique, false otherwise.
+     */
+    static bool isSimplicial(htd::vertex_t vertex, const std::vector<std::vector<htd::vertex_t>> & neighborhood);
+
+    /**
+     *  Check whether at least all but one of the neighbors of the given vertex form a clique
+     *  and whether the remaining neighbor can be connected to all other neighbors safely.
+     *
+     *  @param[in] vertex               The vertex which shall be tested.
+     *  @param[in] neighborhood         The neighborhood relation of the remaining graph.
+     *  @param[out] culprit             The neighbor which is not part of the clique or the vertex itself if the vertex is simplicial.
+     *  @param[out] missingNeighbors    The neighbors of the vertex which have to be connected to the culprit, sorted in ascending order.
+     *
+     *  @return True if the given vertex is simplicial or almost simplicial, false otherwise.
+     */
+    static bool isAlmostSimplicial(htd::vertex_t vertex,
+                                   const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                   htd::vertex_t & culprit,
+                                   std::vector<htd::vertex_t> & missingNeighbors);
+
+    /**
+     *  Append the vertices which are found in the first but not in the second set to the given result vector.
+     *
+     *  @note If the second set is much larger than the first one, each vertex of the first set is located by binary search
+     *  instead of merging both sets, because the neighborhood of a vertex of small degree is often compared to the
+     *  neighborhood of a vertex of very large degree.
+     *
+     *  @param[in] set1     The first set of vertices, sorted in ascending order.
+     *  @param[in] set2     The second set of vertices, sorted in ascending order.
+     *  @param[out] result  The vector to which the vertices found only in the first set are appended in ascending order.
+     */
+    static void appendDifference(const std::vector<htd::vertex_t> & set1,
+                                 const std::vector<htd::vertex_t> & set2,
+                                 std::vector<htd::vertex_t> & result);
+
+    /**
+     *  Test the given candidate vertices in parallel and record all failed tests in the given tracker.
+     *
+     *  @param[in] candidates   The vertices which shall be tested.
+     *  @param[in] function     The function which performs the test for a candidate.
+     *  @param[in] test         The test which is performed by the given function.
+     *  @param[in] tracker      The tracker in which the failed tests shall be recorded.
+     *  @param[in] threadCount  The number of threads which shall be used to test the candidate vertices.
+     */
+    template <typename Function>
+    static void recordFailedTests(const std::vector<htd::vertex_t> & candidates,
+                                  const Function & function,
+                                  ModificationTracker::Test test,
+                                  ModificationTracker & tracker,
+                                  std::size_t threadCount);
 
     /**
      *  Update the group to which the given vertex belongs.
@@ -699,50 +963,90 @@ struct htd::GraphPreprocessor::Implementation
                                     std::size_t newDegree);
 
     /**
-     *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
+     *  Determine the biconnected components of the graph which remained after the reduction rules were applied.
      *
-     *  @param[in] set1                 The first set of vertices, sorted in ascending order.
-     *  @param[in] set2                 The second set of vertices, sorted in ascending order.
-     *  @param[out] resultOnlySet1      The set of vertices which are found only in the first set, sorted in ascending order.
-     *  @param[out] resultIntersection  The set of vertices which are found in both sets, sorted in ascending order.
+     *  @param[in] preprocessedGraph    The preprocessed graph.
+     *  @param[out] components          The biconnected components of the remaining graph, each sorted in ascending order. Isolated vertices form a component on their own.
      */
-    void splitSets(const std::vector<htd::vertex_t> & set1,
-                   const std::vector<htd::vertex_t> & set2,
-                   std::vector<htd::vertex_t> & resultOnlySet1,
-                   std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT;
+    void applyBiconnectedComponentPreprocessing(const htd::PreprocessedGraph & preprocessedGraph,
+                                                std::vector<std::vector<htd::vertex_t>> & components) const;
 
     /**
-     *  Compute largest biconnected component of the given graph and eliminate all vertices contained in the remainder.
+     *  Decompose the given biconnected components into their atoms and eliminate all atoms but the largest one.
+     *
+     *  The atoms of the components are determined in parallel. Afterwards, they are arranged in a forest in which
+     *  adjacent atoms share exactly the clique which separates them, i.e., a clique minimal separator within a
+     *  component or an articulation point between two components.
      *
-     *  @param[in] graph                The graph which shall be preprocessed.
+     *  @param[in] graph                The graph which is preprocessed.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
+     *  @param[in] components           The biconnected components of the remaining graph.
      */
-    void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+    void applyCliqueSeparatorPreprocessing(const htd::IMultiHypergraph & graph,
+                                           htd::PreprocessedGraph & preprocessedGraph,
+                                           const std::vector<std::vector<htd::vertex_t>> & components) const;
 
     /**
-     *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
+     *  Eliminate all atoms of the given forest except the largest one and update the preprocessed graph accordingly.
      *
-     *  @param[in] graph                The graph underlying the operation.
-     *  @param[in] vertices             The vertices which shall be eliminated.
+     *  The forest is rooted at the largest atom and the atoms are eliminated bottom-up. Each atom eliminates all its vertices
+     *  except those it shares with its parent. At this point, all other neighbors of these vertices are already eliminated,
+     *  so the elimination ordering of each atom can be computed independently and in parallel. The vertices of the
+     *  separator shared with the parent are moved to the end of the ordering of the atom without increasing its width.
+     *
+     *  @param[in] graph                The graph which is preprocessed.
      *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
+     *  @param[in] atoms                The atoms of the remaining graph.
+     *  @param[in] adjacentAtoms        The adjacent atoms of each atom together with the index of the separator shared with them.
+     *  @param[in] separators           The separators shared by adjacent atoms.
      */
-    void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
-                           htd::PreprocessedGraph & preprocessedGraph,
-                           std::size_t & minTreeWidth) const;
+    void eliminateAtoms(const htd::IMultiHypergraph & graph,
+                        htd::PreprocessedGraph & preprocessedGraph,
+                        std::vector<std::vector<htd::vertex_t>> && atoms,
+                        const std::vector<std::vector<std::pair<htd::index_t, htd::index_t>>> & adjacentAtoms,
+                        const std::vector<std::vector<htd::vertex_t>> & separators) const;
 
     /**
-     *  Iteratively compute the clique minimal separators of the given graph and remove them from the graph.
+     *  Compute the best vertex elimination ordering for the remaining vertices of the given graph within the configured number of iterations.
      *
-     *  @param[in] preprocessedGraph    The preprocessed graph which shall be updated.
-     *  @param[in] vertices             The set of all available vertices.
+     *  @param[in] graph                The graph underlying the operation.
+     *  @param[in] preprocessedGraph    The preprocessed graph for which the ordering shall be computed.
+     *  @param[in] algorithm            The ordering algorithm which shall be used.
+     *  @param[in] managementInstance   The management instance which shall be checked for termination.
+     *
+     *  @return The best vertex elimination ordering found or nullptr if the algorithm was terminated before the first ordering was found.
+     */
+    htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph,
+                                                       const htd::IPreprocessedGraph & preprocessedGraph,
+                                                       const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                                       const htd::LibraryInstance & managementInstance) const;
+
+    /**
+     *  Reorder the given vertex elimination ordering such that the vertices of the given clique are eliminated last.
+     *
+     *  The new ordering is a perfect elimination ordering of the triangulation induced by the given ordering. It is
+     *  computed by a maximum cardinality search which visits the vertices of the clique first, hence the width of
+     *  the ordering does not increase.
+     *
+     *  @param[in] neighborhood The neighborhood of each of the vertices.
+     *  @param[in,out] ordering The vertex elimination ordering which shall be reordered.
+     *  @param[in] clique       The vertices which shall be eliminated last. They must form a clique.
+     */
+    static void moveCliqueToEnd(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                std::vector<htd::vertex_t> & ordering,
+                                const std::vector<htd::vertex_t> & clique);
+
+    /**
+     *  Perform the given function for each task index in parallel.
+     *
+     *  @note Each worker thread uses its own management instance. Its random number generator is reseeded before each
+     *  task based on the task index, so the results do not depend on the number of threads.
+     *
+     *  @param[in] taskCount    The number of tasks.
+     *  @param[in] function     The function which shall be called with the management instance and the index of the worker as well as the index of the task.
      */
-    void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
+    template <typename Function>
+    void forEachInParallel(std::size_t taskCount, const Function & function) const;
 };
 
 htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -750,6 +1054,11 @@ htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const man
 
 }
 
+htd::GraphPreprocessor::GraphPreprocessor(const htd::GraphPreprocessor & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
 htd::GraphPreprocessor::~GraphPreprocessor()
 {
 
@@ -761,6 +1070,8 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
+    HTD_STATISTICS(htd::PhaseTimer phaseTimer(managementInstance, htd::Statistics::PREPROCESSING_PHASE);)
+
     htd::GraphPreprocessor::Implementation::PreparedInput input(managementInstance, graph);
 
     std::size_t size = input.vertexNames.size();
@@ -780,6 +1091,8 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         std::size_t minTreeWidth = 0;
 
+        htd::GraphPreprocessor::Implementation::ModificationTracker tracker(size);
+
         for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
         {
             vertices.insert(vertex);
@@ -787,7 +1100,7 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
         }
 
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering, tracker))
         {
 
         }
@@ -798,36 +1111,36 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
         {
             minTreeWidth = 2;
 
-            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering, tracker))
             {
                 ok = true;
             }
 
             if (ok)
             {
-                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering, tracker))
                 {
 
                 }
             }
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing3_)
+        if (!vertices.empty() && implementation_->applyPreprocessing3_ && !managementInstance.isTerminated())
         {
             minTreeWidth = 3;
 
-            while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+            while (!managementInstance.isTerminated() && implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering, tracker))
             {
                 ok = false;
 
-                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering, tracker))
                 {
                     ok = true;
                 }
 
                 if (ok)
                 {
-                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering, tracker))
                     {
 
                     }
@@ -835,42 +1148,42 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             }
         }
 
-        if (!vertices.empty() && implementation_->applyPreprocessing4_)
+        if (!vertices.empty() && implementation_->applyPreprocessing4_ && !managementInstance.isTerminated())
         {
-            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
+            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth, tracker, implementation_->threadCount_))
             {
-                while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                while (!managementInstance.isTerminated() && implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering, tracker))
                 {
                     ok = false;
 
-                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering, tracker))
                     {
                         ok = true;
                     }
 
                     if (ok)
                     {
-                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering, tracker))
                         {
 
                         }
                     }
                 }
 
-                while (implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
+                while (!managementInstance.isTerminated() && implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth, tracker, implementation_->threadCount_))
                 {
-                    while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                    while (!managementInstance.isTerminated() && implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering, tracker))
                     {
                         ok = false;
 
-                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering, tracker))
                         {
                             ok = true;
                         }
 
                         if (ok)
                         {
-                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering, tracker))
                             {
 
                             }
@@ -891,13 +1204,13 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         ret = new htd::PreprocessedGraph(std::move(vertexNames), std::move(neighborhood), std::move(ordering), std::move(remainingVertices), graph.edgeCount(), minTreeWidth);
 
-        if (implementation_->applyPreprocessing4_)
+        if (implementation_->applyPreprocessing5_ && !ret->remainingVertices().empty() && !managementInstance.isTerminated())
         {
-            //TODO
-            //implementation_->applyBiconnectedComponentPreprocessing(graph, *ret, vertices);
+            std::vector<std::vector<htd::vertex_t>> components;
+
+            implementation_->applyBiconnectedComponentPreprocessing(*ret, components);
 
-            //TODO
-            //implementation_->applyCliqueSeparatorPreprocessing(*ret, vertices);
+            implementation_->applyCliqueSeparatorPreprocessing(graph, *ret, components);
         }
     }
     else
@@ -920,6 +1233,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = false;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
     else if (level == 1)
     {
@@ -927,6 +1241,7 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = false;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
     else if (level == 2)
     {
@@ -934,13 +1249,23 @@ void htd::GraphPreprocessor::setPreprocessingStrategy(std::size_t level)
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = false;
+        implementation_->applyPreprocessing5_ = false;
     }
-    else if (level > 2)
+    else if (level == 3)
     {
         implementation_->applyPreprocessing1_ = true;
         implementation_->applyPreprocessing2_ = true;
         implementation_->applyPreprocessing3_ = true;
         implementation_->applyPreprocessing4_ = true;
+        implementation_->applyPreprocessing5_ = false;
+    }
+    else
+    {
+        implementation_->applyPreprocessing1_ = true;
+        implementation_->applyPreprocessing2_ = true;
+        implementation_->applyPreprocessing3_ = true;
+        implementation_->applyPreprocessing4_ = true;
+        implementation_->applyPreprocessing5_ = true;
     }
 }
 
@@ -976,6 +1301,18 @@ void htd::GraphPreprocessor::setNonImprovementLimit(std::size_t nonImprovementLi
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::GraphPreprocessor::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::GraphPreprocessor::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAlgorithm * algorithm)
 {
     HTD_ASSERT(algorithm != nullptr)
@@ -987,7 +1324,7 @@ void htd::GraphPreprocessor::setOrderingAlgorithm(htd::IWidthLimitableOrderingAl
 
 htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
 {
-    return new htd::GraphPreprocessor(implementation_->managementInstance_);
+    return new htd::GraphPreprocessor(*this);
 }
 
 void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
@@ -1016,7 +1353,8 @@ void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t v
 bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
                                                                                   std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                                                  std::vector<htd::vertex_t> & ordering)
+                                                                                  std::vector<htd::vertex_t> & ordering,
+                                                                                  ModificationTracker & tracker)
 {
     std::size_t oldOrderingSize = ordering.size();
 
@@ -1043,6 +1381,8 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
 
             std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
 
+            tracker.markModified(currentNeighborhood);
+
             /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
             // coverity[use_iterator]
             otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
@@ -1072,7 +1412,8 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
 bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<htd::vertex_t> & vertices,
                                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                           std::vector<htd::vertex_t> & ordering)
+                                                           std::vector<htd::vertex_t> & ordering,
+                                                           ModificationTracker & tracker)
 {
     std::size_t oldOrderingSize = ordering.size();
 
@@ -1092,6 +1433,8 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
             std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
             std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
 
+            tracker.markModified(currentNeighborhood);
+
             /* Because 'neighbor1' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood1'. */
             // coverity[use_iterator]
             otherNeighborhood1.erase(std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), vertex));
@@ -1111,6 +1454,9 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
             {
                 otherNeighborhood1.insert(position, neighbor2);
                 otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), neighbor1), neighbor1);
+
+                tracker.markExtended(neighbor1);
+                tracker.markExtended(neighbor2);
             }
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
@@ -1129,7 +1475,8 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
                                                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                             std::vector<htd::vertex_t> & ordering)
+                                                             std::vector<htd::vertex_t> & ordering,
+                                                             ModificationTracker & tracker)
 {
     std::size_t oldOrderingSize = ordering.size();
 
@@ -1220,6 +1567,23 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
 
             if (preprocessingApplicable)
             {
+                tracker.markModified(currentNeighborhood);
+
+                if (neighborDegree1 != otherNeighborhood1.size())
+                {
+                    tracker.markExtended(neighbor1);
+                }
+
+                if (neighborDegree2 != otherNeighborhood2.size())
+                {
+                    tracker.markExtended(neighbor2);
+                }
+
+                if (neighborDegree3 != otherNeighborhood3.size())
+                {
+                    tracker.markExtended(neighbor3);
+                }
+
                 /* Because 'neighbor1' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood1'. */
                 // coverity[use_iterator]
                 otherNeighborhood1.erase(std::lower_bound(otherNeighborhood1.begin(), otherNeighborhood1.end(), vertex));
@@ -1264,7 +1628,8 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
 bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
                                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
-                                                           std::vector<htd::vertex_t> & ordering)
+                                                           std::vector<htd::vertex_t> & ordering,
+                                                           ModificationTracker & tracker)
 {
     std::size_t oldOrderingSize = ordering.size();
 
@@ -1310,6 +1675,12 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                             std::size_t neighborDegree2 = otherNeighborhood2.size();
                             std::size_t neighborDegree3 = otherNeighborhood3.size();
 
+                            tracker.markModified(currentNeighborhood1);
+
+                            tracker.markExtended(neighbor1);
+                            tracker.markExtended(neighbor2);
+                            tracker.markExtended(neighbor3);
+
                             for (htd::vertex_t vertex : currentNeighborhood1)
                             {
                                 std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[vertex];
@@ -1381,27 +1752,37 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
                                                                          std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                          std::vector<htd::vertex_t> & ordering,
                                                                          std::size_t maxDegree,
-                                                                         std::size_t & minTreewidth)
+                                                                         std::size_t & minTreewidth,
+                                                                         ModificationTracker & tracker,
+                                                                         std::size_t threadCount)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    if (threadCount > 1)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        std::vector<htd::vertex_t> candidates;
 
-        if (currentNeighborhood.size() <= maxDegree)
+        for (htd::vertex_t vertex : vertices)
         {
-            bool ok = true;
-
-            for (auto it = currentNeighborhood.begin(); ok && it != currentNeighborhood.end(); ++it)
+            if (neighborhood[vertex].size() <= maxDegree && tracker.isOutdated(vertex, neighborhood, ModificationTracker::SIMPLICIAL))
             {
-                const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
-
-                ok = htd::set_intersection_size(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end()) == currentNeighborhood.size() - 1;
+                candidates.push_back(vertex);
             }
+        }
 
-            if (ok)
+        recordFailedTests(candidates, [&](htd::vertex_t vertex) { return isSimplicial(vertex, neighborhood); }, ModificationTracker::SIMPLICIAL, tracker, threadCount);
+    }
+
+    for (htd::vertex_t vertex : vertices)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        if (currentNeighborhood.size() <= maxDegree && tracker.isOutdated(vertex, neighborhood, ModificationTracker::SIMPLICIAL))
+        {
+            if (isSimplicial(vertex, neighborhood))
             {
+                tracker.markModified(currentNeighborhood);
+
                 for (htd::vertex_t neighbor : currentNeighborhood)
                 {
                     std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
@@ -1419,6 +1800,10 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
 
                 ordering.push_back(vertex);
             }
+            else
+            {
+                tracker.recordFailedTest(vertex, ModificationTracker::SIMPLICIAL);
+            }
         }
     }
 
@@ -1444,36 +1829,56 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                                                                                std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
                                                                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                std::vector<htd::vertex_t> & ordering,
-                                                                               std::size_t & minTreeWidth)
+                                                                               std::size_t & minTreeWidth,
+                                                                               ModificationTracker & tracker,
+                                                                               std::size_t threadCount)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    if (threadCount > 1)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+        std::vector<htd::vertex_t> candidates;
 
-        if (currentNeighborhood.size() > 1 && currentNeighborhood.size() <= minTreeWidth)
+        for (htd::vertex_t vertex : vertices)
         {
-            bool ok = true;
+            std::size_t degree = neighborhood[vertex].size();
 
-            std::size_t oldMissingVertexCount = 0;
+            if (degree > 1 && degree <= minTreeWidth && tracker.isOutdated(vertex, neighborhood, ModificationTracker::ALMOST_SIMPLICIAL))
+            {
+                candidates.push_back(vertex);
+            }
+        }
 
-            std::vector<htd::vertex_t> missingVertices;
+        recordFailedTests(candidates, [&](htd::vertex_t vertex)
+        {
+            htd::vertex_t culprit = vertex;
 
-            for (auto it = currentNeighborhood.begin(); ok && it != currentNeighborhood.end(); ++it)
-            {
-                const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
+            std::vector<htd::vertex_t> missingNeighbors;
 
-                std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices));
+            return isAlmostSimplicial(vertex, neighborhood, culprit, missingNeighbors);
+        }, ModificationTracker::ALMOST_SIMPLICIAL, tracker, threadCount);
+    }
+
+    std::vector<htd::vertex_t> missingVertices2;
+
+    for (htd::vertex_t vertex : vertices)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-                missingVertices.erase(std::lower_bound(missingVertices.begin() + oldMissingVertexCount, missingVertices.end(), *it));
+        if (currentNeighborhood.size() > 1 && currentNeighborhood.size() <= minTreeWidth && tracker.isOutdated(vertex, neighborhood, ModificationTracker::ALMOST_SIMPLICIAL))
+        {
+            htd::vertex_t culprit = vertex;
 
-                std::inplace_merge(missingVertices.begin(), missingVertices.begin() + oldMissingVertexCount, missingVertices.end());
+            if (!isAlmostSimplicial(vertex, neighborhood, culprit, missingVertices2))
+            {
+                tracker.recordFailedTest(vertex, ModificationTracker::ALMOST_SIMPLICIAL);
 
-                oldMissingVertexCount = missingVertices.size();
+                continue;
             }
 
-            if (missingVertices.empty())
+            tracker.markModified(currentNeighborhood);
+
+            if (culprit == vertex)
             {
                 for (htd::vertex_t neighbor : currentNeighborhood)
                 {
@@ -1487,78 +1892,50 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                 }
 
                 minTreeWidth = std::max(minTreeWidth, currentNeighborhood.size());
-
-                std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-                ordering.push_back(vertex);
             }
             else
             {
-                auto it = missingVertices.begin();
-
-                auto duplicate =  missingVertices.end();
-
-                for (auto next = it; ++next != missingVertices.end() && duplicate == missingVertices.end(); ++it)
-                {
-                    if (*it == *next)
-                    {
-                        duplicate = it;
-                    }
-                }
+                std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[culprit];
 
-                if (duplicate != missingVertices.end())
+                for (htd::vertex_t neighbor : missingVertices2)
                 {
-                    htd::vertex_t culprit = *it;
-
-                    missingVertices.erase(duplicate, std::upper_bound(duplicate, missingVertices.end(), culprit));
-
-                    if (htd::is_sorted_and_duplicate_free(missingVertices.begin(), missingVertices.end()))
-                    {
-                        std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[culprit];
-
-                        std::vector<htd::vertex_t> missingVertices2;
-
-                        std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(), otherNeighborhood.begin(), otherNeighborhood.end(), std::back_inserter(missingVertices2));
+                    std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
 
-                        missingVertices2.erase(std::lower_bound(missingVertices2.begin(), missingVertices2.end(), culprit));
+                    otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
 
-                        if (htd::set_difference_size(missingVertices.begin(), missingVertices.end(), missingVertices2.begin(), missingVertices2.end()) == 0)
-                        {
-                            for (htd::vertex_t neighbor : missingVertices2)
-                            {
-                                std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
-
-                                otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
-
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
-                            }
+                    tracker.markExtended(neighbor);
 
-                            std::size_t middle = otherNeighborhood.size();
+                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
+                }
 
-                            otherNeighborhood.insert(otherNeighborhood.end(), missingVertices2.begin(), missingVertices2.end());
+                std::size_t middle = otherNeighborhood.size();
 
-                            std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
+                if (!missingVertices2.empty())
+                {
+                    tracker.markExtended(culprit);
+                }
 
-                            assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
+                otherNeighborhood.insert(otherNeighborhood.end(), missingVertices2.begin(), missingVertices2.end());
 
-                            for (htd::vertex_t neighbor : currentNeighborhood)
-                            {
-                                std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
+                std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
 
-                                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood2'. */
-                                // coverity[use_iterator]
-                                otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
+                assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
-                            }
+                for (htd::vertex_t neighbor : currentNeighborhood)
+                {
+                    std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor];
 
-                            std::vector<htd::vertex_t>().swap(currentNeighborhood);
+                    /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood2'. */
+                    // coverity[use_iterator]
+                    otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
 
-                            ordering.push_back(vertex);
-                        }
-                    }
+                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
                 }
             }
+
+            std::vector<htd::vertex_t>().swap(currentNeighborhood);
+
+            ordering.push_back(vertex);
         }
     }
 
@@ -1580,301 +1957,558 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
     return ordering.size() > oldOrderingSize;
 }
 
-void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::vertex_t> & set1,
-                                                       const std::vector<htd::vertex_t> & set2,
-                                                       std::vector<htd::vertex_t> & resultOnlySet1,
-                                                       std::vector<htd::vertex_t> & resultIntersection) const HTD_NOEXCEPT
+bool htd::GraphPreprocessor::Implementation::isSimplicial(htd::vertex_t vertex, const std::vector<std::vector<htd::vertex_t>> & neighborhood)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    bool ok = true;
 
-    while (first1 != last1 && first2 != last2)
+    for (auto it = currentNeighborhood.begin(); ok && it != currentNeighborhood.end(); ++it)
     {
-        if (*first1 < *first2)
-        {
-            resultOnlySet1.push_back(*first1);
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            resultIntersection.push_back(*first1);
-
-            ++first1;
+        const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
 
-            //Skip common value in set 2.
-            ++first2;
-        }
+        ok = htd::set_intersection_size(otherNeighborhood.begin(), otherNeighborhood.end(), currentNeighborhood.begin(), currentNeighborhood.end()) == currentNeighborhood.size() - 1;
     }
 
-    if (first1 != last1)
-    {
-        resultOnlySet1.insert(resultOnlySet1.end(), first1, last1);
-    }
+    return ok;
 }
 
-void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
-                                                                                    htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+bool htd::GraphPreprocessor::Implementation::isAlmostSimplicial(htd::vertex_t vertex,
+                                                                const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                                htd::vertex_t & culprit,
+                                                                std::vector<htd::vertex_t> & missingNeighbors)
 {
-    htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
+    const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
-    std::vector<htd::vertex_t> articulationPoints;
-
-    std::vector<std::vector<htd::vertex_t>> components;
+    std::size_t oldMissingVertexCount = 0;
 
-    biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
+    std::vector<htd::vertex_t> missingVertices;
 
-    if (components.size() > 1)
+    for (auto it = currentNeighborhood.begin(); it != currentNeighborhood.end(); ++it)
     {
-        std::vector<htd::index_t> pool;
-        htd::index_t index = 0;
-        std::size_t max = 0;
-        for (const std::vector<htd::vertex_t> & component : components)
-        {
-            std::size_t size = component.size();
+        const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[*it];
 
-            if (size >= max)
-            {
-                if (size > max)
-                {
-                    max = size;
+        appendDifference(currentNeighborhood, otherNeighborhood, missingVertices);
 
-                    pool.clear();
-                }
+        missingVertices.erase(std::lower_bound(missingVertices.begin() + oldMissingVertexCount, missingVertices.end(), *it));
 
-                pool.push_back(index);
-            }
+        std::inplace_merge(missingVertices.begin(), missingVertices.begin() + oldMissingVertexCount, missingVertices.end());
 
-            ++index;
-        }
+        oldMissingVertexCount = missingVertices.size();
+    }
+
+    missingNeighbors.clear();
 
-        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
+    if (missingVertices.empty())
+    {
+        culprit = vertex;
+
+        return true;
+    }
+
+    auto it = missingVertices.begin();
+
+    auto duplicate =  missingVertices.end();
+
+    for (auto next = it; ++next != missingVertices.end() && duplicate == missingVertices.end(); ++it)
+    {
+        if (*it == *next)
+        {
+            duplicate = it;
+        }
+    }
 
-        std::vector<htd::vertex_t> relevantArticulationPoints;
+    if (duplicate != missingVertices.end())
+    {
+        culprit = *it;
 
-        std::set_intersection(selectedComponent.begin(), selectedComponent.end(),
-                              articulationPoints.begin(), articulationPoints.end(),
-                              std::back_inserter(relevantArticulationPoints));
+        missingVertices.erase(duplicate, std::upper_bound(duplicate, missingVertices.end(), culprit));
 
-        for (htd::vertex_t vertex : relevantArticulationPoints)
+        if (htd::is_sorted_and_duplicate_free(missingVertices.begin(), missingVertices.end()))
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+            const std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[culprit];
 
-            std::vector<htd::vertex_t> newNeighborhood;
-            std::vector<htd::vertex_t> otherNeighbors;
+            appendDifference(currentNeighborhood, otherNeighborhood, missingNeighbors);
 
-            splitSets(currentNeighborhood, selectedComponent, otherNeighbors, newNeighborhood);
+            missingNeighbors.erase(std::lower_bound(missingNeighbors.begin(), missingNeighbors.end(), culprit));
 
-            currentNeighborhood.swap(newNeighborhood);
+            return htd::set_difference_size(missingVertices.begin(), missingVertices.end(), missingNeighbors.begin(), missingNeighbors.end()) == 0;
+        }
+    }
 
-            for (htd::vertex_t neighbor : otherNeighbors)
+    return false;
+}
+
+void htd::GraphPreprocessor::Implementation::appendDifference(const std::vector<htd::vertex_t> & set1,
+                                                              const std::vector<htd::vertex_t> & set2,
+                                                              std::vector<htd::vertex_t> & result)
+{
+    if (set2.size() > 16 * set1.size())
+    {
+        auto position = set2.begin();
+
+        for (htd::vertex_t vertex : set1)
+        {
+            position = std::lower_bound(position, set2.end(), vertex);
+
+            if (position == set2.end() || *position != vertex)
             {
-                std::vector<htd::vertex_t> & otherNeighborhood = preprocessedGraph.neighborhood(neighbor);
+                result.push_back(vertex);
+            }
+        }
+    }
+    else
+    {
+        std::set_difference(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(result));
+    }
+}
 
-                /* Because 'neighbor' is a neighbor of 'vertex', std::lower_bound will always find 'vertex' in 'otherNeighborhood'. */
-                // coverity[use_iterator]
-                otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
+template <typename Function>
+void htd::GraphPreprocessor::Implementation::recordFailedTests(const std::vector<htd::vertex_t> & candidates,
+                                                               const Function & function,
+                                                               ModificationTracker::Test test,
+                                                               ModificationTracker & tracker,
+                                                               std::size_t threadCount)
+{
+    /* Each chunk is large enough to amortize the synchronization, the failed tests of different candidates are recorded in distinct entries. */
+    const std::size_t chunkSize = 256;
+
+    std::size_t chunkCount = (candidates.size() + chunkSize - 1) / chunkSize;
+
+    std::atomic<htd::index_t> nextChunk(0);
+
+    auto runWorker = [&](void)
+    {
+        for (htd::index_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++)
+        {
+            auto last = candidates.begin() + std::min(candidates.size(), (chunk + 1) * chunkSize);
+
+            for (auto it = candidates.begin() + chunk * chunkSize; it != last; ++it)
+            {
+                if (!function(*it))
+                {
+                    tracker.recordFailedTest(*it, test);
+                }
             }
         }
+    };
 
-        preprocessedGraph.updateEdgeCount();
+    std::size_t workerCount = std::min(threadCount, chunkCount);
 
-        htd::IConnectedComponentAlgorithm * connectedComponentAlgorithm = managementInstance_->connectedComponentAlgorithmFactory().createInstance();
+    if (workerCount > 1)
+    {
+        std::vector<std::thread> workers;
 
-        std::vector<std::vector<htd::vertex_t>> connectedComponents;
+        for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+        {
+            workers.emplace_back(runWorker);
+        }
 
-        connectedComponentAlgorithm->determineComponents(preprocessedGraph, connectedComponents);
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+    }
+    else
+    {
+        runWorker();
+    }
+}
 
-        delete connectedComponentAlgorithm;
+void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::PreprocessedGraph & preprocessedGraph,
+                                                                                    std::vector<std::vector<htd::vertex_t>> & components) const
+{
+    htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
-        auto position = std::find_if(connectedComponents.begin(), connectedComponents.end(),
-                                     [&](const std::vector<htd::vertex_t> & component)
+    std::vector<htd::vertex_t> articulationPoints;
+
+    biconnectedComponentAlgorithm.determineComponents(preprocessedGraph, components, articulationPoints);
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        if (preprocessedGraph.neighborhood(vertex).empty())
         {
-            return std::binary_search(component.begin(), component.end(), selectedComponent[0]);
-        });
+            components.emplace_back(1, vertex);
+        }
+    }
+}
 
-        HTD_ASSERT(position != connectedComponents.end())
+void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(const htd::IMultiHypergraph & graph,
+                                                                               htd::PreprocessedGraph & preprocessedGraph,
+                                                                               const std::vector<std::vector<htd::vertex_t>> & components) const
+{
+    std::size_t componentCount = components.size();
 
-        /*
-         * After separating the largest biconnected component from the remainder of the graph,
-         * it forms a connected component of the graph, i.e., the iterator 'position' always
-         * points to a valid position within the set of connected components.
-         */
-        // coverity[deref_iterator]
-        position->swap(*(connectedComponents.rbegin()));
+    std::vector<std::vector<std::vector<htd::vertex_t>>> componentAtoms(componentCount);
 
-        std::sort(connectedComponents.begin(), connectedComponents.end() - 1,
-                  [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
+    std::vector<std::vector<std::vector<htd::vertex_t>>> componentSeparators(componentCount);
+
+    forEachInParallel(componentCount, [&](htd::LibraryInstance & workerInstance, htd::index_t workerIndex, htd::index_t componentIndex)
+    {
+        HTD_UNUSED(workerIndex)
+
+        const std::vector<htd::vertex_t> & component = components[componentIndex];
+
+        /* Biconnected graphs with at most three vertices are cliques, hence they cannot be decomposed any further. */
+        if (component.size() > 3)
         {
-           return component1.size() < component2.size();
-        });
+            htd::PreprocessedGraphComponent componentGraph(preprocessedGraph, std::vector<htd::vertex_t>(component), 0);
+
+            htd::CliqueMinimalSeparatorAlgorithm cliqueMinimalSeparatorAlgorithm(&workerInstance);
 
-        for (const std::vector<htd::vertex_t> & component : connectedComponents)
+            cliqueMinimalSeparatorAlgorithm.determineAtoms(componentGraph, componentAtoms[componentIndex], componentSeparators[componentIndex]);
+        }
+        else
         {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+            componentAtoms[componentIndex].push_back(component);
+
+            std::sort(componentAtoms[componentIndex].back().begin(), componentAtoms[componentIndex].back().end());
+
+            componentSeparators[componentIndex].emplace_back();
+        }
+    });
+
+    if (managementInstance_->isTerminated())
+    {
+        return;
+    }
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<htd::index_t> atomComponents;
+
+    std::vector<std::vector<std::pair<htd::index_t, htd::index_t>>> adjacentAtoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    std::vector<std::vector<htd::index_t>> vertexAtoms(preprocessedGraph.inputGraphVertexCount());
+
+    auto addEdge = [&](htd::index_t atom1, htd::index_t atom2, std::vector<htd::vertex_t> && separator)
+    {
+        adjacentAtoms[atom1].emplace_back(atom2, separators.size());
+        adjacentAtoms[atom2].emplace_back(atom1, separators.size());
+
+        separators.push_back(std::move(separator));
+    };
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        std::vector<std::vector<htd::vertex_t>> & currentAtoms = componentAtoms[componentIndex];
 
-            std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+        std::vector<std::vector<htd::vertex_t>> & currentSeparators = componentSeparators[componentIndex];
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
+        htd::index_t offset = atoms.size();
 
-            std::size_t minTreeWidth = 0;
+        std::size_t atomCount = currentAtoms.size();
 
-            for (htd::vertex_t vertex : component)
+        for (std::vector<htd::vertex_t> & atom : currentAtoms)
+        {
+            for (htd::vertex_t vertex : atom)
             {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
+                vertexAtoms[vertex].push_back(atoms.size());
             }
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-            {
+            atoms.push_back(std::move(atom));
 
-            }
+            atomComponents.push_back(componentIndex);
+        }
 
-            bool ok = false;
+        adjacentAtoms.resize(atoms.size());
 
-            if (!componentVertices.empty())
-            {
-                minTreeWidth = 2;
+        /* Each atom is connected to a subsequent atom of the same component which contains the clique minimal separator which split it off. */
+        for (htd::index_t index = 0; index + 1 < atomCount; ++index)
+        {
+            std::vector<htd::vertex_t> & separator = currentSeparators[index];
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = true;
-                }
+            htd::index_t parent = offset + atomCount - 1;
 
-                if (ok)
+            if (!separator.empty())
+            {
+                for (htd::index_t candidate : vertexAtoms[separator[0]])
                 {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    if (candidate > offset + index && candidate < offset + atomCount && std::includes(atoms[candidate].begin(), atoms[candidate].end(), separator.begin(), separator.end()))
                     {
+                        parent = candidate;
 
+                        break;
                     }
                 }
             }
 
-            if (!componentVertices.empty())
-            {
-                minTreeWidth = 3;
+            addEdge(offset + index, parent, std::move(separator));
+        }
+    }
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                {
-                    ok = false;
+    /* The components containing an articulation point are connected via the first atom which contains the articulation point. */
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        const std::vector<htd::index_t> & currentAtoms = vertexAtoms[vertex];
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = true;
-                    }
+        if (!currentAtoms.empty())
+        {
+            htd::index_t lastComponent = atomComponents[currentAtoms[0]];
 
-                    if (ok)
-                    {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
+            for (htd::index_t atom : currentAtoms)
+            {
+                if (atomComponents[atom] != lastComponent)
+                {
+                    addEdge(currentAtoms[0], atom, std::vector<htd::vertex_t> { vertex });
 
-                        }
-                    }
+                    lastComponent = atomComponents[atom];
                 }
             }
+        }
+    }
 
-            if (!componentVertices.empty())
-            {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
-                {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                    {
-                        ok = false;
+    eliminateAtoms(graph, preprocessedGraph, std::move(atoms), adjacentAtoms, separators);
+}
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = true;
-                        }
+void htd::GraphPreprocessor::Implementation::eliminateAtoms(const htd::IMultiHypergraph & graph,
+                                                            htd::PreprocessedGraph & preprocessedGraph,
+                                                            std::vector<std::vector<htd::vertex_t>> && atoms,
+                                                            const std::vector<std::vector<std::pair<htd::index_t, htd::index_t>>> & adjacentAtoms,
+                                                            const std::vector<std::vector<htd::vertex_t>> & separators) const
+{
+    std::size_t atomCount = atoms.size();
 
-                        if (ok)
-                        {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
+    htd::index_t rootAtom = 0;
 
-                            }
-                        }
-                    }
+    for (htd::index_t atom = 1; atom < atomCount; ++atom)
+    {
+        if (atoms[atom].size() > atoms[rootAtom].size())
+        {
+            rootAtom = atom;
+        }
+    }
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
-                    {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                        {
-                            ok = false;
+    /* The index of the separator shared with the parent of each atom. The roots of the trees use the index of a non-existing separator. */
+    std::vector<htd::index_t> parentSeparators(atomCount, separators.size());
 
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                            {
-                                ok = true;
-                            }
+    std::vector<bool> visited(atomCount, false);
 
-                            if (ok)
-                            {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
-                                {
+    /* The atoms in the order in which they are eliminated. Each tree is traversed in pre-order and reversed afterwards, hence each atom follows its descendants. The root atom is the last one. */
+    std::vector<htd::index_t> eliminationOrder;
 
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+    eliminationOrder.reserve(atomCount);
 
-            for (auto it = preprocessedGraph.eliminationSequence().begin() + oldOrderingSize; it != preprocessedGraph.eliminationSequence().end(); ++it)
+    std::vector<htd::index_t> stack;
+
+    auto traverseTree = [&](htd::index_t start, std::vector<htd::index_t> & target)
+    {
+        std::size_t oldSize = target.size();
+
+        visited[start] = true;
+
+        stack.push_back(start);
+
+        while (!stack.empty())
+        {
+            htd::index_t atom = stack.back();
+
+            stack.pop_back();
+
+            target.push_back(atom);
+
+            for (const std::pair<htd::index_t, htd::index_t> & neighbor : adjacentAtoms[atom])
             {
-                vertices.erase(*it);
+                if (!visited[neighbor.first])
+                {
+                    visited[neighbor.first] = true;
+
+                    parentSeparators[neighbor.first] = neighbor.second;
 
-                *it = preprocessedGraph.vertexName(*it);
+                    stack.push_back(neighbor.first);
+                }
             }
+        }
 
-            if (!std::binary_search(component.begin(), component.end(), selectedComponent[0]))
-            {
-                oldOrderingSize = preprocessedGraph.eliminationSequence().size();
+        std::reverse(target.begin() + oldSize, target.end());
+    };
+
+    std::vector<htd::index_t> rootTree;
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+    traverseTree(rootAtom, rootTree);
+
+    for (htd::index_t atom = 0; atom < atomCount; ++atom)
+    {
+        if (!visited[atom])
+        {
+            traverseTree(atom, eliminationOrder);
+        }
+    }
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
+    eliminationOrder.insert(eliminationOrder.end(), rootTree.begin(), rootTree.end());
+
+    std::size_t taskCount = atomCount - 1;
+
+    std::vector<std::vector<htd::vertex_t>> eliminatedVertices(taskCount);
+
+    std::vector<std::size_t> maximumBagSizes(taskCount, 0);
+
+    std::vector<std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm>> algorithms(threadCount_);
+
+    std::atomic<bool> failed(false);
+
+    forEachInParallel(taskCount, [&](htd::LibraryInstance & workerInstance, htd::index_t workerIndex, htd::index_t taskIndex)
+    {
+        std::unique_ptr<htd::IWidthLimitableOrderingAlgorithm> & algorithm = algorithms[workerIndex];
+
+        if (!algorithm)
+        {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            algorithm.reset(orderingAlgorithm_->clone());
+#else
+            algorithm.reset(orderingAlgorithm_->cloneWidthLimitableOrderingAlgorithm());
+#endif
+
+            algorithm->setManagementInstance(&workerInstance);
+        }
+
+        htd::index_t atom = eliminationOrder[taskIndex];
+
+        const std::vector<htd::vertex_t> & atomVertices = atoms[atom];
+
+        std::size_t size = atomVertices.size();
+
+        /* The vertices of the atom are renamed to their position within the atom, hence the names of the vertices of the atom graph are the identifiers of the vertices in the preprocessed graph. */
+        std::vector<std::vector<htd::vertex_t>> neighborhood(size);
+
+        std::size_t edgeCount = 0;
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(atomVertices[index]))
+            {
+                auto position = std::lower_bound(atomVertices.begin(), atomVertices.end(), neighbor);
+
+                if (position != atomVertices.end() && *position == neighbor)
                 {
-                    vertices.erase(*it);
+                    neighborhood[index].push_back(static_cast<htd::vertex_t>(std::distance(atomVertices.begin(), position)));
                 }
             }
-            else
-            {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
 
-                std::sort(remainingVertices.begin(), remainingVertices.end());
+            edgeCount += neighborhood[index].size();
+        }
+
+        std::vector<htd::vertex_t> remainingVertices(size);
+
+        std::iota(remainingVertices.begin(), remainingVertices.end(), 0);
+
+        htd::PreprocessedGraph atomGraph(std::vector<htd::vertex_t>(atomVertices), std::move(neighborhood), std::vector<htd::vertex_t>(), std::move(remainingVertices), edgeCount / 2, 0);
+
+        std::unique_ptr<htd::IWidthLimitedVertexOrdering> ordering(computeOrdering(graph, atomGraph, *algorithm, workerInstance));
+
+        if (ordering == nullptr || ordering->sequence().size() != size)
+        {
+            failed = true;
+
+            return;
+        }
+
+        std::vector<htd::vertex_t> localOrdering;
+
+        localOrdering.reserve(size);
+
+        for (htd::vertex_t vertex : ordering->sequence())
+        {
+            localOrdering.push_back(static_cast<htd::vertex_t>(std::distance(atomVertices.begin(), std::lower_bound(atomVertices.begin(), atomVertices.end(), vertex))));
+        }
+
+        std::size_t separatorSize = 0;
+
+        if (parentSeparators[atom] < separators.size())
+        {
+            const std::vector<htd::vertex_t> & separator = separators[parentSeparators[atom]];
+
+            std::vector<htd::vertex_t> localSeparator;
+
+            localSeparator.reserve(separator.size());
 
-                preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
+            for (htd::vertex_t vertex : separator)
+            {
+                localSeparator.push_back(static_cast<htd::vertex_t>(std::distance(atomVertices.begin(), std::lower_bound(atomVertices.begin(), atomVertices.end(), vertex))));
             }
 
-            preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
+            moveCliqueToEnd(atomGraph.neighborhood(), localOrdering, localSeparator);
+
+            separatorSize = separator.size();
         }
+
+        std::vector<htd::vertex_t> & result = eliminatedVertices[taskIndex];
+
+        result.reserve(size - separatorSize);
+
+        for (auto it = localOrdering.begin(); it != localOrdering.end() - separatorSize; ++it)
+        {
+            result.push_back(atomVertices[*it]);
+        }
+
+        maximumBagSizes[taskIndex] = ordering->maximumBagSize();
+    });
+
+    if (failed || managementInstance_->isTerminated())
+    {
+        return;
     }
-}
 
-void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
-                                                               htd::PreprocessedGraph & preprocessedGraph,
-                                                               std::size_t & minTreeWidth) const
-{
-    std::vector<htd::vertex_t> remainingComponentVertices(vertices.begin(), vertices.end());
+    std::vector<char> eliminated(preprocessedGraph.inputGraphVertexCount(), 0);
+
+    std::vector<htd::vertex_t> & eliminationSequence = preprocessedGraph.eliminationSequence();
+
+    /* The atoms are eliminated heuristically, hence their bags do not affect the lower bound for the treewidth. */
+    std::size_t eliminationSequenceBagSize = preprocessedGraph.eliminationSequenceBagSize();
+
+    for (htd::index_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        for (htd::vertex_t vertex : eliminatedVertices[taskIndex])
+        {
+            eliminated[vertex] = 1;
+
+            eliminationSequence.push_back(preprocessedGraph.vertexName(vertex));
+
+            std::vector<htd::vertex_t>().swap(preprocessedGraph.neighborhood(vertex));
+        }
+
+        eliminationSequenceBagSize = std::max(eliminationSequenceBagSize, maximumBagSizes[taskIndex]);
+    }
+
+    preprocessedGraph.setEliminationSequenceBagSize(eliminationSequenceBagSize);
+
+    std::vector<htd::vertex_t> remainingVertices(atoms[rootAtom]);
 
-    std::sort(remainingComponentVertices.begin(), remainingComponentVertices.end());
+    for (htd::vertex_t vertex : remainingVertices)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+
+        currentNeighborhood.erase(std::remove_if(currentNeighborhood.begin(), currentNeighborhood.end(), [&](htd::vertex_t neighbor) { return eliminated[neighbor] != 0; }), currentNeighborhood.end());
+    }
 
-    htd::PreprocessedGraphComponent component(preprocessedGraph, std::move(remainingComponentVertices), minTreeWidth);
+    preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
 
-    htd::IWidthLimitedVertexOrdering * optimalOrdering = nullptr;
+    std::vector<std::vector<htd::vertex_t>> orderedAtoms;
+
+    orderedAtoms.reserve(atomCount);
+
+    for (htd::index_t atom : eliminationOrder)
+    {
+        orderedAtoms.push_back(std::move(atoms[atom]));
+    }
+
+    preprocessedGraph.setAtoms(std::move(orderedAtoms));
+}
+
+htd::IWidthLimitedVertexOrdering * htd::GraphPreprocessor::Implementation::computeOrdering(const htd::IMultiHypergraph & graph,
+                                                                                           const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                                           const htd::IWidthLimitableOrderingAlgorithm & algorithm,
+                                                                                           const htd::LibraryInstance & managementInstance) const
+{
+    htd::IWidthLimitedVertexOrdering * ret = nullptr;
 
     std::size_t bestMaxBagSize = 0;
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || iterationCount_ == 0 || iteration < iterationCount_) && !managementInstance_->isTerminated())
+    while ((iteration == 0 || iterationCount_ == 0 || iteration < iterationCount_) && !managementInstance.isTerminated())
     {
         std::size_t remainingIterations = iterationCount_ - iteration;
 
@@ -1883,7 +2517,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             remainingIterations = std::min(remainingIterations, nonImprovementLimit_);
         }
 
-        htd::IWidthLimitedVertexOrdering * currentOrdering = orderingAlgorithm_->computeOrdering(graph, component, bestMaxBagSize - 1, remainingIterations);
+        htd::IWidthLimitedVertexOrdering * currentOrdering = algorithm.computeOrdering(graph, preprocessedGraph, bestMaxBagSize - 1, remainingIterations);
 
         if (currentOrdering->requiredIterations() < nonImprovementLimit_)
         {
@@ -1894,66 +2528,209 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
             iteration = (std::size_t)-1;
         }
 
-        std::size_t currentMaxBagSize = currentOrdering->maximumBagSize();
+        if (!managementInstance.isTerminated() && (ret == nullptr || currentOrdering->maximumBagSize() < bestMaxBagSize))
+        {
+            delete ret;
+
+            ret = currentOrdering;
 
-        if (!managementInstance_->isTerminated())
+            bestMaxBagSize = currentOrdering->maximumBagSize();
+        }
+        else
         {
-            if ((iteration == 1 && bestMaxBagSize == 0) || currentMaxBagSize < bestMaxBagSize)
-            {
-                if (iteration > 1)
-                {
-                    delete optimalOrdering;
-                }
+            delete currentOrdering;
+        }
+    }
+
+    return ret;
+}
 
-                optimalOrdering = currentOrdering;
+void htd::GraphPreprocessor::Implementation::moveCliqueToEnd(const std::vector<std::vector<htd::vertex_t>> & neighborhood,
+                                                             std::vector<htd::vertex_t> & ordering,
+                                                             const std::vector<htd::vertex_t> & clique)
+{
+    std::size_t size = ordering.size();
+
+    std::vector<htd::index_t> positions(size);
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        positions[ordering[index]] = index;
+    }
 
-                bestMaxBagSize = currentMaxBagSize;
+    /* The neighbors of each vertex in the triangulation which are eliminated after the vertex itself, sorted in ascending order. */
+    std::vector<std::vector<htd::vertex_t>> laterNeighbors(size);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        for (htd::vertex_t neighbor : neighborhood[vertex])
+        {
+            if (positions[neighbor] > positions[vertex])
+            {
+                laterNeighbors[vertex].push_back(neighbor);
             }
-            else
+        }
+    }
+
+    std::vector<htd::vertex_t> tmp;
+
+    /* Eliminating a vertex turns its later neighbors into a clique. It suffices to pass them on to the first of them, because it passes them on in turn when it is eliminated. */
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> & currentNeighbors = laterNeighbors[vertex];
+
+        if (currentNeighbors.size() > 1)
+        {
+            htd::vertex_t first = *std::min_element(currentNeighbors.begin(), currentNeighbors.end(), [&](htd::vertex_t vertex1, htd::vertex_t vertex2) { return positions[vertex1] < positions[vertex2]; });
+
+            std::vector<htd::vertex_t> & firstNeighbors = laterNeighbors[first];
+
+            tmp.clear();
+
+            for (htd::vertex_t neighbor : currentNeighbors)
             {
-                delete currentOrdering;
+                if (neighbor != first)
+                {
+                    tmp.push_back(neighbor);
+                }
             }
+
+            std::vector<htd::vertex_t> merged;
+
+            merged.reserve(firstNeighbors.size() + tmp.size());
+
+            std::set_union(firstNeighbors.begin(), firstNeighbors.end(), tmp.begin(), tmp.end(), std::back_inserter(merged));
+
+            firstNeighbors.swap(merged);
         }
-        else
+    }
+
+    std::vector<std::vector<htd::vertex_t>> triangulation(size);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        for (htd::vertex_t neighbor : laterNeighbors[vertex])
         {
-            delete currentOrdering;
+            triangulation[vertex].push_back(neighbor);
+            triangulation[neighbor].push_back(vertex);
         }
     }
 
-    if (optimalOrdering != nullptr)
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+
+    std::vector<std::size_t> weights(size, 0);
+
+    std::vector<char> numbered(size, 0);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        priorityQueue.push(vertex, 0);
+    }
+
+    htd::index_t position = size;
+
+    /* The vertices of the clique have maximum weight while they are visited first, so the search remains a maximum cardinality search. */
+    for (htd::index_t index = 0; index < size; ++index)
     {
-        preprocessedGraph.eliminationSequence().insert(preprocessedGraph.eliminationSequence().end(), optimalOrdering->sequence().begin(), optimalOrdering->sequence().end());
+        htd::vertex_t selectedVertex = index < clique.size() ? clique[index] : priorityQueue.top();
 
-        preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), optimalOrdering->maximumBagSize() - 1);
+        priorityQueue.erase(selectedVertex, weights[selectedVertex]);
 
-        delete optimalOrdering;
+        numbered[selectedVertex] = 1;
+
+        ordering[--position] = selectedVertex;
+
+        for (htd::vertex_t neighbor : triangulation[selectedVertex])
+        {
+            if (!numbered[neighbor])
+            {
+                std::size_t & currentWeight = weights[neighbor];
+
+                priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
+
+                ++currentWeight;
+            }
+        }
     }
 }
 
-void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
+template <typename Function>
+void htd::GraphPreprocessor::Implementation::forEachInParallel(std::size_t taskCount, const Function & function) const
 {
-    htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::size_t workerCount = std::min(threadCount_, taskCount);
+
+    if (workerCount == 0)
+    {
+        return;
+    }
+
+    /* The seed is drawn from a copy of the random number generator, hence preprocessing the same graph twice yields the same result. */
+    htd::RandomNumberGenerator generator(managementInstance.randomNumberGenerator());
+
+    std::uint64_t baseSeed = generator();
+
+    std::vector<std::unique_ptr<htd::LibraryInstance>> workerInstances;
+
+    for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workerInstances.emplace_back(htd::cloneManagementInstance(managementInstance));
+    }
 
-    std::vector<htd::vertex_t> * separator = algorithm.computeSeparator(preprocessedGraph);
+    std::atomic<htd::index_t> nextTask(0);
 
-    while (separator != nullptr && !separator->empty())
+    std::mutex mutex;
+
+    std::condition_variable stateChanged;
+
+    std::size_t activeWorkerCount = workerCount;
+
+    auto runWorker = [&](htd::index_t workerIndex)
     {
-        for (htd::vertex_t vertex : *separator)
+        htd::LibraryInstance & workerInstance = *(workerInstances[workerIndex]);
+
+        for (htd::index_t taskIndex = nextTask++; taskIndex < taskCount && !workerInstance.isTerminated(); taskIndex = nextTask++)
         {
-            preprocessedGraph.removeVertex(vertex);
+            workerInstance.randomNumberGenerator().seed(baseSeed + taskIndex);
 
-            vertices.erase(vertex);
+            function(workerInstance, workerIndex, taskIndex);
         }
 
-        delete separator;
+        std::lock_guard<std::mutex> lock(mutex);
+
+        --activeWorkerCount;
 
-        separator = algorithm.computeSeparator(preprocessedGraph);
+        stateChanged.notify_all();
+    };
+
+    std::vector<std::thread> workers;
+
+    for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+    {
+        workers.emplace_back(runWorker, workerIndex);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        while (activeWorkerCount > 0)
+        {
+            stateChanged.wait_for(lock, std::chrono::milliseconds(10));
+
+            if (managementInstance.isTerminated())
+            {
+                for (const std::unique_ptr<htd::LibraryInstance> & workerInstance : workerInstances)
+                {
+                    workerInstance->terminate();
+                }
+            }
+        }
     }
 
-    if (separator != nullptr)
+    for (std::thread & worker : workers)
     {
-        delete separator;
+        worker.join();
     }
 }
 
@@ -41,7 +41,7 @@ htd::GraphPreprocessorFactory::~GraphPreprocessorFactory()
 
 htd::IGraphPreprocessor * htd::GraphPreprocessorFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_GRAPHPREPROCESSORFACTORY_CPP */
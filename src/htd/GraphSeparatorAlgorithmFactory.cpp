@@ -41,7 +41,7 @@ htd::GraphSeparatorAlgorithmFactory::~GraphSeparatorAlgorithmFactory()
 
 htd::IGraphSeparatorAlgorithm * htd::GraphSeparatorAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_TREEDECOMPOSITIONALGORITHMFACTORY_CPP */
@@ -27,6 +27,655 @@
 
 #include <htd/Helpers.hpp>
 
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HTD_SIMD_DISPATCH_X86
+
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     *  Word-wise operation selecting the elements found in both of two bitsets.
+     */
+    struct BitsetIntersection
+    {
+        /**
+         *  The first bitset.
+         */
+        const std::uint64_t * bitset1;
+
+        /**
+         *  The second bitset.
+         */
+        const std::uint64_t * bitset2;
+
+        /**
+         *  Compute the word with the given index of the resulting bitset.
+         *
+         *  @param[in] index    The index of the word.
+         *
+         *  @return The word with the given index of the resulting bitset.
+         */
+        std::uint64_t operator()(std::size_t index) const
+        {
+            return bitset1[index] & bitset2[index];
+        }
+    };
+
+    /**
+     *  Word-wise operation selecting the elements found in the first but not in the second bitset.
+     */
+    struct BitsetDifference
+    {
+        /**
+         *  The first bitset.
+         */
+        const std::uint64_t * bitset1;
+
+        /**
+         *  The second bitset.
+         */
+        const std::uint64_t * bitset2;
+
+        /**
+         *  Compute the word with the given index of the resulting bitset.
+         *
+         *  @param[in] index    The index of the word.
+         *
+         *  @return The word with the given index of the resulting bitset.
+         */
+        std::uint64_t operator()(std::size_t index) const
+        {
+            return bitset1[index] & ~bitset2[index];
+        }
+    };
+
+    /**
+     *  Word-wise operation selecting the elements found in the first and the second but not in the third bitset.
+     */
+    struct BitsetIntersectionDifference
+    {
+        /**
+         *  The first bitset.
+         */
+        const std::uint64_t * bitset1;
+
+        /**
+         *  The second bitset.
+         */
+        const std::uint64_t * bitset2;
+
+        /**
+         *  The third bitset.
+         */
+        const std::uint64_t * bitset3;
+
+        /**
+         *  Compute the word with the given index of the resulting bitset.
+         *
+         *  @param[in] index    The index of the word.
+         *
+         *  @return The word with the given index of the resulting bitset.
+         */
+        std::uint64_t operator()(std::size_t index) const
+        {
+            return bitset1[index] & bitset2[index] & ~bitset3[index];
+        }
+    };
+
+    /**
+     *  Portable population count of a single word.
+     */
+    inline std::size_t popcount(std::uint64_t word)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     *  Compute the number of set bits of the bitset resulting from the given word-wise operation.
+     */
+    template < typename Operation >
+    std::size_t countBitsScalar(const Operation & operation, std::size_t wordCount)
+    {
+        std::size_t ret = 0;
+
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            ret += popcount(operation(index));
+        }
+
+        return ret;
+    }
+
+#ifdef HTD_SIMD_DISPATCH_X86
+    /*
+     *  The loops below are identical to the scalar one. The target attributes allow the compiler to use the
+     *  POPCNT instruction and to vectorize the loop using AVX2 or, respectively, the AVX-512 VPOPCNTQ instruction.
+     */
+    template < typename Operation >
+    __attribute__((target("avx2,popcnt"))) std::size_t countBitsAvx2(const Operation & operation, std::size_t wordCount)
+    {
+        std::size_t ret = 0;
+
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            ret += static_cast<std::size_t>(__builtin_popcountll(operation(index)));
+        }
+
+        return ret;
+    }
+
+    template < typename Operation >
+    __attribute__((target("avx512f,avx512vpopcntdq,popcnt"))) std::size_t countBitsAvx512(const Operation & operation, std::size_t wordCount)
+    {
+        std::size_t ret = 0;
+
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            ret += static_cast<std::size_t>(__builtin_popcountll(operation(index)));
+        }
+
+        return ret;
+    }
+
+    /**
+     *  The instruction set extensions which can be used for computing population counts.
+     */
+    enum class PopcountLevel
+    {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+
+    /**
+     *  Determine the most efficient instruction set extension supported by the processor.
+     */
+    PopcountLevel detectPopcountLevel(void)
+    {
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512vpopcntdq") && __builtin_cpu_supports("avx512f"))
+        {
+            return PopcountLevel::Avx512;
+        }
+
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        {
+            return PopcountLevel::Avx2;
+        }
+
+        return PopcountLevel::Scalar;
+    }
+#endif
+
+    /**
+     *  Compute the number of set bits of the bitset resulting from the given word-wise operation using the most
+     *  efficient implementation supported by the processor.
+     */
+    template < typename Operation >
+    std::size_t countBits(const Operation & operation, std::size_t wordCount)
+    {
+#ifdef HTD_SIMD_DISPATCH_X86
+        static const PopcountLevel level = detectPopcountLevel();
+
+        switch (level)
+        {
+            case PopcountLevel::Avx512:
+                return countBitsAvx512(operation, wordCount);
+            case PopcountLevel::Avx2:
+                return countBitsAvx2(operation, wordCount);
+            default:
+                break;
+        }
+#endif
+
+        return countBitsScalar(operation, wordCount);
+    }
+
+    /**
+     *  If the larger of two sets exceeds the smaller one by more than this factor, their intersection is computed by
+     *  searching each element of the smaller set in the larger one instead of merging both sets.
+     */
+    constexpr std::size_t GALLOPING_THRESHOLD = 32;
+
+    /**
+     *  Compute the number of vertices found in both sets by merging them element by element.
+     */
+    std::size_t intersectionSizeScalar(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 < size1 && index2 < size2)
+        {
+            if (set1[index1] < set2[index2])
+            {
+                ++index1;
+            }
+            else if (set2[index2] < set1[index1])
+            {
+                ++index2;
+            }
+            else
+            {
+                ++ret;
+
+                ++index1;
+                ++index2;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Write the vertices found in both sets to the given output buffer by merging the sets element by element.
+     *
+     *  @return A pointer behind the last vertex written to the output buffer.
+     */
+    htd::vertex_t * intersectionScalar(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2, htd::vertex_t * output)
+    {
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 < size1 && index2 < size2)
+        {
+            if (set1[index1] < set2[index2])
+            {
+                ++index1;
+            }
+            else if (set2[index2] < set1[index1])
+            {
+                ++index2;
+            }
+            else
+            {
+                *output = set1[index1];
+
+                ++output;
+
+                ++index1;
+                ++index2;
+            }
+        }
+
+        return output;
+    }
+
+    /**
+     *  Determine the first position within the given range whose vertex is not less than the given one, using an
+     *  exponential search starting at the beginning of the range.
+     */
+    const htd::vertex_t * gallop(const htd::vertex_t * first, const htd::vertex_t * last, htd::vertex_t vertex)
+    {
+        std::size_t remaining = static_cast<std::size_t>(last - first);
+
+        std::size_t bound = 1;
+
+        while (bound < remaining && first[bound] < vertex)
+        {
+            bound <<= 1;
+        }
+
+        return std::lower_bound(first + (bound >> 1), first + std::min(bound + 1, remaining), vertex);
+    }
+
+    /**
+     *  Compute the number of vertices found in both sets by searching each vertex of the small set in the large set.
+     */
+    std::size_t intersectionSizeGalloping(const htd::vertex_t * smallSet, std::size_t smallSize, const htd::vertex_t * largeSet, std::size_t largeSize)
+    {
+        std::size_t ret = 0;
+
+        const htd::vertex_t * position = largeSet;
+        const htd::vertex_t * last = largeSet + largeSize;
+
+        for (std::size_t index = 0; index < smallSize && position != last; ++index)
+        {
+            position = gallop(position, last, smallSet[index]);
+
+            if (position != last && *position == smallSet[index])
+            {
+                ++ret;
+
+                ++position;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Write the vertices found in both sets to the given output buffer by searching each vertex of the small set in the large set.
+     *
+     *  @return A pointer behind the last vertex written to the output buffer.
+     */
+    htd::vertex_t * intersectionGalloping(const htd::vertex_t * smallSet, std::size_t smallSize, const htd::vertex_t * largeSet, std::size_t largeSize, htd::vertex_t * output)
+    {
+        const htd::vertex_t * position = largeSet;
+        const htd::vertex_t * last = largeSet + largeSize;
+
+        for (std::size_t index = 0; index < smallSize && position != last; ++index)
+        {
+            position = gallop(position, last, smallSet[index]);
+
+            if (position != last && *position == smallSet[index])
+            {
+                *output = smallSet[index];
+
+                ++output;
+
+                ++position;
+            }
+        }
+
+        return output;
+    }
+
+#ifdef HTD_SIMD_DISPATCH_X86
+    /*
+     *  The vectorized intersections compare a block of vertices of the first set with all rotations of a block of the
+     *  second set. The resulting mask marks the vertices of the first block which are found in the second one. Afterwards,
+     *  the block with the smaller maximum is advanced (both blocks, if the maxima are equal). Because both sets are free
+     *  of duplicates, every vertex of the first set matches at most one vertex of the second set.
+     */
+
+    /**
+     *  Shuffle masks moving the 32-bit lanes of a 128-bit vector which are selected by a 4-bit mask to the front.
+     */
+    typedef std::array<std::array<std::uint8_t, 16>, 16> ShuffleTable;
+
+    /**
+     *  Compute the shuffle masks for all 4-bit lane selections.
+     */
+    ShuffleTable createShuffleTable(void)
+    {
+        ShuffleTable ret;
+
+        for (std::size_t mask = 0; mask < 16; ++mask)
+        {
+            std::size_t position = 0;
+
+            ret[mask].fill(0x80);
+
+            for (std::size_t lane = 0; lane < 4; ++lane)
+            {
+                if ((mask >> lane) & 1)
+                {
+                    for (std::size_t byte = 0; byte < 4; ++byte)
+                    {
+                        ret[mask][position++] = static_cast<std::uint8_t>(lane * 4 + byte);
+                    }
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  The shuffle masks used to compress the matching lanes of a 128-bit vector.
+     */
+    const ShuffleTable & shuffleTable(void)
+    {
+        static const ShuffleTable ret = createShuffleTable();
+
+        return ret;
+    }
+
+    /**
+     *  Determine the lanes of the first block which are found in the second block (4 lanes each).
+     */
+    __attribute__((target("ssse3"))) inline int matchingLanesSsse3(__m128i block1, __m128i block2)
+    {
+        __m128i result = _mm_cmpeq_epi32(block1, block2);
+
+        result = _mm_or_si128(result, _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(0, 3, 2, 1))));
+        result = _mm_or_si128(result, _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(1, 0, 3, 2))));
+        result = _mm_or_si128(result, _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, _MM_SHUFFLE(2, 1, 0, 3))));
+
+        return _mm_movemask_ps(_mm_castsi128_ps(result));
+    }
+
+    /**
+     *  Determine the lanes of the first block which are found in the second block (8 lanes each).
+     */
+    __attribute__((target("avx2"))) inline int matchingLanesAvx2(__m256i block1, __m256i block2)
+    {
+        const __m256i rotation = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+
+        __m256i result = _mm256_cmpeq_epi32(block1, block2);
+
+        for (int step = 1; step < 8; ++step)
+        {
+            block2 = _mm256_permutevar8x32_epi32(block2, rotation);
+
+            result = _mm256_or_si256(result, _mm256_cmpeq_epi32(block1, block2));
+        }
+
+        return _mm256_movemask_ps(_mm256_castsi256_ps(result));
+    }
+
+    __attribute__((target("ssse3,popcnt"))) std::size_t intersectionSizeSsse3(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 + 4 <= size1 && index2 + 4 <= size2)
+        {
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set1 + index1));
+            __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set2 + index2));
+
+            ret += static_cast<std::size_t>(__builtin_popcount(matchingLanesSsse3(block1, block2)));
+
+            htd::vertex_t maximum1 = set1[index1 + 3];
+            htd::vertex_t maximum2 = set2[index2 + 3];
+
+            if (maximum1 <= maximum2)
+            {
+                index1 += 4;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                index2 += 4;
+            }
+        }
+
+        return ret + intersectionSizeScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2);
+    }
+
+    __attribute__((target("avx2,popcnt"))) std::size_t intersectionSizeAvx2(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2)
+    {
+        std::size_t ret = 0;
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 + 8 <= size1 && index2 + 8 <= size2)
+        {
+            __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set1 + index1));
+            __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set2 + index2));
+
+            ret += static_cast<std::size_t>(__builtin_popcount(matchingLanesAvx2(block1, block2)));
+
+            htd::vertex_t maximum1 = set1[index1 + 7];
+            htd::vertex_t maximum2 = set2[index2 + 7];
+
+            if (maximum1 <= maximum2)
+            {
+                index1 += 8;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                index2 += 8;
+            }
+        }
+
+        return ret + intersectionSizeScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2);
+    }
+
+    /**
+     *  @note The output buffer must provide space for at least min(size1, size2) + 8 vertices because complete blocks are stored.
+     */
+    __attribute__((target("ssse3,popcnt"))) htd::vertex_t * intersectionSsse3(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2, htd::vertex_t * output)
+    {
+        const ShuffleTable & table = shuffleTable();
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 + 4 <= size1 && index2 + 4 <= size2)
+        {
+            __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set1 + index1));
+            __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(set2 + index2));
+
+            int mask = matchingLanesSsse3(block1, block2);
+
+            __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table[mask].data()));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_shuffle_epi8(block1, shuffle));
+
+            output += __builtin_popcount(mask);
+
+            htd::vertex_t maximum1 = set1[index1 + 3];
+            htd::vertex_t maximum2 = set2[index2 + 3];
+
+            if (maximum1 <= maximum2)
+            {
+                index1 += 4;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                index2 += 4;
+            }
+        }
+
+        return intersectionScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2, output);
+    }
+
+    /**
+     *  @note The output buffer must provide space for at least min(size1, size2) + 8 vertices because complete blocks are stored.
+     */
+    __attribute__((target("avx2,popcnt"))) htd::vertex_t * intersectionAvx2(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2, htd::vertex_t * output)
+    {
+        const ShuffleTable & table = shuffleTable();
+
+        std::size_t index1 = 0;
+        std::size_t index2 = 0;
+
+        while (index1 + 8 <= size1 && index2 + 8 <= size2)
+        {
+            __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set1 + index1));
+            __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(set2 + index2));
+
+            int mask = matchingLanesAvx2(block1, block2);
+
+            __m128i lowerShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table[mask & 15].data()));
+            __m128i upperShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table[mask >> 4].data()));
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_shuffle_epi8(_mm256_castsi256_si128(block1), lowerShuffle));
+
+            output += __builtin_popcount(mask & 15);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_shuffle_epi8(_mm256_extracti128_si256(block1, 1), upperShuffle));
+
+            output += __builtin_popcount(mask >> 4);
+
+            htd::vertex_t maximum1 = set1[index1 + 7];
+            htd::vertex_t maximum2 = set2[index2 + 7];
+
+            if (maximum1 <= maximum2)
+            {
+                index1 += 8;
+            }
+
+            if (maximum2 <= maximum1)
+            {
+                index2 += 8;
+            }
+        }
+
+        return intersectionScalar(set1 + index1, size1 - index1, set2 + index2, size2 - index2, output);
+    }
+
+    /**
+     *  The instruction set extensions which can be used for intersecting sets of vertices.
+     */
+    enum class IntersectionLevel
+    {
+        Scalar,
+        Ssse3,
+        Avx2
+    };
+
+    /**
+     *  Determine the most efficient instruction set extension supported by the processor.
+     */
+    IntersectionLevel detectIntersectionLevel(void)
+    {
+        __builtin_cpu_init();
+
+        if (sizeof(htd::vertex_t) != sizeof(std::uint32_t))
+        {
+            return IntersectionLevel::Scalar;
+        }
+
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        {
+            return IntersectionLevel::Avx2;
+        }
+
+        if (__builtin_cpu_supports("ssse3") && __builtin_cpu_supports("popcnt"))
+        {
+            return IntersectionLevel::Ssse3;
+        }
+
+        return IntersectionLevel::Scalar;
+    }
+
+    /**
+     *  The instruction set extension used for intersecting sets of vertices.
+     */
+    IntersectionLevel intersectionLevel(void)
+    {
+        static const IntersectionLevel ret = detectIntersectionLevel();
+
+        return ret;
+    }
+#endif
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -36,6 +685,76 @@ htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
     return ret;
 }
 
+htd::LibraryInstance * htd::cloneManagementInstance(const htd::LibraryInstance & original)
+{
+    htd::LibraryInstance * ret = htd::createManagementInstance(original.id());
+
+    ret->copyFactoryConfiguration(original);
+
+    ret->randomNumberGenerator() = original.randomNumberGenerator();
+
+    ret->setTimeLimit(original.remainingTime());
+
+    ret->setMemoryLimit(original.memoryLimit());
+
+    ret->setStatistics(original.statistics());
+
+    return ret;
+}
+
+std::size_t htd::peakMemoryUsage(void)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+
+#ifdef __APPLE__
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+    return 0;
+#endif
+}
+
+std::size_t htd::currentMemoryUsage(void)
+{
+#if defined(__APPLE__)
+    mach_task_basic_info_data_t info;
+
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS)
+    {
+        return 0;
+    }
+
+    return static_cast<std::size_t>(info.resident_size);
+#elif defined(__unix__)
+    /* The second field of /proc/self/statm is the resident set size in pages. */
+    std::ifstream statm("/proc/self/statm");
+
+    std::size_t size = 0;
+    std::size_t residentPages = 0;
+
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    if (!(statm >> size >> residentPages) || pageSize <= 0)
+    {
+        return 0;
+    }
+
+    return residentPages * static_cast<std::size_t>(pageSize);
+#else
+    return 0;
+#endif
+}
+
 void htd::print(bool input)
 {
     print(input, std::cout);
@@ -184,75 +903,14 @@ void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
                            const std::vector<htd::vertex_t> & set2,
                            std::vector<htd::vertex_t> & result)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            ++first2;
-        }
-        else
-        {
-            result.push_back(*first1);
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
+    htd::vertex_set_intersection(set1.data(), set1.size(), set2.data(), set2.size(), result);
 }
 
 std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-    std::size_t overlap = 0;
-
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
+    std::size_t overlap = htd::vertex_set_intersection_size(set1.data(), set1.size(), set2.data(), set2.size());
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
-
-            ++first2;
-        }
-        else
-        {
-            overlap++;
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
-
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
-
-    return std::tuple<std::size_t, std::size_t, std::size_t>(onlySet1, overlap, onlySet2);
+    return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
 }
 
 void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
@@ -304,42 +962,106 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
 
 std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    std::size_t overlap = htd::vertex_set_intersection_size(set1.data(), set1.size(), set2.data(), set2.size());
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
+}
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
+std::size_t htd::vertex_set_intersection_size(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2) HTD_NOEXCEPT
+{
+    if (size1 > size2)
+    {
+        std::swap(set1, set2);
+        std::swap(size1, size2);
+    }
 
-    while (first1 != last1 && first2 != last2)
+    if (size1 == 0)
     {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
+        return 0;
+    }
 
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
+    if (size1 * GALLOPING_THRESHOLD < size2)
+    {
+        return intersectionSizeGalloping(set1, size1, set2, size2);
+    }
 
-            ++first2;
-        }
-        else
-        {
-            ++first1;
+#ifdef HTD_SIMD_DISPATCH_X86
+    switch (intersectionLevel())
+    {
+        case IntersectionLevel::Avx2:
+            return intersectionSizeAvx2(set1, size1, set2, size2);
+        case IntersectionLevel::Ssse3:
+            return intersectionSizeSsse3(set1, size1, set2, size2);
+        default:
+            break;
+    }
+#endif
 
-            //Skip common value in set 2.
-            ++first2;
+    return intersectionSizeScalar(set1, size1, set2, size2);
+}
+
+void htd::vertex_set_intersection(const htd::vertex_t * set1, std::size_t size1, const htd::vertex_t * set2, std::size_t size2, std::vector<htd::vertex_t> & result)
+{
+    if (size1 > size2)
+    {
+        std::swap(set1, set2);
+        std::swap(size1, size2);
+    }
+
+    if (size1 == 0)
+    {
+        return;
+    }
+
+    std::size_t offset = result.size();
+
+    /* The vectorized implementations store complete blocks, so the buffer provides space for one additional block. */
+    result.resize(offset + size1 + 8);
+
+    htd::vertex_t * output = result.data() + offset;
+
+    htd::vertex_t * end = nullptr;
+
+    if (size1 * GALLOPING_THRESHOLD < size2)
+    {
+        end = intersectionGalloping(set1, size1, set2, size2, output);
+    }
+    else
+    {
+#ifdef HTD_SIMD_DISPATCH_X86
+        switch (intersectionLevel())
+        {
+            case IntersectionLevel::Avx2:
+                end = intersectionAvx2(set1, size1, set2, size2, output);
+                break;
+            case IntersectionLevel::Ssse3:
+                end = intersectionSsse3(set1, size1, set2, size2, output);
+                break;
+            default:
+                end = intersectionScalar(set1, size1, set2, size2, output);
+                break;
         }
+#else
+        end = intersectionScalar(set1, size1, set2, size2, output);
+#endif
     }
 
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
+    result.resize(offset + static_cast<std::size_t>(end - output));
+}
 
-    return std::pair<std::size_t, std::size_t>(onlySet1, onlySet2);
+std::size_t htd::bitset_intersection_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, std::size_t wordCount) HTD_NOEXCEPT
+{
+    return countBits(BitsetIntersection { bitset1, bitset2 }, wordCount);
+}
+
+std::size_t htd::bitset_difference_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, std::size_t wordCount) HTD_NOEXCEPT
+{
+    return countBits(BitsetDifference { bitset1, bitset2 }, wordCount);
+}
+
+std::size_t htd::bitset_intersection_difference_size(const std::uint64_t * bitset1, const std::uint64_t * bitset2, const std::uint64_t * bitset3, std::size_t wordCount) HTD_NOEXCEPT
+{
+    return countBits(BitsetIntersectionDifference { bitset1, bitset2, bitset3 }, wordCount);
 }
 
 std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
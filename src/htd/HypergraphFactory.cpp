@@ -42,9 +42,9 @@ htd::HypergraphFactory::~HypergraphFactory()
 htd::IMutableHypergraph * htd::HypergraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableHypergraph();
+    return constructionTemplate()->cloneMutableHypergraph();
 #endif
 }
 
@@ -33,12 +33,16 @@
 #include <htd/IMutableHypertreeDecomposition.hpp>
 #include <htd/HypertreeDecompositionFactory.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
-#include <htd/PostOrderTreeTraversal.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <atomic>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -52,7 +56,7 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), labelingFunctions_(), postProcessingOperations_(), computeInducedEdges_(true), threadCount_(1)
     {
 
     }
@@ -90,13 +94,20 @@ struct htd::HypertreeDecompositionAlgorithm::Implementation
      */
     bool computeInducedEdges_;
 
+    /**
+     *  The number of threads which shall be used to determine the hyperedges covering the bags of the decomposition.
+     */
+    std::size_t threadCount_;
+
     /**
      *  Set the hyperedges covering the bags of the hypertree decomposition.
      *
      *  @param[in] graph            The graph which was decomposed.
      *  @param[in] decomposition    The hypertree decomposition which shall be updated.
+     *
+     *  @return True if the covering hyperedges of all bags were set or false if the management instance was terminated before all covers were determined.
      */
-    void setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const;
+    bool setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const;
 };
 
 htd::HypertreeDecompositionAlgorithm::HypertreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -151,11 +162,31 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
 
     delete algorithm;
 
-    ret = managementInstance()->hypertreeDecompositionFactory().createInstance(*treeDecomposition);
+    if (treeDecomposition != nullptr)
+    {
+        ret = managementInstance()->hypertreeDecompositionFactory().createInstance(*treeDecomposition);
+
+        delete treeDecomposition;
 
-    HTD_ASSERT(ret != nullptr)
+        HTD_ASSERT(ret != nullptr)
 
-    implementation_->setCoveringEdges(graph, *ret);
+        if (!implementation_->setCoveringEdges(graph, *ret))
+        {
+            delete ret;
+
+            ret = nullptr;
+        }
+    }
+
+    if (ret == nullptr)
+    {
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return nullptr;
+    }
 
     std::vector<htd::ILabelingFunction *> labelingFunctions;
 
@@ -226,8 +257,6 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
         delete postProcessingOperation;
     }
 
-    delete treeDecomposition;
-
     return ret;
 }
 
@@ -337,6 +366,18 @@ void htd::HypertreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool co
     implementation_->computeInducedEdges_ = computeInducedEdgesEnabled;
 }
 
+std::size_t htd::HypertreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::HypertreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::HypertreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -371,115 +412,199 @@ htd::HypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithm::clo
 #endif
     }
 
+    ret->setThreadCount(implementation_->threadCount_);
+
     ret->setManagementInstance(managementInstance());
 
     return ret;
 }
 
-void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const
+bool htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(const htd::IMultiHypergraph & graph, htd::IMutableHypertreeDecomposition & decomposition) const
 {
-    std::vector<htd::Hyperedge> relevantHyperedges;
-
-    std::vector<htd::Hyperedge> newRelevantHyperedges;
+    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
 
-    std::vector<std::vector<htd::id_t>> relevantContainers;
+    std::vector<htd::Hyperedge> allHyperedges(hyperedges.begin(), hyperedges.end());
 
-    std::vector<std::vector<htd::id_t>> newRelevantContainers;
+    htd::vertex_t lastVertex = graph.vertexCount() > 0 ? graph.vertexAtPosition(graph.vertexCount() - 1) : 0;
 
-    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges();
+    std::vector<std::vector<htd::index_t>> incidentHyperedges(lastVertex + 1);
 
-    std::size_t edgeCount = graph.edgeCount();
+    for (htd::index_t index = 0; index < allHyperedges.size(); ++index)
+    {
+        for (htd::vertex_t vertex : allHyperedges[index].sortedElements())
+        {
+            incidentHyperedges[vertex].push_back(index);
+        }
+    }
 
-    auto it1 = hyperedges.begin();
+    std::vector<htd::Hyperedge> relevantHyperedges;
 
-    for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
-    {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
+    std::vector<std::vector<htd::id_t>> relevantContainers;
 
-        bool maximal = true;
+    std::vector<std::vector<htd::index_t>> incidentContainers(lastVertex + 1);
 
-        auto it2 = it1;
+    for (htd::index_t index1 = 0; index1 < allHyperedges.size(); ++index1)
+    {
+        const std::vector<htd::vertex_t> & elements1 = allHyperedges[index1].sortedElements();
 
-        ++it2;
+        bool maximal = !elements1.empty();
 
-        for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
+        if (maximal)
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            /* A hyperedge containing the current one must be incident to its vertex with the fewest incident hyperedges. */
+            htd::vertex_t rarestVertex = *std::min_element(elements1.begin(), elements1.end(), [&](htd::vertex_t vertex1, htd::vertex_t vertex2) { return incidentHyperedges[vertex1].size() < incidentHyperedges[vertex2].size(); });
 
-            if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
+            for (auto it = incidentHyperedges[rarestVertex].begin(); maximal && it != incidentHyperedges[rarestVertex].end(); ++it)
             {
-                maximal = false;
-            }
+                const std::vector<htd::vertex_t> & elements2 = allHyperedges[*it].sortedElements();
 
-            ++it2;
+                maximal = *it <= index1 || !std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end());
+            }
         }
 
         if (maximal)
         {
-            relevantHyperedges.push_back(*it1);
+            for (htd::vertex_t vertex : elements1)
+            {
+                incidentContainers[vertex].push_back(relevantContainers.size());
+            }
+
+            relevantHyperedges.push_back(allHyperedges[index1]);
 
             relevantContainers.push_back(elements1);
         }
-
-        ++it1;
     }
 
-    htd::ISetCoverAlgorithm * setCoverAlgorithm = managementInstance_->setCoverAlgorithmFactory().createInstance();
+    const htd::ConstCollection<htd::vertex_t> & decompositionVertices = decomposition.vertices();
+
+    std::vector<htd::vertex_t> nodes(decompositionVertices.begin(), decompositionVertices.end());
+
+    std::vector<std::vector<htd::index_t>> selectedContainers(nodes.size());
+
+    /* Bags with identical content share the same set-cover problem, hence each of them is solved only once. */
+    std::unordered_map<std::vector<htd::vertex_t>, std::vector<htd::index_t>> solutions;
+
+    std::mutex solutionMutex;
 
-    htd::PostOrderTreeTraversal traversal;
+    std::atomic<htd::index_t> nextNode(0);
 
-    std::vector<htd::vertex_t> forgottenVertices;
+    std::size_t workerCount = std::max(std::min(threadCount_, nodes.size()), (std::size_t)1);
 
-    traversal.traverse(decomposition, [&](htd::vertex_t vertex, htd::vertex_t parent, std::size_t depth)
+    std::vector<std::unique_ptr<htd::ISetCoverAlgorithm>> setCoverAlgorithms;
+
+    for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
     {
-        HTD_UNUSED(depth)
+        setCoverAlgorithms.emplace_back(managementInstance_->setCoverAlgorithmFactory().createInstance());
+    }
 
-        std::vector<htd::index_t> selectedIndices;
+    auto runWorker = [&](htd::index_t workerIndex)
+    {
+        htd::ISetCoverAlgorithm & setCoverAlgorithm = *(setCoverAlgorithms[workerIndex]);
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+        std::vector<htd::index_t> candidates;
 
-        std::vector<htd::Hyperedge> selectedHyperedges;
+        std::vector<htd::index_t> lastVisit(relevantContainers.size(), (htd::index_t)-1);
 
-        for (htd::index_t selectedHyperedgeIndex : selectedIndices)
+        std::vector<std::vector<htd::id_t>> projectedContainers;
+
+        for (htd::index_t position = nextNode++; position < nodes.size() && !managementInstance_->isTerminated(); position = nextNode++)
         {
-            selectedHyperedges.push_back(relevantHyperedges.at(selectedHyperedgeIndex));
-        }
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(nodes[position]);
 
-        decomposition.setCoveringEdges(vertex, selectedHyperedges);
+            {
+                std::lock_guard<std::mutex> lock(solutionMutex);
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            std::size_t forgottenVertexCount = forgottenVertices.size();
+                auto solution = solutions.find(bag);
+
+                if (solution != solutions.end())
+                {
+                    selectedContainers[position] = solution->second;
 
-            decomposition.copyForgottenVerticesTo(parent, forgottenVertices, vertex);
+                    continue;
+                }
+            }
 
-            std::inplace_merge(forgottenVertices.begin(), forgottenVertices.begin() + forgottenVertexCount, forgottenVertices.end());
+            candidates.clear();
 
-            if (forgottenVertices.size() > 0)
+            for (htd::vertex_t vertex : bag)
             {
-                htd::index_t index = 0;
-
-                for (std::vector<htd::id_t> & container : relevantContainers)
+                for (htd::index_t container : incidentContainers[vertex])
                 {
-                    if (!std::includes(forgottenVertices.begin(), forgottenVertices.end(), container.begin(), container.end()))
+                    if (lastVisit[container] != position)
                     {
-                        newRelevantContainers.push_back(std::move(container));
-                        newRelevantHyperedges.push_back(std::move(relevantHyperedges.at(index)));
-                    }
+                        lastVisit[container] = position;
 
-                    ++index;
+                        candidates.push_back(container);
+                    }
                 }
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            projectedContainers.resize(candidates.size());
+
+            for (htd::index_t index = 0; index < candidates.size(); ++index)
+            {
+                projectedContainers[index].clear();
+
+                htd::set_intersection(relevantContainers[candidates[index]], bag, projectedContainers[index]);
+            }
 
-                relevantContainers.swap(newRelevantContainers);
-                relevantHyperedges.swap(newRelevantHyperedges);
+            std::vector<htd::index_t> selectedIndices;
 
-                newRelevantContainers.clear();
-                newRelevantHyperedges.clear();
+            setCoverAlgorithm.computeSetCover(bag, projectedContainers, selectedIndices);
+
+            std::vector<htd::index_t> & selection = selectedContainers[position];
+
+            for (htd::index_t selectedIndex : selectedIndices)
+            {
+                selection.push_back(candidates[selectedIndex]);
             }
+
+            std::lock_guard<std::mutex> lock(solutionMutex);
+
+            solutions.emplace(bag, selection);
+        }
+    };
+
+    if (workerCount > 1)
+    {
+        std::vector<std::thread> workers;
+
+        for (htd::index_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+        {
+            workers.emplace_back(runWorker, workerIndex);
+        }
+
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+    }
+    else
+    {
+        runWorker(0);
+    }
+
+    /* The workers skip the remaining bags once the management instance is terminated, hence their covers are unknown. */
+    if (managementInstance_->isTerminated())
+    {
+        return false;
+    }
+
+    for (htd::index_t position = 0; position < nodes.size(); ++position)
+    {
+        std::vector<htd::Hyperedge> selectedHyperedges;
+
+        for (htd::index_t container : selectedContainers[position])
+        {
+            selectedHyperedges.push_back(relevantHyperedges[container]);
         }
-    });
 
-    delete setCoverAlgorithm;
+        decomposition.setCoveringEdges(nodes[position], selectedHyperedges);
+    }
+
+    return true;
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHM_CPP */
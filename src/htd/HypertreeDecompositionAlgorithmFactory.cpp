@@ -41,7 +41,7 @@ htd::HypertreeDecompositionAlgorithmFactory::~HypertreeDecompositionAlgorithmFac
 
 htd::IHypertreeDecompositionAlgorithm * htd::HypertreeDecompositionAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_HYPERTREEDECOMPOSITIONALGORITHMFACTORY_CPP */
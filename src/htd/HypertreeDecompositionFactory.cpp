@@ -42,9 +42,9 @@ htd::HypertreeDecompositionFactory::~HypertreeDecompositionFactory()
 htd::IMutableHypertreeDecomposition * htd::HypertreeDecompositionFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableHypertreeDecomposition();
+    return constructionTemplate()->cloneMutableHypertreeDecomposition();
 #endif
 }
 
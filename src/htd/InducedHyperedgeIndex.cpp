@@ -0,0 +1,179 @@
+/*
+ * File:   InducedHyperedgeIndex.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_INDUCEDHYPEREDGEINDEX_CPP
+#define HTD_HTD_INDUCEDHYPEREDGEINDEX_CPP
+
+#include <htd/InducedHyperedgeIndex.hpp>
+
+#include <algorithm>
+
+/**
+ *  Private implementation details of class htd::InducedHyperedgeIndex.
+ */
+struct htd::InducedHyperedgeIndex::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] graph    The graph whose hyperedges shall be indexed.
+     */
+    Implementation(const htd::IMultiHypergraph & graph) : hyperedges_(), offsets_(), hyperedgeIndices_()
+    {
+        std::size_t edgeCount = graph.edgeCount();
+
+        std::vector<htd::index_t> allIndices(edgeCount);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            allIndices[index] = index;
+        }
+
+        hyperedges_ = graph.hyperedgesAtPositions(std::move(allIndices));
+
+        htd::vertex_t maximumVertex = 0;
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            const std::vector<htd::vertex_t> & sortedElements = hyperedges_.at(index).sortedElements();
+
+            if (!sortedElements.empty())
+            {
+                maximumVertex = std::max(maximumVertex, sortedElements[0]);
+            }
+        }
+
+        offsets_.resize(static_cast<std::size_t>(maximumVertex) + 2, 0);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            const std::vector<htd::vertex_t> & sortedElements = hyperedges_.at(index).sortedElements();
+
+            if (!sortedElements.empty())
+            {
+                ++offsets_[sortedElements[0] + 1];
+            }
+        }
+
+        for (std::size_t vertex = 1; vertex < offsets_.size(); ++vertex)
+        {
+            offsets_[vertex] += offsets_[vertex - 1];
+        }
+
+        hyperedgeIndices_.resize(offsets_.back());
+
+        std::vector<htd::index_t> nextPosition(offsets_.begin(), offsets_.end() - 1);
+
+        for (htd::index_t index = 0; index < edgeCount; ++index)
+        {
+            const std::vector<htd::vertex_t> & sortedElements = hyperedges_.at(index).sortedElements();
+
+            if (!sortedElements.empty())
+            {
+                hyperedgeIndices_[nextPosition[sortedElements[0]]++] = index;
+            }
+        }
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  All hyperedges of the indexed graph, the position of each hyperedge within the collection is equal to its
+     *  position within the graph.
+     */
+    htd::FilteredHyperedgeCollection hyperedges_;
+
+    /**
+     *  The offsets of the hyperedges registered at each vertex within hyperedgeIndices_.
+     */
+    std::vector<htd::index_t> offsets_;
+
+    /**
+     *  The positions of the hyperedges, grouped by their smallest endpoint.
+     */
+    std::vector<htd::index_t> hyperedgeIndices_;
+};
+
+htd::InducedHyperedgeIndex::InducedHyperedgeIndex(const htd::IMultiHypergraph & graph) : implementation_(new Implementation(graph))
+{
+
+}
+
+htd::InducedHyperedgeIndex::~InducedHyperedgeIndex()
+{
+
+}
+
+htd::FilteredHyperedgeCollection htd::InducedHyperedgeIndex::inducedHyperedges(const std::vector<htd::vertex_t> & vertices) const
+{
+    const htd::FilteredHyperedgeCollection & hyperedges = implementation_->hyperedges_;
+
+    const std::vector<htd::index_t> & offsets = implementation_->offsets_;
+
+    const std::vector<htd::index_t> & hyperedgeIndices = implementation_->hyperedgeIndices_;
+
+    std::vector<htd::vertex_t> sortedVertices;
+
+    if (!std::is_sorted(vertices.begin(), vertices.end()))
+    {
+        sortedVertices = vertices;
+
+        std::sort(sortedVertices.begin(), sortedVertices.end());
+    }
+
+    const std::vector<htd::vertex_t> & relevantVertices = sortedVertices.empty() ? vertices : sortedVertices;
+
+    std::vector<htd::index_t> relevantIndices;
+
+    auto end = relevantVertices.end();
+
+    for (auto it = relevantVertices.begin(); it != end; ++it)
+    {
+        htd::vertex_t vertex = *it;
+
+        if (static_cast<std::size_t>(vertex) + 1 < offsets.size())
+        {
+            for (htd::index_t position = offsets[vertex]; position < offsets[vertex + 1]; ++position)
+            {
+                htd::index_t index = hyperedgeIndices[position];
+
+                const std::vector<htd::vertex_t> & sortedElements = hyperedges.at(index).sortedElements();
+
+                if (std::includes(it, end, sortedElements.begin(), sortedElements.end()))
+                {
+                    relevantIndices.push_back(index);
+                }
+            }
+        }
+    }
+
+    std::sort(relevantIndices.begin(), relevantIndices.end());
+
+    return htd::FilteredHyperedgeCollection(hyperedges, std::move(relevantIndices));
+}
+
+#endif /* HTD_HTD_INDUCEDHYPEREDGEINDEX_CPP */
@@ -28,9 +28,18 @@
 #include <htd/IterativeImprovementTreeDecompositionAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/Helpers.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/PhaseTimer.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::IterativeImprovementTreeDecompositionAlgorithm.
@@ -45,7 +54,7 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      *  @param[in] fitnessFunction  The fitness function which will be used to evaluate the constructed tree decompositions.
      */
     Implementation(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction)
-        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
+        : managementInstance_(manager), iterationCount_(1), nonImprovementLimit_(-1), threadCount_(1), algorithm_(algorithm), fitnessFunction_(fitnessFunction), labelingFunctions_(), postProcessingOperations_()
     {
 
     }
@@ -82,6 +91,11 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
      */
     std::size_t nonImprovementLimit_;
 
+    /**
+     *  The number of threads which shall be used to perform the iterations.
+     */
+    std::size_t threadCount_;
+
     /**
      *  The decomposition algorithm which will be called repeatedly.
      */
@@ -103,13 +117,358 @@ struct htd::IterativeImprovementTreeDecompositionAlgorithm::Implementation
     std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations_;
 
     /**
-     *  Compute a new mutable tree decompostion of the given graph.
+     *  Perform a single iteration, i.e., compute a new decomposition of the given graph and apply the given manipulation operations and labeling functions to it.
+     *
+     *  @param[in] algorithm                The decomposition algorithm which shall be used to compute the decomposition.
+     *  @param[in] graph                    The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] postProcessingOperations The manipulation operations which shall be applied to the new decomposition.
+     *  @param[in] labelingFunctions        The labeling functions which shall be applied to the new decomposition.
+     *
+     *  @return The new decomposition of the given graph or nullptr if the base algorithm did not return a mutable tree decomposition.
+     */
+    htd::IMutableTreeDecomposition * computeIteration(const htd::ITreeDecompositionAlgorithm & algorithm,
+                                                      const htd::IMultiHypergraph & graph,
+                                                      const htd::IPreprocessedGraph & preprocessedGraph,
+                                                      const std::vector<htd::ITreeDecompositionManipulationOperation *> & postProcessingOperations,
+                                                      const std::vector<htd::ILabelingFunction *> & labelingFunctions) const
+    {
+        htd::IMutableTreeDecomposition * ret = dynamic_cast<htd::IMutableTreeDecomposition *>(algorithm.computeDecomposition(graph, preprocessedGraph));
+
+        if (ret != nullptr)
+        {
+            HTD_STATISTICS(htd::PhaseTimer manipulationTimer(*(algorithm.managementInstance()), htd::Statistics::MANIPULATION_PHASE);)
+
+            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
+            {
+                operation->apply(graph, *ret);
+            }
+
+            for (const htd::ILabelingFunction * labelingFunction : labelingFunctions)
+            {
+                for (htd::vertex_t vertex : ret->vertices())
+                {
+                    htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
+
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+
+                    delete labelCollection;
+
+                    ret->setVertexLabel(labelingFunction->name(), vertex, newLabel);
+                }
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Compute a decomposition of the given graph by distributing the iterations among threadCount_ threads.
      *
-     *  @param[in] graph    The graph which shall be decomposed.
+     *  @param[in] graph                    The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations provided to the current call which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked in the order of the iteration index for each decomposition which was computed.
      *
-     *  @return A mutable tree decompostion of the given graph.
+     *  @return The best decomposition found or nullptr if no decomposition was found before the algorithm was terminated.
      */
-    htd::IMutableTreeDecomposition * computeMutableDecomposition(const htd::IMultiHypergraph & graph) const;
+    htd::ITreeDecomposition * computeParallelDecomposition(const htd::IMultiHypergraph & graph,
+                                                           const htd::IPreprocessedGraph & preprocessedGraph,
+                                                           const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        std::uint64_t baseSeed = managementInstance.randomNumberGenerator()();
+
+        std::vector<std::unique_ptr<htd::LibraryInstance>> workerInstances;
+
+        for (htd::index_t workerIndex = 0; workerIndex < threadCount_; ++workerIndex)
+        {
+            htd::LibraryInstance * workerInstance = htd::cloneManagementInstance(managementInstance);
+
+            workerInstances.emplace_back(workerInstance);
+        }
+
+        /*
+         *  The result of a single iteration. A missing decomposition denotes an iteration which did not result in a decomposition.
+         */
+        typedef std::pair<htd::IMutableTreeDecomposition *, htd::FitnessEvaluation *> IterationResult;
+
+        std::mutex mutex;
+
+        std::condition_variable stateChanged;
+
+        std::map<htd::index_t, IterationResult> pendingResults;
+
+        std::atomic<htd::index_t> nextIteration(0);
+
+        htd::index_t nextCommittedIteration = 0;
+
+        std::size_t activeWorkerCount = threadCount_;
+
+        std::size_t nonImprovementCount = 0;
+
+        bool finished = false;
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        htd::FitnessEvaluation * bestEvaluation = nullptr;
+
+        auto terminateWorkers = [&](void)
+        {
+            for (const std::unique_ptr<htd::LibraryInstance> & workerInstance : workerInstances)
+            {
+                workerInstance->terminate();
+            }
+        };
+
+        /*
+         *  Evaluate the pending results in the order of their iteration index. This function must only be called while holding the mutex.
+         */
+        auto commitPendingResults = [&](void)
+        {
+            for (auto it = pendingResults.find(nextCommittedIteration); !finished && it != pendingResults.end(); it = pendingResults.find(nextCommittedIteration))
+            {
+                IterationResult result = it->second;
+
+                pendingResults.erase(it);
+
+                ++nextCommittedIteration;
+
+                if (result.first != nullptr)
+                {
+                    progressCallback(graph, *(result.first), *(result.second));
+
+                    if (bestEvaluation == nullptr || *(result.second) > *bestEvaluation)
+                    {
+                        delete ret;
+
+                        delete bestEvaluation;
+
+                        result.first->setManagementInstance(managementInstance_);
+
+                        ret = result.first;
+
+                        bestEvaluation = result.second;
+
+                        nonImprovementCount = 0;
+                    }
+                    else
+                    {
+                        delete result.first;
+
+                        delete result.second;
+
+                        ++nonImprovementCount;
+                    }
+                }
+                else
+                {
+                    ++nonImprovementCount;
+                }
+
+                if (nonImprovementCount > nonImprovementLimit_ || (iterationCount_ > 0 && nextCommittedIteration >= iterationCount_))
+                {
+                    finished = true;
+
+                    terminateWorkers();
+                }
+            }
+
+            stateChanged.notify_all();
+        };
+
+        auto runWorker = [&](htd::index_t workerIndex)
+        {
+            htd::LibraryInstance & workerInstance = *(workerInstances[workerIndex]);
+
+            std::unique_ptr<htd::ITreeDecompositionAlgorithm> algorithm(algorithm_->clone());
+
+            std::unique_ptr<htd::ITreeDecompositionFitnessFunction> fitnessFunction(fitnessFunction_->clone());
+
+            algorithm->setManagementInstance(&workerInstance);
+
+            std::vector<htd::ITreeDecompositionManipulationOperation *> workerPostProcessingOperations;
+
+            std::vector<htd::ILabelingFunction *> workerLabelingFunctions;
+
+            std::vector<htd::IDecompositionManipulationOperation *> workerOperations;
+
+            for (const htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations_)
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                htd::ITreeDecompositionManipulationOperation * clonedOperation = operation->clone();
+#else
+                htd::ITreeDecompositionManipulationOperation * clonedOperation = operation->cloneTreeDecompositionManipulationOperation();
+#endif
+
+                workerPostProcessingOperations.push_back(clonedOperation);
+
+                workerOperations.push_back(clonedOperation);
+            }
+
+            for (const htd::ILabelingFunction * labelingFunction : labelingFunctions_)
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                htd::ILabelingFunction * clonedLabelingFunction = labelingFunction->clone();
+#else
+                htd::ILabelingFunction * clonedLabelingFunction = labelingFunction->cloneLabelingFunction();
+#endif
+
+                workerLabelingFunctions.push_back(clonedLabelingFunction);
+
+                workerOperations.push_back(clonedLabelingFunction);
+            }
+
+            for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+            {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                htd::IDecompositionManipulationOperation * clonedOperation = operation->clone();
+#else
+                htd::IDecompositionManipulationOperation * clonedOperation = operation->cloneDecompositionManipulationOperation();
+#endif
+
+                htd::ILabelingFunction * labelingFunction = dynamic_cast<htd::ILabelingFunction *>(clonedOperation);
+
+                if (labelingFunction != nullptr)
+                {
+                    workerLabelingFunctions.push_back(labelingFunction);
+                }
+
+                htd::ITreeDecompositionManipulationOperation * manipulationOperation = dynamic_cast<htd::ITreeDecompositionManipulationOperation *>(clonedOperation);
+
+                if (manipulationOperation != nullptr)
+                {
+                    workerPostProcessingOperations.push_back(manipulationOperation);
+                }
+
+                workerOperations.push_back(clonedOperation);
+            }
+
+            for (htd::IDecompositionManipulationOperation * operation : workerOperations)
+            {
+                operation->setManagementInstance(&workerInstance);
+            }
+
+            bool done = false;
+
+            while (!done && !workerInstance.isTerminated())
+            {
+                htd::index_t iteration = nextIteration++;
+
+                if (iterationCount_ > 0 && iteration >= iterationCount_)
+                {
+                    done = true;
+                }
+                else
+                {
+                    {
+                        /* Limit the number of speculative iterations which are not yet evaluated. */
+                        std::unique_lock<std::mutex> lock(mutex);
+
+                        while (!finished && !workerInstance.isTerminated() && iteration >= nextCommittedIteration + 2 * threadCount_)
+                        {
+                            stateChanged.wait_for(lock, std::chrono::milliseconds(10));
+                        }
+                    }
+
+                    workerInstance.randomNumberGenerator().seed(baseSeed + iteration);
+
+                    htd::IMutableTreeDecomposition * currentDecomposition = nullptr;
+
+                    htd::FitnessEvaluation * currentEvaluation = nullptr;
+
+                    if (!workerInstance.isTerminated())
+                    {
+                        currentDecomposition = computeIteration(*algorithm, graph, preprocessedGraph, workerPostProcessingOperations, workerLabelingFunctions);
+
+                        if (currentDecomposition != nullptr && !workerInstance.isTerminated())
+                        {
+                            currentEvaluation = fitnessFunction->fitness(graph, *currentDecomposition);
+                        }
+                    }
+
+                    if (workerInstance.isTerminated())
+                    {
+                        /* The result of an interrupted iteration is discarded and no later iteration can be evaluated anymore. */
+                        delete currentDecomposition;
+
+                        delete currentEvaluation;
+
+                        done = true;
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        if (finished)
+                        {
+                            delete currentDecomposition;
+
+                            delete currentEvaluation;
+
+                            done = true;
+                        }
+                        else
+                        {
+                            pendingResults[iteration] = IterationResult(currentDecomposition, currentEvaluation);
+
+                            commitPendingResults();
+                        }
+                    }
+                }
+            }
+
+            for (htd::IDecompositionManipulationOperation * operation : workerOperations)
+            {
+                delete operation;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            --activeWorkerCount;
+
+            stateChanged.notify_all();
+        };
+
+        std::vector<std::thread> workers;
+
+        for (htd::index_t workerIndex = 0; workerIndex < threadCount_; ++workerIndex)
+        {
+            workers.emplace_back(runWorker, workerIndex);
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            while (activeWorkerCount > 0)
+            {
+                stateChanged.wait_for(lock, std::chrono::milliseconds(10));
+
+                if (managementInstance.isTerminated())
+                {
+                    terminateWorkers();
+                }
+            }
+        }
+
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+
+        for (auto & pendingResult : pendingResults)
+        {
+            delete pendingResult.second.first;
+
+            delete pendingResult.second.second;
+        }
+
+        delete bestEvaluation;
+
+        return ret;
+    }
 };
 
 htd::IterativeImprovementTreeDecompositionAlgorithm::IterativeImprovementTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, htd::ITreeDecompositionAlgorithm * algorithm, htd::ITreeDecompositionFitnessFunction * fitnessFunction) : implementation_(new Implementation(manager, algorithm, fitnessFunction))
@@ -186,9 +545,21 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
                                                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback) const
 {
-    std::vector<htd::ILabelingFunction *> labelingFunctions;
+    if (implementation_->threadCount_ > 1)
+    {
+        htd::ITreeDecomposition * ret = implementation_->computeParallelDecomposition(graph, preprocessedGraph, manipulationOperations, progressCallback);
 
-    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations;
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
+    std::vector<htd::ILabelingFunction *> labelingFunctions(implementation_->labelingFunctions_);
+
+    std::vector<htd::ITreeDecompositionManipulationOperation *> postProcessingOperations(implementation_->postProcessingOperations_);
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
     {
@@ -215,50 +586,21 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
-    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
-    {
-        htd::IMutableTreeDecomposition * currentDecomposition = dynamic_cast<htd::IMutableTreeDecomposition *>(implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph));
-
-        if (currentDecomposition != nullptr)
-        {
-            for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
-
-            for (htd::ITreeDecompositionManipulationOperation * operation : postProcessingOperations)
-            {
-                operation->apply(graph, *currentDecomposition);
-            }
-
-            for (const htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
-
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
-
-                    delete labelCollection;
-
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance.randomNumberGenerator();
 
-            for (htd::ILabelingFunction * labelingFunction : labelingFunctions)
-            {
-                for (htd::vertex_t vertex : currentDecomposition->vertices())
-                {
-                    htd::ILabelCollection * labelCollection = currentDecomposition->labelings().exportVertexLabelCollection(vertex);
+    /* Each iteration is seeded in the same way as in the parallel case, hence the result does not depend on the thread count. */
+    std::uint64_t baseSeed = randomNumberGenerator();
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(currentDecomposition->bagContent(vertex), *labelCollection);
+    htd::RandomNumberGenerator originalRandomNumberGenerator(randomNumberGenerator);
 
-                    delete labelCollection;
+    for (htd::index_t iteration = 0; (iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && nonImprovementCount <= implementation_->nonImprovementLimit_ && !managementInstance.isTerminated(); ++iteration)
+    {
+        randomNumberGenerator.seed(baseSeed + iteration);
 
-                    currentDecomposition->setVertexLabel(labelingFunction->name(), vertex, newLabel);
-                }
-            }
+        htd::IMutableTreeDecomposition * currentDecomposition = implementation_->computeIteration(*(implementation_->algorithm_), graph, preprocessedGraph, postProcessingOperations, labelingFunctions);
 
+        if (currentDecomposition != nullptr)
+        {
             if (!managementInstance.isTerminated())
             {
                 htd::FitnessEvaluation * currentEvaluation = implementation_->fitnessFunction_->fitness(graph, *currentDecomposition);
@@ -267,14 +609,11 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
                 {
                     progressCallback(graph, *currentDecomposition, *currentEvaluation);
 
-                    if (iteration == 0 || *currentEvaluation > *bestEvaluation)
+                    if (bestEvaluation == nullptr || *currentEvaluation > *bestEvaluation)
                     {
-                        if (iteration > 0)
-                        {
-                            delete ret;
+                        delete ret;
 
-                            delete bestEvaluation;
-                        }
+                        delete bestEvaluation;
 
                         ret = currentDecomposition;
 
@@ -309,6 +648,9 @@ htd::ITreeDecomposition * htd::IterativeImprovementTreeDecompositionAlgorithm::c
         }
     }
 
+    /* The parallel case draws only the base seed from the generator, so its remaining state is restored. */
+    randomNumberGenerator = originalRandomNumberGenerator;
+
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
     {
         delete operation;
@@ -437,6 +779,18 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setNonImprovementLimit
     implementation_->nonImprovementLimit_ = nonImprovementLimit;
 }
 
+std::size_t htd::IterativeImprovementTreeDecompositionAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::IterativeImprovementTreeDecompositionAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 const htd::LibraryInstance * htd::IterativeImprovementTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -447,6 +801,18 @@ void htd::IterativeImprovementTreeDecompositionAlgorithm::setManagementInstance(
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->algorithm_->setManagementInstance(manager);
+
+    for (htd::ILabelingFunction * labelingFunction : implementation_->labelingFunctions_)
+    {
+        labelingFunction->setManagementInstance(manager);
+    }
+
+    for (htd::ITreeDecompositionManipulationOperation * postProcessingOperation : implementation_->postProcessingOperations_)
+    {
+        postProcessingOperation->setManagementInstance(manager);
+    }
 }
 
 htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementTreeDecompositionAlgorithm::clone(void) const
@@ -473,6 +839,7 @@ htd::IterativeImprovementTreeDecompositionAlgorithm * htd::IterativeImprovementT
 
     ret->setIterationCount(implementation_->iterationCount_);
     ret->setNonImprovementLimit(implementation_->nonImprovementLimit_);
+    ret->setThreadCount(implementation_->threadCount_);
 
     return ret;
 }
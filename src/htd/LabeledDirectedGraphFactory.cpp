@@ -42,9 +42,9 @@ htd::LabeledDirectedGraphFactory::~LabeledDirectedGraphFactory()
 htd::IMutableLabeledDirectedGraph * htd::LabeledDirectedGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledDirectedGraph();
+    return constructionTemplate()->cloneMutableLabeledDirectedGraph();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::LabeledDirectedMultiGraphFactory::~LabeledDirectedMultiGraphFactory()
 htd::IMutableLabeledDirectedMultiGraph * htd::LabeledDirectedMultiGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledDirectedMultiGraph();
+    return constructionTemplate()->cloneMutableLabeledDirectedMultiGraph();
 #endif
 }
 
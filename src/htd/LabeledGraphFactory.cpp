@@ -42,9 +42,9 @@ htd::LabeledGraphFactory::~LabeledGraphFactory()
 htd::IMutableLabeledGraph * htd::LabeledGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledGraph();
+    return constructionTemplate()->cloneMutableLabeledGraph();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::LabeledHypergraphFactory::~LabeledHypergraphFactory()
 htd::IMutableLabeledHypergraph * htd::LabeledHypergraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledHypergraph();
+    return constructionTemplate()->cloneMutableLabeledHypergraph();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::LabeledMultiGraphFactory::~LabeledMultiGraphFactory()
 htd::IMutableLabeledMultiGraph * htd::LabeledMultiGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledMultiGraph();
+    return constructionTemplate()->cloneMutableLabeledMultiGraph();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::LabeledMultiHypergraphFactory::~LabeledMultiHypergraphFactory()
 htd::IMutableLabeledMultiHypergraph * htd::LabeledMultiHypergraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledMultiHypergraph();
+    return constructionTemplate()->cloneMutableLabeledMultiHypergraph();
 #endif
 }
 
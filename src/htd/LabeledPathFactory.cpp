@@ -42,9 +42,9 @@ htd::LabeledPathFactory::~LabeledPathFactory()
 htd::IMutableLabeledPath * htd::LabeledPathFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledPath();
+    return constructionTemplate()->cloneMutableLabeledPath();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::LabeledTreeFactory::~LabeledTreeFactory()
 htd::IMutableLabeledTree * htd::LabeledTreeFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableLabeledTree();
+    return constructionTemplate()->cloneMutableLabeledTree();
 #endif
 }
 
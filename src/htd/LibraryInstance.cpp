@@ -56,7 +56,12 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 
+#include <htd/Helpers.hpp>
+
+#include <atomic>
+#include <chrono>
 #include <csignal>
+#include <cstdint>
 
 /**
  *  Private implementation details of class htd::LibraryInstance.
@@ -68,7 +73,7 @@ struct htd::LibraryInstance::Implementation
      *
      *  @param[in] id   The identifier of the management instance.
      */
-    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false)
+    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false), randomNumberGenerator_(id), budgeted_(false), budgetExhausted_(false), budgetCheckCount_(0), timeLimit_((std::size_t)-1), deadline_(), memoryLimit_((std::size_t)-1), statistics_(nullptr)
     {
 
     }
@@ -118,6 +123,43 @@ struct htd::LibraryInstance::Implementation
         graphSeparatorAlgorithmFactory_.reset(new htd::GraphSeparatorAlgorithmFactory(manager));
     }
 
+    /**
+     *  Copy the construction templates of all factory classes of the given implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    void copyFactoryConfiguration(const Implementation & original)
+    {
+        multiHypergraphFactory_->setConstructionTemplate(original.multiHypergraphFactory_->createInstance());
+        hypergraphFactory_->setConstructionTemplate(original.hypergraphFactory_->createInstance());
+        multiGraphFactory_->setConstructionTemplate(original.multiGraphFactory_->createInstance());
+        graphFactory_->setConstructionTemplate(original.graphFactory_->createInstance());
+        directedMultiGraphFactory_->setConstructionTemplate(original.directedMultiGraphFactory_->createInstance());
+        directedGraphFactory_->setConstructionTemplate(original.directedGraphFactory_->createInstance());
+        connectedComponentAlgorithmFactory_->setConstructionTemplate(original.connectedComponentAlgorithmFactory_->createInstance());
+        graphDecompositionFactory_->setConstructionTemplate(original.graphDecompositionFactory_->createInstance());
+        hypertreeDecompositionFactory_->setConstructionTemplate(original.hypertreeDecompositionFactory_->createInstance());
+        labeledDirectedGraphFactory_->setConstructionTemplate(original.labeledDirectedGraphFactory_->createInstance());
+        labeledDirectedMultiGraphFactory_->setConstructionTemplate(original.labeledDirectedMultiGraphFactory_->createInstance());
+        labeledGraphFactory_->setConstructionTemplate(original.labeledGraphFactory_->createInstance());
+        labeledHypergraphFactory_->setConstructionTemplate(original.labeledHypergraphFactory_->createInstance());
+        labeledMultiGraphFactory_->setConstructionTemplate(original.labeledMultiGraphFactory_->createInstance());
+        labeledMultiHypergraphFactory_->setConstructionTemplate(original.labeledMultiHypergraphFactory_->createInstance());
+        labeledPathFactory_->setConstructionTemplate(original.labeledPathFactory_->createInstance());
+        labeledTreeFactory_->setConstructionTemplate(original.labeledTreeFactory_->createInstance());
+        orderingAlgorithmFactory_->setConstructionTemplate(original.orderingAlgorithmFactory_->createInstance());
+        graphDecompositionAlgorithmFactory_->setConstructionTemplate(original.graphDecompositionAlgorithmFactory_->createInstance());
+        treeDecompositionAlgorithmFactory_->setConstructionTemplate(original.treeDecompositionAlgorithmFactory_->createInstance());
+        hypertreeDecompositionAlgorithmFactory_->setConstructionTemplate(original.hypertreeDecompositionAlgorithmFactory_->createInstance());
+        pathDecompositionAlgorithmFactory_->setConstructionTemplate(original.pathDecompositionAlgorithmFactory_->createInstance());
+        pathDecompositionFactory_->setConstructionTemplate(original.pathDecompositionFactory_->createInstance());
+        setCoverAlgorithmFactory_->setConstructionTemplate(original.setCoverAlgorithmFactory_->createInstance());
+        stronglyConnectedComponentAlgorithmFactory_->setConstructionTemplate(original.stronglyConnectedComponentAlgorithmFactory_->createInstance());
+        treeDecompositionFactory_->setConstructionTemplate(original.treeDecompositionFactory_->createInstance());
+        graphPreprocessorFactory_->setConstructionTemplate(original.graphPreprocessorFactory_->createInstance());
+        graphSeparatorAlgorithmFactory_->setConstructionTemplate(original.graphSeparatorAlgorithmFactory_->createInstance());
+    }
+
     /**
      *  The identifier of the management instance.
      */
@@ -131,7 +173,78 @@ struct htd::LibraryInstance::Implementation
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
+
+    /**
+     *  The random number generator of the management instance.
+     */
+    htd::RandomNumberGenerator randomNumberGenerator_;
+
+    /**
+     *  A boolean flag indicating whether a time limit or a memory limit is set.
+     */
+    bool budgeted_;
+
+    /**
+     *  A boolean flag indicating whether the management instance was terminated because of an exhausted budget.
+     */
+    std::atomic<bool> budgetExhausted_;
+
+    /**
+     *  The number of budget checks performed so far, used to amortize the cost of the checks.
+     */
+    std::atomic<std::uint32_t> budgetCheckCount_;
+
+    /**
+     *  The time limit in milliseconds.
+     */
+    std::size_t timeLimit_;
+
+    /**
+     *  The point in time at which the time limit is reached.
+     */
+    std::chrono::steady_clock::time_point deadline_;
+
+    /**
+     *  The memory limit in bytes.
+     */
+    std::size_t memoryLimit_;
+
+    /**
+     *  The statistics attached to the management instance.
+     */
+    htd::Statistics * statistics_;
+
+    /**
+     *  Check whether the time limit or the memory limit is exhausted and terminate the management instance if this is the case.
+     *
+     *  @return True if a budget is exhausted, false otherwise.
+     */
+    bool checkBudgets(void)
+    {
+        std::uint32_t count = budgetCheckCount_.fetch_add(1, std::memory_order_relaxed);
+
+        if (count % 16 != 0)
+        {
+            return false;
+        }
+
+        bool exhausted = timeLimit_ != (std::size_t)-1 && std::chrono::steady_clock::now() >= deadline_;
+
+        if (!exhausted && memoryLimit_ != (std::size_t)-1 && count % 1024 == 0)
+        {
+            exhausted = htd::currentMemoryUsage() > memoryLimit_;
+        }
+
+        if (exhausted)
+        {
+            budgetExhausted_ = true;
+
+            terminated_ = true;
+        }
+
+        return exhausted;
+    }
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -289,6 +402,11 @@ void htd::LibraryInstance::initializeFactoryClasses(const htd::LibraryInstance *
     implementation_->initializeFactoryClasses(manager);
 }
 
+void htd::LibraryInstance::copyFactoryConfiguration(const htd::LibraryInstance & original)
+{
+    implementation_->copyFactoryConfiguration(*(original.implementation_));
+}
+
 htd::id_t htd::LibraryInstance::id(void) const
 {
     return implementation_->id_;
@@ -296,7 +414,12 @@ htd::id_t htd::LibraryInstance::id(void) const
 
 bool htd::LibraryInstance::isTerminated(void) const
 {
-    return implementation_->terminated_;
+    if (implementation_->terminated_)
+    {
+        return true;
+    }
+
+    return implementation_->budgeted_ && implementation_->checkBudgets();
 }
 
 void htd::LibraryInstance::terminate(void)
@@ -307,6 +430,85 @@ void htd::LibraryInstance::terminate(void)
 void htd::LibraryInstance::reset(void)
 {
     implementation_->terminated_ = false;
+
+    implementation_->budgetExhausted_ = false;
+}
+
+std::size_t htd::LibraryInstance::timeLimit(void) const
+{
+    return implementation_->timeLimit_;
+}
+
+std::size_t htd::LibraryInstance::remainingTime(void) const
+{
+    if (implementation_->timeLimit_ == (std::size_t)-1)
+    {
+        return (std::size_t)-1;
+    }
+
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (now >= implementation_->deadline_)
+    {
+        return 0;
+    }
+
+    std::chrono::milliseconds remaining = std::chrono::duration_cast<std::chrono::milliseconds>(implementation_->deadline_ - now);
+
+    if (now + remaining < implementation_->deadline_)
+    {
+        ++remaining;
+    }
+
+    return static_cast<std::size_t>(remaining.count());
+}
+
+void htd::LibraryInstance::setTimeLimit(std::size_t milliseconds)
+{
+    implementation_->timeLimit_ = milliseconds;
+
+    if (milliseconds != (std::size_t)-1)
+    {
+        implementation_->deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(milliseconds);
+    }
+
+    implementation_->budgeted_ = implementation_->timeLimit_ != (std::size_t)-1 || implementation_->memoryLimit_ != (std::size_t)-1;
+
+    implementation_->budgetCheckCount_ = 0;
+}
+
+std::size_t htd::LibraryInstance::memoryLimit(void) const
+{
+    return implementation_->memoryLimit_;
+}
+
+void htd::LibraryInstance::setMemoryLimit(std::size_t bytes)
+{
+    implementation_->memoryLimit_ = bytes;
+
+    implementation_->budgeted_ = implementation_->timeLimit_ != (std::size_t)-1 || implementation_->memoryLimit_ != (std::size_t)-1;
+
+    implementation_->budgetCheckCount_ = 0;
+}
+
+bool htd::LibraryInstance::isBudgetExhausted(void) const
+{
+    return implementation_->budgetExhausted_;
+}
+
+htd::RandomNumberGenerator & htd::LibraryInstance::randomNumberGenerator(void) const
+{
+    return implementation_->randomNumberGenerator_;
+}
+
+htd::Statistics * htd::LibraryInstance::statistics(void) const
+{
+    return implementation_->statistics_;
+}
+
+void htd::LibraryInstance::setStatistics(htd::Statistics * statistics)
+{
+    implementation_->statistics_ = statistics;
 }
 
 htd::ConnectedComponentAlgorithmFactory & htd::LibraryInstance::connectedComponentAlgorithmFactory(void)
@@ -32,9 +32,10 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/Statistics.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::MaximumCardinalitySearchOrderingAlgorithm.
@@ -92,16 +93,18 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    /* The weights are bounded by the vertex degrees, hence the bucket-based priority queue performs each update in constant time. */
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
-
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+    HTD_STATISTICS(std::size_t priorityQueueUpdateCount = 0;)
 
     std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
 
+    /* Numbered vertices are skipped instead of being erased from the neighborhoods, so the preprocessed graph is never copied. */
+    std::vector<char> numbered(preprocessedGraph.inputGraphVertexCount(), 1);
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     std::vector<htd::vertex_t> ordering;
@@ -113,36 +116,33 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
     {
+        numbered[vertex] = 0;
+
         priorityQueue.push(vertex, 0);
     }
 
     while (size > 0 && !managementInstance.isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance.randomNumberGenerator());
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        numbered[selectedVertex] = 1;
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        for (htd::vertex_t neighbor : neighborhood[selectedVertex])
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
-
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+            if (!numbered[neighbor])
+            {
+                std::size_t & currentWeight = weights[neighbor];
 
-            std::size_t & currentWeight = weights[neighbor];
+                priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
+                HTD_STATISTICS(++priorityQueueUpdateCount;)
 
-            ++currentWeight;
+                ++currentWeight;
+            }
         }
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
-
-        vertices.erase(selectedVertex);
-
         --size;
 
         ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
@@ -150,6 +150,8 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     std::reverse(ordering.begin() + preprocessedGraph.eliminationSequence().size(), ordering.end());
 
+    HTD_STATISTICS(htd::Statistics::increment(managementInstance, htd::Statistics::PRIORITY_QUEUE_UPDATES, priorityQueueUpdateCount);)
+
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
 
@@ -32,6 +32,7 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/Statistics.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -152,13 +153,17 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    HTD_STATISTICS(std::size_t fillEdgeCount = 0;)
+
+    HTD_STATISTICS(std::size_t priorityQueueUpdateCount = 0;)
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.eliminationSequenceBagSize();
 
     for (htd::vertex_t vertex : vertices)
     {
@@ -171,7 +176,7 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance_->randomNumberGenerator());
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
@@ -202,12 +207,16 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
             if (!difference.empty())
             {
+                HTD_STATISTICS(fillEdgeCount += difference.size();)
+
                 htd::inplace_merge(currentNeighborhood, difference);
 
                 difference.clear();
             }
 
             priorityQueue.updatePriority(neighbor, oldNeighborhoodSize, currentNeighborhood.size());
+
+            HTD_STATISTICS(++priorityQueueUpdateCount;)
         }
 
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
@@ -217,6 +226,11 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
         target.push_back(preprocessedGraph.vertexName(selectedVertex));
     }
 
+    /* Each fill edge is added to the neighborhoods of both of its endpoints. */
+    HTD_STATISTICS(htd::Statistics::increment(*managementInstance_, htd::Statistics::FILL_EDGES, fillEdgeCount / 2);)
+
+    HTD_STATISTICS(htd::Statistics::increment(*managementInstance_, htd::Statistics::PRIORITY_QUEUE_UPDATES, priorityQueueUpdateCount);)
+
     return ret;
 }
 
@@ -32,8 +32,10 @@
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
 #include <htd/PriorityQueue.hpp>
+#include <htd/Statistics.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <unordered_set>
 
 /**
@@ -46,7 +48,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), densityThreshold_(0.1)
     {
 
     }
@@ -61,12 +63,23 @@ struct htd::MinFillOrderingAlgorithm::Implementation
      */
     const htd::LibraryInstance * managementInstance_;
 
+    /**
+     *  The minimum density of the preprocessed input graph for which the fill values are computed based on packed bitsets.
+     */
+    double densityThreshold_;
+
+    /**
+     *  The maximum number of vertices of the input graph for which the fill values are computed based on packed bitsets.
+     */
+    static constexpr std::size_t maximumBitsetVertexCount = 16384;
+
     /**
      *  Structure representing the preprocessed input for the algorithm.
      *
      *  The preprocessing step consists of replacing the vertex identifiers by indices starting at 0 so that vectors
      *  instead of maps can be used for efficiently accessing information. Additionally, the initial fill value for
-     *  each vertex is computed and the pool of vertices with minimum fill value is initialized.
+     *  each vertex is computed and the pool of vertices with minimum fill value is initialized. For dense graphs,
+     *  the neighborhoods are additionally stored as packed bitsets, one row of wordCount words per vertex.
      */
     struct PreparedInput
     {
@@ -98,13 +111,36 @@ struct htd::MinFillOrderingAlgorithm::Implementation
             return ret;
         }
 
+        /**
+         *  Compute the number of edges between the neighbors of a vertex based on the bitset representation of the neighborhoods.
+         *
+         *  @param[in] vertex       The vertex for whose neighbors the number of edges shall be returned.
+         *  @param[in] neighborhood The neighborhood of the given vertex.
+         *
+         *  @return The number of edges between the neighbors of the given vertex.
+         */
+        std::size_t computeEdgeCount(htd::vertex_t vertex, const std::vector<htd::vertex_t> & neighborhood) const
+        {
+            std::size_t ret = 0;
+
+            const std::uint64_t * vertexBitset = adjacency.data() + vertex * wordCount;
+
+            for (htd::vertex_t neighbor : neighborhood)
+            {
+                ret += htd::bitset_intersection_size(vertexBitset, adjacency.data() + neighbor * wordCount, wordCount);
+            }
+
+            return ret / 2;
+        }
+
         /**
          *  Contructor for the PreparedInput data structure.
          *
          *  @param[in] managementInstance   The management instance to which the new algorithm belongs.
          *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+         *  @param[in] densityThreshold     The minimum density of the preprocessed input graph for which the neighborhoods shall be stored as packed bitsets.
          */
-        PreparedInput(const htd::LibraryInstance & managementInstance, const htd::IPreprocessedGraph & preprocessedGraph) : minFill((std::size_t)-1), totalFill(0), fillValue()
+        PreparedInput(const htd::LibraryInstance & managementInstance, const htd::IPreprocessedGraph & preprocessedGraph, double densityThreshold) : minFill((std::size_t)-1), totalFill(0), fillValue(), wordCount(0), adjacency()
         {
             HTD_UNUSED(managementInstance)
 
@@ -112,11 +148,42 @@ struct htd::MinFillOrderingAlgorithm::Implementation
 
             fillValue.resize(size, 0);
 
+            std::size_t remainingVertexCount = preprocessedGraph.remainingVertices().size();
+
+            if (remainingVertexCount > 1 && size <= maximumBitsetVertexCount)
+            {
+                std::size_t neighborCount = 0;
+
+                for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+                {
+                    neighborCount += preprocessedGraph.neighborhood(vertex).size();
+                }
+
+                if (static_cast<double>(neighborCount) >= densityThreshold * static_cast<double>(remainingVertexCount) * static_cast<double>(remainingVertexCount - 1))
+                {
+                    wordCount = (size + 63) / 64;
+
+                    adjacency.resize(size * wordCount, 0);
+
+                    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+                    {
+                        std::uint64_t * vertexBitset = adjacency.data() + vertex * wordCount;
+
+                        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+                        {
+                            vertexBitset[neighbor >> 6] |= static_cast<std::uint64_t>(1) << (neighbor & 63);
+                        }
+                    }
+                }
+            }
+
             for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
             {
                 const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
 
-                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                std::size_t edgeCount = adjacency.empty() ? computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood) : computeEdgeCount(vertex, currentNeighborhood);
+
+                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - edgeCount;
 
                 fillValue[vertex] = currentFillValue;
 
@@ -143,6 +210,16 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *  A vector containing the fill value for each vertex.
          */
         std::vector<std::size_t> fillValue;
+
+        /**
+         *  The number of words of the bitset representing the neighborhood of a vertex.
+         */
+        std::size_t wordCount;
+
+        /**
+         *  The (open) neighborhoods of all vertices as packed bitsets or an empty vector if the graph is not dense enough.
+         */
+        std::vector<std::uint64_t> adjacency;
     };
 
     /**
@@ -199,7 +276,7 @@ htd::IWidthLimitedVertexOrdering * htd::MinFillOrderingAlgorithm::computeOrderin
     std::vector<htd::vertex_t> ordering;
     ordering.reserve(graph.vertexCount());
 
-    htd::MinFillOrderingAlgorithm::Implementation::PreparedInput input(managementInstance, preprocessedGraph);
+    htd::MinFillOrderingAlgorithm::Implementation::PreparedInput input(managementInstance, preprocessedGraph, implementation_->densityThreshold_);
 
     std::size_t iterations = 0;
 
@@ -237,7 +314,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     std::vector<std::size_t> fillValue(input.fillValue.begin(), input.fillValue.end());
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    HTD_STATISTICS(std::size_t fillEdgeCount = 0;)
+
+    HTD_STATISTICS(std::size_t priorityQueueUpdateCount = 0;)
 
     std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
 
@@ -252,11 +333,38 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     std::vector<htd::vertex_t> affectedVertices;
     affectedVertices.reserve(size);
 
+    /*
+     *  If the graph is dense, the closed neighborhoods are additionally maintained as packed bitsets. The bitsets mirror the
+     *  vectors in 'neighborhood' with the exception that the additional neighbors resulting from the elimination of a vertex
+     *  are only added after all fill values were updated. This way, the bitsets of the neighbors of the eliminated vertex
+     *  still represent the neighborhoods underlying the sets computed via htd::decompose_sets.
+     */
+    bool useBitsets = !input.adjacency.empty();
+
+    std::size_t wordCount = input.wordCount;
+
+    std::vector<std::uint64_t> bitsets(input.adjacency);
+
+    auto bitset = [&](htd::vertex_t vertex)
+    {
+        return bitsets.data() + vertex * wordCount;
+    };
+
+    auto setBit = [&](htd::vertex_t vertex, htd::vertex_t neighbor)
+    {
+        bitsets[vertex * wordCount + (neighbor >> 6)] |= static_cast<std::uint64_t>(1) << (neighbor & 63);
+    };
+
+    auto clearBit = [&](htd::vertex_t vertex, htd::vertex_t neighbor)
+    {
+        bitsets[vertex * wordCount + (neighbor >> 6)] &= ~(static_cast<std::uint64_t>(1) << (neighbor & 63));
+    };
+
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
 
-    ret = preprocessedGraph.minTreeWidth() + 1;
+    ret = preprocessedGraph.eliminationSequenceBagSize();
 
     size = preprocessedGraph.remainingVertices().size();
 
@@ -266,12 +374,17 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
 
+        if (useBitsets)
+        {
+            setBit(vertex, vertex);
+        }
+
         priorityQueue.push(vertex, fillValue[vertex]);
     }
 
     while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), managementInstance_->randomNumberGenerator());
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
@@ -288,8 +401,15 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
         totalFill -= fillValue[selectedVertex];
 
+        HTD_STATISTICS(fillEdgeCount += fillValue[selectedVertex];)
+
         selectedNeighborhood.erase(std::lower_bound(selectedNeighborhood.begin(), selectedNeighborhood.end(), selectedVertex));
 
+        if (useBitsets)
+        {
+            clearBit(selectedVertex, selectedVertex);
+        }
+
         if (fillValue[selectedVertex] == 0)
         {
             for (htd::vertex_t vertex : selectedNeighborhood)
@@ -300,12 +420,18 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 // coverity[use_iterator]
                 currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
 
+                if (useBitsets)
+                {
+                    clearBit(vertex, selectedVertex);
+                }
+
                 std::size_t tmp = fillValue[vertex];
 
                 if (tmp > 0)
                 {
-                    std::size_t fillReduction = htd::set_difference_size(currentNeighborhood.begin(), currentNeighborhood.end(),
-                                                                         selectedNeighborhood.begin(), selectedNeighborhood.end());
+                    std::size_t fillReduction = useBitsets ? htd::bitset_difference_size(bitset(vertex), bitset(selectedVertex), wordCount) :
+                                                             htd::set_difference_size(currentNeighborhood.begin(), currentNeighborhood.end(),
+                                                                                      selectedNeighborhood.begin(), selectedNeighborhood.end());
 
                     if (fillReduction > 0)
                     {
@@ -315,6 +441,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        HTD_STATISTICS(++priorityQueueUpdateCount;)
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -330,6 +458,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                     currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
 
+                    if (useBitsets)
+                    {
+                        clearBit(neighbor, selectedVertex);
+                    }
+
                     htd::decompose_sets(selectedNeighborhood, currentNeighborhood,
                                         additionalNeighbors[neighbor],
                                         unaffectedNeighbors[neighbor],
@@ -356,6 +489,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                                 // coverity[use_iterator]
                                 currentNeighborhood.erase(position);
 
+                                if (useBitsets)
+                                {
+                                    clearBit(affectedVertex, selectedVertex);
+                                }
+
                                 htd::decompose_sets(selectedNeighborhood, currentNeighborhood,
                                                     additionalNeighbors[affectedVertex],
                                                     unaffectedNeighbors[affectedVertex],
@@ -396,7 +534,16 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 {
                     long fillUpdate = -(static_cast<long>(unaffectedNeighborCount));
 
-                    if (additionalNeighborCount > 0)
+                    if (additionalNeighborCount > 0 && useBitsets)
+                    {
+                        for (htd::vertex_t additionalVertex : currentAdditionalNeighborhood)
+                        {
+                            fillUpdate += static_cast<long>(unaffectedNeighborCount);
+
+                            fillUpdate -= static_cast<long>(htd::bitset_intersection_difference_size(bitset(additionalVertex), bitset(vertex), bitset(selectedVertex), wordCount));
+                        }
+                    }
+                    else if (additionalNeighborCount > 0)
                     {
                         for (htd::vertex_t additionalVertex : currentAdditionalNeighborhood)
                         {
@@ -415,7 +562,20 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                         }
                     }
 
-                    auto neighborhoodEnd = currentExistingNeighborhood.end();
+                    if (useBitsets)
+                    {
+                        /* Each pair of existing neighbors which is connected via a new edge is counted twice. */
+                        std::size_t newEdgeCount = 0;
+
+                        for (htd::vertex_t existingVertex : currentExistingNeighborhood)
+                        {
+                            newEdgeCount += htd::bitset_intersection_difference_size(bitset(selectedVertex), bitset(vertex), bitset(existingVertex), wordCount);
+                        }
+
+                        fillUpdate -= static_cast<long>(newEdgeCount / 2);
+                    }
+
+                    auto neighborhoodEnd = useBitsets ? currentExistingNeighborhood.begin() : currentExistingNeighborhood.end();
 
                     for (auto it = currentExistingNeighborhood.begin(); it != neighborhoodEnd && tmp + fillUpdate > 0;)
                     {
@@ -456,6 +616,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        HTD_STATISTICS(++priorityQueueUpdateCount;)
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -465,6 +627,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                     priorityQueue.updatePriority(vertex, fillValue[vertex], 0);
 
+                    HTD_STATISTICS(++priorityQueueUpdateCount;)
+
                     fillValue[vertex] = 0;
                 }
 
@@ -481,9 +645,20 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                     std::size_t fillReduction = 0;
 
+                    if (useBitsets)
+                    {
+                        /* Each pair of relevant neighbors which is connected via a new edge is counted twice. */
+                        for (htd::vertex_t relevantVertex : relevantNeighborhood)
+                        {
+                            fillReduction += htd::bitset_intersection_difference_size(bitset(selectedVertex), bitset(vertex), bitset(relevantVertex), wordCount);
+                        }
+
+                        fillReduction /= 2;
+                    }
+
                     auto neighborhoodEnd = relevantNeighborhood.end();
 
-                    for (auto it = relevantNeighborhood.begin(); it != neighborhoodEnd - 1 && tmp - fillReduction > 0;)
+                    for (auto it = relevantNeighborhood.begin(); !useBitsets && it != neighborhoodEnd - 1 && tmp - fillReduction > 0;)
                     {
                         const std::vector<htd::vertex_t> & currentAdditionalNeighborhood2 = additionalNeighbors[*it];
 
@@ -520,6 +695,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                         priorityQueue.updatePriority(vertex, fillValue[vertex], tmp);
 
+                        HTD_STATISTICS(++priorityQueueUpdateCount;)
+
                         fillValue[vertex] = tmp;
                     }
                 }
@@ -531,12 +708,25 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
             for (htd::vertex_t vertex : selectedNeighborhood)
             {
+                if (useBitsets)
+                {
+                    for (htd::vertex_t additionalVertex : additionalNeighbors[vertex])
+                    {
+                        setBit(vertex, additionalVertex);
+                    }
+                }
+
                 additionalNeighbors[vertex].clear();
                 unaffectedNeighbors[vertex].clear();
                 existingNeighbors[vertex].clear();
             }
         }
 
+        if (useBitsets)
+        {
+            std::fill(bitset(selectedVertex), bitset(selectedVertex) + wordCount, 0);
+        }
+
         std::vector<htd::vertex_t>().swap(selectedNeighborhood);
         std::vector<htd::vertex_t>().swap(additionalNeighbors[selectedVertex]);
         std::vector<htd::vertex_t>().swap(unaffectedNeighbors[selectedVertex]);
@@ -641,7 +831,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices);
+        htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices, managementInstance_->randomNumberGenerator());
 
         std::size_t neighborhoodSize = neighborhood[vertex].size();
 
@@ -659,6 +849,10 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
         //std::cout << "ORDERING: " << vertexNames[vertex] << std::endl;
     }
 
+    HTD_STATISTICS(htd::Statistics::increment(*managementInstance_, htd::Statistics::FILL_EDGES, fillEdgeCount);)
+
+    HTD_STATISTICS(htd::Statistics::increment(*managementInstance_, htd::Statistics::PRIORITY_QUEUE_UPDATES, priorityQueueUpdateCount);)
+
     return ret;
 }
 
@@ -667,6 +861,16 @@ const htd::LibraryInstance * htd::MinFillOrderingAlgorithm::managementInstance(v
     return implementation_->managementInstance_;
 }
 
+double htd::MinFillOrderingAlgorithm::densityThreshold(void) const
+{
+    return implementation_->densityThreshold_;
+}
+
+void htd::MinFillOrderingAlgorithm::setDensityThreshold(double densityThreshold)
+{
+    implementation_->densityThreshold_ = densityThreshold;
+}
+
 void htd::MinFillOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
 {
     HTD_ASSERT(manager != nullptr)
@@ -676,18 +880,22 @@ void htd::MinFillOrderingAlgorithm::setManagementInstance(const htd::LibraryInst
 
 htd::MinFillOrderingAlgorithm * htd::MinFillOrderingAlgorithm::clone(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    htd::MinFillOrderingAlgorithm * ret = new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+
+    ret->setDensityThreshold(implementation_->densityThreshold_);
+
+    return ret;
 }
 
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 htd::IOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 
 htd::IWidthLimitableOrderingAlgorithm * htd::MinFillOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
 {
-    return new htd::MinFillOrderingAlgorithm(implementation_->managementInstance_);
+    return clone();
 }
 #endif
 
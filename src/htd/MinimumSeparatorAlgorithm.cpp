@@ -26,13 +26,15 @@
 #define HTD_HTD_MINIMUMSEPARATORALGORITHM_CPP
 
 #include <htd/MinimumSeparatorAlgorithm.hpp>
-
-#include <htd/FlowNetworkStructure.hpp>
+#include <htd/CompressedFlowNetwork.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
+#include <htd/Helpers.hpp>
 
 #include <algorithm>
-#include <unordered_map>
-#include <unordered_set>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+#include <thread>
 
 /**
  *  Private implementation details of class htd::MinimumSeparatorAlgorithm.
@@ -44,7 +46,7 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), threadCount_(1)
     {
 
     }
@@ -58,6 +60,90 @@ struct htd::MinimumSeparatorAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The number of threads which shall be used to process the vertex pairs.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The best separator found so far, shared among all threads working on the same graph.
+     *
+     *  Separators are ordered by their size and, for separators of the same size, by the index of the vertex pair
+     *  for which they were found. This reproduces the result of processing all pairs sequentially, where a separator
+     *  is only replaced by a strictly smaller one.
+     */
+    struct BestSeparator
+    {
+        /**
+         *  Constructor for a new best separator.
+         *
+         *  @param[in] separator    The initial separator.
+         */
+        BestSeparator(std::vector<htd::vertex_t> * separator) : mutex_(), separator_(separator), pairIndex_(0)
+        {
+
+        }
+
+        /**
+         *  Getter for the size of the best separator.
+         *
+         *  @return The size of the best separator.
+         */
+        std::size_t size(void)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return separator_->size();
+        }
+
+        /**
+         *  Determine the smallest size of a separator found for the given vertex pair which cannot be better than the best separator.
+         *
+         *  @param[in] pairIndex    The index of the vertex pair.
+         *
+         *  @return The smallest size of a separator found for the given vertex pair which cannot be better than the best separator.
+         */
+        std::size_t limit(std::size_t pairIndex)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            return pairIndex > pairIndex_ ? separator_->size() : separator_->size() + 1;
+        }
+
+        /**
+         *  Replace the best separator by the given candidate if it is better.
+         *
+         *  @param[in] candidate    The candidate in ascending order.
+         *  @param[in] pairIndex    The index of the vertex pair for which the candidate was found.
+         */
+        void update(const std::vector<htd::vertex_t> & candidate, std::size_t pairIndex)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (candidate.size() < separator_->size() || (candidate.size() == separator_->size() && pairIndex < pairIndex_))
+            {
+                *separator_ = candidate;
+
+                pairIndex_ = pairIndex;
+            }
+        }
+
+        /**
+         *  The mutex protecting the best separator.
+         */
+        std::mutex mutex_;
+
+        /**
+         *  The best separator found so far.
+         */
+        std::vector<htd::vertex_t> * separator_;
+
+        /**
+         *  The index of the vertex pair for which the best separator was found. The index 0 denotes the initial separator.
+         */
+        std::size_t pairIndex_;
+    };
 };
 
 htd::MinimumSeparatorAlgorithm::MinimumSeparatorAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -76,75 +162,225 @@ std::vector<htd::vertex_t> * htd::MinimumSeparatorAlgorithm::computeSeparator(co
 
     std::size_t n = graph.vertexCount();
 
-    htd::index_t index = 0;
+    graph.copyVerticesTo(*ret);
 
-    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+    if (n < 2)
+    {
+        return ret;
+    }
+
+    std::vector<htd::index_t> positions(*std::max_element(ret->begin(), ret->end()) + 1);
+
+    for (htd::index_t index = 0; index < n; ++index)
+    {
+        positions[graph.vertexAtPosition(index)] = index;
+    }
+
+    /* The flow network contains arcs in both directions for each pair of neighbors, hence the adjacency lists are symmetric. */
+    std::vector<std::vector<htd::index_t>> neighbors(n);
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::index_t index = 0; index < n; ++index)
     {
-        indices.emplace(vertex, index);
+        for (htd::vertex_t neighbor : graph.neighbors(graph.vertexAtPosition(index)))
+        {
+            neighbors[index].push_back(positions[neighbor]);
 
-        ++index;
+            neighbors[positions[neighbor]].push_back(index);
+        }
     }
 
-    htd::FlowNetworkStructure flowNetwork(n * 2);
+    /*
+     *  The flow network contains an in-node k and an out-node k + n for each vertex position k. Each in-node is
+     *  connected to its out-node via an arc of capacity one and each out-node is connected to the in-nodes of all
+     *  neighbors via arcs of unbounded capacity.
+     */
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> arcs;
+
+    std::vector<std::size_t> capacities;
 
-    for (htd::vertex_t vertex : graph.vertices())
+    for (htd::index_t index = 0; index < n; ++index)
     {
-        htd::index_t vertexIndex = indices.at(vertex);
+        std::vector<htd::index_t> & currentNeighbors = neighbors[index];
+
+        std::sort(currentNeighbors.begin(), currentNeighbors.end());
+
+        currentNeighbors.erase(std::unique(currentNeighbors.begin(), currentNeighbors.end()), currentNeighbors.end());
+
+        arcs.emplace_back(index, index + n);
 
-        flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
+        capacities.push_back(1);
 
-        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        for (htd::index_t neighbor : currentNeighbors)
         {
-            htd::index_t neighborIndex = indices.at(neighbor);
+            arcs.emplace_back(index + n, neighbor);
 
-            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
-            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+            capacities.push_back((std::size_t)-1);
         }
     }
 
-    graph.copyVerticesTo(*ret);
+    const htd::CompressedFlowNetwork flowNetwork(n * 2, arcs, capacities);
+
+    Implementation::BestSeparator best(ret);
+
+    std::atomic<htd::index_t> nextSource(0);
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    auto processPairs = [&]()
+    {
+        htd::CompressedFlowNetwork currentFlowNetwork(flowNetwork);
+
+        htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(&managementInstance);
+
+        std::vector<htd::vertex_t> candidate;
+
+        /*
+         *  Each minimum separator misses one of the first k + 1 vertex positions, where k is the size of the minimum
+         *  separator, and all other vertices missed by it have larger positions. Hence the first pair of vertices
+         *  separated by a minimum separator has its first vertex among the first k + 1 positions and the remaining
+         *  positions never need to be processed (see S. Even, "An Algorithm for Determining Whether the Connectivity
+         *  of a Graph is at Least k", 1975).
+         */
+        for (htd::index_t i = nextSource++; i < n && i <= best.size() && !managementInstance.isTerminated(); i = nextSource++)
+        {
+            const std::vector<htd::index_t> & currentNeighbors = neighbors[i];
+
+            for (htd::index_t j = i + 1; j < n && !managementInstance.isTerminated(); ++j)
+            {
+                if (!std::binary_search(currentNeighbors.begin(), currentNeighbors.end(), j))
+                {
+                    std::size_t pairIndex = i * n + j + 1;
+
+                    /* The size of the minimum cut equals the flow value, hence the flow computation can stop as soon as it reaches the limit. */
+                    std::size_t limit = best.limit(pairIndex);
 
-    for (htd::index_t i = 0; i < n; ++i)
+                    if (limit > 0)
+                    {
+                        currentFlowNetwork.reset();
+
+                        std::size_t flow = maxFlowAlgorithm.determineMaximumFlow(currentFlowNetwork, i + n, j, limit);
+
+                        if (flow < limit && !managementInstance.isTerminated())
+                        {
+                            candidate.clear();
+
+                            for (htd::index_t k = 0; k < n; ++k)
+                            {
+                                if (currentFlowNetwork.level(k) != (std::size_t)-1 && currentFlowNetwork.level(k + n) == (std::size_t)-1)
+                                {
+                                    candidate.push_back(graph.vertexAtPosition(k));
+                                }
+                            }
+
+                            std::sort(candidate.begin(), candidate.end());
+
+                            best.update(candidate, pairIndex);
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    std::size_t threadCount = std::min(implementation_->threadCount_, n);
+
+    if (threadCount > 1)
     {
-        htd::vertex_t vertex1 = graph.vertexAtPosition(i);
+        std::vector<std::thread> workers;
 
-        for (htd::index_t j = i + 1; j < n; ++j)
+        for (htd::index_t workerIndex = 0; workerIndex < threadCount; ++workerIndex)
         {
-            htd::vertex_t vertex2 = graph.vertexAtPosition(j);
+            workers.emplace_back(processPairs);
+        }
 
-            if (!graph.isNeighbor(vertex1, vertex2))
+        for (std::thread & worker : workers)
+        {
+            worker.join();
+        }
+    }
+    else
+    {
+        processPairs();
+    }
+
+    /*
+     *  If the common neighbors of a pair of non-adjacent vertices separate the pair and their number equals the size
+     *  of a minimum separator, they form a minimum separator. The previous implementation of the algorithm returned
+     *  the first such separator whenever it returned a minimum separator at all, so it is preferred over the minimum
+     *  cut computed above to keep those results unchanged.
+     */
+    std::size_t separatorSize = ret->size();
+
+    if (separatorSize > 0 && separatorSize + 2 <= n)
+    {
+        std::vector<htd::index_t> commonNeighbors;
+
+        std::vector<std::size_t> visited(n, 0);
+
+        std::size_t visitMarker = 0;
+
+        std::vector<htd::index_t> stack;
+
+        for (htd::index_t i = 0; i < n && !managementInstance.isTerminated(); ++i)
+        {
+            const std::vector<htd::index_t> & currentNeighbors = neighbors[i];
+
+            for (htd::index_t j = i + 1; j < n; ++j)
             {
-                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(implementation_->managementInstance_);
+                const std::vector<htd::index_t> & otherNeighbors = neighbors[j];
+
+                if (otherNeighbors.size() < separatorSize || currentNeighbors.size() < separatorSize ||
+                    std::binary_search(currentNeighbors.begin(), currentNeighbors.end(), j) ||
+                    htd::set_intersection_size(currentNeighbors.begin(), currentNeighbors.end(), otherNeighbors.begin(), otherNeighbors.end()) != separatorSize)
+                {
+                    continue;
+                }
 
-                htd::IFlow * flow = maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j);
+                commonNeighbors.clear();
 
-                std::unordered_set<htd::vertex_t> candidate;
+                std::set_intersection(currentNeighbors.begin(), currentNeighbors.end(), otherNeighbors.begin(), otherNeighbors.end(), std::back_inserter(commonNeighbors));
 
-                for(htd::index_t k = 0; k < n; ++k)
+                ++visitMarker;
+
+                for (htd::index_t commonNeighbor : commonNeighbors)
                 {
-                    if (k != i && k != j)
-                    {
-                        std::size_t capacity = flowNetwork.capacity(k, k + n);
+                    visited[commonNeighbor] = visitMarker;
+                }
 
-                        if (static_cast<std::size_t>(flow->flow(k, k + n)) == capacity && capacity > 0 && capacity < (std::size_t)-1)
+                visited[i] = visitMarker;
+
+                stack.assign(1, i);
+
+                while (!stack.empty() && visited[j] != visitMarker)
+                {
+                    htd::index_t current = stack.back();
+
+                    stack.pop_back();
+
+                    for (htd::index_t neighbor : neighbors[current])
+                    {
+                        if (visited[neighbor] != visitMarker)
                         {
-                            candidate.insert(graph.vertexAtPosition(k));
+                            visited[neighbor] = visitMarker;
+
+                            stack.push_back(neighbor);
                         }
                     }
                 }
 
-                if (candidate.size() < ret->size())
+                if (visited[j] != visitMarker)
                 {
                     ret->clear();
 
-                    ret->insert(ret->end(), candidate.begin(), candidate.end());
+                    for (htd::index_t commonNeighbor : commonNeighbors)
+                    {
+                        ret->push_back(graph.vertexAtPosition(commonNeighbor));
+                    }
 
                     std::sort(ret->begin(), ret->end());
-                }
 
-                delete flow;
+                    return ret;
+                }
             }
         }
     }
@@ -164,9 +400,25 @@ void htd::MinimumSeparatorAlgorithm::setManagementInstance(const htd::LibraryIns
     implementation_->managementInstance_ = manager;
 }
 
+std::size_t htd::MinimumSeparatorAlgorithm::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::MinimumSeparatorAlgorithm::setThreadCount(std::size_t threadCount)
+{
+    HTD_ASSERT(threadCount > 0)
+
+    implementation_->threadCount_ = threadCount;
+}
+
 htd::MinimumSeparatorAlgorithm * htd::MinimumSeparatorAlgorithm::clone(void) const
 {
-    return new htd::MinimumSeparatorAlgorithm(managementInstance());
+    htd::MinimumSeparatorAlgorithm * ret = new htd::MinimumSeparatorAlgorithm(managementInstance());
+
+    ret->setThreadCount(implementation_->threadCount_);
+
+    return ret;
 }
 
 #endif /* HTD_HTD_MINIMUMSEPARATORALGORITHM_CPP */
@@ -42,9 +42,9 @@ htd::MultiGraphFactory::~MultiGraphFactory()
 htd::IMutableMultiGraph * htd::MultiGraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableMultiGraph();
+    return constructionTemplate()->cloneMutableMultiGraph();
 #endif
 }
 
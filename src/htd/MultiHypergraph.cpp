@@ -1011,6 +1011,142 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     return implementation_->next_edge_++;
 }
 
+void htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
+{
+    std::vector<std::size_t> additionalNeighborCount(implementation_->neighborhood_.size(), 0);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        HTD_ASSERT(isVertex(edge.first) && isVertex(edge.second))
+
+        ++additionalNeighborCount[edge.first - htd::Vertex::FIRST];
+
+        if (edge.first != edge.second)
+        {
+            ++additionalNeighborCount[edge.second - htd::Vertex::FIRST];
+        }
+    }
+
+    for (htd::index_t index = 0; index < additionalNeighborCount.size(); ++index)
+    {
+        if (additionalNeighborCount[index] > 0)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[index];
+
+            currentNeighborhood.reserve(currentNeighborhood.size() + additionalNeighborCount[index]);
+        }
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        htd::vertex_t vertex1 = edge.first;
+        htd::vertex_t vertex2 = edge.second;
+
+        implementation_->edges_->emplace_back(implementation_->next_edge_++, vertex1, vertex2);
+
+        implementation_->neighborhood_[vertex1 - htd::Vertex::FIRST].push_back(vertex2);
+
+        if (vertex1 != vertex2)
+        {
+            implementation_->neighborhood_[vertex2 - htd::Vertex::FIRST].push_back(vertex1);
+        }
+        else
+        {
+            implementation_->selfLoops_.insert(vertex1);
+        }
+    }
+
+    for (htd::index_t index = 0; index < additionalNeighborCount.size(); ++index)
+    {
+        if (additionalNeighborCount[index] > 0)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[index];
+
+            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+            currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+        }
+    }
+}
+
+void htd::MultiHypergraph::addEdges(std::vector<std::vector<htd::vertex_t>> && edges)
+{
+    std::vector<bool> affectedVertices(implementation_->neighborhood_.size(), false);
+
+    for (std::vector<htd::vertex_t> & elements : edges)
+    {
+        HTD_ASSERT(!elements.empty())
+
+        #ifndef NDEBUG
+        for (htd::vertex_t vertex : elements)
+        {
+            HTD_ASSERT(isVertex(vertex))
+        }
+        #endif
+
+        if (elements.size() == 1)
+        {
+            implementation_->edges_->emplace_back(implementation_->next_edge_++, elements[0]);
+        }
+        else
+        {
+            std::vector<htd::vertex_t> sortedElements(elements);
+
+            std::sort(sortedElements.begin(), sortedElements.end());
+
+            auto position = std::unique(sortedElements.begin(), sortedElements.end());
+
+            implementation_->selfLoops_.insert(position, sortedElements.end());
+
+            sortedElements.erase(position, sortedElements.end());
+
+            for (htd::vertex_t vertex : sortedElements)
+            {
+                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+
+                /* The vertex itself is added to its neighborhood when the self-loops are known. */
+                for (htd::vertex_t neighbor : sortedElements)
+                {
+                    if (neighbor != vertex)
+                    {
+                        currentNeighborhood.push_back(neighbor);
+                    }
+                }
+
+                affectedVertices[vertex - htd::Vertex::FIRST] = true;
+            }
+
+            if (elements.size() == 2)
+            {
+                implementation_->edges_->emplace_back(implementation_->next_edge_++, elements[0], elements[1]);
+            }
+            else
+            {
+                implementation_->edges_->emplace_back(implementation_->next_edge_++, std::move(elements), std::move(sortedElements));
+            }
+        }
+    }
+
+    for (htd::index_t index = 0; index < affectedVertices.size(); ++index)
+    {
+        if (affectedVertices[index])
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[index];
+
+            htd::vertex_t vertex = static_cast<htd::vertex_t>(index + htd::Vertex::FIRST);
+
+            if (implementation_->selfLoops_.count(vertex) > 0)
+            {
+                currentNeighborhood.push_back(vertex);
+            }
+
+            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+            currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+        }
+    }
+}
+
 void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
 {
     bool found = false;
@@ -42,9 +42,9 @@ htd::MultiHypergraphFactory::~MultiHypergraphFactory()
 htd::IMutableMultiHypergraph * htd::MultiHypergraphFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableMultiHypergraph();
+    return constructionTemplate()->cloneMutableMultiHypergraph();
 #endif
 }
 
@@ -42,9 +42,9 @@ htd::OrderingAlgorithmFactory::~OrderingAlgorithmFactory()
 htd::IOrderingAlgorithm * htd::OrderingAlgorithmFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneOrderingAlgorithm();
+    return constructionTemplate()->cloneOrderingAlgorithm();
 #endif
 }
 
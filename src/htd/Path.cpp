@@ -41,66 +41,25 @@
 #include <memory>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::Path.
  */
 struct htd::Path::Implementation
 {
-    /**
-     *  Structure representing a node of a path.
-     */
-    struct Node
-    {
-        /**
-         *  The ID of the path node.
-         */
-        htd::id_t id;
-
-        /**
-         *  The parent of the path node.
-         */
-        htd::vertex_t parent;
-
-        /**
-         *  The child of the path node.
-         */
-        htd::vertex_t child;
-
-        /**
-         *  The collection of all edge identifiers containing the path node.
-         */
-        std::vector<htd::id_t> edges;
-
-        /**
-         *  Constructor for a path node.
-         *
-         *  @param[in] id       The ID of the constructed path node.
-         *  @param[in] parent   The parent of the constructed path node.
-         */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), child(htd::Vertex::UNKNOWN), edges()
-        {
-
-        }
-    };
-
     /**
      *  Constructor for the implementation details structure.
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodeExists_(), parents_(), childs_(), nodeEdges_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         for (htd::Hyperedge * edge : *edges_)
         {
             delete edge;
@@ -121,14 +80,15 @@ struct htd::Path::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
+          nodeExists_(original.nodeExists_),
+          parents_(original.parents_),
+          childs_(original.childs_),
+          nodeEdges_(original.nodeEdges_),
           edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
+        for (const htd::Hyperedge * edge : *(original.edges_))
         {
-            nodes_.insert(std::make_pair(node.first, new Node(*(node.second))));
+            edges_->emplace_back(new htd::Hyperedge(*edge));
         }
     }
 
@@ -139,12 +99,7 @@ struct htd::Path::Implementation
     {
         if (root_ != htd::Vertex::UNKNOWN)
         {
-            for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-            {
-                delete it->second;
-            }
-
-            nodes_.clear();
+            clearNodes();
 
             for (htd::Hyperedge * edge : *edges_)
             {
@@ -196,30 +151,173 @@ struct htd::Path::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all path nodes. It maps vertex IDs to the corresponding node information.
+     *  Information whether a path node exists, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<bool> nodeExists_;
+
+    /**
+     *  The parents of the path nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<htd::vertex_t> parents_;
+
+    /**
+     *  The children of the path nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::vector<htd::vertex_t> childs_;
+
+    /**
+     *  The identifiers of the edges containing the path nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<std::vector<htd::id_t>> nodeEdges_;
 
     /**
      *  The collection of all hyperedges which exist in the path.
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  Check whether a path node with the given ID exists.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return True if a path node with the given ID exists, false otherwise.
+     */
+    bool containsNode(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < nodeExists_.size() && nodeExists_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the parent of the given path node.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return The parent of the given path node or htd::Vertex::UNKNOWN if the path node is the root.
+     */
+    htd::vertex_t & parentOf(htd::vertex_t vertex)
+    {
+        return parents_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the parent of the given path node.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return The parent of the given path node or htd::Vertex::UNKNOWN if the path node is the root.
+     */
+    htd::vertex_t parentOf(htd::vertex_t vertex) const
+    {
+        return parents_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the child of the given path node.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return The child of the given path node or htd::Vertex::UNKNOWN if the path node is the leaf.
+     */
+    htd::vertex_t & childOf(htd::vertex_t vertex)
+    {
+        return childs_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the child of the given path node.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return The child of the given path node or htd::Vertex::UNKNOWN if the path node is the leaf.
+     */
+    htd::vertex_t childOf(htd::vertex_t vertex) const
+    {
+        return childs_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the identifiers of the edges containing the given path node.
+     *
+     *  @note The returned reference is invalidated when a new path node is created.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     *
+     *  @return The identifiers of the edges containing the given path node in ascending order.
+     */
+    std::vector<htd::id_t> & edgesOf(htd::vertex_t vertex)
+    {
+        return nodeEdges_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Create a new path node.
+     *
+     *  @param[in] vertex   The ID of the new path node.
+     *  @param[in] parent   The parent of the new path node.
+     */
+    void createNode(htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        std::size_t index = vertex - htd::Vertex::FIRST;
+
+        if (index >= nodeExists_.size())
+        {
+            nodeExists_.resize(index + 1, false);
+            parents_.resize(index + 1, htd::Vertex::UNKNOWN);
+            childs_.resize(index + 1, htd::Vertex::UNKNOWN);
+            nodeEdges_.resize(index + 1);
+        }
+
+        nodeExists_[index] = true;
+
+        parents_[index] = parent;
+
+        childs_[index] = htd::Vertex::UNKNOWN;
+    }
+
+    /**
+     *  Release the storage of the given path node.
+     *
+     *  @param[in] vertex   The ID of the path node.
+     */
+    void releaseNode(htd::vertex_t vertex)
+    {
+        std::size_t index = vertex - htd::Vertex::FIRST;
+
+        nodeExists_[index] = false;
+
+        parents_[index] = htd::Vertex::UNKNOWN;
+
+        childs_[index] = htd::Vertex::UNKNOWN;
+
+        nodeEdges_[index].clear();
+    }
+
+    /**
+     *  Remove all path nodes.
+     */
+    void clearNodes(void)
+    {
+        nodeExists_.clear();
+        parents_.clear();
+        childs_.clear();
+        nodeEdges_.clear();
+    }
+
     /**
      *  Delete a node of the path and perform an update of the internal state.
      *
-     *  @param[in] node The node of the path which shall be removed.
+     *  @param[in] vertex   The node of the path which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(htd::vertex_t vertex);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
      *
-     *  @param[in] node             The node for which swapWithParent(htd::vertex_t) was called.
-     *  @param[in] parentNode       The parent node of the swapped node.
-     *  @param[in] grandParentNode  The grandparent node of the swapped node.
+     *  @param[in] vertex       The node for which swapWithParent(htd::vertex_t) was called.
+     *  @param[in] parent       The parent node of the swapped node.
+     *  @param[in] grandParent  The grandparent node of the swapped node.
      */
-    void updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode);
+    void updateEdgesAfterSwapWithParent(htd::vertex_t vertex, htd::vertex_t parent, htd::vertex_t grandParent);
 };
 
 htd::Path::Path(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -259,7 +357,7 @@ std::size_t htd::Path::vertexCount(htd::vertex_t subPathRoot) const
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->child;
+        currentVertex = implementation_->childOf(currentVertex);
     }
 
     return ret;
@@ -279,7 +377,7 @@ std::size_t htd::Path::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Path::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->next_vertex_ && implementation_->containsNode(vertex);
 }
 
 bool htd::Path::isEdge(htd::id_t edgeId) const
@@ -372,9 +470,7 @@ bool htd::Path::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     
     if (isVertex(vertex) && isVertex(neighbor))
     {
-        const auto & node = implementation_->nodes_.at(vertex);
-
-        ret = node->parent == neighbor || node->child == neighbor;
+        ret = implementation_->parentOf(vertex) == neighbor || implementation_->childOf(vertex) == neighbor;
     }
     
     return ret;
@@ -396,14 +492,12 @@ std::size_t htd::Path::neighborCount(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        const auto & node = implementation_->nodes_.at(vertex);
-
-        if (node->parent != htd::Vertex::UNKNOWN)
+        if (implementation_->parentOf(vertex) != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
 
-        if (node->child != htd::Vertex::UNKNOWN)
+        if (implementation_->childOf(vertex) != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
@@ -420,16 +514,17 @@ htd::ConstCollection<htd::vertex_t> htd::Path::neighbors(htd::vertex_t vertex) c
 
     auto & result = ret.container();
 
-    const auto & node = implementation_->nodes_.at(vertex);
+    htd::vertex_t parent = implementation_->parentOf(vertex);
+    htd::vertex_t child = implementation_->childOf(vertex);
 
-    if (node->parent != htd::Vertex::UNKNOWN)
+    if (parent != htd::Vertex::UNKNOWN)
     {
-        result.push_back(node->parent);
+        result.push_back(parent);
     }
 
-    if (node->child != htd::Vertex::UNKNOWN)
+    if (child != htd::Vertex::UNKNOWN)
     {
-        result.push_back(node->child);
+        result.push_back(child);
     }
 
     std::sort(result.begin(), result.end());
@@ -443,16 +538,17 @@ void htd::Path::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = implementation_->nodes_.at(vertex);
+    htd::vertex_t parent = implementation_->parentOf(vertex);
+    htd::vertex_t child = implementation_->childOf(vertex);
 
-    if (node->parent != htd::Vertex::UNKNOWN)
+    if (parent != htd::Vertex::UNKNOWN)
     {
-        target.push_back(node->parent);
+        target.push_back(parent);
     }
 
-    if (node->child != htd::Vertex::UNKNOWN)
+    if (child != htd::Vertex::UNKNOWN)
     {
-        target.push_back(node->child);
+        target.push_back(child);
     }
 
     std::sort(target.begin() + size, target.end());
@@ -653,7 +749,7 @@ htd::vertex_t htd::Path::parent(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        ret = implementation_->nodes_.at(vertex)->parent;
+        ret = implementation_->parentOf(vertex);
     }
     
     return ret;
@@ -664,7 +760,7 @@ bool htd::Path::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->parentOf(vertex) == parent;
 }
 
 std::size_t htd::Path::childCount(htd::vertex_t vertex) const
@@ -673,7 +769,7 @@ std::size_t htd::Path::childCount(htd::vertex_t vertex) const
     
     if (isVertex(vertex))
     {
-        if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+        if (implementation_->childOf(vertex) != htd::Vertex::UNKNOWN)
         {
             ++ret;
         }
@@ -688,9 +784,9 @@ htd::ConstCollection<htd::vertex_t> htd::Path::children(htd::vertex_t vertex) co
 
     htd::VectorAdapter<htd::vertex_t> ret;
 
-    if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+    if (implementation_->childOf(vertex) != htd::Vertex::UNKNOWN)
     {
-        ret.container().emplace_back(implementation_->nodes_.at(vertex)->child);
+        ret.container().emplace_back(implementation_->childOf(vertex));
     }
 
     return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
@@ -700,9 +796,9 @@ void htd::Path::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 {
     HTD_ASSERT(isVertex(vertex))
 
-    if (implementation_->nodes_.at(vertex)->child != htd::Vertex::UNKNOWN)
+    if (implementation_->childOf(vertex) != htd::Vertex::UNKNOWN)
     {
-        target.emplace_back(implementation_->nodes_.at(vertex)->child);
+        target.emplace_back(implementation_->childOf(vertex));
     }
 }
 
@@ -710,7 +806,7 @@ htd::vertex_t htd::Path::child(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->childOf(vertex);
 
     HTD_ASSERT(child != htd::Vertex::UNKNOWN)
 
@@ -723,7 +819,7 @@ htd::vertex_t htd::Path::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->childOf(vertex);
 
     HTD_ASSERT(index == 0 && child != htd::Vertex::UNKNOWN)
     
@@ -735,7 +831,7 @@ bool htd::Path::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    return implementation_->nodes_.at(vertex)->child == child;
+    return implementation_->childOf(vertex) == child;
 }
 
 std::size_t htd::Path::height(void) const
@@ -749,13 +845,13 @@ std::size_t htd::Path::height(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t currentVertex = implementation_->childOf(vertex);
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->child;
+        currentVertex = implementation_->childOf(currentVertex);
     }
 
     return ret;
@@ -767,13 +863,13 @@ std::size_t htd::Path::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->parentOf(vertex);
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->parentOf(currentVertex);
     }
 
     return ret;
@@ -793,11 +889,11 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    std::vector<htd::id_t> & edges = implementation_->edgesOf(vertex);
 
     auto end = implementation_->edges_->end();
 
-    for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
+    for (auto it = edges.rbegin(); it != edges.rend(); ++it)
     {
         auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
 
@@ -805,7 +901,7 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->edgesOf(currentVertex);
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -820,47 +916,44 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
         end = implementation_->edges_->erase(position);
     }
 
-    if (node.parent != htd::Vertex::UNKNOWN)
-    {
-        auto & parentNode = *(implementation_->nodes_.at(node.parent));
+    htd::vertex_t parent = implementation_->parentOf(vertex);
+    htd::vertex_t child = implementation_->childOf(vertex);
 
-        parentNode.child = node.child;
+    if (parent != htd::Vertex::UNKNOWN)
+    {
+        implementation_->childOf(parent) = child;
 
-        if (node.child != htd::Vertex::UNKNOWN)
+        if (child != htd::Vertex::UNKNOWN)
         {
-            auto & childNode = *(implementation_->nodes_.at(node.child));
+            implementation_->parentOf(child) = parent;
 
-            childNode.parent = node.parent;
-
-            if (node.parent < node.child)
+            if (parent < child)
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, node.child));
+                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, parent, child));
             }
             else
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.child, node.parent));
+                implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, parent));
             }
 
-            childNode.edges.emplace_back(implementation_->next_edge_);
+            implementation_->edgesOf(child).emplace_back(implementation_->next_edge_);
 
-            parentNode.edges.emplace_back(implementation_->next_edge_);
+            implementation_->edgesOf(parent).emplace_back(implementation_->next_edge_);
 
             ++implementation_->next_edge_;
         }
 
-        implementation_->deleteNode(&node);
+        implementation_->deleteNode(vertex);
     }
     else
     {
-        if (node.child != htd::Vertex::UNKNOWN)
+        if (child != htd::Vertex::UNKNOWN)
         {
-            auto & child = *(implementation_->nodes_.at(node.child));
-
-            child.parent = htd::Vertex::UNKNOWN;
+            implementation_->parentOf(child) = htd::Vertex::UNKNOWN;
 
-            implementation_->root_ = node.child;
+            implementation_->root_ = child;
 
-            implementation_->deleteNode(&node);
+            implementation_->deleteNode(vertex);
         }
         else
         {
@@ -868,12 +961,10 @@ void htd::Path::removeVertex(htd::vertex_t vertex)
 
             implementation_->size_ = 0;
 
-            implementation_->nodes_.clear();
+            implementation_->clearNodes();
             implementation_->edges_->clear();
 
             implementation_->vertices_.clear();
-
-            delete &node;
         }
     }
 }
@@ -901,7 +992,7 @@ htd::vertex_t htd::Path::insertRoot(void)
 
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.push_back(implementation_->root_);
 
@@ -917,25 +1008,25 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
     ret = implementation_->next_vertex_;
 
-    htd::vertex_t child = node.child;
+    htd::vertex_t child = implementation_->childOf(vertex);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    /* The new path node may cause a reallocation of the node storage, so it must be created before references are taken. */
+    implementation_->createNode(ret, vertex);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    std::vector<htd::id_t> & edges = implementation_->edgesOf(vertex);
+    std::vector<htd::id_t> & newEdges = implementation_->edgesOf(ret);
 
     if (child != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+        std::vector<htd::id_t> & childEdges = implementation_->edgesOf(child);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
-        auto it = node.edges.begin();
+        auto it = edges.begin();
 
-        while (it != node.edges.end())
+        while (it != edges.end())
         {
             auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
@@ -949,7 +1040,7 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
 
                 implementation_->edges_->erase(position);
 
-                it = node.edges.end();
+                it = edges.end();
             }
             else
             {
@@ -957,26 +1048,26 @@ htd::vertex_t htd::Path::addChild(htd::vertex_t vertex)
             }
         }
 
-        node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-        childNode.edges.erase(std::lower_bound(childNode.edges.begin(), childNode.edges.end(), oldHyperedge));
+        edges.erase(std::lower_bound(edges.begin(), edges.end(), oldHyperedge));
+        childEdges.erase(std::lower_bound(childEdges.begin(), childEdges.end(), oldHyperedge));
 
-        childNode.parent = ret;
-        newNode->child = child;
+        implementation_->parentOf(child) = ret;
+        implementation_->childOf(ret) = child;
 
         implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, ret));
 
-        newNode->edges.push_back(implementation_->next_edge_);
-        childNode.edges.push_back(implementation_->next_edge_);
+        newEdges.push_back(implementation_->next_edge_);
+        childEdges.push_back(implementation_->next_edge_);
 
         implementation_->next_edge_++;
     }
 
-    node.child = ret;
+    implementation_->childOf(vertex) = ret;
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    node.edges.push_back(implementation_->next_edge_);
-    newNode->edges.push_back(implementation_->next_edge_);
+    edges.push_back(implementation_->next_edge_);
+    newEdges.push_back(implementation_->next_edge_);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -993,7 +1084,7 @@ void htd::Path::removeChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t child = implementation_->nodes_.at(vertex)->child;
+    htd::vertex_t child = implementation_->childOf(vertex);
 
     HTD_ASSERT(child != htd::Vertex::UNKNOWN)
 
@@ -1005,9 +1096,7 @@ void htd::Path::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & node = implementation_->nodes_.at(vertex);
-
-    if (node->child == child)
+    if (implementation_->childOf(vertex) == child)
     {
         removeVertex(child);
     }
@@ -1021,17 +1110,13 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = *(implementation_->nodes_.at(vertex));
-
         ret = implementation_->next_vertex_;
 
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
-
-        node.parent = ret;
+        implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
-        newRootNode->child = vertex;
+        implementation_->parentOf(vertex) = ret;
 
-        implementation_->nodes_.emplace(ret, newRootNode);
+        implementation_->childOf(ret) = vertex;
 
         implementation_->vertices_.push_back(ret);
 
@@ -1043,8 +1128,8 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
         implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-        implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-        newRootNode->edges.push_back(implementation_->next_edge_);
+        implementation_->edgesOf(vertex).push_back(implementation_->next_edge_);
+        implementation_->edgesOf(ret).push_back(implementation_->next_edge_);
 
         implementation_->next_edge_++;
     }
@@ -1054,14 +1139,11 @@ htd::vertex_t htd::Path::addParent(htd::vertex_t vertex)
 
         ret = addChild(parentVertex);
 
-        auto & selectedNode = *(implementation_->nodes_.at(vertex));
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
-
-        intermediateNode.parent = parentVertex;
+        implementation_->parentOf(ret) = parentVertex;
 
-        intermediateNode.child = vertex;
+        implementation_->childOf(ret) = vertex;
 
-        selectedNode.parent = ret;
+        implementation_->parentOf(vertex) = ret;
     }
 
     return ret;
@@ -1090,26 +1172,24 @@ htd::ConstCollection<htd::vertex_t> htd::Path::leaves(void) const
 
 void htd::Path::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->child == htd::Vertex::UNKNOWN)
+        if (implementation_->childOf(vertex) == htd::Vertex::UNKNOWN)
         {
-            target.push_back(node.first);
+            target.push_back(vertex);
         }
     }
-
-    std::sort(target.begin(), target.end());
 }
 
 htd::vertex_t htd::Path::leaf(void) const
 {
     HTD_ASSERT(implementation_->size_ > 0)
 
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->child == htd::Vertex::UNKNOWN)
+        if (implementation_->childOf(vertex) == htd::Vertex::UNKNOWN)
         {
-            return node.first;
+            return vertex;
         }
     }
 
@@ -1129,49 +1209,18 @@ bool htd::Path::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->child == htd::Vertex::UNKNOWN;
+    return implementation_->childOf(vertex) == htd::Vertex::UNKNOWN;
 }
 
-void htd::Path::Implementation::deleteNode(Node * node)
+void htd::Path::Implementation::deleteNode(htd::vertex_t vertex)
 {
-    if (node != nullptr)
+    if (containsNode(vertex))
     {
-        auto & parent = node->parent;
-
-        htd::id_t nodeIdentifier = node->id;
+        size_--;
 
-        if (parent != htd::Vertex::UNKNOWN)
-        {
-            auto & parentNode = nodes_.at(parent);
-
-            htd::vertex_t child = parentNode->child;
-
-            if (child != htd::Vertex::UNKNOWN)
-            {
-                auto & childNode = nodes_.at(child);
+        releaseNode(vertex);
 
-                parentNode->child = child;
-                childNode->parent = parent;
-            }
-
-            size_--;
-
-            delete nodes_.at(nodeIdentifier);
-
-            nodes_.erase(nodeIdentifier);
-
-            vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), nodeIdentifier));
-        }
-        else
-        {
-            size_--;
-
-            delete nodes_.at(nodeIdentifier);
-
-            nodes_.erase(nodeIdentifier);
-
-            vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), nodeIdentifier));
-        }
+        vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
     }
 }
 
@@ -1179,44 +1228,38 @@ void htd::Path::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    htd::vertex_t parent = node.parent;
+    htd::vertex_t parent = implementation_->parentOf(vertex);
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    htd::vertex_t grandParent = implementation_->parentOf(parent);
 
-    std::swap(node.child, parentNode.child);
+    htd::vertex_t child = implementation_->childOf(vertex);
 
-    node.parent = parentNode.parent;
+    implementation_->childOf(parent) = child;
 
-    parentNode.parent = vertex;
+    implementation_->parentOf(vertex) = grandParent;
 
-    node.child = parent;
+    implementation_->parentOf(parent) = vertex;
 
-    if (node.parent == htd::Vertex::UNKNOWN)
+    implementation_->childOf(vertex) = parent;
+
+    if (grandParent == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = vertex;
 
-        if (parentNode.child != htd::Vertex::UNKNOWN)
+        if (child != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & childNode = *(implementation_->nodes_.at(parentNode.child));
-
-            implementation_->updateEdgesAfterSwapWithParent(parentNode, node, childNode);
+            implementation_->updateEdgesAfterSwapWithParent(parent, vertex, child);
 
-            childNode.parent = parent;
+            implementation_->parentOf(child) = parent;
         }
     }
     else
     {
-        htd::vertex_t grandParent = node.parent;
+        implementation_->childOf(grandParent) = vertex;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
-
-        grandParentNode.child = vertex;
-
-        implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
+        implementation_->updateEdgesAfterSwapWithParent(vertex, parent, grandParent);
     }
 }
 
@@ -1285,17 +1328,17 @@ htd::Path & htd::Path::operator=(const htd::Path & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodeExists_ = original.implementation_->nodeExists_;
+        implementation_->parents_ = original.implementation_->parents_;
+        implementation_->childs_ = original.implementation_->childs_;
+        implementation_->nodeEdges_ = original.implementation_->nodeEdges_;
 
         implementation_->root_ = original.implementation_->root_;
 
         implementation_->size_ = original.implementation_->size_;
 
+        implementation_->vertices_ = original.implementation_->vertices_;
+
         if (original.implementation_->next_vertex_ >= htd::Vertex::FIRST)
         {
             implementation_->next_vertex_ = original.implementation_->next_vertex_;
@@ -1304,6 +1347,13 @@ htd::Path & htd::Path::operator=(const htd::Path & original)
         {
             implementation_->next_vertex_ = htd::Vertex::FIRST;
         }
+
+        for (const htd::Hyperedge * edge : *(original.implementation_->edges_))
+        {
+            implementation_->edges_->push_back(new htd::Hyperedge(*edge));
+        }
+
+        implementation_->next_edge_ = original.implementation_->next_edge_;
     }
 
     return *this;
@@ -1329,24 +1379,20 @@ htd::Path & htd::Path::operator=(const htd::IPath & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->createNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->createNode(vertex, original.parent(vertex));
                 }
 
                 if (!original.isLeaf(vertex))
                 {
-                    newNode->child = original.child(vertex);
+                    implementation_->childOf(vertex) = original.child(vertex);
                 }
 
-                implementation_->nodes_.emplace(vertex, newNode);
-
                 if (vertex > maximumVertex)
                 {
                     maximumVertex = vertex;
@@ -1361,6 +1407,23 @@ htd::Path & htd::Path::operator=(const htd::IPath & original)
             {
                 implementation_->next_vertex_ = htd::Vertex::FIRST;
             }
+
+            const htd::ConstCollection<htd::Hyperedge> & originalEdges = original.hyperedges();
+
+            for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
+            {
+                implementation_->edges_->push_back(new htd::Hyperedge(*it));
+
+                for (htd::vertex_t vertex : it->sortedElements())
+                {
+                    implementation_->edgesOf(vertex).push_back(it->id());
+                }
+            }
+
+            if (!implementation_->edges_->empty())
+            {
+                implementation_->next_edge_ = (*(implementation_->edges_->rbegin()))->id() + 1;
+            }
         }
     }
 
@@ -1374,15 +1437,15 @@ void htd::Path::assign(const htd::IPath & original)
 }
 #endif
 
-void htd::Path::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode)
+void htd::Path::Implementation::updateEdgesAfterSwapWithParent(htd::vertex_t vertex, htd::vertex_t parent, htd::vertex_t grandParent)
 {
-    htd::vertex_t vertex = node.id;
-    htd::vertex_t parent = parentNode.id;
-    htd::vertex_t grandParent = grandParentNode.id;
+    std::vector<htd::id_t> & edges = edgesOf(vertex);
+    std::vector<htd::id_t> & parentEdges = edgesOf(parent);
+    std::vector<htd::id_t> & grandParentEdges = edgesOf(grandParent);
 
     auto relevantEdgePosition = edges_->end();
 
-    for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
+    for (auto it = grandParentEdges.begin(); it != grandParentEdges.end() && relevantEdgePosition == edges_->end(); ++it)
     {
         auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
 
@@ -1394,13 +1457,13 @@ void htd::Path::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
 
-    parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
+    parentEdges.erase(std::lower_bound(parentEdges.begin(), parentEdges.end(), oldEdgeId));
 
-    grandParentNode.edges.erase(std::lower_bound(grandParentNode.edges.begin(), grandParentNode.edges.end(), oldEdgeId));
+    grandParentEdges.erase(std::lower_bound(grandParentEdges.begin(), grandParentEdges.end(), oldEdgeId));
 
-    node.edges.emplace_back(next_edge_);
+    edges.emplace_back(next_edge_);
 
-    grandParentNode.edges.emplace_back(next_edge_);
+    grandParentEdges.emplace_back(next_edge_);
 
     (*relevantEdgePosition)->setId(next_edge_);
 
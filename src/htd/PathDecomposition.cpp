@@ -40,7 +40,7 @@ htd::PathDecomposition::PathDecomposition(const htd::LibraryInstance * const man
 
 }
 
-htd::PathDecomposition::PathDecomposition(const htd::PathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::PathDecomposition::PathDecomposition(const htd::PathDecomposition & original) : htd::LabeledPath::LabeledPath(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_), inducedHyperedgeIndex_(original.inducedHyperedgeIndex_), inducedEdgesMutex_()
 {
 
 }
@@ -550,6 +550,11 @@ htd::FilteredHyperedgeCollection & htd::PathDecomposition::mutableInducedHypered
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
     return inducedEdges_.at(vertex);
 }
 
@@ -557,6 +562,64 @@ const htd::FilteredHyperedgeCollection & htd::PathDecomposition::inducedHyperedg
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
+    return inducedEdges_.at(vertex);
+}
+
+void htd::PathDecomposition::evictInducedHyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    if (inducedHyperedgeIndex_)
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        inducedEdges_.erase(vertex);
+    }
+}
+
+void htd::PathDecomposition::setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index)
+{
+    if (index)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            inducedEdges_.erase(vertex);
+        }
+    }
+    else if (inducedHyperedgeIndex_)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            lazyInducedHyperedges(vertex);
+        }
+    }
+
+    inducedHyperedgeIndex_ = index;
+}
+
+htd::FilteredHyperedgeCollection & htd::PathDecomposition::lazyInducedHyperedges(htd::vertex_t vertex) const
+{
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        if (inducedEdges_.count(vertex) > 0)
+        {
+            return inducedEdges_.at(vertex);
+        }
+    }
+
+    /* Compute the induced hyperedges without holding the lock, so that other vertices can be accessed concurrently. */
+    htd::FilteredHyperedgeCollection inducedEdges = inducedHyperedgeIndex_->inducedHyperedges(bagContent(vertex));
+
+    std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+    inducedEdges_.emplace(vertex, std::move(inducedEdges));
+
     return inducedEdges_.at(vertex);
 }
 
@@ -41,7 +41,7 @@ htd::PathDecompositionAlgorithmFactory::~PathDecompositionAlgorithmFactory()
 
 htd::IPathDecompositionAlgorithm * htd::PathDecompositionAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_PATHDECOMPOSITIONALGORITHMFACTORY_CPP */
@@ -42,9 +42,9 @@ htd::PathDecompositionFactory::~PathDecompositionFactory()
 htd::IMutablePathDecomposition * htd::PathDecompositionFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutablePathDecomposition();
+    return constructionTemplate()->cloneMutablePathDecomposition();
 #endif
 }
 
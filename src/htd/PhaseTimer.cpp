@@ -0,0 +1,118 @@
+/*
+ * File:   PhaseTimer.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_PHASETIMER_CPP
+#define HTD_HTD_PHASETIMER_CPP
+
+#include <htd/PhaseTimer.hpp>
+
+#include <chrono>
+#include <ctime>
+
+/**
+ *  The innermost running phase timer of the current thread.
+ */
+static thread_local htd::PhaseTimer * activePhaseTimer = nullptr;
+
+/**
+ *  Determine the current wall-clock time.
+ *
+ *  @return The current wall-clock time in nanoseconds since an arbitrary point in time.
+ */
+static std::uint64_t currentWallTime(void)
+{
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ *  Determine the CPU time consumed by the calling thread.
+ *
+ *  @return The CPU time consumed by the calling thread in nanoseconds. On platforms without per-thread CPU clocks, the CPU time of the process is returned.
+ */
+static std::uint64_t currentCpuTime(void)
+{
+#if defined(CLOCK_THREAD_CPUTIME_ID)
+    struct timespec time;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0)
+    {
+        return static_cast<std::uint64_t>(time.tv_sec) * 1000000000 + static_cast<std::uint64_t>(time.tv_nsec);
+    }
+#endif
+
+    return static_cast<std::uint64_t>(std::clock()) * (1000000000 / CLOCKS_PER_SEC);
+}
+
+htd::PhaseTimer::PhaseTimer(const htd::LibraryInstance & instance, std::size_t phase) : statistics_(instance.statistics()), phase_(phase), parent_(nullptr), wallTime_(0), cpuTime_(0), allocationCount_(0), nestedWallTime_(0), nestedCpuTime_(0), nestedAllocationCount_(0)
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    if (statistics_ != nullptr)
+    {
+        parent_ = activePhaseTimer;
+
+        activePhaseTimer = this;
+
+        allocationCount_ = htd::Statistics::totalAllocationCount();
+
+        cpuTime_ = currentCpuTime();
+
+        wallTime_ = currentWallTime();
+    }
+}
+
+htd::PhaseTimer::~PhaseTimer()
+{
+    stop();
+}
+
+void htd::PhaseTimer::stop(void)
+{
+    if (statistics_ != nullptr)
+    {
+        std::uint64_t wallTime = currentWallTime() - wallTime_;
+
+        std::uint64_t cpuTime = currentCpuTime() - cpuTime_;
+
+        std::size_t allocationCount = htd::Statistics::totalAllocationCount() - allocationCount_;
+
+        HTD_ASSERT(activePhaseTimer == this)
+
+        activePhaseTimer = parent_;
+
+        if (parent_ != nullptr)
+        {
+            parent_->nestedWallTime_ += wallTime;
+            parent_->nestedCpuTime_ += cpuTime;
+            parent_->nestedAllocationCount_ += allocationCount;
+        }
+
+        statistics_->recordPhase(phase_, wallTime - nestedWallTime_, cpuTime - nestedCpuTime_, allocationCount - nestedAllocationCount_);
+
+        statistics_ = nullptr;
+    }
+}
+
+#endif /* HTD_HTD_PHASETIMER_CPP */
@@ -57,7 +57,7 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), atoms_(), minTreeWidth_(minTreeWidth), eliminationSequenceBagSize_(0), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
     {
         updateEdgeCount();
     }
@@ -68,7 +68,7 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), atoms_(original.atoms_), minTreeWidth_(original.minTreeWidth_), eliminationSequenceBagSize_(original.eliminationSequenceBagSize_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
     {
 
     }
@@ -98,11 +98,21 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::vector<htd::vertex_t> remainingVertices_;
 
+    /**
+     *  The atoms of the graph which remained after the reduction rules of the preprocessing phase were applied.
+     */
+    std::vector<std::vector<htd::vertex_t>> atoms_;
+
     /**
      *  The lower bound of the treewidth of the input graph.
      */
     std::size_t minTreeWidth_;
 
+    /**
+     *  The maximum bag size induced by the partial vertex elimination ordering which exceeds the lower bound of the treewidth.
+     */
+    std::size_t eliminationSequenceBagSize_;
+
     /**
      *  The number of edges in the preprocessed graph.
      */
@@ -507,6 +517,26 @@ std::size_t htd::PreprocessedGraph::minTreeWidth(void) const HTD_NOEXCEPT
     return implementation_->minTreeWidth_;
 }
 
+std::size_t htd::PreprocessedGraph::eliminationSequenceBagSize(void) const HTD_NOEXCEPT
+{
+    return std::max(implementation_->minTreeWidth_ + 1, implementation_->eliminationSequenceBagSize_);
+}
+
+void htd::PreprocessedGraph::setEliminationSequenceBagSize(std::size_t bagSize)
+{
+    implementation_->eliminationSequenceBagSize_ = bagSize;
+}
+
+const std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::atoms(void) const HTD_NOEXCEPT
+{
+    return implementation_->atoms_;
+}
+
+void htd::PreprocessedGraph::setAtoms(std::vector<std::vector<htd::vertex_t>> && atoms)
+{
+    implementation_->atoms_ = std::move(atoms);
+}
+
 htd::PreprocessedGraph * htd::PreprocessedGraph::clone(void) const
 {
     return new htd::PreprocessedGraph(*this);
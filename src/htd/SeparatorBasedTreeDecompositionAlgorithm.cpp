@@ -40,6 +40,7 @@
 #include <htd/ITreeDecompositionManipulationOperation.hpp>
 #include <htd/TrivialTreeDecompositionAlgorithm.hpp>
 #include <htd/WidthReductionOperation.hpp>
+#include <htd/PhaseTimer.hpp>
 
 #include <algorithm>
 #include <cstdarg>
@@ -211,6 +212,8 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
             }
         }
 
+        HTD_STATISTICS(htd::PhaseTimer manipulationTimer(*(implementation_->managementInstance_), htd::Statistics::MANIPULATION_PHASE);)
+
         for (const htd::ITreeDecompositionManipulationOperation * operation : implementation_->postProcessingOperations_)
         {
             operation->apply(graph, *ret);
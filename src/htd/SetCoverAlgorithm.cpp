@@ -30,10 +30,9 @@
 #include <htd/SetCoverAlgorithm.hpp>
 #include <htd/VectorAdapter.hpp>
 
-#include <deque>
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
-#include <queue>
-#include <unordered_map>
 #include <vector>
 
 /**
@@ -42,56 +41,51 @@
 struct htd::SetCoverAlgorithm::Implementation
 {
     /**
-     *  Structure for historical entries needed for backtracking.
+     *  Set-cover instance in which the elements are represented by bit positions and the containers by packed bitsets.
      */
-    struct HistoryEntry
+    struct Instance
     {
         /**
-         *  The index of the selected container.
+         *  The number of 64-bit words of each bitset.
          */
-        htd::index_t selectedIndex;
+        std::size_t wordCount;
 
         /**
-         *  The remaining elements which still need to be covered.
+         *  The bitsets of the relevant containers, stored consecutively.
          */
-        std::vector<htd::id_t> remainder;
+        std::vector<std::uint64_t> containers;
 
         /**
-         *  The containers which have a non-empty set intersection with the remaining elements.
+         *  The indices of the relevant containers within the collection provided by the caller.
          */
-        std::vector<htd::id_t> containers;
+        std::vector<htd::index_t> originalIndices;
 
         /**
-         *  Constructor for a new history entry.
+         *  The relevant containers covering each element, indexed by the bit position of the element.
+         */
+        std::vector<std::vector<htd::index_t>> coveringContainers;
+
+        /**
+         *  Access the bitset of the relevant container with the given index.
          *
-         *  @param[in] selectedIndex    The index of the selected container.
-         *  @param[in] remainder        The remaining elements which still need to be covered.
-         *  @param[in] containers       The containers which have a non-empty set intersection with the remaining elements.
+         *  @param[in] container    The index of the relevant container.
+         *
+         *  @return A pointer to the first word of the bitset of the relevant container with the given index.
          */
-        HistoryEntry(htd::index_t selectedIndex, const std::vector<htd::id_t> & remainder, const std::vector<htd::id_t> & containers) : selectedIndex(selectedIndex), remainder(remainder), containers(containers)
+        const std::uint64_t * container(htd::index_t container) const
         {
-
+            return containers.data() + container * wordCount;
         }
-    };
 
-    /**
-     *  The comparison operator used to rank the quality of solutions.
-     */
-    class Compare
-    {
-        public:
-            /**
-             *  Check whether one solution is better than another.
-             *
-             *  @param[in] solution1    The first solution which shall be compared.
-             *  @param[in] solution2    The second solution which shall be compared.
-             *
-             *  @return True if solution1 is better than solution2, false otherwise.
-             */
-            bool operator() (const std::vector<htd::index_t> & solution1, const std::vector<htd::index_t> & solution2)
-            {
-                return solution1.size() < solution2.size();
-            }
+        /**
+         *  Getter for the number of relevant containers.
+         *
+         *  @return The number of relevant containers.
+         */
+        std::size_t containerCount(void) const
+        {
+            return originalIndices.size();
+        }
     };
 
     /**
@@ -113,6 +107,45 @@ struct htd::SetCoverAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Compute the bitset representation of the given set-cover problem.
+     *
+     *  Containers not covering any element are dropped. Of several containers covering the same elements only the first
+     *  one is kept and each container covering a proper subset of the elements covered by another container is dropped,
+     *  because it can be replaced by the dominating container in every cover.
+     *
+     *  @param[in] elements     The elements which must be covered, sorted in ascending order.
+     *  @param[in] containers   The collection of containers which are available for covering the given elements.
+     *  @param[out] instance    The bitset representation of the set-cover problem.
+     *
+     *  @return True if the containers cover all elements, false otherwise.
+     */
+    bool createInstance(const std::vector<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, Instance & instance) const;
+
+    /**
+     *  Search a minimum cover of the given set of uncovered elements via branch-and-bound.
+     *
+     *  @param[in] instance         The bitset representation of the set-cover problem.
+     *  @param[in] uncovered        The bitset of the elements which still need to be covered.
+     *  @param[in] selection        The relevant containers selected so far.
+     *  @param[in,out] solution     The smallest cover found so far. It is replaced whenever a smaller cover is found.
+     */
+    void search(const Instance & instance, std::vector<std::uint64_t> & uncovered, std::vector<htd::index_t> & selection, std::vector<htd::index_t> & solution) const;
+
+    /**
+     *  Compute a lower bound for the number of containers needed for covering the given set of elements.
+     *
+     *  The bound is the maximum of two bounds: the number of elements divided by the largest number of elements covered by a
+     *  single container and the number of elements found greedily such that no container covers two of them.
+     *
+     *  @param[in] instance     The bitset representation of the set-cover problem.
+     *  @param[in] uncovered    The bitset of the elements which still need to be covered.
+     *  @param[in] marked       Scratch space with one entry per relevant container, all of which must be false.
+     *
+     *  @return A lower bound for the number of containers needed for covering the given set of elements.
+     */
+    std::size_t lowerBound(const Instance & instance, const std::vector<std::uint64_t> & uncovered, std::vector<bool> & marked) const;
 };
 
 htd::SetCoverAlgorithm::SetCoverAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -132,307 +165,326 @@ void htd::SetCoverAlgorithm::computeSetCover(const std::vector<htd::id_t> & elem
 
 void htd::SetCoverAlgorithm::computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const
 {
-    htd::id_t next = 0;
-    
-    std::deque<Implementation::HistoryEntry> history;
-
-    std::vector<htd::id_t> relevantContainers;
-    
-    std::vector<htd::id_t> oldRelevantContainers;
-    
-    std::vector<std::vector<htd::index_t>> solutions;
-    
     std::vector<htd::id_t> remainder(elements.begin(), elements.end());
 
-    std::unordered_map<htd::id_t, std::size_t> additionalCoverage;
+    Implementation::Instance instance;
+
+    if (remainder.empty() || !implementation_->createInstance(remainder, containers, instance))
+    {
+        return;
+    }
 
-    std::size_t minimumCoverSize = (std::size_t)-1;
+    std::size_t wordCount = instance.wordCount;
 
-    for (htd::index_t index = 0; index < containers.size(); index++)
+    std::vector<std::uint64_t> uncovered(wordCount, 0);
+
+    for (htd::index_t position = 0; position < remainder.size(); ++position)
     {
-        std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[index].begin(), containers[index].end());
+        uncovered[position / 64] |= (std::uint64_t)1 << (position % 64);
+    }
+
+    std::vector<htd::index_t> selection;
 
-        if (coverage > 0)
+    /* Containers which are the only ones covering an element are part of every cover. */
+    for (const std::vector<htd::index_t> & coveringContainers : instance.coveringContainers)
+    {
+        if (coveringContainers.size() == 1 && std::find(selection.begin(), selection.end(), coveringContainers[0]) == selection.end())
         {
-            relevantContainers.push_back(static_cast<htd::id_t>(index));
+            selection.push_back(coveringContainers[0]);
+
+            const std::uint64_t * container = instance.container(coveringContainers[0]);
 
-            additionalCoverage[static_cast<htd::id_t>(index)] = coverage;
+            for (htd::index_t word = 0; word < wordCount; ++word)
+            {
+                uncovered[word] &= ~container[word];
+            }
         }
     }
 
-    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t container1, htd::id_t container2) { return containers[container1].size() > containers[container2].size(); });
+    /* The greedy cover serves as initial upper bound for the branch-and-bound search. */
+    std::vector<htd::index_t> solution(selection);
 
-    std::unordered_set<htd::id_t> dominatedContainers;
+    std::vector<std::uint64_t> greedyUncovered(uncovered);
 
-    for (auto it1 = relevantContainers.begin(); it1 < relevantContainers.end(); it1++)
+    while (htd::bitset_intersection_size(greedyUncovered.data(), greedyUncovered.data(), wordCount) > 0)
     {
-        htd::id_t container = *it1;
+        htd::index_t bestContainer = 0;
+
+        std::size_t bestCoverage = 0;
 
-        for (auto it2 = it1 + 1; it2 < relevantContainers.end(); it2++)
+        for (htd::index_t container = 0; container < instance.containerCount(); ++container)
         {
-            if (std::includes(containers[container].begin(), containers[container].end(), containers[*it2].begin(), containers[*it2].end()))
+            std::size_t coverage = htd::bitset_intersection_size(greedyUncovered.data(), instance.container(container), wordCount);
+
+            if (coverage > bestCoverage)
             {
-                dominatedContainers.insert(*it2);
+                bestContainer = container;
+
+                bestCoverage = coverage;
             }
         }
-    }
 
-    std::sort(relevantContainers.begin(), relevantContainers.end());
+        solution.push_back(bestContainer);
 
-    for (htd::id_t dominatedContainer : dominatedContainers)
-    {
-        auto position = std::lower_bound(relevantContainers.begin(), relevantContainers.end(), dominatedContainer);
-
-        if (position != relevantContainers.end())
+        for (htd::index_t word = 0; word < wordCount; ++word)
         {
-            relevantContainers.erase(position);
+            greedyUncovered[word] &= ~instance.container(bestContainer)[word];
         }
     }
 
-    DEBUGGING_CODE(
-    std::cout << "Set cover: " << std::endl << "   ";
-    htd::print(vertices, false);
-    std::cout << std::endl << std::endl;
+    implementation_->search(instance, uncovered, selection, solution);
 
-    for (htd::index_t container : relevantContainers)
-    {
-        std::cout << "   Relevant container: " << container << "   (";
-        htd::print(containers[container], false);
-        std::cout << std::endl;
-    })
+    std::vector<htd::index_t> result;
 
-    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t left, htd::id_t right) { return additionalCoverage[left] > additionalCoverage[right]; });
+    result.reserve(solution.size());
 
-    while (relevantContainers.size() > 0)
+    for (htd::index_t container : solution)
     {
-        std::swap(relevantContainers, oldRelevantContainers);
-        
-        relevantContainers.clear();
-        additionalCoverage.clear();
+        result.push_back(instance.originalIndices[container]);
+    }
 
-        if (history.size() < minimumCoverSize && next < oldRelevantContainers.size())
-        {
-            htd::id_t selected = next;
+    std::sort(result.begin(), result.end());
 
-            history.push_back(Implementation::HistoryEntry(selected, remainder, oldRelevantContainers));
+    std::copy(result.begin(), result.end(), std::back_inserter(target));
+}
 
-            DEBUGGING_CODE(
-            std::cout << "Selected: " << oldRelevantContainers[selected] << std::endl << "   ";
-            htd::print(containers[oldRelevantContainers[selected]], false);
-            std::cout << std::endl << std::endl;)
+const htd::LibraryInstance * htd::SetCoverAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
 
-            for (htd::id_t vertex : containers[oldRelevantContainers[selected]])
-            {
-                std::vector<htd::id_t>::iterator position = std::find(remainder.begin(), remainder.end(), vertex);
+void htd::SetCoverAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
 
-                if (position != remainder.end())
-                {
-                    /* Iterator 'position' is no longer used after erasing the underlying element. Therefore, invalidating the iterator does no harm. */
-                    // coverity[use_iterator]
-                    remainder.erase(position);
-                }
-            }
+    implementation_->managementInstance_ = manager;
+}
 
-            next = 0;
+htd::SetCoverAlgorithm * htd::SetCoverAlgorithm::clone(void) const
+{
+    return new htd::SetCoverAlgorithm(managementInstance());
+}
 
-            if (remainder.size() > 0)
-            {
-                DEBUGGING_CODE(
-                for (htd::id_t vertex : remainder)
-                {
-                    std::cout << "Remaining: " << vertex << std::endl;
-                }
+bool htd::SetCoverAlgorithm::Implementation::createInstance(const std::vector<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, Instance & instance) const
+{
+    std::size_t elementCount = elements.size();
 
-                std::cout << std::endl;)
+    std::size_t wordCount = (elementCount + 63) / 64;
 
-                htd::index_t index = 0;
+    std::vector<std::uint64_t> candidates;
 
-                for (htd::id_t container : oldRelevantContainers)
-                {
-                    DEBUGGING_CODE(
-                    std::cout << "Container: " << container << "   ";
-                    htd::print(containers[container], false);
-                    std::cout << std::endl;)
+    std::vector<htd::index_t> candidateIndices;
 
-                    std::size_t coverage = htd::set_intersection_size(remainder.begin(), remainder.end(), containers[container].begin(), containers[container].end());
+    std::vector<std::size_t> candidateSizes;
 
-                    if (index > selected && coverage > 0)
-                    {
-                        DEBUGGING_CODE(
-                        std::cout << "Relevant container: " << container << "   ";
-                        htd::print(containers[container], false);
-                        std::cout << std::endl;)
+    std::vector<std::uint64_t> bitset(wordCount);
 
-                        relevantContainers.push_back(container);
+    std::vector<std::uint64_t> coverage(wordCount, 0);
 
-                        additionalCoverage[container] = coverage;
-                    }
+    for (htd::index_t index = 0; index < containers.size(); ++index)
+    {
+        const std::vector<htd::id_t> & container = containers[index];
 
-                    index++;
-                }
+        std::fill(bitset.begin(), bitset.end(), 0);
 
-                if (relevantContainers.size() > 0)
-                {
-                    std::sort(relevantContainers.begin(), relevantContainers.end(), [&](htd::id_t left, htd::id_t right) { return additionalCoverage[left] > additionalCoverage[right]; });
+        std::size_t size = 0;
 
-                    DEBUGGING_CODE(std::cout << std::endl;)
-                
-                    next = 0;
-                }
-                else
-                {
-                    DEBUGGING_CODE(std::cout << "Backtracking ..." << std::endl;)
-
-                    if (!history.empty())
-                    {
-                        next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
-
-                        remainder = history.back().remainder;
-
-                        relevantContainers = history.back().containers;
-
-                        history.pop_back();
-
-                        DEBUGGING_CODE(
-                        std::cout << "   Next container: " << next << std::endl;
-                        std::cout << "   Current remainder: ";
-                        htd::print(remainder, false);
-                        std::cout << std::endl;
-                        std::cout << "   Relevant containers: ";
-                        htd::print(relevantContainers, false);
-                        std::cout << std::endl << std::endl;)
-                    }
-                    else
-                    {
-                        DEBUGGING_CODE(std::cout << "   No backtracking history found ..." << std::endl << std::endl;)
-                    }
-                }
+        auto element = elements.begin();
+
+        for (auto it = container.begin(); it != container.end() && element != elements.end(); ++it)
+        {
+            element = std::lower_bound(element, elements.end(), *it);
+
+            if (element != elements.end() && *element == *it)
+            {
+                std::size_t position = static_cast<std::size_t>(std::distance(elements.begin(), element));
+
+                bitset[position / 64] |= (std::uint64_t)1 << (position % 64);
+
+                ++size;
             }
-            else
+        }
+
+        if (size > 0)
+        {
+            candidates.insert(candidates.end(), bitset.begin(), bitset.end());
+
+            candidateIndices.push_back(index);
+
+            candidateSizes.push_back(size);
+
+            for (htd::index_t word = 0; word < wordCount; ++word)
             {
-                std::vector<htd::index_t> newSolution;
+                coverage[word] |= bitset[word];
+            }
+        }
+    }
 
-                newSolution.reserve(history.size());
+    if (htd::bitset_intersection_size(coverage.data(), coverage.data(), wordCount) < elementCount)
+    {
+        return false;
+    }
 
-                for (const Implementation::HistoryEntry & entry : history)
-                {
-                    newSolution.push_back(entry.containers[entry.selectedIndex]);
-                }
+    std::vector<htd::index_t> order(candidateIndices.size());
 
-                std::sort(newSolution.begin(), newSolution.end());
+    for (htd::index_t position = 0; position < order.size(); ++position)
+    {
+        order[position] = position;
+    }
 
-                DEBUGGING_CODE(
-                std::cout << "Solution:   ";
-                htd::print(newSolution, false);
-                std::cout << std::endl << std::endl;
-                std::cout << "Backtracking ..." << std::endl;)
+    /* Larger containers come first, so each container can only be dominated by one of its predecessors. */
+    std::stable_sort(order.begin(), order.end(), [&](htd::index_t candidate1, htd::index_t candidate2) { return candidateSizes[candidate1] > candidateSizes[candidate2]; });
 
-                solutions.push_back(newSolution);
+    instance.wordCount = wordCount;
 
-                if (history.size() < minimumCoverSize)
-                {
-                    minimumCoverSize = history.size();
-                }
+    instance.containers.clear();
+    instance.originalIndices.clear();
 
-                next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
+    instance.coveringContainers.assign(elementCount, std::vector<htd::index_t>());
 
-                remainder = history.back().remainder;
+    for (htd::index_t candidate : order)
+    {
+        const std::uint64_t * bitset1 = candidates.data() + candidate * wordCount;
 
-                relevantContainers = history.back().containers;
+        bool dominated = false;
 
-                history.pop_back();
+        for (htd::index_t container = 0; !dominated && container < instance.containerCount(); ++container)
+        {
+            dominated = htd::bitset_difference_size(bitset1, instance.container(container), wordCount) == 0;
+        }
+
+        if (!dominated)
+        {
+            instance.containers.insert(instance.containers.end(), bitset1, bitset1 + wordCount);
 
-                DEBUGGING_CODE(
-                std::cout << "   Next container: " << next << std::endl;
-                std::cout << "   Current remainder: ";
-                htd::print(remainder, false);
-                std::cout << std::endl;
-                std::cout << "   Relevant containers: ";
-                htd::print(relevantContainers, false);
-                std::cout << std::endl << std::endl;)
+            instance.originalIndices.push_back(candidateIndices[candidate]);
+        }
+    }
+
+    for (htd::index_t container = 0; container < instance.containerCount(); ++container)
+    {
+        const std::uint64_t * bitset1 = instance.container(container);
+
+        for (htd::index_t position = 0; position < elementCount; ++position)
+        {
+            if ((bitset1[position / 64] >> (position % 64)) & 1)
+            {
+                instance.coveringContainers[position].push_back(container);
             }
         }
-        else
+    }
+
+    return true;
+}
+
+void htd::SetCoverAlgorithm::Implementation::search(const Instance & instance, std::vector<std::uint64_t> & uncovered, std::vector<htd::index_t> & selection, std::vector<htd::index_t> & solution) const
+{
+    std::size_t wordCount = instance.wordCount;
+
+    if (htd::bitset_intersection_size(uncovered.data(), uncovered.data(), wordCount) == 0)
+    {
+        if (selection.size() < solution.size())
         {
-            DEBUGGING_CODE(std::cout << "Backtracking ..." << std::endl;)
+            solution = selection;
+        }
 
-            if (!history.empty())
-            {
-                next = static_cast<htd::id_t>(history.back().selectedIndex) + 1;
+        return;
+    }
 
-                remainder = history.back().remainder;
+    std::vector<bool> marked(instance.containerCount(), false);
 
-                relevantContainers = history.back().containers;
+    if (selection.size() + lowerBound(instance, uncovered, marked) >= solution.size() || managementInstance_->isTerminated())
+    {
+        return;
+    }
 
-                history.pop_back();
+    /* Every cover contains one of the containers covering the element with the fewest covering containers. */
+    const std::vector<htd::index_t> * branchingContainers = nullptr;
 
-                DEBUGGING_CODE(
-                std::cout << "   Next container: " << next << std::endl;
-                std::cout << "   Current remainder: ";
-                htd::print(remainder, false);
-                std::cout << std::endl;
-                std::cout << "   Relevant containers: ";
-                htd::print(relevantContainers, false);
-                std::cout << std::endl << std::endl;)
-            }
-            else
+    for (htd::index_t position = 0; position < instance.coveringContainers.size(); ++position)
+    {
+        if ((uncovered[position / 64] >> (position % 64)) & 1)
+        {
+            const std::vector<htd::index_t> & coveringContainers = instance.coveringContainers[position];
+
+            if (branchingContainers == nullptr || coveringContainers.size() < branchingContainers->size())
             {
-                DEBUGGING_CODE(std::cout << "   No backtracking history found ..." << std::endl << std::endl;)
+                branchingContainers = &coveringContainers;
             }
         }
     }
-    
-    if (solutions.size() > 0)
+
+    std::vector<std::pair<std::size_t, htd::index_t>> branches;
+
+    branches.reserve(branchingContainers->size());
+
+    for (htd::index_t container : *branchingContainers)
     {
-        std::sort(solutions.begin(), solutions.end(), Implementation::Compare());
+        branches.emplace_back(htd::bitset_intersection_size(uncovered.data(), instance.container(container), wordCount), container);
+    }
 
-        DEBUGGING_CODE(
-        std::size_t count = 0;
-        
-        for (const std::vector<htd::id_t>& solution : solutions)
-        {
-            if (solution.size() == minimumCoverSize)
-            {
-                std::cout << "Solution: ";
-                htd::print(solution, false);
-                std::cout << std::endl;
+    std::stable_sort(branches.begin(), branches.end(), [](const std::pair<std::size_t, htd::index_t> & branch1, const std::pair<std::size_t, htd::index_t> & branch2) { return branch1.first > branch2.first; });
 
-                for (htd::id_t container : solution)
-                {
-                    std::cout << "   " << container << ":   Content: ";
+    std::vector<std::uint64_t> remainder(wordCount);
 
-                    htd::print(containers[container], false);
-                    std::cout << std::endl;
-                }
+    for (const std::pair<std::size_t, htd::index_t> & branch : branches)
+    {
+        const std::uint64_t * container = instance.container(branch.second);
 
-                std::cout << std::endl;
-                
-                count++;
-            }
+        for (htd::index_t word = 0; word < wordCount; ++word)
+        {
+            remainder[word] = uncovered[word] & ~container[word];
         }
-        
-        std::cout << "Total solutions: " << count << std::endl << std::endl;
-        )
 
-        std::copy(solutions[0].begin(), solutions[0].end(), std::back_inserter(target));
+        selection.push_back(branch.second);
+
+        search(instance, remainder, selection, solution);
+
+        selection.pop_back();
+
+        if (selection.size() + 1 >= solution.size())
+        {
+            return;
+        }
     }
 }
 
-const htd::LibraryInstance * htd::SetCoverAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+std::size_t htd::SetCoverAlgorithm::Implementation::lowerBound(const Instance & instance, const std::vector<std::uint64_t> & uncovered, std::vector<bool> & marked) const
 {
-    return implementation_->managementInstance_;
-}
+    std::size_t wordCount = instance.wordCount;
 
-void htd::SetCoverAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
-{
-    HTD_ASSERT(manager != nullptr)
+    std::size_t uncoveredCount = htd::bitset_intersection_size(uncovered.data(), uncovered.data(), wordCount);
 
-    implementation_->managementInstance_ = manager;
-}
+    std::size_t maximumCoverage = 0;
 
-htd::SetCoverAlgorithm * htd::SetCoverAlgorithm::clone(void) const
-{
-    return new htd::SetCoverAlgorithm(managementInstance());
+    for (htd::index_t container = 0; container < instance.containerCount(); ++container)
+    {
+        maximumCoverage = std::max(maximumCoverage, htd::bitset_intersection_size(uncovered.data(), instance.container(container), wordCount));
+    }
+
+    std::size_t ret = (uncoveredCount + maximumCoverage - 1) / maximumCoverage;
+
+    std::size_t independentCount = 0;
+
+    for (htd::index_t position = 0; position < instance.coveringContainers.size(); ++position)
+    {
+        if ((uncovered[position / 64] >> (position % 64)) & 1)
+        {
+            const std::vector<htd::index_t> & coveringContainers = instance.coveringContainers[position];
+
+            if (std::none_of(coveringContainers.begin(), coveringContainers.end(), [&](htd::index_t container) { return marked[container]; }))
+            {
+                ++independentCount;
+
+                for (htd::index_t container : coveringContainers)
+                {
+                    marked[container] = true;
+                }
+            }
+        }
+    }
+
+    return std::max(ret, independentCount);
 }
 
 #endif /* HTD_HTD_SETCOVERALGORITHM_CPP */
@@ -41,7 +41,7 @@ htd::SetCoverAlgorithmFactory::~SetCoverAlgorithmFactory()
 
 htd::ISetCoverAlgorithm * htd::SetCoverAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_SETCOVERALGORITHMFACTORY_CPP */
@@ -0,0 +1,317 @@
+/*
+ * File:   Statistics.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_HTD_STATISTICS_CPP
+#define HTD_HTD_STATISTICS_CPP
+
+#include <htd/Statistics.hpp>
+
+#include <htd/Helpers.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <array>
+#include <atomic>
+#include <iomanip>
+
+constexpr std::size_t htd::Statistics::IMPORT_PHASE;
+constexpr std::size_t htd::Statistics::PREPROCESSING_PHASE;
+constexpr std::size_t htd::Statistics::ORDERING_PHASE;
+constexpr std::size_t htd::Statistics::BUCKET_ELIMINATION_PHASE;
+constexpr std::size_t htd::Statistics::INDUCED_EDGES_PHASE;
+constexpr std::size_t htd::Statistics::MANIPULATION_PHASE;
+constexpr std::size_t htd::Statistics::EXPORT_PHASE;
+constexpr std::size_t htd::Statistics::PHASE_COUNT;
+constexpr std::size_t htd::Statistics::ELIMINATED_VERTICES;
+constexpr std::size_t htd::Statistics::FILL_EDGES;
+constexpr std::size_t htd::Statistics::PRIORITY_QUEUE_UPDATES;
+constexpr std::size_t htd::Statistics::COUNTER_COUNT;
+
+/**
+ *  The number of memory allocations reported by the current thread via htd::Statistics::recordAllocation().
+ */
+static thread_local std::size_t reportedAllocationCount = 0;
+
+/**
+ *  Private implementation details of class htd::Statistics.
+ */
+struct htd::Statistics::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void)
+    {
+        reset();
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Reset all phases and counters to 0.
+     */
+    void reset(void)
+    {
+        for (std::size_t phase = 0; phase < htd::Statistics::PHASE_COUNT; ++phase)
+        {
+            invocationCount_[phase] = 0;
+            wallTime_[phase] = 0;
+            cpuTime_[phase] = 0;
+            allocationCount_[phase] = 0;
+            peakMemoryUsage_[phase] = 0;
+        }
+
+        for (std::size_t counter = 0; counter < htd::Statistics::COUNTER_COUNT; ++counter)
+        {
+            counter_[counter] = 0;
+        }
+    }
+
+    /**
+     *  The number of times each phase was completed.
+     */
+    std::array<std::atomic<std::size_t>, htd::Statistics::PHASE_COUNT> invocationCount_;
+
+    /**
+     *  The wall-clock time spent in each phase in nanoseconds.
+     */
+    std::array<std::atomic<std::uint64_t>, htd::Statistics::PHASE_COUNT> wallTime_;
+
+    /**
+     *  The CPU time spent in each phase in nanoseconds.
+     */
+    std::array<std::atomic<std::uint64_t>, htd::Statistics::PHASE_COUNT> cpuTime_;
+
+    /**
+     *  The number of memory allocations performed in each phase.
+     */
+    std::array<std::atomic<std::size_t>, htd::Statistics::PHASE_COUNT> allocationCount_;
+
+    /**
+     *  The maximum memory usage observed at the end of each phase.
+     */
+    std::array<std::atomic<std::size_t>, htd::Statistics::PHASE_COUNT> peakMemoryUsage_;
+
+    /**
+     *  The values of the counters.
+     */
+    std::array<std::atomic<std::size_t>, htd::Statistics::COUNTER_COUNT> counter_;
+};
+
+htd::Statistics::Statistics(void) : implementation_(new Implementation())
+{
+
+}
+
+htd::Statistics::~Statistics()
+{
+
+}
+
+const char * htd::Statistics::phaseName(std::size_t phase)
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    static const char * const names[] = { "import", "preprocessing", "ordering", "bucket_elimination", "induced_edges", "manipulation", "export" };
+
+    return names[phase];
+}
+
+const char * htd::Statistics::counterName(std::size_t counter)
+{
+    HTD_ASSERT(counter < htd::Statistics::COUNTER_COUNT)
+
+    static const char * const names[] = { "eliminated_vertices", "fill_edges", "priority_queue_updates" };
+
+    return names[counter];
+}
+
+std::size_t htd::Statistics::invocationCount(std::size_t phase) const
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    return implementation_->invocationCount_[phase].load(std::memory_order_relaxed);
+}
+
+double htd::Statistics::wallTime(std::size_t phase) const
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    return implementation_->wallTime_[phase].load(std::memory_order_relaxed) / 1000000.0;
+}
+
+double htd::Statistics::cpuTime(std::size_t phase) const
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    return implementation_->cpuTime_[phase].load(std::memory_order_relaxed) / 1000000.0;
+}
+
+std::size_t htd::Statistics::allocationCount(std::size_t phase) const
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    return implementation_->allocationCount_[phase].load(std::memory_order_relaxed);
+}
+
+std::size_t htd::Statistics::peakMemoryUsage(std::size_t phase) const
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    return implementation_->peakMemoryUsage_[phase].load(std::memory_order_relaxed);
+}
+
+std::size_t htd::Statistics::counter(std::size_t counter) const
+{
+    HTD_ASSERT(counter < htd::Statistics::COUNTER_COUNT)
+
+    return implementation_->counter_[counter].load(std::memory_order_relaxed);
+}
+
+void htd::Statistics::recordPhase(std::size_t phase, std::uint64_t wallTime, std::uint64_t cpuTime, std::size_t allocations)
+{
+    HTD_ASSERT(phase < htd::Statistics::PHASE_COUNT)
+
+    implementation_->invocationCount_[phase].fetch_add(1, std::memory_order_relaxed);
+    implementation_->wallTime_[phase].fetch_add(wallTime, std::memory_order_relaxed);
+    implementation_->cpuTime_[phase].fetch_add(cpuTime, std::memory_order_relaxed);
+    implementation_->allocationCount_[phase].fetch_add(allocations, std::memory_order_relaxed);
+
+    std::size_t memoryUsage = htd::currentMemoryUsage();
+
+    std::atomic<std::size_t> & peakMemoryUsage = implementation_->peakMemoryUsage_[phase];
+
+    std::size_t currentValue = peakMemoryUsage.load(std::memory_order_relaxed);
+
+    while (currentValue < memoryUsage && !peakMemoryUsage.compare_exchange_weak(currentValue, memoryUsage, std::memory_order_relaxed))
+    {
+
+    }
+}
+
+void htd::Statistics::increment(std::size_t counter, std::size_t amount)
+{
+    HTD_ASSERT(counter < htd::Statistics::COUNTER_COUNT)
+
+    implementation_->counter_[counter].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void htd::Statistics::increment(const htd::LibraryInstance & instance, std::size_t counter, std::size_t amount)
+{
+    htd::Statistics * statistics = instance.statistics();
+
+    if (statistics != nullptr)
+    {
+        statistics->increment(counter, amount);
+    }
+}
+
+void htd::Statistics::reset(void)
+{
+    implementation_->reset();
+}
+
+void htd::Statistics::print(std::ostream & stream) const
+{
+    std::ios::fmtflags oldflags(stream.flags());
+
+    stream << std::left << std::setw(20) << "Phase"
+           << std::right << std::setw(12) << "Invocations"
+           << std::setw(16) << "Wall Time (ms)"
+           << std::setw(16) << "CPU Time (ms)"
+           << std::setw(14) << "Allocations"
+           << std::setw(20) << "Peak Memory (bytes)" << std::endl;
+
+    for (std::size_t phase = 0; phase < htd::Statistics::PHASE_COUNT; ++phase)
+    {
+        stream << std::left << std::setw(20) << phaseName(phase)
+               << std::right << std::setw(12) << invocationCount(phase)
+               << std::setw(16) << std::fixed << std::setprecision(3) << wallTime(phase)
+               << std::setw(16) << std::fixed << std::setprecision(3) << cpuTime(phase)
+               << std::setw(14) << allocationCount(phase)
+               << std::setw(20) << peakMemoryUsage(phase) << std::endl;
+    }
+
+    stream << std::endl;
+
+    for (std::size_t counter = 0; counter < htd::Statistics::COUNTER_COUNT; ++counter)
+    {
+        stream << std::left << std::setw(24) << counterName(counter) << std::right << std::setw(20) << this->counter(counter) << std::endl;
+    }
+
+    stream << std::left << std::setw(24) << "peak_memory_usage" << std::right << std::setw(20) << htd::peakMemoryUsage() << std::endl;
+
+    stream.flags(oldflags);
+}
+
+void htd::Statistics::writeJson(std::ostream & stream) const
+{
+    std::ios::fmtflags oldflags(stream.flags());
+
+    stream << "{" << std::endl;
+    stream << "  \"phases\": {" << std::endl;
+
+    for (std::size_t phase = 0; phase < htd::Statistics::PHASE_COUNT; ++phase)
+    {
+        stream << "    \"" << phaseName(phase) << "\": { "
+               << "\"invocations\": " << invocationCount(phase) << ", "
+               << "\"wall_time_ms\": " << std::fixed << std::setprecision(3) << wallTime(phase) << ", "
+               << "\"cpu_time_ms\": " << std::fixed << std::setprecision(3) << cpuTime(phase) << ", "
+               << "\"allocations\": " << allocationCount(phase) << ", "
+               << "\"peak_memory_bytes\": " << peakMemoryUsage(phase) << " }";
+
+        stream << (phase + 1 < htd::Statistics::PHASE_COUNT ? "," : "") << std::endl;
+    }
+
+    stream << "  }," << std::endl;
+    stream << "  \"counters\": {" << std::endl;
+
+    for (std::size_t counter = 0; counter < htd::Statistics::COUNTER_COUNT; ++counter)
+    {
+        stream << "    \"" << counterName(counter) << "\": " << this->counter(counter);
+
+        stream << (counter + 1 < htd::Statistics::COUNTER_COUNT ? "," : "") << std::endl;
+    }
+
+    stream << "  }," << std::endl;
+    stream << "  \"peak_memory_bytes\": " << htd::peakMemoryUsage() << std::endl;
+    stream << "}" << std::endl;
+
+    stream.flags(oldflags);
+}
+
+void htd::Statistics::recordAllocation(void) HTD_NOEXCEPT
+{
+    ++reportedAllocationCount;
+}
+
+std::size_t htd::Statistics::totalAllocationCount(void) HTD_NOEXCEPT
+{
+    return reportedAllocationCount;
+}
+
+#endif /* HTD_HTD_STATISTICS_CPP */
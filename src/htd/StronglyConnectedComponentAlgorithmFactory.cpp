@@ -41,7 +41,7 @@ htd::StronglyConnectedComponentAlgorithmFactory::~StronglyConnectedComponentAlgo
 
 htd::IStronglyConnectedComponentAlgorithm * htd::StronglyConnectedComponentAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_STRONGLYCONNECTEDCOMPONENTALGORITHMFACTORY_CPP */
@@ -41,88 +41,26 @@
 #include <iterator>
 #include <memory>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::Tree.
  */
 struct htd::Tree::Implementation
 {
-    /**
-     *  Structure representing a node of a tree.
-     */
-    struct Node
-    {
-        /**
-         *  The ID of the tree node.
-         */
-        htd::id_t id;
-
-        /**
-         *  The parent of the tree node.
-         */
-        htd::vertex_t parent;
-
-        /**
-         *  The collection of all edge identifiers containing the tree node.
-         */
-        std::vector<htd::id_t> edges;
-
-        /**
-         *  The collection of all children of the tree node.
-         */
-        std::vector<htd::vertex_t> children;
-
-        /**
-         *  Constructor for a tree node.
-         *
-         *  @param[in] id       The ID of the constructed tree node.
-         *  @param[in] parent   The parent of the constructed tree node.
-         */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), edges(), children()
-        {
-
-        }
-
-        /**
-         *  Copy constructor for a tree node.
-         *
-         *  @param[in] original  The original tree node.
-         */
-        Node(const Node & original) : id(original.id), parent(original.parent), edges(original.edges), children(original.children)
-        {
-
-        }
-
-        /**
-         *  Move constructor for a tree node.
-         *
-         *  @param[in] original  The original tree node.
-         */
-        Node(Node && original) : id(original.id), parent(original.parent), edges(std::move(original.edges)), children(std::move(original.children))
-        {
-
-        }
-    };
-
     /**
      *  Constructor for the implementation details structure.
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodeExists_(), parents_(), children_(), nodeEdges_(), freeChildLists_(), freeEdgeLists_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         for (htd::Hyperedge * edge : *edges_)
         {
             delete edge;
@@ -141,16 +79,14 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
+          nodeExists_(original.nodeExists_),
+          parents_(original.parents_),
+          children_(original.children_),
+          nodeEdges_(original.nodeEdges_),
+          freeChildLists_(),
+          freeEdgeLists_(),
           edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
-
         for (const htd::Hyperedge * edge : *(original.edges_))
         {
             edges_->emplace_back(new htd::Hyperedge(*edge));
@@ -162,12 +98,7 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
-        nodes_.clear();
+        clearNodes();
 
         for (htd::Hyperedge * edge : *edges_)
         {
@@ -218,30 +149,215 @@ struct htd::Tree::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  Information whether a tree node exists, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<bool> nodeExists_;
+
+    /**
+     *  The parents of the tree nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<htd::vertex_t> parents_;
+
+    /**
+     *  The children of the tree nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<std::vector<htd::vertex_t>> children_;
+
+    /**
+     *  The identifiers of the edges containing the tree nodes, indexed by the vertex ID minus htd::Vertex::FIRST.
+     */
+    std::vector<std::vector<htd::id_t>> nodeEdges_;
+
+    /**
+     *  Free-list of the (empty) child collections of removed tree nodes which can be re-used by new tree nodes.
+     */
+    std::vector<std::vector<htd::vertex_t>> freeChildLists_;
+
+    /**
+     *  Free-list of the (empty) edge collections of removed tree nodes which can be re-used by new tree nodes.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    std::vector<std::vector<htd::id_t>> freeEdgeLists_;
 
     /**
      *  The collection of all hyperedges which exist in the tree.
      */
     std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
 
+    /**
+     *  Check whether a tree node with the given ID exists.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return True if a tree node with the given ID exists, false otherwise.
+     */
+    bool containsNode(htd::vertex_t vertex) const
+    {
+        return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < nodeExists_.size() && nodeExists_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the parent of the given tree node.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return The parent of the given tree node or htd::Vertex::UNKNOWN if the tree node is the root.
+     */
+    htd::vertex_t & parentOf(htd::vertex_t vertex)
+    {
+        return parents_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the parent of the given tree node.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return The parent of the given tree node or htd::Vertex::UNKNOWN if the tree node is the root.
+     */
+    htd::vertex_t parentOf(htd::vertex_t vertex) const
+    {
+        return parents_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the children of the given tree node.
+     *
+     *  @note The returned reference is invalidated when a new tree node is created.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return The children of the given tree node in ascending order.
+     */
+    std::vector<htd::vertex_t> & childrenOf(htd::vertex_t vertex)
+    {
+        return children_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the children of the given tree node.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return The children of the given tree node in ascending order.
+     */
+    const std::vector<htd::vertex_t> & childrenOf(htd::vertex_t vertex) const
+    {
+        return children_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Access the identifiers of the edges containing the given tree node.
+     *
+     *  @note The returned reference is invalidated when a new tree node is created.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     *
+     *  @return The identifiers of the edges containing the given tree node in ascending order.
+     */
+    std::vector<htd::id_t> & edgesOf(htd::vertex_t vertex)
+    {
+        return nodeEdges_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Create a new tree node.
+     *
+     *  @param[in] vertex   The ID of the new tree node.
+     *  @param[in] parent   The parent of the new tree node.
+     */
+    void createNode(htd::vertex_t vertex, htd::vertex_t parent)
+    {
+        std::size_t index = vertex - htd::Vertex::FIRST;
+
+        if (index >= nodeExists_.size())
+        {
+            nodeExists_.resize(index + 1, false);
+            parents_.resize(index + 1, htd::Vertex::UNKNOWN);
+            children_.resize(index + 1);
+            nodeEdges_.resize(index + 1);
+        }
+
+        nodeExists_[index] = true;
+
+        parents_[index] = parent;
+
+        if (!freeChildLists_.empty())
+        {
+            children_[index].swap(freeChildLists_.back());
+
+            freeChildLists_.pop_back();
+        }
+
+        if (!freeEdgeLists_.empty())
+        {
+            nodeEdges_[index].swap(freeEdgeLists_.back());
+
+            freeEdgeLists_.pop_back();
+        }
+    }
+
+    /**
+     *  Release the storage of the given tree node and put its collections on the free-lists.
+     *
+     *  @param[in] vertex   The ID of the tree node.
+     */
+    void releaseNode(htd::vertex_t vertex)
+    {
+        std::size_t index = vertex - htd::Vertex::FIRST;
+
+        nodeExists_[index] = false;
+
+        parents_[index] = htd::Vertex::UNKNOWN;
+
+        std::vector<htd::vertex_t> & currentChildren = children_[index];
+        std::vector<htd::id_t> & currentEdges = nodeEdges_[index];
+
+        currentChildren.clear();
+        currentEdges.clear();
+
+        if (currentChildren.capacity() > 0)
+        {
+            freeChildLists_.emplace_back(std::move(currentChildren));
+
+            currentChildren = std::vector<htd::vertex_t>();
+        }
+
+        if (currentEdges.capacity() > 0)
+        {
+            freeEdgeLists_.emplace_back(std::move(currentEdges));
+
+            currentEdges = std::vector<htd::id_t>();
+        }
+    }
+
+    /**
+     *  Remove all tree nodes.
+     */
+    void clearNodes(void)
+    {
+        nodeExists_.clear();
+        parents_.clear();
+        children_.clear();
+        nodeEdges_.clear();
+        freeChildLists_.clear();
+        freeEdgeLists_.clear();
+    }
+
     /**
      *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] vertex   The node of the tree which shall be removed.
      */
-    void deleteNode(Node * node);
+    void deleteNode(htd::vertex_t vertex);
 
     /**
      *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
      *
-     *  @param[in] node             The node for which swapWithParent(htd::vertex_t) was called.
-     *  @param[in] parentNode       The parent node of the swapped node.
-     *  @param[in] grandParentNode  The grandparent node of the swapped node.
+     *  @param[in] vertex       The node for which swapWithParent(htd::vertex_t) was called.
+     *  @param[in] parent       The parent node of the swapped node.
+     *  @param[in] grandParent  The grandparent node of the swapped node.
      */
-    void updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode);
+    void updateEdgesAfterSwapWithParent(htd::vertex_t vertex, htd::vertex_t parent, htd::vertex_t grandParent);
 };
 
 htd::Tree::Tree(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -303,7 +419,7 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->next_vertex_ && implementation_->containsNode(vertex);
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
@@ -397,13 +513,13 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    htd::vertex_t parent = implementation_->parentOf(vertex);
 
-    const auto & children = node.children;
+    const auto & children = implementation_->childrenOf(vertex);
 
-    if (node.parent != htd::Vertex::UNKNOWN)
+    if (parent != htd::Vertex::UNKNOWN)
     {
-        if (node.parent == neighbor)
+        if (parent == neighbor)
         {
             ret = true;
         }
@@ -445,14 +561,12 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
-
-    if (node.parent != htd::Vertex::UNKNOWN)
+    if (implementation_->parentOf(vertex) != htd::Vertex::UNKNOWN)
     {
         ret++;
     }
 
-    return ret + node.children.size();
+    return ret + implementation_->childrenOf(vertex).size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::neighbors(htd::vertex_t vertex) const
@@ -472,13 +586,13 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    htd::vertex_t parent = implementation_->parentOf(vertex);
 
-    const auto & children = node.children;
+    const auto & children = implementation_->childrenOf(vertex);
 
-    if (node.parent != htd::Vertex::UNKNOWN)
+    if (parent != htd::Vertex::UNKNOWN)
     {
-        target.emplace_back(node.parent);
+        target.emplace_back(parent);
     }
 
     target.insert(target.end(), children.begin(), children.end());
@@ -665,7 +779,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->parentOf(vertex);
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,28 +791,28 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->parentOf(vertex) == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->childrenOf(vertex).size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->childrenOf(vertex));
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->childrenOf(vertex);
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
@@ -707,7 +821,7 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->childrenOf(vertex);
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +833,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->childrenOf(vertex);
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +871,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->parentOf(vertex);
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->parentOf(currentVertex);
     }
 
     return ret;
@@ -783,11 +897,11 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    std::vector<htd::id_t> & nodeEdges = implementation_->edgesOf(vertex);
 
     auto end = implementation_->edges_->end();
 
-    for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
+    for (auto it = nodeEdges.rbegin(); it != nodeEdges.rend(); ++it)
     {
         auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
 
@@ -795,7 +909,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
         {
             if (currentVertex != vertex)
             {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
+                std::vector<htd::id_t> & currentEdges = implementation_->edgesOf(currentVertex);
 
                 /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
                  * edge connecting the two vertices, std::lower_bound will always find the edge
@@ -810,13 +924,15 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
         end = implementation_->edges_->erase(position);
     }
 
-    const auto & children = node.children;
+    const auto & children = implementation_->childrenOf(vertex);
+
+    htd::vertex_t parent = implementation_->parentOf(vertex);
 
-    if (node.parent != htd::Vertex::UNKNOWN)
+    if (parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        auto & siblings = implementation_->childrenOf(parent);
 
-        auto & siblings = parentNode.children;
+        auto & parentEdges = implementation_->edgesOf(parent);
 
         switch (children.size())
         {
@@ -828,9 +944,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 htd::vertex_t child = children[0];
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                childNode.parent = node.parent;
+                implementation_->parentOf(child) = parent;
 
                 auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
 
@@ -839,18 +953,18 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                     siblings.insert(position, child);
                 }
 
-                if (node.parent < child)
+                if (parent < child)
                 {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
+                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, parent, child));
                 }
                 else
                 {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
+                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, parent));
                 }
 
-                childNode.edges.emplace_back(implementation_->next_edge_);
+                implementation_->edgesOf(child).emplace_back(implementation_->next_edge_);
 
-                parentNode.edges.emplace_back(implementation_->next_edge_);
+                parentEdges.emplace_back(implementation_->next_edge_);
 
                 ++implementation_->next_edge_;
 
@@ -860,9 +974,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 for (htd::vertex_t child : children)
                 {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                    childNode.parent = node.parent;
+                    implementation_->parentOf(child) = parent;
 
                     auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
 
@@ -871,18 +983,18 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                         siblings.insert(position, child);
                     }
 
-                    if (node.parent < child)
+                    if (parent < child)
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
+                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, parent, child));
                     }
                     else
                     {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
+                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, parent));
                     }
 
-                    childNode.edges.emplace_back(implementation_->next_edge_);
+                    implementation_->edgesOf(child).emplace_back(implementation_->next_edge_);
 
-                    parentNode.edges.emplace_back(implementation_->next_edge_);
+                    parentEdges.emplace_back(implementation_->next_edge_);
 
                     implementation_->next_edge_++;
                 }
@@ -891,7 +1003,7 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(vertex);
     }
     else
     {
@@ -903,7 +1015,13 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 
                 implementation_->size_ = 0;
 
-                implementation_->nodes_.clear();
+                implementation_->clearNodes();
+
+                for (htd::Hyperedge * edge : *(implementation_->edges_))
+                {
+                    delete edge;
+                }
+
                 implementation_->edges_->clear();
 
                 implementation_->vertices_.clear();
@@ -914,9 +1032,9 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                implementation_->parentOf(implementation_->root_) = htd::Vertex::UNKNOWN;
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -924,19 +1042,17 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                implementation_->parentOf(implementation_->root_) = htd::Vertex::UNKNOWN;
 
-                rootNode.parent = htd::Vertex::UNKNOWN;
+                std::vector<htd::vertex_t> & newRootChildren = implementation_->childrenOf(implementation_->root_);
 
-                std::vector<htd::vertex_t> & newRootChildren = rootNode.children;
+                std::vector<htd::id_t> & newRootEdges = implementation_->edgesOf(implementation_->root_);
 
                 for (auto it = children.begin() + 1; it != children.end(); ++it)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                    childNode.parent = implementation_->root_;
+                    implementation_->parentOf(child) = implementation_->root_;
 
                     auto position = std::lower_bound(newRootChildren.begin(), newRootChildren.end(), child);
 
@@ -954,14 +1070,14 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                         implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, implementation_->root_));
                     }
 
-                    childNode.edges.emplace_back(implementation_->next_edge_);
+                    implementation_->edgesOf(child).emplace_back(implementation_->next_edge_);
 
-                    rootNode.edges.emplace_back(implementation_->next_edge_);
+                    newRootEdges.emplace_back(implementation_->next_edge_);
 
                     implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -994,8 +1110,8 @@ htd::vertex_t htd::Tree::insertRoot(void)
 
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
-        implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->clearNodes();
+        implementation_->createNode(implementation_->root_, htd::Vertex::UNKNOWN);
 
         implementation_->vertices_.emplace_back(implementation_->root_);
 
@@ -1018,11 +1134,9 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            nextVertex = implementation_->parentOf(vertex);
 
-            nextVertex = node.parent;
-
-            std::vector<htd::vertex_t> & currentChildren = node.children;
+            std::vector<htd::vertex_t> & currentChildren = implementation_->childrenOf(vertex);
 
             if (lastVertex != htd::Vertex::UNKNOWN)
             {
@@ -1034,7 +1148,7 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
                 currentChildren.insert(std::lower_bound(currentChildren.begin(), currentChildren.end(), nextVertex), nextVertex);
             }
 
-            node.parent = lastVertex;
+            implementation_->parentOf(vertex) = lastVertex;
 
             lastVertex = vertex;
 
@@ -1049,15 +1163,11 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     htd::vertex_t ret = htd::Vertex::UNKNOWN;
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
     ret = implementation_->next_vertex_;
 
-    node.children.emplace_back(ret);
+    implementation_->createNode(ret, vertex);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
-
-    implementation_->nodes_.emplace(ret, newNode);
+    implementation_->childrenOf(vertex).emplace_back(ret);
 
     implementation_->vertices_.emplace_back(ret);
 
@@ -1067,9 +1177,9 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    node.edges.push_back(implementation_->next_edge_);
+    implementation_->edgesOf(vertex).push_back(implementation_->next_edge_);
 
-    newNode->edges.push_back(implementation_->next_edge_);
+    implementation_->edgesOf(ret).push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1081,9 +1191,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
-
-    auto & children = node.children;
+    auto & children = implementation_->childrenOf(vertex);
 
     if (!children.empty())
     {
@@ -1112,17 +1220,13 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
-
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
+        implementation_->createNode(ret, htd::Vertex::UNKNOWN);
 
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        implementation_->parentOf(vertex) = ret;
 
-        newRootNode->children.emplace_back(vertex);
-
-        implementation_->nodes_.emplace(ret, newRootNode);
+        implementation_->childrenOf(ret).emplace_back(vertex);
 
         implementation_->vertices_.emplace_back(ret);
 
@@ -1136,14 +1240,14 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
+        std::vector<htd::id_t> & parentEdges = implementation_->edgesOf(parentVertex);
+        std::vector<htd::id_t> & selectedEdges = implementation_->edgesOf(vertex);
 
         htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
-        auto it = selectedNode.edges.begin();
+        auto it = selectedEdges.begin();
 
-        while (it != selectedNode.edges.end())
+        while (it != selectedEdges.end())
         {
             auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
@@ -1157,7 +1261,7 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
                 implementation_->edges_->erase(position);
 
-                it = selectedNode.edges.end();
+                it = selectedEdges.end();
             }
             else
             {
@@ -1165,31 +1269,32 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
             }
         }
 
-        parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldHyperedge));
-        selectedNode.edges.erase(std::lower_bound(selectedNode.edges.begin(), selectedNode.edges.end(), oldHyperedge));
+        parentEdges.erase(std::lower_bound(parentEdges.begin(), parentEdges.end(), oldHyperedge));
+        selectedEdges.erase(std::lower_bound(selectedEdges.begin(), selectedEdges.end(), oldHyperedge));
 
+        /* The new tree node may cause a reallocation of the node storage, so the references above must not be used anymore. */
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
+        implementation_->parentOf(ret) = parentVertex;
 
-        intermediateNode.parent = parentVertex;
+        implementation_->childrenOf(ret).emplace_back(vertex);
 
-        intermediateNode.children.emplace_back(vertex);
+        std::vector<htd::vertex_t> & parentChildren = implementation_->childrenOf(parentVertex);
 
-        auto position = std::find(parentNode.children.begin(), parentNode.children.end(), vertex);
+        auto position = std::find(parentChildren.begin(), parentChildren.end(), vertex);
 
-        if (position != parentNode.children.end())
+        if (position != parentChildren.end())
         {
-            parentNode.children.erase(position);
+            parentChildren.erase(position);
         }
 
-        selectedNode.parent = ret;
+        implementation_->parentOf(vertex) = ret;
     }
 
     implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    implementation_->edgesOf(vertex).push_back(implementation_->next_edge_);
+    implementation_->edgesOf(ret).push_back(implementation_->next_edge_);
 
     implementation_->next_edge_++;
 
@@ -1202,25 +1307,25 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    std::vector<htd::id_t> & edges = implementation_->edgesOf(vertex);
 
-    htd::vertex_t oldParent = node.parent;
+    htd::vertex_t oldParent = implementation_->parentOf(vertex);
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            std::vector<htd::vertex_t> & oldParentChildren = implementation_->childrenOf(oldParent);
+            std::vector<htd::id_t> & oldParentEdges = implementation_->edgesOf(oldParent);
 
-            oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
+            oldParentChildren.erase(std::find(oldParentChildren.begin(), oldParentChildren.end(), vertex));
 
             htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
-            auto it = oldParentNode.edges.begin();
+            auto it = oldParentEdges.begin();
 
-            while (it != oldParentNode.edges.end())
+            while (it != oldParentEdges.end())
             {
                 auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
@@ -1234,7 +1339,7 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 
                     implementation_->edges_->erase(position);
 
-                    it = oldParentNode.edges.end();
+                    it = oldParentEdges.end();
                 }
                 else
                 {
@@ -1242,33 +1347,34 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
                 }
             }
 
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            oldParentNode.edges.erase(std::lower_bound(oldParentNode.edges.begin(), oldParentNode.edges.end(), oldHyperedge));
+            edges.erase(std::lower_bound(edges.begin(), edges.end(), oldHyperedge));
+            oldParentEdges.erase(std::lower_bound(oldParentEdges.begin(), oldParentEdges.end(), oldHyperedge));
         }
         else
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->parentOf(relevantVertex) != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->parentOf(relevantVertex);
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            std::vector<htd::vertex_t> & children = implementation_->childrenOf(vertex);
+            std::vector<htd::id_t> & relevantEdges = implementation_->edgesOf(relevantVertex);
 
-            relevantNode.parent = htd::Vertex::UNKNOWN;
+            implementation_->parentOf(relevantVertex) = htd::Vertex::UNKNOWN;
 
-            node.children.erase(std::find(node.children.begin(), node.children.end(), relevantVertex));
+            children.erase(std::find(children.begin(), children.end(), relevantVertex));
 
             htd::id_t oldHyperedge = htd::Id::UNKNOWN;
 
-            auto it = relevantNode.edges.begin();
+            auto it = relevantEdges.begin();
 
-            while (it != relevantNode.edges.end())
+            while (it != relevantEdges.end())
             {
                 auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
 
@@ -1282,7 +1388,7 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
 
                     implementation_->edges_->erase(position);
 
-                    it = relevantNode.edges.end();
+                    it = relevantEdges.end();
                 }
                 else
                 {
@@ -1290,19 +1396,21 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
                 }
             }
 
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            relevantNode.edges.erase(std::lower_bound(relevantNode.edges.begin(), relevantNode.edges.end(), oldHyperedge));
+            edges.erase(std::lower_bound(edges.begin(), edges.end(), oldHyperedge));
+            relevantEdges.erase(std::lower_bound(relevantEdges.begin(), relevantEdges.end(), oldHyperedge));
         }
 
-        auto position = std::lower_bound(newParentNode.children.begin(), newParentNode.children.end(), vertex);
+        std::vector<htd::vertex_t> & newParentChildren = implementation_->childrenOf(newParent);
+
+        auto position = std::lower_bound(newParentChildren.begin(), newParentChildren.end(), vertex);
 
-        newParentNode.children.insert(position, vertex);
+        newParentChildren.insert(position, vertex);
 
-        newParentNode.edges.emplace_back(implementation_->next_edge_);
+        implementation_->edgesOf(newParent).emplace_back(implementation_->next_edge_);
 
-        node.edges.emplace_back(implementation_->next_edge_);
+        edges.emplace_back(implementation_->next_edge_);
 
-        node.parent = newParent;
+        implementation_->parentOf(vertex) = newParent;
 
         if (vertex < newParent)
         {
@@ -1321,9 +1429,9 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->childrenOf(vertex).empty())
         {
             ret++;
         }
@@ -1343,15 +1451,13 @@ htd::ConstCollection<htd::vertex_t> htd::Tree::leaves(void) const
 
 void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        if (node.second->children.empty())
+        if (implementation_->childrenOf(vertex).empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(vertex);
         }
     }
-
-    std::sort(target.begin(), target.end());
 }
 
 htd::vertex_t htd::Tree::leafAtPosition(htd::index_t index) const
@@ -1371,67 +1477,62 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->childrenOf(vertex).empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    htd::vertex_t parent = node.parent;
+    htd::vertex_t parent = implementation_->parentOf(vertex);
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    htd::vertex_t grandParent = implementation_->parentOf(parent);
+
+    std::vector<htd::vertex_t> & children = implementation_->childrenOf(vertex);
+    std::vector<htd::vertex_t> & parentChildren = implementation_->childrenOf(parent);
 
-    node.parent = parentNode.parent;
+    implementation_->parentOf(vertex) = grandParent;
 
-    node.children.insert(std::lower_bound(node.children.begin(), node.children.end(), parent), parent);
+    children.insert(std::lower_bound(children.begin(), children.end(), parent), parent);
 
-    parentNode.parent = vertex;
+    implementation_->parentOf(parent) = vertex;
 
-    parentNode.children.erase(std::lower_bound(parentNode.children.begin(), parentNode.children.end(), vertex));
+    parentChildren.erase(std::lower_bound(parentChildren.begin(), parentChildren.end(), vertex));
 
-    if (node.parent == htd::Vertex::UNKNOWN)
+    if (grandParent == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = vertex;
     }
     else
     {
-        htd::vertex_t grandParent = node.parent;
+        std::vector<htd::vertex_t> & grandParentChildren = implementation_->childrenOf(grandParent);
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        implementation_->updateEdgesAfterSwapWithParent(vertex, parent, grandParent);
 
-        implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
+        grandParentChildren.erase(std::lower_bound(grandParentChildren.begin(), grandParentChildren.end(), parent));
 
-        grandParentNode.children.erase(std::lower_bound(grandParentNode.children.begin(), grandParentNode.children.end(), parent));
-
-        grandParentNode.children.insert(std::lower_bound(grandParentNode.children.begin(), grandParentNode.children.end(), vertex), vertex);
+        grandParentChildren.insert(std::lower_bound(grandParentChildren.begin(), grandParentChildren.end(), vertex), vertex);
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::deleteNode(htd::vertex_t vertex)
 {
-    HTD_ASSERT(node != nullptr)
-
-    auto & parent = node->parent;
+    HTD_ASSERT(containsNode(vertex))
 
-    htd::vertex_t vertex = node->id;
+    htd::vertex_t parent = parentOf(vertex);
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        std::vector<htd::vertex_t> & children = childrenOf(parent);
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
     vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
 
-    nodes_.erase(vertex);
-
-    delete node;
+    releaseNode(vertex);
 
     size_--;
 }
@@ -1496,12 +1597,10 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodeExists_ = original.implementation_->nodeExists_;
+        implementation_->parents_ = original.implementation_->parents_;
+        implementation_->children_ = original.implementation_->children_;
+        implementation_->nodeEdges_ = original.implementation_->nodeEdges_;
 
         implementation_->root_ = original.implementation_->root_;
 
@@ -1551,22 +1650,18 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->createNode(vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->createNode(vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(implementation_->childrenOf(vertex)));
 
                 if (vertex > maximumVertex)
                 {
@@ -1588,6 +1683,11 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
             for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
             {
                 implementation_->edges_->push_back(new htd::Hyperedge(*it));
+
+                for (htd::vertex_t vertex : it->sortedElements())
+                {
+                    implementation_->edgesOf(vertex).push_back(it->id());
+                }
             }
 
             if (!implementation_->edges_->empty())
@@ -1607,15 +1707,15 @@ void htd::Tree::assign(const htd::ITree & original)
 }
 #endif
 
-void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode)
+void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(htd::vertex_t vertex, htd::vertex_t parent, htd::vertex_t grandParent)
 {
-    htd::vertex_t vertex = node.id;
-    htd::vertex_t parent = parentNode.id;
-    htd::vertex_t grandParent = grandParentNode.id;
+    std::vector<htd::id_t> & edges = edgesOf(vertex);
+    std::vector<htd::id_t> & parentEdges = edgesOf(parent);
+    std::vector<htd::id_t> & grandParentEdges = edgesOf(grandParent);
 
     auto relevantEdgePosition = edges_->end();
 
-    for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
+    for (auto it = grandParentEdges.begin(); it != grandParentEdges.end() && relevantEdgePosition == edges_->end(); ++it)
     {
         auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
 
@@ -1627,13 +1727,13 @@ void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node
 
     htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
 
-    parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
+    parentEdges.erase(std::lower_bound(parentEdges.begin(), parentEdges.end(), oldEdgeId));
 
-    grandParentNode.edges.erase(std::lower_bound(grandParentNode.edges.begin(), grandParentNode.edges.end(), oldEdgeId));
+    grandParentEdges.erase(std::lower_bound(grandParentEdges.begin(), grandParentEdges.end(), oldEdgeId));
 
-    node.edges.emplace_back(next_edge_);
+    edges.emplace_back(next_edge_);
 
-    grandParentNode.edges.emplace_back(next_edge_);
+    grandParentEdges.emplace_back(next_edge_);
 
     (*relevantEdgePosition)->setId(next_edge_);
 
@@ -41,7 +41,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::LibraryInstance * const man
 
 }
 
-htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_)
+htd::TreeDecomposition::TreeDecomposition(const htd::TreeDecomposition & original) : htd::LabeledTree::LabeledTree(original), bagContent_(original.bagContent_), inducedEdges_(original.inducedEdges_), inducedHyperedgeIndex_(original.inducedHyperedgeIndex_), inducedEdgesMutex_()
 {
 
 }
@@ -537,6 +537,11 @@ htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHypered
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
     return inducedEdges_.at(vertex);
 }
 
@@ -544,6 +549,64 @@ const htd::FilteredHyperedgeCollection & htd::TreeDecomposition::inducedHyperedg
 {
     HTD_ASSERT(isVertex(vertex))
 
+    if (inducedHyperedgeIndex_)
+    {
+        return lazyInducedHyperedges(vertex);
+    }
+
+    return inducedEdges_.at(vertex);
+}
+
+void htd::TreeDecomposition::evictInducedHyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    if (inducedHyperedgeIndex_)
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        inducedEdges_.erase(vertex);
+    }
+}
+
+void htd::TreeDecomposition::setInducedHyperedgeIndex(const std::shared_ptr<htd::InducedHyperedgeIndex> & index)
+{
+    if (index)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            inducedEdges_.erase(vertex);
+        }
+    }
+    else if (inducedHyperedgeIndex_)
+    {
+        for (htd::vertex_t vertex : vertices())
+        {
+            lazyInducedHyperedges(vertex);
+        }
+    }
+
+    inducedHyperedgeIndex_ = index;
+}
+
+htd::FilteredHyperedgeCollection & htd::TreeDecomposition::lazyInducedHyperedges(htd::vertex_t vertex) const
+{
+    {
+        std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+        if (inducedEdges_.count(vertex) > 0)
+        {
+            return inducedEdges_.at(vertex);
+        }
+    }
+
+    /* Compute the induced hyperedges without holding the lock, so that other vertices can be accessed concurrently. */
+    htd::FilteredHyperedgeCollection inducedEdges = inducedHyperedgeIndex_->inducedHyperedges(bagContent(vertex));
+
+    std::lock_guard<std::mutex> lock(inducedEdgesMutex_);
+
+    inducedEdges_.emplace(vertex, std::move(inducedEdges));
+
     return inducedEdges_.at(vertex);
 }
 
@@ -1087,11 +1150,22 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
     {
         htd::LabeledTree::operator=(original);
 
+        inducedHyperedgeIndex_ = original.inducedHyperedgeIndex_;
+
+        std::lock_guard<std::mutex> lock(original.inducedEdgesMutex_);
+
         for (htd::vertex_t vertex : original.vertexVector())
         {
             bagContent_[vertex] = original.bagContent(vertex);
 
-            inducedEdges_[vertex] = original.inducedHyperedges(vertex);
+            if (original.inducedEdges_.count(vertex) > 0)
+            {
+                inducedEdges_[vertex] = original.inducedEdges_.at(vertex);
+            }
+            else
+            {
+                inducedEdges_.erase(vertex);
+            }
         }
     }
 
@@ -1104,6 +1178,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
     {
         htd::LabeledTree::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
@@ -1121,6 +1197,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
     {
         htd::LabeledTree::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = std::vector<htd::vertex_t>();
@@ -1138,6 +1216,8 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
     {
         htd::LabeledTree::operator=(original);
 
+        inducedHyperedgeIndex_.reset();
+
         for (htd::vertex_t vertex : original.vertices())
         {
             bagContent_[vertex] = original.bagContent(vertex);
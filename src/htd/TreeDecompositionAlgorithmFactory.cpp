@@ -41,7 +41,7 @@ htd::TreeDecompositionAlgorithmFactory::~TreeDecompositionAlgorithmFactory()
 
 htd::ITreeDecompositionAlgorithm * htd::TreeDecompositionAlgorithmFactory::createInstance(void) const
 {
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 }
 
 #endif /* HTD_HTD_TREEDECOMPOSITIONALGORITHMFACTORY_CPP */
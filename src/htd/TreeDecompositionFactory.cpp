@@ -42,9 +42,9 @@ htd::TreeDecompositionFactory::~TreeDecompositionFactory()
 htd::IMutableTreeDecomposition * htd::TreeDecompositionFactory::createInstance(void) const
 {
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-    return constructionTemplate_->clone();
+    return constructionTemplate()->clone();
 #else
-    return constructionTemplate_->cloneMutableTreeDecomposition();
+    return constructionTemplate()->cloneMutableTreeDecomposition();
 #endif
 }
 
@@ -981,6 +981,8 @@ void htd::TriangulationMinimizationOrderingAlgorithm::setManagementInstance(cons
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->orderingAlgorithm_->setManagementInstance(manager);
 }
 
 void htd::TriangulationMinimizationOrderingAlgorithm::setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm)
@@ -45,7 +45,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manager  The management instance to which the current object instance belongs.
      */
     Implementation(const htd::LibraryInstance * const manager)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), iterationCount_(1), nonImprovementLimit_(-1), sharedMaximumBagSize_(nullptr)
     {
 
     }
@@ -57,7 +57,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
      */
     Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
-        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), iterationCount_(1), nonImprovementLimit_(-1), sharedMaximumBagSize_(nullptr)
     {
 
     }
@@ -67,7 +67,7 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *
      *  @param[in] original The original implementation details structure.
      */
-    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_)
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), iterationCount_(original.iterationCount_), nonImprovementLimit_(original.nonImprovementLimit_), sharedMaximumBagSize_(nullptr)
     {
 
     }
@@ -96,6 +96,11 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  The maximum bag size bound which is shared with concurrently running algorithms.
+     */
+    const std::atomic<std::size_t> * sharedMaximumBagSize_;
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -299,7 +304,14 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
             remainingIterations = std::min(remainingIterations, implementation_->nonImprovementLimit_);
         }
 
-        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bestMaxBagSize - 1, remainingIterations);
+        std::size_t currentLimit = bestMaxBagSize - 1;
+
+        if (implementation_->sharedMaximumBagSize_ != nullptr)
+        {
+            currentLimit = std::min(currentLimit, implementation_->sharedMaximumBagSize_->load() - 1);
+        }
+
+        std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult = implementation_->algorithm_->computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, currentLimit, remainingIterations);
 
         htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
 
@@ -444,6 +456,16 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setCompressionEnabled(bool
     implementation_->algorithm_->setCompressionEnabled(compressionEnabled);
 }
 
+const std::atomic<std::size_t> * htd::WidthMinimizingTreeDecompositionAlgorithm::sharedMaximumBagSize(void) const
+{
+    return implementation_->sharedMaximumBagSize_;
+}
+
+void htd::WidthMinimizingTreeDecompositionAlgorithm::setSharedMaximumBagSize(const std::atomic<std::size_t> * sharedMaximumBagSize)
+{
+    implementation_->sharedMaximumBagSize_ = sharedMaximumBagSize;
+}
+
 bool htd::WidthMinimizingTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
 {
     return implementation_->algorithm_->isComputeInducedEdgesEnabled();
@@ -464,6 +486,8 @@ void htd::WidthMinimizingTreeDecompositionAlgorithm::setManagementInstance(const
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
+
+    implementation_->algorithm_->setManagementInstance(manager);
 }
 
 htd::WidthMinimizingTreeDecompositionAlgorithm * htd::WidthMinimizingTreeDecompositionAlgorithm::clone(void) const
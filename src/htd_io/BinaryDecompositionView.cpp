@@ -0,0 +1,842 @@
+/*
+ * File:   BinaryDecompositionView.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYDECOMPOSITIONVIEW_CPP
+#define HTD_IO_BINARYDECOMPOSITIONVIEW_CPP
+
+#include <htd_io/BinaryDecompositionView.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
+
+#include <htd/HyperedgeVector.hpp>
+#include <htd/Label.hpp>
+#include <htd/PathDecompositionFactory.hpp>
+#include <htd/TreeDecompositionFactory.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+static_assert(sizeof(htd::vertex_t) == sizeof(std::uint32_t), "The binary decomposition format requires 32-bit vertex identifiers.");
+static_assert(sizeof(htd_io::BinaryDecompositionView::Header) == 128, "The header of the binary decomposition format must not contain padding.");
+static_assert(sizeof(htd_io::BinaryDecompositionView::LabelRecord) == 32, "The label records of the binary decomposition format must not contain padding.");
+static_assert(sizeof(htd_io::BinaryDecompositionView::LabelEntry) == 24, "The label entries of the binary decomposition format must not contain padding.");
+
+const std::uint32_t htd_io::BinaryDecompositionView::FORMAT_VERSION;
+const std::uint32_t htd_io::BinaryDecompositionView::BYTE_ORDER_MARK;
+const std::uint32_t htd_io::BinaryDecompositionView::PATH_DECOMPOSITION_FLAG;
+
+/**
+ *  Private implementation details of class htd_io::BinaryDecompositionView.
+ */
+struct htd_io::BinaryDecompositionView::Implementation
+{
+    /**
+     *  Range of vertices stored in a section of the file which can be exposed as htd::ConstCollection.
+     */
+    struct VertexRange
+    {
+        /**
+         *  Constructor for a new range of vertices.
+         *
+         *  @param[in] first    A pointer to the first vertex of the range.
+         *  @param[in] last     A pointer past the last vertex of the range.
+         */
+        VertexRange(const htd::vertex_t * first, const htd::vertex_t * last) : first_(first), last_(last)
+        {
+
+        }
+
+        /**
+         *  Getter for the iterator to the first vertex of the range.
+         *
+         *  @return An iterator to the first vertex of the range.
+         */
+        const htd::vertex_t * begin(void) const
+        {
+            return first_;
+        }
+
+        /**
+         *  Getter for the iterator past the last vertex of the range.
+         *
+         *  @return An iterator past the last vertex of the range.
+         */
+        const htd::vertex_t * end(void) const
+        {
+            return last_;
+        }
+
+        /**
+         *  Getter for the size of the range.
+         *
+         *  @return The size of the range.
+         */
+        std::size_t size(void) const
+        {
+            return static_cast<std::size_t>(last_ - first_);
+        }
+
+        /**
+         *  A pointer to the first vertex of the range.
+         */
+        const htd::vertex_t * first_;
+
+        /**
+         *  A pointer past the last vertex of the range.
+         */
+        const htd::vertex_t * last_;
+    };
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] path The path to the file which contains the decomposition.
+     */
+    Implementation(const std::string & path) : file_(path), buffer_(), data_(nullptr), size_(0), header_(nullptr),
+                                               nodes_(nullptr), positions_(nullptr), parents_(nullptr), childOffsets_(nullptr), children_(nullptr),
+                                               bagOffsets_(nullptr), bagContents_(nullptr), hyperedgeIds_(nullptr), hyperedgeOffsets_(nullptr),
+                                               hyperedgeVertices_(nullptr), inducedOffsets_(nullptr), inducedHyperedges_(nullptr),
+                                               labels_(nullptr), labelEntries_(nullptr), text_(nullptr)
+    {
+        if (file_.isOpen())
+        {
+            data_ = file_.data();
+            size_ = file_.size();
+        }
+        else
+        {
+            std::ifstream stream(path, std::ios::in | std::ios::binary);
+
+            if (stream.is_open())
+            {
+                std::vector<char> content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+                /* Use a buffer of 64-bit integers to guarantee the alignment of the sections. */
+                buffer_.resize((content.size() + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+
+                if (!content.empty())
+                {
+                    std::memcpy(buffer_.data(), content.data(), content.size());
+                }
+
+                data_ = reinterpret_cast<const char *>(buffer_.data());
+                size_ = content.size();
+            }
+        }
+
+        if (!initialize())
+        {
+            header_ = nullptr;
+        }
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Determine the locations of the sections of the file and check the consistency of the header.
+     *
+     *  @return True if the file contains a valid decomposition, false otherwise.
+     */
+    bool initialize(void)
+    {
+        if (data_ == nullptr || size_ < sizeof(htd_io::BinaryDecompositionView::Header))
+        {
+            return false;
+        }
+
+        const htd_io::BinaryDecompositionView::Header * header = reinterpret_cast<const htd_io::BinaryDecompositionView::Header *>(data_);
+
+        if (std::memcmp(header->magic, htd_io::BinaryDecompositionView::magic(), sizeof(header->magic)) != 0 ||
+            header->version != htd_io::BinaryDecompositionView::FORMAT_VERSION ||
+            header->byteOrderMark != htd_io::BinaryDecompositionView::BYTE_ORDER_MARK)
+        {
+            return false;
+        }
+
+        std::uint64_t nodeCount = header->nodeCount;
+
+        /* Each node and each hyperedge occupies at least four bytes of the file, so larger counts cannot be valid and
+           checking them first protects the computations below against overflows. The largest node identifier must be
+           smaller than 0xFFFFFFFF, which marks unused entries of the positions section. */
+        if (nodeCount >= size_ || header->hyperedgeCount >= size_ ||
+            (nodeCount > 0 && (header->maximumNodeId >= 0xFFFFFFFF || header->maximumNodeId < nodeCount)))
+        {
+            return false;
+        }
+
+        std::size_t offset = sizeof(htd_io::BinaryDecompositionView::Header);
+
+        std::uint64_t childEntryCount = nodeCount > 0 ? nodeCount - 1 : 0;
+
+        std::uint64_t positionCount = nodeCount > 0 ? header->maximumNodeId + 1 : 0;
+
+        bool ok = section(offset, nodeCount, nodes_) &&
+                  section(offset, positionCount, positions_) &&
+                  section(offset, nodeCount, parents_) &&
+                  section(offset, nodeCount + 1, childOffsets_) &&
+                  section(offset, childEntryCount, children_) &&
+                  section(offset, nodeCount + 1, bagOffsets_) &&
+                  section(offset, header->bagEntryCount, bagContents_) &&
+                  section(offset, header->hyperedgeCount, hyperedgeIds_) &&
+                  section(offset, header->hyperedgeCount + 1, hyperedgeOffsets_) &&
+                  section(offset, header->hyperedgeVertexEntryCount, hyperedgeVertices_) &&
+                  section(offset, nodeCount + 1, inducedOffsets_) &&
+                  section(offset, header->inducedEntryCount, inducedHyperedges_) &&
+                  section(offset, header->labelCount, labels_) &&
+                  section(offset, header->labelEntryCount, labelEntries_) &&
+                  section(offset, header->textLength, text_);
+
+        if (!ok ||
+            !isMonotone(childOffsets_, nodeCount, childEntryCount) ||
+            !isMonotone(bagOffsets_, nodeCount, header->bagEntryCount) ||
+            !isMonotone(inducedOffsets_, nodeCount, header->inducedEntryCount) ||
+            !isMonotone(hyperedgeOffsets_, header->hyperedgeCount, header->hyperedgeVertexEntryCount))
+        {
+            return false;
+        }
+
+        header_ = header;
+
+        return validateNodes() && validateLabels();
+    }
+
+    /**
+     *  Check whether a section of offsets starts at zero, never decreases and ends at the size of the section it refers to.
+     *
+     *  @param[in] offsets  The offsets.
+     *  @param[in] count    The number of ranges described by the offsets, i.e., the number of offsets minus one.
+     *  @param[in] total    The number of elements of the section to which the offsets refer.
+     *
+     *  @return True if the offsets are consistent, false otherwise.
+     */
+    bool isMonotone(const std::uint64_t * offsets, std::uint64_t count, std::uint64_t total) const
+    {
+        if (offsets[0] != 0 || offsets[count] != total)
+        {
+            return false;
+        }
+
+        for (std::uint64_t index = 0; index < count; ++index)
+        {
+            if (offsets[index] > offsets[index + 1])
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  Check that the node identifiers, the positions, the tree structure and the induced hyperedges stored in the
+     *  file are consistent, so that none of them leads to an access outside of the sections of the file.
+     *
+     *  @return True if the nodes form a valid tree, false otherwise.
+     */
+    bool validateNodes(void) const
+    {
+        std::size_t nodeCount = static_cast<std::size_t>(header_->nodeCount);
+
+        if (nodeCount == 0)
+        {
+            return true;
+        }
+
+        std::size_t positionCount = static_cast<std::size_t>(header_->maximumNodeId) + 1;
+
+        for (std::size_t index = 0; index < positionCount; ++index)
+        {
+            if (positions_[index] != 0xFFFFFFFF && (positions_[index] >= nodeCount || nodes_[positions_[index]] != index))
+            {
+                return false;
+            }
+        }
+
+        for (std::size_t index = 0; index < nodeCount; ++index)
+        {
+            if (nodes_[index] == htd::Vertex::UNKNOWN || nodes_[index] >= positionCount || positions_[nodes_[index]] != index)
+            {
+                return false;
+            }
+        }
+
+        if (header_->root >= positionCount || !isVertex(static_cast<htd::vertex_t>(header_->root)) || parents_[position(static_cast<htd::vertex_t>(header_->root))] != htd::Vertex::UNKNOWN)
+        {
+            return false;
+        }
+
+        /* Every child must point back to the node which lists it and must be listed only once. Together with the number
+           of child entries this makes every node except the root a child of exactly one node, and the breadth-first
+           traversal below rules out cycles which are not connected to the root. */
+        std::vector<bool> listed(nodeCount, false);
+
+        for (std::size_t index = 0; index < nodeCount; ++index)
+        {
+            for (std::size_t childIndex = static_cast<std::size_t>(childOffsets_[index]); childIndex < childOffsets_[index + 1]; ++childIndex)
+            {
+                htd::vertex_t child = children_[childIndex];
+
+                if (!isVertex(child) || listed[positions_[child]] || parents_[positions_[child]] != nodes_[index])
+                {
+                    return false;
+                }
+
+                listed[positions_[child]] = true;
+            }
+        }
+
+        std::vector<std::size_t> queue;
+
+        queue.reserve(nodeCount);
+
+        queue.push_back(positions_[header_->root]);
+
+        for (std::size_t index = 0; index < queue.size(); ++index)
+        {
+            std::size_t nodePosition = queue[index];
+
+            for (std::size_t childIndex = static_cast<std::size_t>(childOffsets_[nodePosition]); childIndex < childOffsets_[nodePosition + 1]; ++childIndex)
+            {
+                queue.push_back(positions_[children_[childIndex]]);
+            }
+        }
+
+        if (queue.size() != nodeCount)
+        {
+            return false;
+        }
+
+        for (std::size_t index = 0; index < header_->inducedEntryCount; ++index)
+        {
+            if (inducedHyperedges_[index] >= header_->hyperedgeCount)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  Check that the label records and label entries stored in the file refer only to existing text, entries and nodes.
+     *
+     *  @return True if the labels are consistent, false otherwise.
+     */
+    bool validateLabels(void) const
+    {
+        std::uint64_t textLength = header_->textLength;
+
+        for (std::size_t index = 0; index < header_->labelCount; ++index)
+        {
+            const htd_io::BinaryDecompositionView::LabelRecord & record = labels_[index];
+
+            if (record.nameOffset > textLength || record.nameLength > textLength - record.nameOffset ||
+                record.firstEntry > header_->labelEntryCount || record.entryCount > header_->labelEntryCount - record.firstEntry)
+            {
+                return false;
+            }
+
+            for (std::size_t entryIndex = 0; entryIndex < record.entryCount; ++entryIndex)
+            {
+                const htd_io::BinaryDecompositionView::LabelEntry & entry = labelEntries_[record.firstEntry + entryIndex];
+
+                /* The entries of a label are searched by binary search, so they must be sorted by their node. */
+                if (!isVertex(entry.vertex) || (entryIndex > 0 && labelEntries_[record.firstEntry + entryIndex - 1].vertex >= entry.vertex) ||
+                    entry.textOffset > textLength || entry.textLength > textLength - entry.textOffset)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  Determine the location of a section of the file.
+     *
+     *  @param[in,out] offset   The offset of the section. The offset is updated to the offset of the next section.
+     *  @param[in] count        The number of elements of the section.
+     *  @param[out] target      The pointer to the first element of the section.
+     *
+     *  @return True if the section is located completely within the file, false otherwise.
+     */
+    template <typename T>
+    bool section(std::size_t & offset, std::uint64_t count, const T * & target)
+    {
+        if (count > (size_ - offset) / sizeof(T))
+        {
+            return false;
+        }
+
+        std::size_t length = static_cast<std::size_t>(count) * sizeof(T);
+
+        target = reinterpret_cast<const T *>(data_ + offset);
+
+        offset += (length + 7) / 8 * 8;
+
+        if (offset > size_)
+        {
+            offset = size_;
+        }
+
+        return true;
+    }
+
+    /**
+     *  Check whether a given vertex is a node of the decomposition.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex is a node of the decomposition, false otherwise.
+     */
+    bool isVertex(htd::vertex_t vertex) const
+    {
+        return header_->nodeCount > 0 && vertex <= header_->maximumNodeId && positions_[vertex] != 0xFFFFFFFF;
+    }
+
+    /**
+     *  Getter for the position of a node within the sections of the file.
+     *
+     *  @param[in] vertex   The node.
+     *
+     *  @return The position of the given node within the sections of the file.
+     */
+    std::size_t position(htd::vertex_t vertex) const
+    {
+        HTD_ASSERT(isVertex(vertex))
+
+        return positions_[vertex];
+    }
+
+    /**
+     *  Find the label entry of a node.
+     *
+     *  @param[in] labelName    The name of the label.
+     *  @param[in] vertex       The node.
+     *
+     *  @return A pointer to the label entry of the given node or nullptr if the node is not labeled with the given label.
+     */
+    const htd_io::BinaryDecompositionView::LabelEntry * findLabelEntry(const std::string & labelName, htd::vertex_t vertex) const
+    {
+        for (std::size_t index = 0; index < header_->labelCount; ++index)
+        {
+            const htd_io::BinaryDecompositionView::LabelRecord & record = labels_[index];
+
+            if (record.nameLength == labelName.size() && labelName.compare(0, labelName.size(), text_ + record.nameOffset, record.nameLength) == 0)
+            {
+                const htd_io::BinaryDecompositionView::LabelEntry * first = labelEntries_ + record.firstEntry;
+                const htd_io::BinaryDecompositionView::LabelEntry * last = first + record.entryCount;
+
+                const htd_io::BinaryDecompositionView::LabelEntry * entry =
+                    std::lower_bound(first, last, vertex, [](const htd_io::BinaryDecompositionView::LabelEntry & element, htd::vertex_t value) { return element.vertex < value; });
+
+                return entry != last && entry->vertex == vertex ? entry : nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     *  Create the collection of hyperedges induced by the bag of a node.
+     *
+     *  @param[in] hyperedges   The collection of all induced hyperedges stored in the file.
+     *  @param[in] vertex       The node.
+     *
+     *  @return The collection of hyperedges induced by the bag of the given node.
+     */
+    htd::FilteredHyperedgeCollection inducedHyperedges(const std::shared_ptr<htd::IHyperedgeCollection> & hyperedges, htd::vertex_t vertex) const
+    {
+        std::size_t nodePosition = position(vertex);
+
+        return htd::FilteredHyperedgeCollection(hyperedges, std::vector<htd::index_t>(inducedHyperedges_ + inducedOffsets_[nodePosition], inducedHyperedges_ + inducedOffsets_[nodePosition + 1]));
+    }
+
+    /**
+     *  Create the bag content of a node.
+     *
+     *  @param[in] vertex   The node.
+     *
+     *  @return The bag content of the given node.
+     */
+    std::vector<htd::vertex_t> bagContent(htd::vertex_t vertex) const
+    {
+        std::size_t nodePosition = position(vertex);
+
+        return std::vector<htd::vertex_t>(bagContents_ + bagOffsets_[nodePosition], bagContents_ + bagOffsets_[nodePosition + 1]);
+    }
+
+    /**
+     *  Copy the stored decomposition into the given, empty decomposition.
+     *
+     *  @param[out] decomposition   The decomposition to which the stored decomposition shall be copied.
+     */
+    template <typename DecompositionType>
+    void copyTo(DecompositionType & decomposition) const
+    {
+        std::size_t nodeCount = static_cast<std::size_t>(header_->nodeCount);
+
+        if (nodeCount == 0)
+        {
+            return;
+        }
+
+        std::vector<htd::Hyperedge> hyperedgeContent;
+
+        hyperedgeContent.reserve(static_cast<std::size_t>(header_->hyperedgeCount));
+
+        for (std::size_t index = 0; index < header_->hyperedgeCount; ++index)
+        {
+            hyperedgeContent.emplace_back(hyperedgeIds_[index], std::vector<htd::vertex_t>(hyperedgeVertices_ + hyperedgeOffsets_[index], hyperedgeVertices_ + hyperedgeOffsets_[index + 1]));
+        }
+
+        std::shared_ptr<htd::IHyperedgeCollection> hyperedges = std::make_shared<htd::HyperedgeVector>(std::move(hyperedgeContent));
+
+        std::vector<htd::vertex_t> mapping(nodeCount, htd::Vertex::UNKNOWN);
+
+        std::vector<htd::vertex_t> queue;
+
+        queue.reserve(nodeCount);
+
+        htd::vertex_t root = static_cast<htd::vertex_t>(header_->root);
+
+        mapping[position(root)] = decomposition.insertRoot(bagContent(root), inducedHyperedges(hyperedges, root));
+
+        queue.push_back(root);
+
+        for (std::size_t index = 0; index < queue.size(); ++index)
+        {
+            std::size_t nodePosition = position(queue[index]);
+
+            for (std::size_t childIndex = childOffsets_[nodePosition]; childIndex < childOffsets_[nodePosition + 1]; ++childIndex)
+            {
+                htd::vertex_t child = children_[childIndex];
+
+                mapping[position(child)] = decomposition.addChild(mapping[nodePosition], bagContent(child), inducedHyperedges(hyperedges, child));
+
+                queue.push_back(child);
+            }
+        }
+
+        for (std::size_t index = 0; index < header_->labelCount; ++index)
+        {
+            const htd_io::BinaryDecompositionView::LabelRecord & record = labels_[index];
+
+            std::string labelName(text_ + record.nameOffset, static_cast<std::size_t>(record.nameLength));
+
+            for (std::size_t entryIndex = 0; entryIndex < record.entryCount; ++entryIndex)
+            {
+                const htd_io::BinaryDecompositionView::LabelEntry & entry = labelEntries_[record.firstEntry + entryIndex];
+
+                decomposition.setVertexLabel(labelName, mapping[position(entry.vertex)], new htd::Label<std::string>(std::string(text_ + entry.textOffset, static_cast<std::size_t>(entry.textLength))));
+            }
+        }
+    }
+
+    /**
+     *  The memory-mapped file.
+     */
+    htd_io::MemoryMappedFile file_;
+
+    /**
+     *  The content of the file in case it could not be mapped into memory.
+     */
+    std::vector<std::uint64_t> buffer_;
+
+    /**
+     *  A pointer to the content of the file.
+     */
+    const char * data_;
+
+    /**
+     *  The size of the file in bytes.
+     */
+    std::size_t size_;
+
+    /**
+     *  The header of the file or nullptr if the file does not contain a valid decomposition.
+     */
+    const htd_io::BinaryDecompositionView::Header * header_;
+
+    /**
+     *  The identifiers of the nodes.
+     */
+    const htd::vertex_t * nodes_;
+
+    /**
+     *  The positions of the nodes, indexed by their identifiers.
+     */
+    const std::uint32_t * positions_;
+
+    /**
+     *  The parents of the nodes.
+     */
+    const htd::vertex_t * parents_;
+
+    /**
+     *  The ranges of the nodes within the children section.
+     */
+    const std::uint64_t * childOffsets_;
+
+    /**
+     *  The children of all nodes.
+     */
+    const htd::vertex_t * children_;
+
+    /**
+     *  The ranges of the nodes within the bag contents section.
+     */
+    const std::uint64_t * bagOffsets_;
+
+    /**
+     *  The bag contents of all nodes.
+     */
+    const htd::vertex_t * bagContents_;
+
+    /**
+     *  The identifiers of the induced hyperedges.
+     */
+    const std::uint32_t * hyperedgeIds_;
+
+    /**
+     *  The ranges of the hyperedges within the hyperedge vertices section.
+     */
+    const std::uint64_t * hyperedgeOffsets_;
+
+    /**
+     *  The end-points of all induced hyperedges.
+     */
+    const htd::vertex_t * hyperedgeVertices_;
+
+    /**
+     *  The ranges of the nodes within the induced hyperedges section.
+     */
+    const std::uint64_t * inducedOffsets_;
+
+    /**
+     *  The positions of the hyperedges induced by the bags of the nodes.
+     */
+    const std::uint32_t * inducedHyperedges_;
+
+    /**
+     *  The descriptions of the labels.
+     */
+    const htd_io::BinaryDecompositionView::LabelRecord * labels_;
+
+    /**
+     *  The labels of the nodes.
+     */
+    const htd_io::BinaryDecompositionView::LabelEntry * labelEntries_;
+
+    /**
+     *  The names of the labels and the textual representations of the labels.
+     */
+    const char * text_;
+};
+
+const char * htd_io::BinaryDecompositionView::magic(void)
+{
+    return "htd-bin";
+}
+
+htd_io::BinaryDecompositionView::BinaryDecompositionView(const std::string & path) : implementation_(new Implementation(path))
+{
+
+}
+
+htd_io::BinaryDecompositionView::~BinaryDecompositionView()
+{
+
+}
+
+bool htd_io::BinaryDecompositionView::isOpen(void) const
+{
+    return implementation_->header_ != nullptr;
+}
+
+bool htd_io::BinaryDecompositionView::isPathDecomposition(void) const
+{
+    return isOpen() && (implementation_->header_->flags & PATH_DECOMPOSITION_FLAG) != 0;
+}
+
+std::size_t htd_io::BinaryDecompositionView::graphVertexCount(void) const
+{
+    return isOpen() ? static_cast<std::size_t>(implementation_->header_->graphVertexCount) : 0;
+}
+
+std::size_t htd_io::BinaryDecompositionView::vertexCount(void) const
+{
+    return isOpen() ? static_cast<std::size_t>(implementation_->header_->nodeCount) : 0;
+}
+
+htd::ConstCollection<htd::vertex_t> htd_io::BinaryDecompositionView::vertices(void) const
+{
+    if (!isOpen())
+    {
+        return htd::ConstCollection<htd::vertex_t>();
+    }
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(Implementation::VertexRange(implementation_->nodes_, implementation_->nodes_ + implementation_->header_->nodeCount));
+}
+
+bool htd_io::BinaryDecompositionView::isVertex(htd::vertex_t vertex) const
+{
+    return isOpen() && implementation_->isVertex(vertex);
+}
+
+htd::vertex_t htd_io::BinaryDecompositionView::root(void) const
+{
+    return isOpen() && implementation_->header_->nodeCount > 0 ? static_cast<htd::vertex_t>(implementation_->header_->root) : htd::Vertex::UNKNOWN;
+}
+
+htd::vertex_t htd_io::BinaryDecompositionView::parent(htd::vertex_t vertex) const
+{
+    return implementation_->parents_[implementation_->position(vertex)];
+}
+
+std::size_t htd_io::BinaryDecompositionView::childCount(htd::vertex_t vertex) const
+{
+    std::size_t position = implementation_->position(vertex);
+
+    return static_cast<std::size_t>(implementation_->childOffsets_[position + 1] - implementation_->childOffsets_[position]);
+}
+
+htd::ConstCollection<htd::vertex_t> htd_io::BinaryDecompositionView::children(htd::vertex_t vertex) const
+{
+    std::size_t position = implementation_->position(vertex);
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(Implementation::VertexRange(implementation_->children_ + implementation_->childOffsets_[position],
+                                                                                          implementation_->children_ + implementation_->childOffsets_[position + 1]));
+}
+
+std::size_t htd_io::BinaryDecompositionView::bagSize(htd::vertex_t vertex) const
+{
+    std::size_t position = implementation_->position(vertex);
+
+    return static_cast<std::size_t>(implementation_->bagOffsets_[position + 1] - implementation_->bagOffsets_[position]);
+}
+
+htd::ConstCollection<htd::vertex_t> htd_io::BinaryDecompositionView::bagContent(htd::vertex_t vertex) const
+{
+    std::size_t position = implementation_->position(vertex);
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(Implementation::VertexRange(implementation_->bagContents_ + implementation_->bagOffsets_[position],
+                                                                                          implementation_->bagContents_ + implementation_->bagOffsets_[position + 1]));
+}
+
+std::size_t htd_io::BinaryDecompositionView::minimumBagSize(void) const
+{
+    return isOpen() ? static_cast<std::size_t>(implementation_->header_->minimumBagSize) : 0;
+}
+
+std::size_t htd_io::BinaryDecompositionView::maximumBagSize(void) const
+{
+    return isOpen() ? static_cast<std::size_t>(implementation_->header_->maximumBagSize) : 0;
+}
+
+std::size_t htd_io::BinaryDecompositionView::inducedHyperedgeCount(htd::vertex_t vertex) const
+{
+    std::size_t position = implementation_->position(vertex);
+
+    return static_cast<std::size_t>(implementation_->inducedOffsets_[position + 1] - implementation_->inducedOffsets_[position]);
+}
+
+htd::Hyperedge htd_io::BinaryDecompositionView::inducedHyperedgeAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(index < inducedHyperedgeCount(vertex))
+
+    std::size_t hyperedge = implementation_->inducedHyperedges_[implementation_->inducedOffsets_[implementation_->position(vertex)] + index];
+
+    return htd::Hyperedge(implementation_->hyperedgeIds_[hyperedge],
+                          std::vector<htd::vertex_t>(implementation_->hyperedgeVertices_ + implementation_->hyperedgeOffsets_[hyperedge],
+                                                     implementation_->hyperedgeVertices_ + implementation_->hyperedgeOffsets_[hyperedge + 1]));
+}
+
+std::size_t htd_io::BinaryDecompositionView::labelCount(void) const
+{
+    return isOpen() ? static_cast<std::size_t>(implementation_->header_->labelCount) : 0;
+}
+
+std::string htd_io::BinaryDecompositionView::labelNameAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < labelCount())
+
+    const LabelRecord & record = implementation_->labels_[index];
+
+    return std::string(implementation_->text_ + record.nameOffset, static_cast<std::size_t>(record.nameLength));
+}
+
+bool htd_io::BinaryDecompositionView::isLabeledVertex(const std::string & labelName, htd::vertex_t vertex) const
+{
+    return isOpen() && implementation_->findLabelEntry(labelName, vertex) != nullptr;
+}
+
+std::string htd_io::BinaryDecompositionView::vertexLabel(const std::string & labelName, htd::vertex_t vertex) const
+{
+    const LabelEntry * entry = isOpen() ? implementation_->findLabelEntry(labelName, vertex) : nullptr;
+
+    if (entry == nullptr)
+    {
+        throw std::logic_error("std::string htd_io::BinaryDecompositionView::vertexLabel(const std::string &, htd::vertex_t) const");
+    }
+
+    return std::string(implementation_->text_ + entry->textOffset, static_cast<std::size_t>(entry->textLength));
+}
+
+htd::IMutableTreeDecomposition * htd_io::BinaryDecompositionView::createTreeDecomposition(const htd::LibraryInstance * const manager) const
+{
+    if (!isOpen())
+    {
+        return nullptr;
+    }
+
+    htd::IMutableTreeDecomposition * ret = manager->treeDecompositionFactory().createInstance();
+
+    implementation_->copyTo(*ret);
+
+    return ret;
+}
+
+htd::IMutablePathDecomposition * htd_io::BinaryDecompositionView::createPathDecomposition(const htd::LibraryInstance * const manager) const
+{
+    if (!isPathDecomposition())
+    {
+        return nullptr;
+    }
+
+    htd::IMutablePathDecomposition * ret = manager->pathDecompositionFactory().createInstance();
+
+    implementation_->copyTo(*ret);
+
+    return ret;
+}
+
+#endif /* HTD_IO_BINARYDECOMPOSITIONVIEW_CPP */
@@ -0,0 +1,263 @@
+/*
+ * File:   BinaryFormatExporter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_BINARYFORMATEXPORTER_CPP
+#define HTD_IO_BINARYFORMATEXPORTER_CPP
+
+#include <htd_io/BinaryFormatExporter.hpp>
+#include <htd_io/BinaryDecompositionView.hpp>
+#include <htd_io/StreamingWriter.hpp>
+
+#include <htd/IPathDecomposition.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+namespace htd_io
+{
+    /**
+     *  Write the content of the given vector as a section of the binary decomposition format.
+     *
+     *  @param[in] values   The values which shall be written.
+     *  @param[in] writer   The writer which shall be used for the output.
+     */
+    template <typename T>
+    void writeBinarySection(const std::vector<T> & values, htd_io::StreamingWriter & writer)
+    {
+        static const char padding[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+        std::size_t length = values.size() * sizeof(T);
+
+        if (length > 0)
+        {
+            writer.write(reinterpret_cast<const char *>(values.data()), length);
+        }
+
+        if (length % 8 != 0)
+        {
+            writer.write(padding, 8 - length % 8);
+        }
+    }
+
+    /**
+     *  Write the given tree decomposition in the binary decomposition format.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be written.
+     *  @param[in] graphVertexCount The number of vertices of the decomposed graph.
+     *  @param[in] outputStream     The output stream to which the decomposition shall be written.
+     */
+    void writeBinaryFormat(const htd::ITreeDecomposition & decomposition, std::size_t graphVertexCount, std::ostream & outputStream)
+    {
+        std::size_t nodeCount = decomposition.vertexCount();
+
+        std::vector<std::uint32_t> nodes;
+        std::vector<std::uint32_t> parents;
+        std::vector<std::uint64_t> childOffsets;
+        std::vector<std::uint32_t> children;
+        std::vector<std::uint64_t> bagOffsets;
+        std::vector<std::uint32_t> bagContents;
+        std::vector<std::uint32_t> hyperedgeIds;
+        std::vector<std::uint64_t> hyperedgeOffsets;
+        std::vector<std::uint32_t> hyperedgeVertices;
+        std::vector<std::uint64_t> inducedOffsets;
+        std::vector<std::uint32_t> inducedHyperedges;
+        std::vector<htd_io::BinaryDecompositionView::LabelRecord> labels;
+        std::vector<htd_io::BinaryDecompositionView::LabelEntry> labelEntries;
+        std::vector<char> text;
+
+        nodes.reserve(nodeCount);
+        parents.reserve(nodeCount);
+        childOffsets.reserve(nodeCount + 1);
+        bagOffsets.reserve(nodeCount + 1);
+        inducedOffsets.reserve(nodeCount + 1);
+
+        childOffsets.push_back(0);
+        bagOffsets.push_back(0);
+        inducedOffsets.push_back(0);
+        hyperedgeOffsets.push_back(0);
+
+        std::unordered_map<htd::id_t, std::uint32_t> hyperedgePositions;
+
+        for (htd::vertex_t node : decomposition.vertices())
+        {
+            nodes.push_back(node);
+
+            parents.push_back(decomposition.isRoot(node) ? htd::Vertex::UNKNOWN : decomposition.parent(node));
+
+            for (htd::vertex_t child : decomposition.children(node))
+            {
+                children.push_back(child);
+            }
+
+            childOffsets.push_back(children.size());
+
+            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+
+            bagContents.insert(bagContents.end(), bag.begin(), bag.end());
+
+            bagOffsets.push_back(bagContents.size());
+
+            for (const htd::Hyperedge & hyperedge : decomposition.inducedHyperedges(node))
+            {
+                auto position = hyperedgePositions.find(hyperedge.id());
+
+                if (position == hyperedgePositions.end())
+                {
+                    position = hyperedgePositions.emplace(hyperedge.id(), static_cast<std::uint32_t>(hyperedgeIds.size())).first;
+
+                    hyperedgeIds.push_back(hyperedge.id());
+
+                    hyperedgeVertices.insert(hyperedgeVertices.end(), hyperedge.elements().begin(), hyperedge.elements().end());
+
+                    hyperedgeOffsets.push_back(hyperedgeVertices.size());
+                }
+
+                inducedHyperedges.push_back(position->second);
+            }
+
+            inducedOffsets.push_back(inducedHyperedges.size());
+        }
+
+        std::vector<std::uint32_t> positions(nodes.empty() ? 0 : *std::max_element(nodes.begin(), nodes.end()) + 1, 0xFFFFFFFF);
+
+        for (std::size_t index = 0; index < nodes.size(); ++index)
+        {
+            positions[nodes[index]] = static_cast<std::uint32_t>(index);
+        }
+
+        for (const std::string & labelName : decomposition.labelNames())
+        {
+            htd_io::BinaryDecompositionView::LabelRecord record;
+
+            record.nameOffset = text.size();
+            record.nameLength = labelName.size();
+            record.firstEntry = labelEntries.size();
+
+            text.insert(text.end(), labelName.begin(), labelName.end());
+
+            std::vector<htd::vertex_t> labeledNodes;
+
+            for (htd::vertex_t node : nodes)
+            {
+                if (decomposition.isLabeledVertex(labelName, node))
+                {
+                    labeledNodes.push_back(node);
+                }
+            }
+
+            std::sort(labeledNodes.begin(), labeledNodes.end());
+
+            for (htd::vertex_t node : labeledNodes)
+            {
+                std::ostringstream labelText;
+
+                decomposition.vertexLabel(labelName, node).print(labelText);
+
+                const std::string & content = labelText.str();
+
+                htd_io::BinaryDecompositionView::LabelEntry entry;
+
+                entry.vertex = node;
+                entry.reserved = 0;
+                entry.textOffset = text.size();
+                entry.textLength = content.size();
+
+                text.insert(text.end(), content.begin(), content.end());
+
+                labelEntries.push_back(entry);
+            }
+
+            record.entryCount = labelEntries.size() - record.firstEntry;
+
+            labels.push_back(record);
+        }
+
+        htd_io::BinaryDecompositionView::Header header;
+
+        std::memcpy(header.magic, htd_io::BinaryDecompositionView::magic(), sizeof(header.magic));
+
+        header.version = htd_io::BinaryDecompositionView::FORMAT_VERSION;
+        header.byteOrderMark = htd_io::BinaryDecompositionView::BYTE_ORDER_MARK;
+        header.flags = dynamic_cast<const htd::IPathDecomposition *>(&decomposition) != nullptr ? htd_io::BinaryDecompositionView::PATH_DECOMPOSITION_FLAG : 0;
+        header.reserved = 0;
+        header.graphVertexCount = graphVertexCount;
+        header.nodeCount = nodeCount;
+        header.maximumNodeId = positions.empty() ? 0 : positions.size() - 1;
+        header.root = nodeCount > 0 ? decomposition.root() : htd::Vertex::UNKNOWN;
+        header.bagEntryCount = bagContents.size();
+        header.hyperedgeCount = hyperedgeIds.size();
+        header.hyperedgeVertexEntryCount = hyperedgeVertices.size();
+        header.inducedEntryCount = inducedHyperedges.size();
+        header.labelCount = labels.size();
+        header.labelEntryCount = labelEntries.size();
+        header.textLength = text.size();
+        header.minimumBagSize = nodeCount > 0 ? decomposition.minimumBagSize() : 0;
+        header.maximumBagSize = nodeCount > 0 ? decomposition.maximumBagSize() : 0;
+
+        htd_io::StreamingWriter writer(outputStream);
+
+        writer.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+        writeBinarySection(nodes, writer);
+        writeBinarySection(positions, writer);
+        writeBinarySection(parents, writer);
+        writeBinarySection(childOffsets, writer);
+        writeBinarySection(children, writer);
+        writeBinarySection(bagOffsets, writer);
+        writeBinarySection(bagContents, writer);
+        writeBinarySection(hyperedgeIds, writer);
+        writeBinarySection(hyperedgeOffsets, writer);
+        writeBinarySection(hyperedgeVertices, writer);
+        writeBinarySection(inducedOffsets, writer);
+        writeBinarySection(inducedHyperedges, writer);
+        writeBinarySection(labels, writer);
+        writeBinarySection(labelEntries, writer);
+        writeBinarySection(text, writer);
+    }
+}
+
+htd_io::BinaryFormatExporter::BinaryFormatExporter(void)
+{
+
+}
+
+htd_io::BinaryFormatExporter::~BinaryFormatExporter()
+{
+
+}
+
+void htd_io::BinaryFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    writeBinaryFormat(decomposition, graph.vertexCount(), outputStream);
+}
+
+void htd_io::BinaryFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    writeBinaryFormat(decomposition, graph.vertexCount(), outputStream);
+}
+
+#endif /* HTD_IO_BINARYFORMATEXPORTER_CPP */
@@ -28,10 +28,84 @@
 #include <htd_io/GrFormatImporter.hpp>
 
 #include <htd/MultiGraphFactory.hpp>
+#include <htd/PhaseTimer.hpp>
+#include <htd_io/MemoryMappedFile.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <iterator>
+#include <limits>
 #include <string>
 #include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Parse the non-negative decimal number starting at the given position.
+     *
+     *  @param[in,out] position The position of the first digit of the number. After parsing, it points to the first character after the number.
+     *  @param[in] end          The end of the input.
+     *  @param[out] value       The parsed number.
+     *
+     *  @return True if at least one digit was read and the number fits into the value type, false otherwise.
+     */
+    bool parseNumber(const char * & position, const char * end, std::size_t & value)
+    {
+        const char * start = position;
+
+        std::size_t result = 0;
+
+        while (position != end && *position >= '0' && *position <= '9')
+        {
+            std::size_t digit = static_cast<std::size_t>(*position - '0');
+
+            if (result > (std::numeric_limits<std::size_t>::max() - digit) / 10)
+            {
+                return false;
+            }
+
+            result = result * 10 + digit;
+
+            ++position;
+        }
+
+        value = result;
+
+        return position != start;
+    }
+
+    /**
+     *  Parse the problem line of the form "p tw <vertex count> <edge count>".
+     *
+     *  @param[in] position     The position of the first character of the line.
+     *  @param[in] lineEnd      The end of the line, excluding the line break.
+     *  @param[out] vertexCount The number of vertices.
+     *  @param[out] edgeCount   The number of edges.
+     *
+     *  @return True if the line is a valid problem line, false otherwise.
+     */
+    bool parseProblemLine(const char * position, const char * lineEnd, std::size_t & vertexCount, std::size_t & edgeCount)
+    {
+        if (lineEnd - position < 5 || std::memcmp(position, "p tw ", 5) != 0)
+        {
+            return false;
+        }
+
+        position += 5;
+
+        if (!parseNumber(position, lineEnd, vertexCount) || position == lineEnd || *position != ' ')
+        {
+            return false;
+        }
+
+        ++position;
+
+        return parseNumber(position, lineEnd, edgeCount) && position == lineEnd;
+    }
+}
 
 /**
  *  Private implementation details of class htd_io::GrFormatImporter.
@@ -57,6 +131,161 @@ struct htd_io::GrFormatImporter::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Parse the information stored in the given buffer.
+     *
+     *  The buffer is tokenized in place, i.e., without creating intermediate strings for its lines.
+     *
+     *  @param[in] begin        A pointer to the first character of the buffer.
+     *  @param[in] end          A pointer past the last character of the buffer.
+     *  @param[out] vertexCount The number of vertices.
+     *  @param[out] edges       The edges in the order in which they occur in the buffer.
+     *
+     *  @return True if the buffer contains a valid instance, false otherwise.
+     */
+    bool parse(const char * begin, const char * end, std::size_t & vertexCount, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) const
+    {
+        std::size_t edgeCount = 0;
+
+        bool firstLine = true;
+
+        bool error = false;
+
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        const char * position = begin;
+
+        while (!error && position != end && !managementInstance.isTerminated())
+        {
+            const char * lineEnd = static_cast<const char *>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+
+            const char * nextLine = lineEnd != nullptr ? lineEnd + 1 : end;
+
+            if (lineEnd == nullptr)
+            {
+                lineEnd = end;
+            }
+
+            if (lineEnd != position && *(lineEnd - 1) == '\r')
+            {
+                --lineEnd;
+            }
+
+            if (lineEnd == position)
+            {
+                error = true;
+            }
+            else if (*position != 'c')
+            {
+                if (firstLine)
+                {
+                    error = !parseProblemLine(position, lineEnd, vertexCount, edgeCount);
+
+                    if (!error)
+                    {
+                        /* The edge count is only a hint, so the reserved memory is bounded by the size of the input. */
+                        edges.reserve(std::min(edgeCount, static_cast<std::size_t>(end - begin) / 2));
+
+                        firstLine = false;
+                    }
+                }
+                else
+                {
+                    std::size_t vertex1 = 0;
+                    std::size_t vertex2 = 0;
+
+                    error = !parseNumber(position, lineEnd, vertex1) || position == lineEnd || *position != ' ';
+
+                    if (!error)
+                    {
+                        ++position;
+
+                        error = !parseNumber(position, lineEnd, vertex2) || position != lineEnd ||
+                                vertex1 < htd::Vertex::FIRST || vertex1 > vertexCount ||
+                                vertex2 < htd::Vertex::FIRST || vertex2 > vertexCount;
+                    }
+
+                    if (!error)
+                    {
+                        edges.emplace_back(static_cast<htd::vertex_t>(vertex1), static_cast<htd::vertex_t>(vertex2));
+                    }
+
+                    if (!error)
+                    {
+                        --edgeCount;
+                    }
+                }
+            }
+
+            position = nextLine;
+        }
+
+        if (edgeCount != 0 && !managementInstance.isTerminated())
+        {
+            error = true;
+        }
+
+        return !firstLine && !error;
+    }
+
+    /**
+     *  Create a new IMultiGraph instance based on the information stored in the given buffer.
+     *
+     *  The edges are added to the new instance at once after the whole buffer was parsed.
+     *
+     *  @param[in] begin    A pointer to the first character of the buffer.
+     *  @param[in] end      A pointer past the last character of the buffer.
+     *
+     *  @return A new IMultiGraph instance based on the information stored in the given buffer.
+     */
+    htd::IMultiGraph * import(const char * begin, const char * end) const
+    {
+        HTD_STATISTICS(htd::PhaseTimer phaseTimer(*managementInstance_, htd::Statistics::IMPORT_PHASE);)
+
+        std::size_t vertexCount = 0;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+        htd::IMutableMultiGraph * ret = nullptr;
+
+        if (parse(begin, end, vertexCount, edges))
+        {
+            ret = managementInstance_->multiGraphFactory().createInstance();
+
+            ret->addVertices(vertexCount);
+
+            ret->addEdges(edges);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Create a new CompressedMultiHypergraph instance based on the information stored in the given buffer.
+     *
+     *  @param[in] begin    A pointer to the first character of the buffer.
+     *  @param[in] end      A pointer past the last character of the buffer.
+     *
+     *  @return A new CompressedMultiHypergraph instance based on the information stored in the given buffer.
+     */
+    htd::CompressedMultiHypergraph * importCompressed(const char * begin, const char * end) const
+    {
+        HTD_STATISTICS(htd::PhaseTimer phaseTimer(*managementInstance_, htd::Statistics::IMPORT_PHASE);)
+
+        std::size_t vertexCount = 0;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+        htd::CompressedMultiHypergraph * ret = nullptr;
+
+        if (parse(begin, end, vertexCount, edges))
+        {
+            ret = new htd::CompressedMultiHypergraph(managementInstance_, vertexCount, edges);
+        }
+
+        return ret;
+    }
 };
 
 htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -71,6 +300,13 @@ htd_io::GrFormatImporter::~GrFormatImporter(void)
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
 {
+    htd_io::MemoryMappedFile file(path);
+
+    if (file.isOpen())
+    {
+        return implementation_->import(file.data(), file.data() + file.size());
+    }
+
     std::ifstream stream(path);
 
     return import(stream);
@@ -78,6 +314,8 @@ htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) co
 
 htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
 {
+    HTD_STATISTICS(htd::PhaseTimer phaseTimer(*(implementation_->managementInstance_), htd::Statistics::IMPORT_PHASE);)
+
     std::size_t vertexCount = 0;
     std::size_t edgeCount = 0;
 
@@ -187,4 +425,32 @@ htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
     return ret;
 }
 
+htd::CompressedMultiHypergraph * htd_io::GrFormatImporter::importCompressed(const std::string & path) const
+{
+    htd_io::MemoryMappedFile file(path);
+
+    if (file.isOpen())
+    {
+        return implementation_->importCompressed(file.data(), file.data() + file.size());
+    }
+
+    std::ifstream stream(path);
+
+    return importCompressed(stream);
+}
+
+htd::CompressedMultiHypergraph * htd_io::GrFormatImporter::importCompressed(std::istream & stream) const
+{
+    htd::CompressedMultiHypergraph * ret = nullptr;
+
+    if (stream.good())
+    {
+        std::string buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        ret = implementation_->importCompressed(buffer.data(), buffer.data() + buffer.size());
+    }
+
+    return ret;
+}
+
 #endif /* HTD_IO_GRFORMATIMPORTER_CPP */
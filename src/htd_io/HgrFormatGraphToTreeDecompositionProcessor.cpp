@@ -133,6 +133,105 @@ struct htd_io::HgrFormatGraphToTreeDecompositionProcessor::Implementation
             callback(fitness);
         }
     }
+
+    /**
+     *  Decompose the given input graph and write the decomposition to the given output stream.
+     *
+     *  @param[in] graph        The input graph or nullptr if the input could not be parsed. The graph is deleted afterwards.
+     *  @param[in] outputStream The output stream to which the decomposition shall be written.
+     */
+    void process(htd::IMultiHypergraph * graph, std::ostream & outputStream) const
+    {
+        if (graph != nullptr)
+        {
+            invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
+
+            htd::ITreeDecompositionAlgorithm * algorithm = managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
+
+            htd::ITreeDecomposition * decomposition = nullptr;
+
+            if (preprocessor_ != nullptr)
+            {
+                htd::IPreprocessedGraph * preprocessedGraph = preprocessor_->prepare(*graph);
+
+                HTD_ASSERT(preprocessedGraph != nullptr)
+
+                invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
+
+                htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+                if (customizedAlgorithm != nullptr)
+                {
+                    decomposition = customizedAlgorithm->computeDecomposition(*graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
+                                                                                                              const htd::ITreeDecomposition & decomposition,
+                                                                                                              const htd::FitnessEvaluation & fitness)
+                    {
+                        HTD_UNUSED(graph)
+                        HTD_UNUSED(decomposition)
+
+                        invokeDecompositionCallbacks(fitness);
+                    });
+                }
+                else
+                {
+                    decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
+
+                    if (decomposition != nullptr)
+                    {
+                        invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    }
+                }
+
+                delete preprocessedGraph;
+            }
+            else
+            {
+                htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
+
+                if (customizedAlgorithm != nullptr)
+                {
+                    decomposition = customizedAlgorithm->computeDecomposition(*graph, [&](const htd::IMultiHypergraph & graph,
+                                                                                          const htd::ITreeDecomposition & decomposition,
+                                                                                          const htd::FitnessEvaluation & fitness)
+                    {
+                        HTD_UNUSED(graph)
+                        HTD_UNUSED(decomposition)
+
+                        invokeDecompositionCallbacks(fitness);
+                    });
+                }
+                else
+                {
+                    decomposition = algorithm->computeDecomposition(*graph);
+
+                    if (decomposition != nullptr)
+                    {
+                        invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
+                    }
+                }
+            }
+
+            delete algorithm;
+
+            if (decomposition != nullptr)
+            {
+                if (exporter_ != nullptr)
+                {
+                    HTD_STATISTICS(htd::PhaseTimer phaseTimer(*managementInstance_, htd::Statistics::EXPORT_PHASE);)
+
+                    exporter_->write(*decomposition, *graph, outputStream);
+                }
+
+                delete decomposition;
+            }
+
+            delete graph;
+        }
+        else
+        {
+            invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
+        }
+    }
 };
 
 htd_io::HgrFormatGraphToTreeDecompositionProcessor::HgrFormatGraphToTreeDecompositionProcessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -147,17 +246,16 @@ htd_io::HgrFormatGraphToTreeDecompositionProcessor::~HgrFormatGraphToTreeDecompo
 
 void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, const std::string & outputFile) const
 {
-    std::ifstream inputStream(inputFile);
     std::ofstream outputStream(outputFile);
 
-    process(inputStream, outputStream);
+    process(inputFile, outputStream);
 }
 
 void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(const std::string & inputFile, std::ostream & outputStream) const
 {
-    std::ifstream inputStream(inputFile);
+    htd_io::HgrFormatImporter importer(implementation_->managementInstance_);
 
-    process(inputStream, outputStream);
+    implementation_->process(importer.import(inputFile), outputStream);
 }
 
 void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(std::istream & inputStream, const std::string & outputFile) const
@@ -171,95 +269,7 @@ void htd_io::HgrFormatGraphToTreeDecompositionProcessor::process(std::istream &
 {
     htd_io::HgrFormatImporter importer(implementation_->managementInstance_);
 
-    htd::IMultiHypergraph * graph = importer.import(inputStream);
-
-    if (graph != nullptr)
-    {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::OK, graph->vertexCount(), graph->edgeCount());
-
-        htd::ITreeDecompositionAlgorithm * algorithm = implementation_->managementInstance_->treeDecompositionAlgorithmFactory().createInstance();
-
-        htd::ITreeDecomposition * decomposition = nullptr;
-
-        if (implementation_->preprocessor_ != nullptr)
-        {
-            htd::IPreprocessedGraph * preprocessedGraph = implementation_->preprocessor_->prepare(*graph);
-
-            HTD_ASSERT(preprocessedGraph != nullptr)
-
-            implementation_->invokePreprocessingCallbacks(preprocessedGraph->vertexCount(), preprocessedGraph->edgeCount());
-
-            htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
-
-            if (customizedAlgorithm != nullptr)
-            {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, *preprocessedGraph, [&](const htd::IMultiHypergraph & graph,
-                                                                                                          const htd::ITreeDecomposition & decomposition,
-                                                                                                          const htd::FitnessEvaluation & fitness)
-                {
-                    HTD_UNUSED(graph)
-                    HTD_UNUSED(decomposition)
-
-                    implementation_->invokeDecompositionCallbacks(fitness);
-                });
-            }
-            else
-            {
-                decomposition = algorithm->computeDecomposition(*graph, *preprocessedGraph);
-
-                if (decomposition != nullptr)
-                {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
-                }
-            }
-
-            delete preprocessedGraph;
-        }
-        else
-        {
-            htd::ICustomizedTreeDecompositionAlgorithm * customizedAlgorithm = dynamic_cast<htd::ICustomizedTreeDecompositionAlgorithm *>(algorithm);
-
-            if (customizedAlgorithm != nullptr)
-            {
-                decomposition = customizedAlgorithm->computeDecomposition(*graph, [&](const htd::IMultiHypergraph & graph,
-                                                                                      const htd::ITreeDecomposition & decomposition,
-                                                                                      const htd::FitnessEvaluation & fitness)
-                {
-                    HTD_UNUSED(graph)
-                    HTD_UNUSED(decomposition)
-
-                    implementation_->invokeDecompositionCallbacks(fitness);
-                });
-            }
-            else
-            {
-                decomposition = algorithm->computeDecomposition(*graph);
-
-                if (decomposition != nullptr)
-                {
-                    implementation_->invokeDecompositionCallbacks(htd::FitnessEvaluation(1, -(static_cast<double>(decomposition->maximumBagSize()))));
-                }
-            }
-        }
-
-        delete algorithm;
-
-        if (decomposition != nullptr)
-        {
-            if (implementation_->exporter_ != nullptr)
-            {
-                implementation_->exporter_->write(*decomposition, *graph, outputStream);
-            }
-
-            delete decomposition;
-        }
-
-        delete graph;
-    }
-    else
-    {
-        implementation_->invokeParsingCallbacks(htd_io::ParsingResult::ERROR, 0, 0);
-    }
+    implementation_->process(importer.import(inputStream), outputStream);
 }
 
 void htd_io::HgrFormatGraphToTreeDecompositionProcessor::setPreprocessor(htd::IGraphPreprocessor * preprocessor)
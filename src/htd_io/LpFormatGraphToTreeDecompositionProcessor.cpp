@@ -249,6 +249,8 @@ void htd_io::LpFormatGraphToTreeDecompositionProcessor::process(std::istream & i
         {
             if (implementation_->exporter_ != nullptr)
             {
+                HTD_STATISTICS(htd::PhaseTimer phaseTimer(*(implementation_->managementInstance_), htd::Statistics::EXPORT_PHASE);)
+
                 implementation_->exporter_->write(*decomposition, *graph, outputStream);
             }
 
@@ -27,6 +27,8 @@
 
 #include <htd_io/LpFormatImporter.hpp>
 
+#include <htd/PhaseTimer.hpp>
+
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -83,6 +85,8 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
 
 htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::import(std::istream & stream) const
 {
+    HTD_STATISTICS(htd::PhaseTimer phaseTimer(*(implementation_->managementInstance_), htd::Statistics::IMPORT_PHASE);)
+
     bool error = false;
 
     htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
@@ -0,0 +1,159 @@
+/*
+ * File:   MemoryMappedFile.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_IO_MEMORYMAPPEDFILE_CPP
+#define HTD_IO_MEMORYMAPPEDFILE_CPP
+
+#include <htd_io/MemoryMappedFile.hpp>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define HTD_IO_USE_POSIX_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_io::MemoryMappedFile.
+ */
+struct htd_io::MemoryMappedFile::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] path The path to the file which shall be mapped into memory.
+     */
+    Implementation(const std::string & path) : data_(nullptr), size_(0)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+        if (file != INVALID_HANDLE_VALUE)
+        {
+            LARGE_INTEGER fileSize;
+
+            if (GetFileType(file) == FILE_TYPE_DISK && GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+            {
+                HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+                if (mapping != nullptr)
+                {
+                    void * view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+                    if (view != nullptr)
+                    {
+                        data_ = static_cast<const char *>(view);
+
+                        size_ = static_cast<std::size_t>(fileSize.QuadPart);
+                    }
+
+                    CloseHandle(mapping);
+                }
+            }
+
+            CloseHandle(file);
+        }
+#elif defined(HTD_IO_USE_POSIX_MMAP)
+        int file = open(path.c_str(), O_RDONLY);
+
+        if (file >= 0)
+        {
+            struct stat status;
+
+            if (fstat(file, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+            {
+                void * view = mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+                if (view != MAP_FAILED)
+                {
+                    /* The file is parsed front to back, so aggressive read-ahead pays off. */
+                    madvise(view, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL);
+
+                    data_ = static_cast<const char *>(view);
+
+                    size_ = static_cast<std::size_t>(status.st_size);
+                }
+            }
+
+            close(file);
+        }
+#else
+        static_cast<void>(path);
+#endif
+    }
+
+    virtual ~Implementation()
+    {
+        if (data_ != nullptr)
+        {
+#if defined(_WIN32)
+            UnmapViewOfFile(data_);
+#elif defined(HTD_IO_USE_POSIX_MMAP)
+            munmap(const_cast<char *>(data_), size_);
+#endif
+        }
+    }
+
+    /**
+     *  A pointer to the first character of the mapped file or nullptr if the file is not open.
+     */
+    const char * data_;
+
+    /**
+     *  The size of the mapped file in bytes.
+     */
+    std::size_t size_;
+};
+
+htd_io::MemoryMappedFile::MemoryMappedFile(const std::string & path) : implementation_(new Implementation(path))
+{
+
+}
+
+htd_io::MemoryMappedFile::~MemoryMappedFile(void)
+{
+
+}
+
+bool htd_io::MemoryMappedFile::isOpen(void) const
+{
+    return implementation_->data_ != nullptr;
+}
+
+const char * htd_io::MemoryMappedFile::data(void) const
+{
+    return implementation_->data_;
+}
+
+std::size_t htd_io::MemoryMappedFile::size(void) const
+{
+    return implementation_->size_;
+}
+
+#endif /* HTD_IO_MEMORYMAPPEDFILE_CPP */
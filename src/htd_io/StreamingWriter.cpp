@@ -0,0 +1,304 @@
+/*
+ * File:   StreamingWriter.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef HTD_IO_STREAMINGWRITER_CPP
+#define HTD_IO_STREAMINGWRITER_CPP
+
+#include <htd_io/StreamingWriter.hpp>
+
+#include <cerrno>
+#include <vector>
+
+#if defined(_WIN32)
+#include <io.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#ifdef HTD_IO_USE_ZLIB
+#include <zlib.h>
+#endif
+
+/**
+ *  Private implementation details of class htd_io::StreamingWriter.
+ */
+struct htd_io::StreamingWriter::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] outputStream     The output stream to which the output shall be written or nullptr if a file descriptor is used.
+     *  @param[in] fileDescriptor   The file descriptor to which the output shall be written if no output stream is used.
+     *  @param[in] compress         A boolean flag whether the output shall be compressed in gzip format.
+     *  @param[in] bufferSize       The size of the write buffer in bytes.
+     */
+    Implementation(std::ostream * outputStream, int fileDescriptor, bool compress, std::size_t bufferSize) : outputStream_(outputStream), fileDescriptor_(fileDescriptor), compress_(compress), good_(true), buffer_(bufferSize > 64 ? bufferSize : 64), compressedBuffer_()
+    {
+        if (compress_)
+        {
+#ifdef HTD_IO_USE_ZLIB
+            compressedBuffer_.resize(buffer_.size());
+
+            stream_.zalloc = Z_NULL;
+            stream_.zfree = Z_NULL;
+            stream_.opaque = Z_NULL;
+
+            /* A window size of 15 + 16 selects the gzip container format. */
+            good_ = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+#else
+            good_ = false;
+#endif
+        }
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The output stream to which the output shall be written or nullptr if a file descriptor is used.
+     */
+    std::ostream * outputStream_;
+
+    /**
+     *  The file descriptor to which the output shall be written if no output stream is used.
+     */
+    int fileDescriptor_;
+
+    /**
+     *  A boolean flag whether the output shall be compressed in gzip format.
+     */
+    bool compress_;
+
+    /**
+     *  A boolean flag indicating whether all output so far was written successfully.
+     */
+    bool good_;
+
+    /**
+     *  The write buffer.
+     */
+    std::vector<char> buffer_;
+
+    /**
+     *  The buffer holding the compressed output.
+     */
+    std::vector<char> compressedBuffer_;
+
+#ifdef HTD_IO_USE_ZLIB
+    /**
+     *  The state of the compressor.
+     */
+    z_stream stream_;
+#endif
+
+    /**
+     *  Pass the given characters to the target without compressing them.
+     *
+     *  @param[in] data     A pointer to the first character.
+     *  @param[in] length   The number of characters.
+     */
+    void writeToTarget(const char * data, std::size_t length)
+    {
+        if (outputStream_ != nullptr)
+        {
+            outputStream_->write(data, static_cast<std::streamsize>(length));
+
+            if (!outputStream_->good())
+            {
+                good_ = false;
+            }
+        }
+        else
+        {
+            while (length > 0 && good_)
+            {
+#if defined(_WIN32)
+                int written = _write(fileDescriptor_, data, static_cast<unsigned int>(length > 0x40000000 ? 0x40000000 : length));
+#elif defined(__unix__) || defined(__APPLE__)
+                ssize_t written = ::write(fileDescriptor_, data, length);
+#else
+                long written = -1;
+#endif
+
+                if (written > 0)
+                {
+                    data += written;
+
+                    length -= static_cast<std::size_t>(written);
+                }
+                else if (written < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                else
+                {
+                    good_ = false;
+                }
+            }
+        }
+    }
+
+    /**
+     *  Pass the given characters to the target, compressing them first if compression is enabled.
+     *
+     *  @param[in] data     A pointer to the first character.
+     *  @param[in] length   The number of characters.
+     *  @param[in] finish   A boolean flag whether the compressed stream shall be finished.
+     */
+    void write(const char * data, std::size_t length, bool finish)
+    {
+        if (!good_)
+        {
+            return;
+        }
+
+        if (!compress_)
+        {
+            writeToTarget(data, length);
+
+            return;
+        }
+
+#ifdef HTD_IO_USE_ZLIB
+        stream_.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+        stream_.avail_in = static_cast<uInt>(length);
+
+        int result = Z_OK;
+
+        do
+        {
+            stream_.next_out = reinterpret_cast<Bytef *>(compressedBuffer_.data());
+            stream_.avail_out = static_cast<uInt>(compressedBuffer_.size());
+
+            result = deflate(&stream_, finish ? Z_FINISH : Z_NO_FLUSH);
+
+            if (result == Z_STREAM_ERROR)
+            {
+                good_ = false;
+
+                return;
+            }
+
+            writeToTarget(compressedBuffer_.data(), compressedBuffer_.size() - stream_.avail_out);
+        }
+        while (good_ && (stream_.avail_out == 0 || (finish && result != Z_STREAM_END)));
+#else
+        HTD_UNUSED(finish)
+#endif
+    }
+
+    /**
+     *  Finish the compressed stream and release the state of the compressor.
+     */
+    void finish(void)
+    {
+#ifdef HTD_IO_USE_ZLIB
+        if (compress_)
+        {
+            write(nullptr, 0, true);
+
+            deflateEnd(&stream_);
+
+            compress_ = false;
+        }
+#endif
+    }
+};
+
+htd_io::StreamingWriter::StreamingWriter(std::ostream & outputStream, bool compress, std::size_t bufferSize) : implementation_(new Implementation(&outputStream, -1, compress, bufferSize)), buffer_(implementation_->buffer_.data()), capacity_(implementation_->buffer_.size()), position_(0)
+{
+
+}
+
+htd_io::StreamingWriter::StreamingWriter(int fileDescriptor, bool compress, std::size_t bufferSize) : implementation_(new Implementation(nullptr, fileDescriptor, compress, bufferSize)), buffer_(implementation_->buffer_.data()), capacity_(implementation_->buffer_.size()), position_(0)
+{
+
+}
+
+htd_io::StreamingWriter::~StreamingWriter()
+{
+    flushBuffer();
+
+    implementation_->finish();
+
+    if (implementation_->outputStream_ != nullptr)
+    {
+        implementation_->outputStream_->flush();
+    }
+}
+
+bool htd_io::StreamingWriter::supportsCompression(void)
+{
+#ifdef HTD_IO_USE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool htd_io::StreamingWriter::good(void) const
+{
+    return implementation_->good_;
+}
+
+void htd_io::StreamingWriter::flush(void)
+{
+    flushBuffer();
+
+    if (implementation_->outputStream_ != nullptr)
+    {
+        implementation_->outputStream_->flush();
+    }
+}
+
+void htd_io::StreamingWriter::flushBuffer(void)
+{
+    if (position_ > 0)
+    {
+        implementation_->write(buffer_, position_, false);
+
+        position_ = 0;
+    }
+}
+
+void htd_io::StreamingWriter::writeLarge(const char * data, std::size_t length)
+{
+    flushBuffer();
+
+    if (length >= capacity_)
+    {
+        implementation_->write(data, length, false);
+    }
+    else
+    {
+        std::memcpy(buffer_, data, length);
+
+        position_ = length;
+    }
+}
+
+#endif /* HTD_IO_STREAMINGWRITER_CPP */
@@ -27,117 +27,106 @@
 
 #include <htd_io/TdFormatExporter.hpp>
 
-#include <sstream>
-#include <unordered_map>
+#include <vector>
 
-htd_io::TdFormatExporter::TdFormatExporter(void)
-{
-
-}
-
-htd_io::TdFormatExporter::~TdFormatExporter()
-{
-
-}
-
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+namespace
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
-
-    if (decomposition.vertexCount() > 0)
+    /**
+     *  Write the given tree decomposition in format 'td'.
+     *
+     *  @param[in] decomposition    The tree decomposition which shall be written.
+     *  @param[in] graphVertexCount The number of vertices of the decomposed graph.
+     *  @param[in] writer           The writer which shall be used for the output.
+     */
+    void writeTdFormat(const htd::ITreeDecomposition & decomposition, std::size_t graphVertexCount, htd_io::StreamingWriter & writer)
     {
-        std::size_t index = 1;
-
-        std::stringstream tmpStream;
-
-        for (htd::vertex_t node : decomposition.vertices())
+        writer.write("s td ", 5);
+        writer.writeUnsigned(decomposition.vertexCount());
+        writer.write(' ');
+        writer.writeUnsigned(decomposition.maximumBagSize());
+        writer.write(' ');
+        writer.writeUnsigned(graphVertexCount);
+        writer.write('\n');
+
+        if (decomposition.vertexCount() > 0)
         {
-            tmpStream << "b " << index << " ";
+            const htd::ConstCollection<htd::vertex_t> & vertexCollection = decomposition.vertices();
+
+            /* The vertices are sorted in ascending order, hence the last one is the largest. */
+            std::vector<std::size_t> indices(vertexCollection[vertexCollection.size() - 1] + 1);
 
-            indices.emplace(node, index);
+            std::size_t index = 1;
 
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
+            for (htd::vertex_t node : vertexCollection)
             {
-                tmpStream << vertex << " ";
-            }
+                writer.write("b ", 2);
+                writer.writeUnsigned(index);
+                writer.write(' ');
 
-            tmpStream << "\n" << std::flush;
+                indices[node] = index;
 
-            outputStream << tmpStream.rdbuf();
+                for (htd::vertex_t vertex : decomposition.bagContent(node))
+                {
+                    writer.writeUnsigned(vertex);
+                    writer.write(' ');
+                }
 
-            tmpStream.clear();
+                writer.write('\n');
 
-            ++index;
-        }
-
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+                ++index;
+            }
 
-        std::size_t edgeCount = decomposition.edgeCount();
+            const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
 
-        auto it = hyperedgeCollection.begin();
+            std::size_t edgeCount = decomposition.edgeCount();
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+            auto it = hyperedgeCollection.begin();
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+            for (htd::index_t index = 0; index < edgeCount; ++index)
+            {
+                writer.writeUnsigned(indices[(*it)[0]]);
+                writer.write(' ');
+                writer.writeUnsigned(indices[(*it)[1]]);
+                writer.write('\n');
 
-            ++it;
+                ++it;
+            }
         }
     }
 }
 
-void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+htd_io::TdFormatExporter::TdFormatExporter(void)
 {
-    std::unordered_map<htd::vertex_t, std::size_t> indices;
-
-    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
 
-    if (decomposition.vertexCount() > 0)
-    {
-        std::size_t index = 1;
-
-        std::stringstream tmpStream;
-
-        for (htd::vertex_t node : decomposition.vertices())
-        {
-            tmpStream << "b " << index << " ";
-
-            indices.emplace(node, index);
-
-            for (htd::vertex_t vertex : decomposition.bagContent(node))
-            {
-                tmpStream << vertex << " ";
-            }
-
-            tmpStream << "\n" << std::flush;
-
-            outputStream << tmpStream.rdbuf();
+}
 
-            tmpStream.clear();
+htd_io::TdFormatExporter::~TdFormatExporter()
+{
 
-            ++index;
-        }
+}
 
-        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream) const
+{
+    htd_io::StreamingWriter writer(outputStream);
 
-        std::size_t edgeCount = decomposition.edgeCount();
+    writeTdFormat(decomposition, graph.vertexCount(), writer);
+}
 
-        auto it = hyperedgeCollection.begin();
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, std::ostream & outputStream) const
+{
+    htd_io::StreamingWriter writer(outputStream);
 
-        for (htd::index_t index = 0; index < edgeCount; ++index)
-        {
-            htd::vertex_t vertex1 = indices.at((*it)[0]);
-            htd::vertex_t vertex2 = indices.at((*it)[1]);
+    writeTdFormat(decomposition, graph.vertexCount(), writer);
+}
 
-            outputStream << vertex1 << " " << vertex2 << "\n";
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, htd_io::StreamingWriter & writer) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), writer);
+}
 
-            ++it;
-        }
-    }
+void htd_io::TdFormatExporter::write(const htd::ITreeDecomposition & decomposition, const htd::NamedMultiHypergraph<std::string, std::string> & graph, htd_io::StreamingWriter & writer) const
+{
+    writeTdFormat(decomposition, graph.vertexCount(), writer);
 }
 
 #endif /* HTD_IO_TDFORMATEXPORTER_CPP */
@@ -0,0 +1,73 @@
+/*
+ * File:   Allocation.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <new>
+
+#ifdef HTD_ENABLE_STATISTICS
+/**
+ *  Replacement of the global allocation function which reports each allocation to htd::Statistics.
+ *
+ *  Like the default allocation function, the replacement calls the installed new-handler until the allocation
+ *  succeeds and throws std::bad_alloc only if no new-handler is installed.
+ */
+void * operator new(std::size_t size)
+{
+    htd::Statistics::recordAllocation();
+
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    void * ret = std::malloc(size);
+
+    while (ret == nullptr)
+    {
+        std::new_handler handler = std::get_new_handler();
+
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        handler();
+
+        ret = std::malloc(size);
+    }
+
+    return ret;
+}
+
+/**
+ *  Replacement of the global deallocation function matching the replacement of the global allocation function.
+ */
+void operator delete(void * pointer) HTD_NOEXCEPT
+{
+    std::free(pointer);
+}
+#endif
@@ -34,6 +34,40 @@
 
 htd::LibraryInstance * const libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
 
+/**
+ *  The statistics which are collected if option --stats is used.
+ */
+htd::Statistics statistics;
+
+/**
+ *  Fitness function which prefers tree decompositions with a smaller maximum bag size.
+ */
+class MaximumBagSizeFitnessFunction : public htd::ITreeDecompositionFitnessFunction
+{
+    public:
+        MaximumBagSizeFitnessFunction(void)
+        {
+
+        }
+
+        virtual ~MaximumBagSizeFitnessFunction()
+        {
+
+        }
+
+        htd::FitnessEvaluation * fitness(const htd::IMultiHypergraph & graph, const htd::ITreeDecomposition & decomposition) const HTD_OVERRIDE
+        {
+            HTD_UNUSED(graph)
+
+            return new htd::FitnessEvaluation(1, -(static_cast<double>(decomposition.maximumBagSize())));
+        }
+
+        MaximumBagSizeFitnessFunction * clone(void) const HTD_OVERRIDE
+        {
+            return new MaximumBagSizeFitnessFunction();
+        }
+};
+
 htd_cli::OptionManager * createOptionManager(void)
 {
     htd_cli::OptionManager * manager = new htd_cli::OptionManager();
@@ -52,6 +86,14 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(seedOption, "General Options");
 
+        htd_cli::SingleValueOption * timeLimitOption = new htd_cli::SingleValueOption("time-limit", "Stop the computation after <milliseconds> and output the best decomposition found so far.", "milliseconds");
+
+        manager->registerOption(timeLimitOption, "General Options");
+
+        htd_cli::SingleValueOption * memoryLimitOption = new htd_cli::SingleValueOption("memory-limit", "Stop the computation once the memory usage exceeds <megabytes> and output the best decomposition found so far.", "megabytes");
+
+        manager->registerOption(memoryLimitOption, "General Options");
+
         htd_cli::Choice * decompositionTypeChoice = new htd_cli::Choice("type", "Compute a graph decomposition of type <type>.", "type");
 
         decompositionTypeChoice->addPossibility("tree", "Compute a tree decomposition of the input graph.");
@@ -78,6 +120,7 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::Choice * outputFormatChoice = new htd_cli::Choice("output", "Set the output format of the decomposition to <format>.\n  (See https://github.com/mabseher/htd/blob/master/FORMATS.md for information about the available output formats.)", "format");
 
         outputFormatChoice->addPossibility("td", "Use the output format 'td'.");
+        outputFormatChoice->addPossibility("binary", "Use the binary decomposition format which can be memory-mapped for loading.");
         outputFormatChoice->addPossibility("human", "Provide a human-readable output of the decomposition.");
         outputFormatChoice->addPossibility("width", "Provide only the maximum bag size of the decomposition.");
 
@@ -89,11 +132,19 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(printProgressOption, "Output-Specific Options");
 
+        htd_cli::Choice * statisticsChoice = new htd_cli::Choice("stats", "Print statistics about the phases of the decomposition process to stderr in format <format>.", "format");
+
+        statisticsChoice->addPossibility("text", "Print the statistics as human-readable table.");
+        statisticsChoice->addPossibility("json", "Print the statistics as JSON object.");
+
+        manager->registerOption(statisticsChoice, "Output-Specific Options");
+
         htd_cli::Choice * strategyChoice = new htd_cli::Choice("strategy", "Set the decomposition strategy which shall be used to <algorithm>.", "algorithm");
 
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
         strategyChoice->addPossibility("min-fill", "Minimum fill ordering algorithm");
         strategyChoice->addPossibility("min-degree", "Minimum degree ordering algorithm");
+        strategyChoice->addPossibility("approximate-min-degree", "Approximate minimum degree ordering algorithm (AMD)");
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
@@ -109,6 +160,7 @@ htd_cli::OptionManager * createOptionManager(void)
         preprocessingChoice->addPossibility("simple", "Use simple preprocessing capabilities.");
         preprocessingChoice->addPossibility("advanced", "Use advanced preprocessing capabilities.");
         preprocessingChoice->addPossibility("full", "Use the full set of preprocessing capabilities.");
+        preprocessingChoice->addPossibility("atoms", "Use the full set of preprocessing capabilities and eliminate all but the largest atom using the ordering of the selected strategy if it supports width limits and min-fill otherwise.");
 
         preprocessingChoice->setDefaultValue("none");
 
@@ -134,6 +186,10 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Set the number of threads used by the width optimization or, without optimization, by the decomposition of the connected components to <count>. Full preprocessing uses the same number of threads to detect simplicial vertices and to process the atoms. (Default: 1)", "count");
+
+        manager->registerOption(threadOption, "Optimization Options");
     }
     catch (const std::runtime_error & exception)
     {
@@ -174,6 +230,10 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & seedOption = optionManager.accessSingleValueOption("seed");
 
+    const htd_cli::SingleValueOption & timeLimitOption = optionManager.accessSingleValueOption("time-limit");
+
+    const htd_cli::SingleValueOption & memoryLimitOption = optionManager.accessSingleValueOption("memory-limit");
+
     const htd_cli::SingleValueOption & instanceOption = optionManager.accessSingleValueOption("instance");
 
     const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
@@ -182,8 +242,14 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
 
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & printProgressOption = optionManager.accessOption("print-progress");
+
+    const htd_cli::Choice & statisticsChoice = optionManager.accessChoice("stats");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -229,16 +295,87 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 }
                 else
                 {
-                    srand(seed);
+                    manager->randomNumberGenerator().seed(seed);
                 }
             }
         }
         else
         {
-            srand(static_cast<unsigned int>(time(NULL)));
+            manager->randomNumberGenerator().seed(static_cast<std::uint64_t>(time(NULL)));
+        }
+    }
+
+    if (ret && timeLimitOption.used())
+    {
+        std::size_t index = 0;
+
+        const std::string & value = timeLimitOption.value();
+
+        if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+        {
+            std::cerr << "INVALID TIME LIMIT: " << timeLimitOption.value() << std::endl;
+
+            ret = false;
+        }
+
+        if (ret)
+        {
+            std::size_t timeLimit = std::stoul(value, &index, 10);
+
+            if (index != value.length())
+            {
+                std::cerr << "INVALID TIME LIMIT: " << value << std::endl;
+
+                ret = false;
+            }
+            else
+            {
+                manager->setTimeLimit(timeLimit);
+            }
+        }
+    }
+
+    if (ret && memoryLimitOption.used())
+    {
+        std::size_t index = 0;
+
+        const std::string & value = memoryLimitOption.value();
+
+        if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+        {
+            std::cerr << "INVALID MEMORY LIMIT: " << memoryLimitOption.value() << std::endl;
+
+            ret = false;
+        }
+
+        if (ret)
+        {
+            std::size_t memoryLimit = std::stoul(value, &index, 10);
+
+            if (index != value.length() || memoryLimit == 0)
+            {
+                std::cerr << "INVALID MEMORY LIMIT: " << value << std::endl;
+
+                ret = false;
+            }
+            else
+            {
+                manager->setMemoryLimit(memoryLimit * 1024 * 1024);
+            }
         }
     }
 
+    if (ret && statisticsChoice.used())
+    {
+#ifdef HTD_ENABLE_STATISTICS
+        manager->setStatistics(&statistics);
+#else
+        std::cerr << "INVALID PROGRAM CALL: Option --stats requires htd to be built with HTD_ENABLE_STATISTICS!" << std::endl;
+
+        ret = false;
+#endif
+    }
+
     if (ret)
     {
         if (instanceOption.used())
@@ -266,6 +403,10 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         {
             manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
         }
+        else if (value == "approximate-min-degree")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::ApproximateMinDegreeOrderingAlgorithm(manager));
+        }
         else if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
@@ -311,6 +452,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret && printProgressOption.used() && outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "binary")
+    {
+        std::cerr << "INVALID PROGRAM CALL: Option --print-progress cannot be used with output format 'binary'!" << std::endl;
+
+        ret = false;
+    }
+
     if (ret && decompositionTypeChoice.used() && std::string(decompositionTypeChoice.value()) == "hypertree")
     {
         if (outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "td")
@@ -320,6 +468,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
             ret = false;
         }
 
+        if (outputFormatChoice.used() && std::string(outputFormatChoice.value()) == "binary")
+        {
+            std::cerr << "INVALID OUTPUT FORMAT: Format 'binary' only supports tree decompositions!" << std::endl;
+
+            ret = false;
+        }
+
         if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
         {
             std::cerr << "INVALID PROGRAM CALL: Currently, optimization is supported only for tree decompositions!" << std::endl;
@@ -404,6 +559,44 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret)
+    {
+        if (threadOption.used())
+        {
+            if ((optimizationChoice.used() && std::string(optimizationChoice.value()) == "width") || std::string(strategyChoice.value()) != "min-separator")
+            {
+                std::size_t index = 0;
+
+                const std::string & value = threadOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::size_t threadCount = std::stoul(value, &index, 10);
+
+                    if (index != value.length() || threadCount == 0)
+                    {
+                        std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --threads may not be used together with strategy \"min-separator\" unless option --opt is set to \"width\"!" << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+
     if (ret && triangulationMinimizationOption.used())
     {
         htd::TriangulationMinimizationOrderingAlgorithm * algorithm =
@@ -417,6 +610,18 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     return ret;
 }
 
+void printTerminationMessage(const htd::LibraryInstance & instance)
+{
+    if (instance.isBudgetExhausted())
+    {
+        std::cerr << "Time or memory limit exceeded!" << std::endl;
+    }
+    else
+    {
+        std::cerr << "Program was terminated successfully!" << std::endl;
+    }
+}
+
 template <typename DecompositionAlgorithm, typename GraphType, typename Exporter>
 void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorithm & algorithm, GraphType * graph, const Exporter & exporter)
 {
@@ -428,11 +633,13 @@ void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorit
         {
             if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
             {
+                HTD_STATISTICS(htd::PhaseTimer phaseTimer(instance, htd::Statistics::EXPORT_PHASE);)
+
                 exporter.write(*decomposition, *graph, std::cout);
             }
             else
             {
-                std::cerr << "Program was terminated successfully!" << std::endl;
+                printTerminationMessage(instance);
             }
 
             delete decomposition;
@@ -441,7 +648,7 @@ void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorit
         {
             if (instance.isTerminated())
             {
-                std::cerr << "Program was terminated successfully!" << std::endl;
+                printTerminationMessage(instance);
             }
             else
             {
@@ -455,7 +662,7 @@ void decompose(const htd::LibraryInstance & instance, const DecompositionAlgorit
     {
         if (instance.isTerminated())
         {
-            std::cerr << "Program was terminated successfully!" << std::endl;
+            printTerminationMessage(instance);
         }
         else
         {
@@ -475,11 +682,13 @@ void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAl
         {
             if (!instance.isTerminated() || algorithm.isSafelyInterruptible())
             {
+                HTD_STATISTICS(htd::PhaseTimer phaseTimer(instance, htd::Statistics::EXPORT_PHASE);)
+
                 exporter.write(*decomposition, *graph, std::cout);
             }
             else
             {
-                std::cerr << "Program was terminated successfully!" << std::endl;
+                printTerminationMessage(instance);
             }
 
             delete decomposition;
@@ -488,7 +697,7 @@ void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAl
         {
             if (instance.isTerminated())
             {
-                std::cerr << "Program was terminated successfully!" << std::endl;
+                printTerminationMessage(instance);
             }
             else
             {
@@ -502,7 +711,7 @@ void decomposeNamed(const htd::LibraryInstance & instance, const DecompositionAl
     {
         if (instance.isTerminated())
         {
-            std::cerr << "Program was terminated successfully!" << std::endl;
+            printTerminationMessage(instance);
         }
         else
         {
@@ -618,6 +827,8 @@ int main(int argc, const char * const * const argv)
 
         const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
 
+        const htd_cli::SingleValueOption & threadOption = optionManager->accessSingleValueOption("threads");
+
         const htd_cli::Option & printProgressOption = optionManager->accessOption("print-progress");
 
         const std::string & outputFormat = outputFormatChoice.value();
@@ -638,6 +849,11 @@ int main(int argc, const char * const * const argv)
 
             treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
 
+            if (threadOption.used() && !optimizationChoice.used())
+            {
+                treeDecompositionAlgorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+            }
+
             libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
         }
 
@@ -686,6 +902,10 @@ int main(int argc, const char * const * const argv)
             {
                 exporter = new htd_io::TdFormatExporter();
             }
+            else if (outputFormat == "binary")
+            {
+                exporter = new htd_io::BinaryFormatExporter();
+            }
             else if (outputFormat == "human")
             {
                 exporter = new htd_io::HumanReadableExporter();
@@ -769,8 +989,61 @@ int main(int argc, const char * const * const argv)
 
                         algorithm->addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
 
+                        if (threadOption.used())
+                        {
+                            std::size_t threadCount = std::stoul(threadOption.value(), nullptr, 10);
+
+                            if (threadCount > 1)
+                            {
+                                algorithm->setParallelExecutionEnabled(true);
+
+                                for (std::size_t index = 2; index < threadCount; ++index)
+                                {
+                                    algorithm->addDecompositionAlgorithm(adaptiveAlgorithm->clone());
+                                }
+                            }
+                        }
+
                         algorithm->addDecompositionAlgorithm(adaptiveAlgorithm);
                     }
+                    else if (threadOption.used() && std::stoul(threadOption.value(), nullptr, 10) > 1)
+                    {
+                        htd::IterativeImprovementTreeDecompositionAlgorithm * baseAlgorithm =
+                            new htd::IterativeImprovementTreeDecompositionAlgorithm(libraryInstance,
+                                                                                   new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance),
+                                                                                   new MaximumBagSizeFitnessFunction());
+
+                        if (iterationOption.used())
+                        {
+                            baseAlgorithm->setIterationCount(std::stoul(iterationOption.value(), nullptr, 10));
+                        }
+                        else
+                        {
+                            baseAlgorithm->setIterationCount(10);
+                        }
+
+                        if (patienceOption.used())
+                        {
+                            if (std::string(patienceOption.value()) == "-1")
+                            {
+                                baseAlgorithm->setNonImprovementLimit((std::size_t)-1);
+                            }
+                            else
+                            {
+                                baseAlgorithm->setNonImprovementLimit(std::stoul(patienceOption.value(), nullptr, 10));
+                            }
+                        }
+
+                        baseAlgorithm->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+
+                        baseAlgorithm->setComputeInducedEdgesEnabled(false);
+
+                        delete algorithm;
+
+                        algorithm = nullptr;
+
+                        libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(baseAlgorithm);
+                    }
                     else
                     {
                         htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm = new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
@@ -806,9 +1079,12 @@ int main(int argc, const char * const * const argv)
                         algorithm->addDecompositionAlgorithm(baseAlgorithm);
                     }
 
-                    algorithm->setComputeInducedEdgesEnabled(false);
+                    if (algorithm != nullptr)
+                    {
+                        algorithm->setComputeInducedEdgesEnabled(false);
 
-                    libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+                        libraryInstance->treeDecompositionAlgorithmFactory().setConstructionTemplate(algorithm);
+                    }
                 }
 
                 htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(libraryInstance);
@@ -825,12 +1101,33 @@ int main(int argc, const char * const * const argv)
                 {
                     preprocessor->setPreprocessingStrategy(2);
                 }
-                else if (std::string(preprocessingChoice.value()) == "full")
+                else if (std::string(preprocessingChoice.value()) == "full" || std::string(preprocessingChoice.value()) == "atoms")
                 {
-                    preprocessor->setPreprocessingStrategy(3);
+                    preprocessor->setPreprocessingStrategy(std::string(preprocessingChoice.value()) == "full" ? 3 : 4);
 
                     preprocessor->setIterationCount(256);
                     preprocessor->setNonImprovementLimit(64);
+
+                    if (threadOption.used())
+                    {
+                        preprocessor->setThreadCount(std::stoul(threadOption.value(), nullptr, 10));
+                    }
+
+                    if (std::string(preprocessingChoice.value()) == "atoms")
+                    {
+                        htd::IOrderingAlgorithm * orderingAlgorithm = libraryInstance->orderingAlgorithmFactory().createInstance();
+
+                        htd::IWidthLimitableOrderingAlgorithm * widthLimitableOrderingAlgorithm = dynamic_cast<htd::IWidthLimitableOrderingAlgorithm *>(orderingAlgorithm);
+
+                        if (widthLimitableOrderingAlgorithm != nullptr)
+                        {
+                            preprocessor->setOrderingAlgorithm(widthLimitableOrderingAlgorithm);
+                        }
+                        else
+                        {
+                            delete orderingAlgorithm;
+                        }
+                    }
                 }
 
                 htd_io::IGraphToTreeDecompositionProcessor * processor = nullptr;
@@ -998,9 +1295,26 @@ int main(int argc, const char * const * const argv)
                     processor->process();
                 }
 
+                if (libraryInstance->isBudgetExhausted())
+                {
+                    printTerminationMessage(*libraryInstance);
+                }
+
                 delete processor;
             }
         }
+
+        if (libraryInstance->statistics() != nullptr)
+        {
+            if (std::string(optionManager->accessChoice("stats").value()) == "json")
+            {
+                libraryInstance->statistics()->writeJson(std::cerr);
+            }
+            else
+            {
+                libraryInstance->statistics()->print(std::cerr);
+            }
+        }
     }
 
     delete libraryInstance;
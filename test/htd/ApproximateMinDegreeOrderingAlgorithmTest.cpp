@@ -0,0 +1,292 @@
+/*
+ * File:   ApproximateMinDegreeOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+class ApproximateMinDegreeOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        ApproximateMinDegreeOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ApproximateMinDegreeOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+htd::MultiHypergraph * createRandomGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount, std::size_t edgeCount, std::mt19937 & generator)
+{
+    htd::MultiHypergraph * ret = new htd::MultiHypergraph(libraryInstance, vertexCount);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = vertexDistribution(generator);
+        htd::vertex_t vertex2 = vertexDistribution(generator);
+
+        if (vertex1 != vertex2)
+        {
+            ret->addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+std::size_t computeMaximumBagSize(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::vector<std::set<htd::vertex_t>> neighborhood(graph.vertexCount() + 1);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            if (neighbor != vertex)
+            {
+                neighborhood[vertex].insert(neighbor);
+            }
+        }
+    }
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::set<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        ret = std::max(ret, currentNeighborhood.size() + 1);
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            neighborhood[neighbor].erase(vertex);
+
+            neighborhood[neighbor].insert(currentNeighborhood.begin(), currentNeighborhood.end());
+
+            neighborhood[neighbor].erase(neighbor);
+        }
+
+        currentNeighborhood.clear();
+    }
+
+    return ret;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance1);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckTreeGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 100);
+
+    std::mt19937 generator(1234);
+
+    for (htd::vertex_t vertex = 2; vertex <= 100; ++vertex)
+    {
+        graph.addEdge(vertex, std::uniform_int_distribution<htd::vertex_t>(1, vertex - 1)(generator));
+    }
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+    ASSERT_EQ((std::size_t)2, ordering->maximumBagSize());
+    ASSERT_EQ((std::size_t)2, computeMaximumBagSize(graph, ordering->sequence()));
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    for (std::size_t iteration = 0; iteration < 40; ++iteration)
+    {
+        std::size_t vertexCount = 10 + iteration * 3;
+
+        htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, vertexCount, vertexCount * (1 + iteration % 4), generator);
+
+        htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(*graph, (std::size_t)-1, 1);
+
+        std::vector<htd::vertex_t> sortedSequence(ordering->sequence());
+
+        std::sort(sortedSequence.begin(), sortedSequence.end());
+
+        ASSERT_EQ(std::vector<htd::vertex_t>(graph->vertices().begin(), graph->vertices().end()), sortedSequence);
+
+        ASSERT_EQ(computeMaximumBagSize(*graph, ordering->sequence()), ordering->maximumBagSize());
+
+        delete ordering;
+        delete graph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckGraphWithDenseVertices)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, 400, 800, generator);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, 400);
+
+    for (htd::vertex_t hub = 1; hub <= 3; ++hub)
+    {
+        for (std::size_t index = 0; index < 300; ++index)
+        {
+            htd::vertex_t neighbor = vertexDistribution(generator);
+
+            if (neighbor != hub)
+            {
+                graph->addEdge(hub, neighbor);
+            }
+        }
+    }
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(*graph, (std::size_t)-1, 1);
+
+    std::vector<htd::vertex_t> sortedSequence(ordering->sequence());
+
+    std::sort(sortedSequence.begin(), sortedSequence.end());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>(graph->vertices().begin(), graph->vertices().end()), sortedSequence);
+
+    ASSERT_EQ(computeMaximumBagSize(*graph, ordering->sequence()), ordering->maximumBagSize());
+
+    delete ordering;
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinDegreeOrderingAlgorithmTest, CheckWidthLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    htd::MultiHypergraph * graph = createRandomGraph(libraryInstance, 60, 240, generator);
+
+    htd::ApproximateMinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering1 = algorithm.computeOrdering(*graph, (std::size_t)-1, 1);
+
+    std::size_t maximumBagSize = ordering1->maximumBagSize();
+
+    htd::IWidthLimitedVertexOrdering * ordering2 = algorithm.computeOrdering(*graph, maximumBagSize, 5);
+
+    ASSERT_EQ(graph->vertexCount(), ordering2->sequence().size());
+    ASSERT_LE(ordering2->maximumBagSize(), maximumBagSize);
+
+    htd::IWidthLimitedVertexOrdering * ordering3 = algorithm.computeOrdering(*graph, 3, 5);
+
+    ASSERT_GT(ordering3->maximumBagSize(), (std::size_t)3);
+    ASSERT_EQ((std::size_t)5, ordering3->requiredIterations());
+
+    htd::IWidthLimitedVertexOrdering * ordering4 = algorithm.computeOrdering(*graph, 3, 0);
+
+    ASSERT_TRUE(ordering4->sequence().empty());
+
+    delete ordering1;
+    delete ordering2;
+    delete ordering3;
+    delete ordering4;
+    delete graph;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
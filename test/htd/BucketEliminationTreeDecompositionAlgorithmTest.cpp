@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 class BucketEliminationTreeDecompositionAlgorithmTest : public ::testing::Test
@@ -415,6 +417,159 @@ TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultSimpleGraphWith
     delete libraryInstance;
 }
 
+void addRandomComponents(htd::MultiHypergraph & graph, std::size_t componentCount, std::size_t componentSize)
+{
+    std::mt19937 generator(componentCount * componentSize);
+
+    for (std::size_t component = 0; component < componentCount; ++component)
+    {
+        htd::vertex_t firstVertex = graph.addVertices(componentSize);
+
+        for (std::size_t index = 1; index < componentSize; ++index)
+        {
+            graph.addEdge(firstVertex + index, firstVertex + generator() % index);
+        }
+
+        for (std::size_t index = 0; index < componentSize; ++index)
+        {
+            htd::vertex_t vertex1 = firstVertex + generator() % componentSize;
+            htd::vertex_t vertex2 = firstVertex + generator() % componentSize;
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+}
+
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphWithMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomComponents(graph, 12, 30);
+
+    graph.addVertex();
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(4);
+
+    ASSERT_EQ((std::size_t)4, algorithm.threadCount());
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        std::vector<htd::vertex_t> bag(decomposition->bagContent(vertex));
+
+        for (const htd::Hyperedge & hyperedge : decomposition->inducedHyperedges(vertex))
+        {
+            for (htd::vertex_t hyperedgeVertex : hyperedge)
+            {
+                ASSERT_TRUE(std::binary_search(bag.begin(), bag.end(), hyperedgeVertex));
+            }
+        }
+    }
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultDisconnectedGraphIsIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomComponents(graph, 10, 25);
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> bags;
+
+    for (std::size_t threadCount = 2; threadCount <= 4; ++threadCount)
+    {
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(threadCount);
+
+        libraryInstance->randomNumberGenerator().seed(42);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        bags.emplace_back();
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            bags.back().push_back(decomposition->bagContent(vertex));
+        }
+
+        delete decomposition;
+    }
+
+    EXPECT_EQ(bags[0], bags[1]);
+    EXPECT_EQ(bags[0], bags[2]);
+
+    delete libraryInstance;
+}
+
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultDisconnectedPreprocessedGraphWithMultipleThreads)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomComponents(graph, 12, 30);
+
+    graph.addVertex();
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(4);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    ASSERT_NE(preprocessedGraph, nullptr);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setThreadCount(4);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_GE(decomposition->maximumBagSize(), preprocessedGraph->minTreeWidth() + 1);
+
+    delete decomposition;
+
+    delete preprocessedGraph;
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,300 @@
+/*
+ * File:   CliqueMinimalSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+class CliqueMinimalSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        CliqueMinimalSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~CliqueMinimalSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Check whether the given vertices form a clique in the given graph.
+ */
+bool isClique(const htd::IGraphStructure & graph, const std::vector<htd::vertex_t> & vertices)
+{
+    for (htd::index_t i = 0; i < vertices.size(); ++i)
+    {
+        for (htd::index_t j = i + 1; j < vertices.size(); ++j)
+        {
+            if (!graph.isNeighbor(vertices[i], vertices[j]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ *  Check whether the subgraph induced by the given vertices has a clique separator by enumerating all vertex subsets.
+ */
+bool hasCliqueSeparator(const htd::IGraphStructure & graph, const std::vector<htd::vertex_t> & vertices)
+{
+    std::size_t n = vertices.size();
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << n); ++subset)
+    {
+        std::vector<htd::vertex_t> separator;
+
+        std::vector<bool> reached(n, false);
+
+        for (htd::index_t index = 0; index < n; ++index)
+        {
+            if ((subset >> index) & 1)
+            {
+                separator.push_back(vertices[index]);
+
+                reached[index] = true;
+            }
+        }
+
+        if (separator.size() + 2 > n || !isClique(graph, separator))
+        {
+            continue;
+        }
+
+        htd::index_t start = 0;
+
+        while (reached[start])
+        {
+            ++start;
+        }
+
+        std::vector<htd::index_t> queue(1, start);
+
+        reached[start] = true;
+
+        for (htd::index_t index = 0; index < queue.size(); ++index)
+        {
+            for (htd::index_t other = 0; other < n; ++other)
+            {
+                if (!reached[other] && graph.isNeighbor(vertices[queue[index]], vertices[other]))
+                {
+                    reached[other] = true;
+
+                    queue.push_back(other);
+                }
+            }
+        }
+
+        if (std::find(reached.begin(), reached.end(), false) != reached.end())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckAtomsOfGluedCycles)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(14);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 1);
+
+    graph.addEdge(2, 6);
+    graph.addEdge(6, 7);
+    graph.addEdge(7, 8);
+    graph.addEdge(8, 1);
+
+    graph.addEdge(3, 9);
+    graph.addEdge(9, 10);
+    graph.addEdge(10, 11);
+    graph.addEdge(11, 3);
+
+    graph.addEdge(8, 12);
+    graph.addEdge(8, 13);
+    graph.addEdge(8, 14);
+    graph.addEdge(12, 13);
+    graph.addEdge(12, 14);
+    graph.addEdge(13, 14);
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.determineAtoms(graph, atoms, separators);
+
+    ASSERT_EQ(atoms.size(), separators.size());
+
+    std::set<std::vector<htd::vertex_t>> expectedAtoms { { 1, 2, 3, 4, 5 }, { 1, 2, 6, 7, 8 }, { 3, 9, 10, 11 }, { 8, 12, 13, 14 } };
+
+    ASSERT_EQ(expectedAtoms, std::set<std::vector<htd::vertex_t>>(atoms.begin(), atoms.end()));
+
+    ASSERT_TRUE(separators.back().empty());
+
+    for (htd::index_t index = 0; index + 1 < atoms.size(); ++index)
+    {
+        const std::vector<htd::vertex_t> & separator = separators[index];
+
+        ASSERT_FALSE(separator.empty());
+
+        ASSERT_TRUE(isClique(graph, separator));
+
+        ASSERT_TRUE(std::includes(atoms[index].begin(), atoms[index].end(), separator.begin(), separator.end()));
+    }
+
+    std::set<std::vector<htd::vertex_t>> expectedSeparators { { 1, 2 }, { 3 }, { 8 } };
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ((std::size_t)1, expectedSeparators.count(*separator));
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckAtomsOfCompleteGraph)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(4);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 4; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 4; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::vector<htd::vertex_t>> separators;
+
+    algorithm.determineAtoms(graph, atoms, separators);
+
+    ASSERT_EQ(std::vector<std::vector<htd::vertex_t>>({ { 1, 2, 3, 4 } }), atoms);
+    ASSERT_EQ(std::vector<std::vector<htd::vertex_t>>(1), separators);
+}
+
+TEST(CliqueMinimalSeparatorAlgorithmTest, CheckAtomsOfRandomGraphs)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::mt19937 generator(2468);
+
+    for (std::size_t round = 0; round < 30; ++round)
+    {
+        std::size_t vertexCount = 6 + round % 7;
+
+        htd::Graph graph(libraryInstance.get());
+
+        graph.addVertices(vertexCount);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+        for (std::size_t index = 0; index < vertexCount * (1 + round % 3); ++index)
+        {
+            htd::vertex_t vertex1 = vertexDistribution(generator);
+            htd::vertex_t vertex2 = vertexDistribution(generator);
+
+            if (vertex1 != vertex2 && !graph.isNeighbor(vertex1, vertex2))
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::CliqueMinimalSeparatorAlgorithm algorithm(libraryInstance.get());
+
+        std::vector<std::vector<htd::vertex_t>> atoms;
+
+        std::vector<std::vector<htd::vertex_t>> separators;
+
+        algorithm.determineAtoms(graph, atoms, separators);
+
+        ASSERT_EQ(atoms.size(), separators.size());
+
+        for (htd::index_t index = 0; index < atoms.size(); ++index)
+        {
+            const std::vector<htd::vertex_t> & atom = atoms[index];
+
+            ASSERT_TRUE(std::is_sorted(atom.begin(), atom.end()));
+
+            ASSERT_FALSE(hasCliqueSeparator(graph, atom));
+
+            ASSERT_TRUE(isClique(graph, separators[index]));
+
+            ASSERT_TRUE(std::includes(atom.begin(), atom.end(), separators[index].begin(), separators[index].end()));
+        }
+
+        for (htd::vertex_t vertex : graph.vertices())
+        {
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                ASSERT_TRUE(std::any_of(atoms.begin(), atoms.end(), [&](const std::vector<htd::vertex_t> & atom)
+                {
+                    return std::binary_search(atom.begin(), atom.end(), vertex) && std::binary_search(atom.begin(), atom.end(), neighbor);
+                }));
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
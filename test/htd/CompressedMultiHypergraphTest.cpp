@@ -0,0 +1,311 @@
+/*
+ * File:   CompressedMultiHypergraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+class CompressedMultiHypergraphTest : public ::testing::Test
+{
+    public:
+        CompressedMultiHypergraphTest(void)
+        {
+
+        }
+
+        virtual ~CompressedMultiHypergraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Copy the elements of the given collection into a vector.
+ */
+template <typename T>
+std::vector<T> toVector(const htd::ConstCollection<T> & collection)
+{
+    return std::vector<T>(collection.begin(), collection.end());
+}
+
+/**
+ *  Compare all queries of the given graphs, which must contain the same vertices and hyperedges.
+ */
+void compareGraphs(const htd::IMultiHypergraph & expected, const htd::CompressedMultiHypergraph & actual)
+{
+    ASSERT_EQ(expected.vertexCount(), actual.vertexCount());
+    ASSERT_EQ(expected.edgeCount(), actual.edgeCount());
+    ASSERT_EQ(expected.isolatedVertexCount(), actual.isolatedVertexCount());
+    ASSERT_EQ(expected.isConnected(), actual.isConnected());
+
+    ASSERT_EQ(toVector(expected.vertices()), toVector(actual.vertices()));
+
+    ASSERT_EQ(toVector(expected.isolatedVertices()), toVector(actual.isolatedVertices()));
+
+    for (htd::vertex_t vertex = htd::Vertex::UNKNOWN; vertex <= expected.vertexCount() + 2; ++vertex)
+    {
+        ASSERT_EQ(expected.isVertex(vertex), actual.isVertex(vertex));
+    }
+
+    for (htd::index_t index = 0; index < expected.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & expectedEdge = expected.hyperedgeAtPosition(index);
+        const htd::Hyperedge & actualEdge = actual.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(expectedEdge, actualEdge);
+        ASSERT_EQ(expectedEdge.id(), actual.hyperedgeIdAtPosition(index));
+        ASSERT_EQ(expectedEdge.elements(), toVector(actual.hyperedgeElementsAtPosition(index)));
+        ASSERT_EQ(expectedEdge.sortedElements(), actualEdge.sortedElements());
+
+        ASSERT_TRUE(actual.isEdge(expectedEdge.id()));
+        ASSERT_EQ(expectedEdge, actual.hyperedge(expectedEdge.id()));
+
+        ASSERT_EQ(expected.isEdge(expectedEdge.elements()), actual.isEdge(expectedEdge.elements()));
+
+        ASSERT_EQ(toVector(expected.associatedEdgeIds(expectedEdge.elements())), toVector(actual.associatedEdgeIds(expectedEdge.elements())));
+    }
+
+    for (htd::id_t edgeId = htd::Id::UNKNOWN; edgeId <= expected.edgeCount() + 2; ++edgeId)
+    {
+        ASSERT_EQ(expected.isEdge(edgeId), actual.isEdge(edgeId));
+    }
+
+    for (htd::vertex_t vertex : expected.vertices())
+    {
+        ASSERT_EQ(expected.neighborCount(vertex), actual.neighborCount(vertex));
+        ASSERT_EQ(expected.edgeCount(vertex), actual.edgeCount(vertex));
+        ASSERT_EQ(expected.isIsolatedVertex(vertex), actual.isIsolatedVertex(vertex));
+
+        std::vector<htd::vertex_t> expectedNeighbors;
+        std::vector<htd::vertex_t> actualNeighbors;
+
+        expected.copyNeighborsTo(vertex, expectedNeighbors);
+        actual.copyNeighborsTo(vertex, actualNeighbors);
+
+        ASSERT_EQ(expectedNeighbors, actualNeighbors);
+        ASSERT_EQ(expectedNeighbors, toVector(actual.neighbors(vertex)));
+
+        for (htd::index_t index = 0; index < expectedNeighbors.size(); ++index)
+        {
+            ASSERT_EQ(expectedNeighbors[index], actual.neighborAtPosition(vertex, index));
+        }
+
+        const htd::ConstCollection<htd::Hyperedge> & expectedHyperedges = expected.hyperedges(vertex);
+        const htd::ConstCollection<htd::Hyperedge> & actualHyperedges = actual.hyperedges(vertex);
+
+        ASSERT_EQ(expectedHyperedges, actualHyperedges);
+
+        for (htd::index_t index = 0; index < expectedHyperedges.size(); ++index)
+        {
+            ASSERT_EQ(expected.hyperedgeAtPosition(index, vertex), actual.hyperedgeAtPosition(index, vertex));
+        }
+
+        ASSERT_THROW(actual.hyperedgeAtPosition(expectedHyperedges.size(), vertex), std::out_of_range);
+
+        for (htd::vertex_t neighbor : expected.vertices())
+        {
+            ASSERT_EQ(expected.isNeighbor(vertex, neighbor), actual.isNeighbor(vertex, neighbor));
+            ASSERT_EQ(expected.isEdge(vertex, neighbor), actual.isEdge(vertex, neighbor));
+            ASSERT_EQ(expected.isConnected(vertex, neighbor), actual.isConnected(vertex, neighbor));
+
+            ASSERT_EQ(toVector(expected.associatedEdgeIds(vertex, neighbor)), toVector(actual.associatedEdgeIds(vertex, neighbor)));
+        }
+    }
+
+    std::vector<htd::index_t> indices { 0, expected.edgeCount() - 1 };
+
+    const htd::FilteredHyperedgeCollection & expectedFilteredHyperedges = expected.hyperedgesAtPositions(indices);
+    const htd::FilteredHyperedgeCollection & actualFilteredHyperedges = actual.hyperedgesAtPositions(indices);
+
+    ASSERT_EQ(expectedFilteredHyperedges.size(), actualFilteredHyperedges.size());
+
+    ASSERT_EQ(*(expectedFilteredHyperedges.begin()), *(actualFilteredHyperedges.begin()));
+    ASSERT_EQ(*(++expectedFilteredHyperedges.begin()), *(++actualFilteredHyperedges.begin()));
+}
+
+TEST(CompressedMultiHypergraphTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::CompressedMultiHypergraph graph(libraryInstance, 0, std::vector<std::pair<htd::vertex_t, htd::vertex_t>>());
+
+    EXPECT_EQ((std::size_t)0, graph.vertexCount());
+    EXPECT_EQ((std::size_t)0, graph.edgeCount());
+    EXPECT_EQ((std::size_t)0, graph.isolatedVertexCount());
+    EXPECT_EQ((std::size_t)0, graph.hyperedges().size());
+
+    EXPECT_FALSE(graph.isVertex(htd::Vertex::FIRST));
+    EXPECT_FALSE(graph.isEdge(htd::Id::FIRST));
+
+    EXPECT_TRUE(graph.isConnected());
+
+    delete libraryInstance;
+}
+
+TEST(CompressedMultiHypergraphTest, CheckGraphWithSelfLoopsAndDuplicateEdges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 1, 2 }, { 2, 1 }, { 1, 2 }, { 3, 3 }, { 3, 4 }, { 6, 7 } };
+
+    htd::MultiHypergraph expected(libraryInstance, 7);
+
+    expected.addEdges(edges);
+
+    htd::CompressedMultiHypergraph actual(libraryInstance, 7, edges);
+
+    compareGraphs(expected, actual);
+
+    EXPECT_TRUE(actual.isNeighbor(3, 3));
+    EXPECT_FALSE(actual.isNeighbor(4, 4));
+    EXPECT_TRUE(actual.isIsolatedVertex(5));
+    EXPECT_FALSE(actual.isConnected());
+
+    EXPECT_EQ(std::vector<htd::id_t>({ 1, 3 }), toVector(actual.associatedEdgeIds(1, 2)));
+
+    delete libraryInstance;
+}
+
+TEST(CompressedMultiHypergraphTest, CheckHypergraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::vector<htd::vertex_t>> edges { { 1 }, { 3, 1, 2 }, { 2, 2 }, { 2, 4 }, { 5, 6, 7, 8 }, { 3, 1, 2 }, { 8 } };
+
+    htd::MultiHypergraph expected(libraryInstance, 9);
+
+    for (const std::vector<htd::vertex_t> & edge : edges)
+    {
+        expected.addEdge(edge);
+    }
+
+    htd::CompressedMultiHypergraph actual(libraryInstance, 9, edges);
+
+    compareGraphs(expected, actual);
+
+    EXPECT_TRUE(actual.isNeighbor(2, 2));
+    EXPECT_FALSE(actual.isNeighbor(1, 1));
+    EXPECT_TRUE(actual.isIsolatedVertex(9));
+    EXPECT_EQ((std::size_t)3, actual.edgeCount(1));
+
+    delete libraryInstance;
+}
+
+TEST(CompressedMultiHypergraphTest, CheckConversionAndCopy)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph expected(libraryInstance, 6);
+
+    expected.addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    expected.addEdge(4, 5);
+    expected.addEdge(5, 6);
+    expected.addEdge(2, 6);
+
+    expected.removeEdge(htd::Id::FIRST + 1);
+    expected.removeVertex(4);
+
+    htd::CompressedMultiHypergraph converted(expected);
+
+    compareGraphs(expected, converted);
+
+    std::unique_ptr<htd::CompressedMultiHypergraph> copy(converted.clone());
+
+    compareGraphs(expected, *copy);
+
+    EXPECT_EQ(libraryInstance, copy->managementInstance());
+
+    EXPECT_TRUE(copy->isConnected());
+
+    delete libraryInstance;
+}
+
+TEST(CompressedMultiHypergraphTest, CheckRandomGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, 60);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    for (std::size_t index = 0; index < 150; ++index)
+    {
+        edges.emplace_back(vertexDistribution(generator), vertexDistribution(generator));
+    }
+
+    htd::MultiHypergraph expected(libraryInstance, 60);
+
+    expected.addEdges(edges);
+
+    htd::CompressedMultiHypergraph actual(libraryInstance, 60, edges);
+
+    compareGraphs(expected, actual);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    libraryInstance->randomNumberGenerator().seed(1234);
+
+    std::unique_ptr<htd::ITreeDecomposition> expectedDecomposition(algorithm.computeDecomposition(expected));
+
+    libraryInstance->randomNumberGenerator().seed(1234);
+
+    std::unique_ptr<htd::ITreeDecomposition> actualDecomposition(algorithm.computeDecomposition(actual));
+
+    ASSERT_NE(nullptr, expectedDecomposition.get());
+    ASSERT_NE(nullptr, actualDecomposition.get());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(actual, *actualDecomposition));
+
+    EXPECT_EQ(expectedDecomposition->maximumBagSize(), actualDecomposition->maximumBagSize());
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
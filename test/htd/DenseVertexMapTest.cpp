@@ -0,0 +1,168 @@
+/*
+ * File:   DenseVertexMapTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+class DenseVertexMapTest : public ::testing::Test
+{
+    public:
+        DenseVertexMapTest(void)
+        {
+
+        }
+
+        virtual ~DenseVertexMapTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(DenseVertexMapTest, CheckEmptyMap)
+{
+    htd::DenseVertexMap<std::vector<htd::vertex_t>> map;
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ((std::size_t)0, map.size());
+
+    ASSERT_EQ((std::size_t)0, map.count(htd::Vertex::UNKNOWN));
+    ASSERT_EQ((std::size_t)0, map.count(1));
+    ASSERT_EQ((std::size_t)0, map.count(1000));
+
+    ASSERT_THROW(map.at(1), std::out_of_range);
+    ASSERT_EQ((std::size_t)0, map.erase(1));
+}
+
+TEST(DenseVertexMapTest, CheckInsertionAndRemoval)
+{
+    htd::DenseVertexMap<std::vector<htd::vertex_t>> map;
+
+    ASSERT_TRUE(map.emplace(1, std::vector<htd::vertex_t> { 1, 2 }));
+    ASSERT_TRUE(map.emplace(5, std::vector<htd::vertex_t> { 3 }));
+    ASSERT_FALSE(map.emplace(1, std::vector<htd::vertex_t> { 4 }));
+
+    ASSERT_EQ((std::size_t)2, map.size());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), map.at(1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), map.at(5));
+
+    ASSERT_EQ((std::size_t)0, map.count(2));
+    ASSERT_THROW(map.at(2), std::out_of_range);
+
+    map[3].push_back(7);
+
+    ASSERT_EQ((std::size_t)3, map.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7 }), map.at(3));
+
+    map[1] = std::vector<htd::vertex_t> { 8 };
+
+    ASSERT_EQ((std::size_t)3, map.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 8 }), map.at(1));
+
+    ASSERT_EQ((std::size_t)1, map.erase(1));
+    ASSERT_EQ((std::size_t)0, map.erase(1));
+
+    ASSERT_EQ((std::size_t)2, map.size());
+    ASSERT_EQ((std::size_t)0, map.count(1));
+
+    ASSERT_TRUE(map.emplace(1, std::vector<htd::vertex_t>()));
+    ASSERT_TRUE(map.at(1).empty());
+
+    const htd::DenseVertexMap<std::vector<htd::vertex_t>> copy(map);
+
+    map.clear();
+
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ((std::size_t)0, map.count(5));
+
+    ASSERT_EQ((std::size_t)3, copy.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3 }), copy.at(5));
+}
+
+TEST(DenseVertexMapTest, CheckReferenceStability)
+{
+    htd::DenseVertexMap<std::vector<htd::vertex_t>> map;
+
+    map.emplace(1, std::vector<htd::vertex_t> { 1, 2, 3 });
+
+    const std::vector<htd::vertex_t> & value = map.at(1);
+
+    for (htd::vertex_t vertex = 2; vertex <= 10000; ++vertex)
+    {
+        map.emplace(vertex, std::vector<htd::vertex_t> { vertex });
+    }
+
+    ASSERT_EQ(&value, &(map.at(1)));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), value);
+    ASSERT_EQ((std::size_t)10000, map.size());
+}
+
+TEST(DenseVertexMapTest, CheckBagContentOfDecompositionWithRemovedNodes)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t node1 = decomposition.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node2 = decomposition.addChild(node1, std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t node3 = decomposition.addChild(node2, std::vector<htd::vertex_t> { 3, 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.removeVertex(node2);
+
+    ASSERT_EQ((std::size_t)2, decomposition.vertexCount());
+    ASSERT_TRUE(decomposition.isParent(node3, node1));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), decomposition.bagContent(node1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 4 }), decomposition.bagContent(node3));
+    ASSERT_EQ((std::size_t)2, decomposition.maximumBagSize());
+
+    htd::vertex_t node4 = decomposition.addParent(node3, std::vector<htd::vertex_t> { 2, 3, 4 }, htd::FilteredHyperedgeCollection());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), decomposition.bagContent(node4));
+    ASSERT_EQ((std::size_t)3, decomposition.maximumBagSize());
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
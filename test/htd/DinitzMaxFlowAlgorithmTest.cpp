@@ -0,0 +1,212 @@
+/*
+ * File:   DinitzMaxFlowAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+class DinitzMaxFlowAlgorithmTest : public ::testing::Test
+{
+    public:
+        DinitzMaxFlowAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~DinitzMaxFlowAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute the capacity of a minimum cut between the given vertices by enumerating all vertex subsets.
+ */
+std::size_t computeMinimumCutCapacity(std::size_t vertexCount, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & arcs, const std::vector<std::size_t> & capacities, htd::vertex_t source, htd::vertex_t target)
+{
+    std::size_t ret = (std::size_t)-1;
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << vertexCount); ++subset)
+    {
+        if (((subset >> source) & 1) == 1 && ((subset >> target) & 1) == 0)
+        {
+            std::size_t capacity = 0;
+
+            for (htd::index_t index = 0; index < arcs.size(); ++index)
+            {
+                if (((subset >> arcs[index].first) & 1) == 1 && ((subset >> arcs[index].second) & 1) == 0)
+                {
+                    capacity += capacities[index];
+                }
+            }
+
+            if (capacity < ret)
+            {
+                ret = capacity;
+            }
+        }
+    }
+
+    return ret;
+}
+
+TEST(DinitzMaxFlowAlgorithmTest, CheckFlowRequiringCancellation)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    /* The only shortest path 0 -> 1 -> 2 -> 5 blocks both other paths unless the flow along 1 -> 2 is cancelled. */
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> arcs { { 0, 1 }, { 1, 2 }, { 2, 5 }, { 0, 3 }, { 3, 4 }, { 4, 2 }, { 1, 6 }, { 6, 7 }, { 7, 5 } };
+
+    htd::FlowNetworkStructure flowNetwork(8);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & arc : arcs)
+    {
+        flowNetwork.updateCapacity(arc.first, arc.second, 1);
+    }
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::IFlow> flow(algorithm.determineMaximumFlow(flowNetwork, 0, 5));
+
+    ASSERT_EQ((std::size_t)2, flow->value());
+    ASSERT_EQ((htd::vertex_t)0, flow->source());
+    ASSERT_EQ((htd::vertex_t)5, flow->target());
+
+    ASSERT_EQ(0, flow->flow(1, 2));
+    ASSERT_EQ(1, flow->flow(1, 6));
+    ASSERT_EQ(1, flow->flow(4, 2));
+    ASSERT_EQ(-1, flow->flow(2, 4));
+}
+
+TEST(DinitzMaxFlowAlgorithmTest, CheckRandomNetworksWithReset)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::DinitzMaxFlowAlgorithm algorithm(libraryInstance.get());
+
+    std::mt19937 generator(1234);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 6 + round % 5;
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(0, static_cast<htd::vertex_t>(vertexCount - 1));
+
+        std::uniform_int_distribution<std::size_t> capacityDistribution(1, 5);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> arcs;
+
+        std::vector<std::size_t> capacities;
+
+        for (std::size_t index = 0; index < vertexCount * 3; ++index)
+        {
+            htd::vertex_t vertex1 = vertexDistribution(generator);
+            htd::vertex_t vertex2 = vertexDistribution(generator);
+
+            if (vertex1 != vertex2)
+            {
+                arcs.emplace_back(vertex1, vertex2);
+
+                capacities.push_back(capacityDistribution(generator));
+            }
+        }
+
+        htd::CompressedFlowNetwork flowNetwork(vertexCount, arcs, capacities);
+
+        ASSERT_EQ(arcs.size() * 2, flowNetwork.arcCount());
+
+        for (htd::vertex_t source = 0; source < vertexCount; ++source)
+        {
+            for (htd::vertex_t target = 0; target < vertexCount; ++target)
+            {
+                if (source != target)
+                {
+                    flowNetwork.reset();
+
+                    std::size_t value = algorithm.determineMaximumFlow(flowNetwork, source, target);
+
+                    ASSERT_EQ(computeMinimumCutCapacity(vertexCount, arcs, capacities, source, target), value);
+
+                    for (htd::vertex_t vertex = 0; vertex < vertexCount; ++vertex)
+                    {
+                        long long balance = 0;
+
+                        for (htd::index_t arc = flowNetwork.beginArc(vertex); arc < flowNetwork.endArc(vertex); ++arc)
+                        {
+                            ASSERT_EQ(vertex, flowNetwork.tail(arc));
+                            ASSERT_EQ(flowNetwork.flow(arc), -flowNetwork.flow(flowNetwork.pairedArc(arc)));
+
+                            balance += flowNetwork.flow(arc);
+                        }
+
+                        if (vertex == source)
+                        {
+                            ASSERT_EQ(static_cast<long long>(value), balance);
+                        }
+                        else if (vertex == target)
+                        {
+                            ASSERT_EQ(-static_cast<long long>(value), balance);
+                        }
+                        else
+                        {
+                            ASSERT_EQ(0, balance);
+                        }
+                    }
+
+                    if (value > 0)
+                    {
+                        flowNetwork.reset();
+
+                        ASSERT_EQ(value - 1, algorithm.determineMaximumFlow(flowNetwork, source, target, value - 1));
+
+                        ASSERT_EQ((std::size_t)1, algorithm.determineMaximumFlow(flowNetwork, source, target));
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <random>
 #include <vector>
 
 class GraphPreprocessorTest : public ::testing::Test
@@ -61,6 +64,128 @@ bool isValidOrdering(htd::MultiHypergraph & graph, const std::vector<htd::vertex
     return sortedVertices == graph.vertexVector();
 }
 
+/**
+ *  Add random dense atoms to the given graph, each of which is glued to one of the previous atoms along a clique of size 1 to 3.
+ */
+void addRandomAtoms(htd::MultiHypergraph & graph, std::mt19937 & generator, std::size_t atomCount)
+{
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges;
+
+    for (htd::index_t index = 0; index < atomCount; ++index)
+    {
+        std::vector<htd::vertex_t> atom;
+
+        if (index > 0)
+        {
+            atom = atoms[generator() % index];
+
+            std::shuffle(atom.begin(), atom.end(), generator);
+
+            atom.resize(1 + generator() % 3);
+
+            for (htd::index_t i = 0; i < atom.size(); ++i)
+            {
+                for (htd::index_t j = i + 1; j < atom.size(); ++j)
+                {
+                    edges.emplace_back(atom[i], atom[j]);
+                }
+            }
+        }
+
+        std::size_t oldSize = atom.size();
+
+        while (atom.size() < 12)
+        {
+            atom.push_back(graph.addVertex());
+        }
+
+        for (htd::index_t i = 0; i < atom.size(); ++i)
+        {
+            for (htd::index_t j = std::max(i + 1, oldSize); j < atom.size(); ++j)
+            {
+                if (generator() % 2 == 0)
+                {
+                    edges.emplace_back(atom[i], atom[j]);
+                }
+            }
+        }
+
+        atoms.push_back(atom);
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        if (!graph.isNeighbor(edge.first, edge.second))
+        {
+            graph.addEdge(edge.first, edge.second);
+        }
+    }
+}
+
+/**
+ *  The number of orderings computed by instances of CountingOrderingAlgorithm.
+ */
+static std::atomic<std::size_t> countedOrderings(0);
+
+/**
+ *  Min-degree ordering algorithm which counts the width-limited orderings it computes for preprocessed graphs.
+ */
+class CountingOrderingAlgorithm : public htd::IWidthLimitableOrderingAlgorithm
+{
+    public:
+        CountingOrderingAlgorithm(const htd::LibraryInstance * const manager) : baseAlgorithm_(manager)
+        {
+
+        }
+
+        virtual ~CountingOrderingAlgorithm()
+        {
+
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.managementInstance();
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            baseAlgorithm_.setManagementInstance(manager);
+        }
+
+        htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph);
+        }
+
+        htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph, preprocessedGraph);
+        }
+
+        htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph, maxBagSize, maxIterationCount);
+        }
+
+        htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            ++countedOrderings;
+
+            return baseAlgorithm_.computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        }
+
+        CountingOrderingAlgorithm * clone(void) const HTD_OVERRIDE
+        {
+            return new CountingOrderingAlgorithm(managementInstance());
+        }
+
+    private:
+        htd::MinDegreeOrderingAlgorithm baseAlgorithm_;
+};
+
 TEST(GraphPreprocessorTest, CheckCloneMethod)
 {
     htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
@@ -83,6 +208,61 @@ TEST(GraphPreprocessorTest, CheckCloneMethod)
     delete clonedPreprocessor;
 }
 
+TEST(GraphPreprocessorTest, CheckCloneMethodCopiesSettings)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(7);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomAtoms(graph, generator, 20);
+
+    htd::GraphPreprocessor * preprocessor = new htd::GraphPreprocessor(libraryInstance);
+
+    preprocessor->setPreprocessingStrategy(4);
+    preprocessor->setIterationCount(3);
+    preprocessor->setNonImprovementLimit(2);
+    preprocessor->setThreadCount(4);
+    preprocessor->setOrderingAlgorithm(new CountingOrderingAlgorithm(libraryInstance));
+
+    htd::GraphPreprocessor * clonedPreprocessor = preprocessor->clone();
+
+    /* The clone must own its ordering algorithm. */
+    delete preprocessor;
+
+    ASSERT_EQ((std::size_t)3, clonedPreprocessor->iterationCount());
+    ASSERT_EQ((std::size_t)2, clonedPreprocessor->nonImprovementLimit());
+    ASSERT_EQ((std::size_t)4, clonedPreprocessor->threadCount());
+
+    htd::GraphPreprocessor referencePreprocessor(libraryInstance);
+
+    referencePreprocessor.setPreprocessingStrategy(4);
+    referencePreprocessor.setIterationCount(3);
+    referencePreprocessor.setNonImprovementLimit(2);
+    referencePreprocessor.setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+
+    countedOrderings = 0;
+
+    const htd::IPreprocessedGraph * preprocessedGraph = clonedPreprocessor->prepare(graph);
+
+    ASSERT_GT(countedOrderings.load(), (std::size_t)0);
+
+    const htd::IPreprocessedGraph * referencePreprocessedGraph = referencePreprocessor.prepare(graph);
+
+    ASSERT_GT(preprocessedGraph->atoms().size(), (std::size_t)1);
+
+    ASSERT_EQ(referencePreprocessedGraph->atoms(), preprocessedGraph->atoms());
+    ASSERT_EQ(referencePreprocessedGraph->eliminationSequence(), preprocessedGraph->eliminationSequence());
+    ASSERT_EQ(referencePreprocessedGraph->remainingVertices(), preprocessedGraph->remainingVertices());
+    ASSERT_EQ(referencePreprocessedGraph->eliminationSequenceBagSize(), preprocessedGraph->eliminationSequenceBagSize());
+
+    delete preprocessedGraph;
+    delete referencePreprocessedGraph;
+    delete clonedPreprocessor;
+    delete libraryInstance;
+}
+
 TEST(GraphPreprocessorTest, CheckEmptyGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1457,6 +1637,264 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckResultRandomGraphIsIndependentOfThreadCount)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(42);
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        std::size_t k = 3 + iteration % 6;
+
+        htd::MultiHypergraph graph(libraryInstance, 1000);
+
+        std::vector<std::vector<htd::vertex_t>> cliques;
+
+        std::vector<htd::vertex_t> initialClique;
+
+        for (htd::vertex_t vertex = 1; vertex <= k + 1; ++vertex)
+        {
+            initialClique.push_back(vertex);
+        }
+
+        cliques.push_back(initialClique);
+
+        /* Construct a random partial k-tree, i.e., a k-tree from which some of the edges are removed. */
+        for (htd::vertex_t vertex = 1; vertex <= 1000; ++vertex)
+        {
+            std::vector<htd::vertex_t> neighbors;
+
+            if (vertex <= k + 1)
+            {
+                neighbors.assign(initialClique.begin(), initialClique.begin() + (vertex - 1));
+            }
+            else
+            {
+                neighbors = cliques[generator() % cliques.size()];
+
+                neighbors.erase(neighbors.begin() + generator() % neighbors.size());
+
+                std::vector<htd::vertex_t> clique(neighbors);
+
+                clique.push_back(vertex);
+
+                cliques.push_back(clique);
+            }
+
+            for (htd::vertex_t neighbor : neighbors)
+            {
+                if (generator() % 10 != 0)
+                {
+                    graph.addEdge(vertex, neighbor);
+                }
+            }
+        }
+
+        htd::GraphPreprocessor preprocessor1(libraryInstance);
+        htd::GraphPreprocessor preprocessor2(libraryInstance);
+
+        // Use the most sophisticated preprocessing strategy available.
+        preprocessor1.setPreprocessingStrategy((std::size_t)-1);
+        preprocessor2.setPreprocessingStrategy((std::size_t)-1);
+
+        preprocessor2.setThreadCount(4);
+
+        ASSERT_EQ((std::size_t)1, preprocessor1.threadCount());
+        ASSERT_EQ((std::size_t)4, preprocessor2.threadCount());
+
+        const htd::IPreprocessedGraph * preprocessedGraph1 = preprocessor1.prepare(graph);
+        const htd::IPreprocessedGraph * preprocessedGraph2 = preprocessor2.prepare(graph);
+
+        ASSERT_FALSE(preprocessedGraph1->eliminationSequence().empty());
+
+        ASSERT_EQ(graph.vertexCount(), preprocessedGraph1->remainingVertices().size() +
+                                       preprocessedGraph1->eliminationSequence().size());
+
+        ASSERT_EQ(preprocessedGraph1->eliminationSequence(), preprocessedGraph2->eliminationSequence());
+        ASSERT_EQ(preprocessedGraph1->remainingVertices(), preprocessedGraph2->remainingVertices());
+        ASSERT_EQ(preprocessedGraph1->minTreeWidth(), preprocessedGraph2->minTreeWidth());
+
+        for (htd::vertex_t vertex : preprocessedGraph1->remainingVertices())
+        {
+            ASSERT_EQ(preprocessedGraph1->neighborhood(vertex), preprocessedGraph2->neighborhood(vertex));
+        }
+
+        delete preprocessedGraph1;
+        delete preprocessedGraph2;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckAtomsOfRandomGraphAreEliminatedCorrectly)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(24);
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance);
+
+        addRandomAtoms(graph, generator, 20 + iteration * 5);
+
+        htd::GraphPreprocessor preprocessor1(libraryInstance);
+        htd::GraphPreprocessor preprocessor2(libraryInstance);
+        htd::GraphPreprocessor preprocessor3(libraryInstance);
+
+        preprocessor1.setPreprocessingStrategy(4);
+        preprocessor2.setPreprocessingStrategy(4);
+        preprocessor3.setPreprocessingStrategy(3);
+
+        preprocessor2.setThreadCount(4);
+
+        const htd::IPreprocessedGraph * preprocessedGraph1 = preprocessor1.prepare(graph);
+        const htd::IPreprocessedGraph * preprocessedGraph2 = preprocessor2.prepare(graph);
+        const htd::IPreprocessedGraph * preprocessedGraph3 = preprocessor3.prepare(graph);
+
+        ASSERT_GT(preprocessedGraph1->atoms().size(), (std::size_t)1);
+
+        ASSERT_EQ(preprocessedGraph1->atoms(), preprocessedGraph2->atoms());
+        ASSERT_EQ(preprocessedGraph1->eliminationSequence(), preprocessedGraph2->eliminationSequence());
+        ASSERT_EQ(preprocessedGraph1->remainingVertices(), preprocessedGraph2->remainingVertices());
+        ASSERT_EQ(preprocessedGraph1->minTreeWidth(), preprocessedGraph2->minTreeWidth());
+        ASSERT_EQ(preprocessedGraph1->eliminationSequenceBagSize(), preprocessedGraph2->eliminationSequenceBagSize());
+
+        /* The atoms are eliminated heuristically, hence they must not affect the lower bound for the treewidth. */
+        ASSERT_EQ(preprocessedGraph3->minTreeWidth(), preprocessedGraph1->minTreeWidth());
+        ASSERT_GE(preprocessedGraph1->eliminationSequenceBagSize(), preprocessedGraph1->minTreeWidth() + 1);
+
+        std::vector<htd::vertex_t> remainingVertices(preprocessedGraph1->remainingVertices());
+
+        std::sort(remainingVertices.begin(), remainingVertices.end());
+
+        ASSERT_EQ(preprocessedGraph1->atoms().back(), remainingVertices);
+
+        std::vector<htd::vertex_t> ordering(preprocessedGraph1->eliminationSequence());
+
+        for (htd::vertex_t vertex : preprocessedGraph1->remainingVertices())
+        {
+            ordering.push_back(preprocessedGraph1->vertexName(vertex));
+        }
+
+        ASSERT_TRUE(isValidOrdering(graph, ordering));
+
+        /* Eliminating the vertices of the elimination sequence must neither create bags exceeding the reported bag size nor fill edges not present in the preprocessed graph. */
+        std::vector<std::vector<htd::vertex_t>> neighborhood(graph.vertexCount() + 1);
+
+        for (htd::vertex_t vertex : graph.vertices())
+        {
+            for (htd::vertex_t neighbor : graph.neighbors(vertex))
+            {
+                neighborhood[vertex].push_back(neighbor);
+            }
+        }
+
+        for (htd::vertex_t vertex : preprocessedGraph1->eliminationSequence())
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+            ASSERT_LT(currentNeighborhood.size(), preprocessedGraph1->eliminationSequenceBagSize());
+
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+                otherNeighborhood.erase(std::find(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
+
+                for (htd::vertex_t other : currentNeighborhood)
+                {
+                    if (other != neighbor && std::find(otherNeighborhood.begin(), otherNeighborhood.end(), other) == otherNeighborhood.end())
+                    {
+                        otherNeighborhood.push_back(other);
+                    }
+                }
+            }
+
+            currentNeighborhood.clear();
+        }
+
+        for (htd::vertex_t vertex : preprocessedGraph1->remainingVertices())
+        {
+            std::vector<htd::vertex_t> expectedNeighborhood;
+
+            for (htd::vertex_t neighbor : preprocessedGraph1->neighborhood(vertex))
+            {
+                expectedNeighborhood.push_back(preprocessedGraph1->vertexName(neighbor));
+            }
+
+            std::vector<htd::vertex_t> & actualNeighborhood = neighborhood[preprocessedGraph1->vertexName(vertex)];
+
+            std::sort(expectedNeighborhood.begin(), expectedNeighborhood.end());
+            std::sort(actualNeighborhood.begin(), actualNeighborhood.end());
+
+            ASSERT_EQ(expectedNeighborhood, actualNeighborhood);
+        }
+
+        htd::MinFillOrderingAlgorithm orderingAlgorithm(libraryInstance);
+
+        htd::IWidthLimitedVertexOrdering * vertexOrdering = orderingAlgorithm.computeOrdering(graph, *preprocessedGraph1, (std::size_t)-1, 1);
+
+        ASSERT_NE(vertexOrdering, nullptr);
+
+        /* The bags of the eliminated atoms are part of the ordering, even if they exceed the lower bound for the treewidth. */
+        ASSERT_GE(vertexOrdering->maximumBagSize(), preprocessedGraph1->eliminationSequenceBagSize());
+
+        delete vertexOrdering;
+
+        delete preprocessedGraph1;
+        delete preprocessedGraph2;
+        delete preprocessedGraph3;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(GraphPreprocessorTest, CheckAtomsAreEliminatedWithSelectedOrderingAlgorithm)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(11);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomAtoms(graph, generator, 20);
+
+    libraryInstance->orderingAlgorithmFactory().setConstructionTemplate(new CountingOrderingAlgorithm(libraryInstance));
+
+    htd::IWidthLimitableOrderingAlgorithm * orderingAlgorithm = dynamic_cast<htd::IWidthLimitableOrderingAlgorithm *>(libraryInstance->orderingAlgorithmFactory().createInstance());
+
+    ASSERT_NE(orderingAlgorithm, nullptr);
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+    htd::GraphPreprocessor referencePreprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(4);
+    referencePreprocessor.setPreprocessingStrategy(4);
+
+    preprocessor.setOrderingAlgorithm(orderingAlgorithm);
+    referencePreprocessor.setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+
+    countedOrderings = 0;
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    ASSERT_GT(preprocessedGraph->atoms().size(), (std::size_t)1);
+
+    /* Each atom but the largest one is eliminated using the selected ordering algorithm. */
+    ASSERT_GE(countedOrderings.load(), preprocessedGraph->atoms().size() - 1);
+
+    const htd::IPreprocessedGraph * referencePreprocessedGraph = referencePreprocessor.prepare(graph);
+
+    ASSERT_EQ(referencePreprocessedGraph->eliminationSequence(), preprocessedGraph->eliminationSequence());
+    ASSERT_EQ(referencePreprocessedGraph->eliminationSequenceBagSize(), preprocessedGraph->eliminationSequenceBagSize());
+
+    delete preprocessedGraph;
+    delete referencePreprocessedGraph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
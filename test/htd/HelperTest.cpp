@@ -26,6 +26,11 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <random>
 #include <vector>
 
 class HelperTest : public ::testing::Test
@@ -714,6 +719,109 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+TEST(HelperTest, CheckBitsetOperationSizes)
+{
+    std::mt19937_64 generator(1234);
+
+    for (std::size_t wordCount : { 1, 3, 8, 17 })
+    {
+        std::vector<std::uint64_t> bitset1(wordCount);
+        std::vector<std::uint64_t> bitset2(wordCount);
+        std::vector<std::uint64_t> bitset3(wordCount);
+
+        std::size_t expectedIntersectionSize = 0;
+        std::size_t expectedDifferenceSize = 0;
+        std::size_t expectedIntersectionDifferenceSize = 0;
+
+        for (std::size_t index = 0; index < wordCount; ++index)
+        {
+            bitset1[index] = generator();
+            bitset2[index] = generator();
+            bitset3[index] = generator();
+
+            for (std::size_t bit = 0; bit < 64; ++bit)
+            {
+                bool bit1 = (bitset1[index] >> bit) & 1;
+                bool bit2 = (bitset2[index] >> bit) & 1;
+                bool bit3 = (bitset3[index] >> bit) & 1;
+
+                expectedIntersectionSize += bit1 && bit2;
+                expectedDifferenceSize += bit1 && !bit2;
+                expectedIntersectionDifferenceSize += bit1 && bit2 && !bit3;
+            }
+        }
+
+        ASSERT_EQ(expectedIntersectionSize, htd::bitset_intersection_size(bitset1.data(), bitset2.data(), wordCount));
+        ASSERT_EQ(expectedDifferenceSize, htd::bitset_difference_size(bitset1.data(), bitset2.data(), wordCount));
+        ASSERT_EQ(expectedIntersectionDifferenceSize, htd::bitset_intersection_difference_size(bitset1.data(), bitset2.data(), bitset3.data(), wordCount));
+    }
+}
+
+TEST(HelperTest, CheckVertexSetIntersection)
+{
+    std::mt19937 generator(1234);
+
+    std::vector<std::pair<std::size_t, std::size_t>> sizes { { 0, 5 }, { 3, 3 }, { 7, 9 }, { 16, 16 }, { 33, 70 }, { 200, 180 }, { 4, 1000 }, { 1000, 20 }, { 0, 100 }, { 100, 0 } };
+
+    for (const std::pair<std::size_t, std::size_t> & size : sizes)
+    {
+        for (htd::vertex_t universe : { 40, 400, 4000 })
+        {
+            std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, universe);
+
+            std::vector<htd::vertex_t> set1;
+            std::vector<htd::vertex_t> set2;
+
+            for (std::size_t index = 0; index < size.first; ++index)
+            {
+                set1.push_back(vertexDistribution(generator));
+            }
+
+            for (std::size_t index = 0; index < size.second; ++index)
+            {
+                set2.push_back(vertexDistribution(generator));
+            }
+
+            std::sort(set1.begin(), set1.end());
+            std::sort(set2.begin(), set2.end());
+
+            set1.erase(std::unique(set1.begin(), set1.end()), set1.end());
+            set2.erase(std::unique(set2.begin(), set2.end()), set2.end());
+
+            std::vector<htd::vertex_t> expectedIntersection;
+            std::vector<htd::vertex_t> expectedDifference;
+
+            std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(expectedIntersection));
+            std::set_difference(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(expectedDifference));
+
+            std::vector<htd::vertex_t> actualIntersection { 0 };
+
+            htd::set_intersection(set1, set2, actualIntersection);
+
+            ASSERT_EQ((htd::vertex_t)0, actualIntersection[0]);
+
+            actualIntersection.erase(actualIntersection.begin());
+
+            ASSERT_EQ(expectedIntersection, actualIntersection);
+
+            ASSERT_EQ(expectedIntersection.size(), htd::vertex_set_intersection_size(set1.data(), set1.size(), set2.data(), set2.size()));
+            ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(set1.begin(), set1.end(), set2.cbegin(), set2.cend()));
+            ASSERT_EQ(expectedDifference.size(), htd::set_difference_size(set1.cbegin(), set1.cend(), set2.begin(), set2.end()));
+
+            std::list<htd::vertex_t> list1(set1.begin(), set1.end());
+
+            ASSERT_EQ(expectedIntersection.size(), htd::set_intersection_size(list1.begin(), list1.end(), set2.begin(), set2.end()));
+            ASSERT_EQ(expectedDifference.size(), htd::set_difference_size(list1.begin(), list1.end(), set2.begin(), set2.end()));
+
+            const std::tuple<std::size_t, std::size_t, std::size_t> & analysis = htd::analyze_sets(set1, set2);
+
+            ASSERT_EQ(expectedDifference.size(), std::get<0>(analysis));
+            ASSERT_EQ(expectedIntersection.size(), std::get<1>(analysis));
+            ASSERT_EQ(set2.size() - expectedIntersection.size(), std::get<2>(analysis));
+        }
+    }
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -27,6 +27,9 @@
 #include <htd/main.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -91,6 +94,56 @@ bool isValidHypertreeDecomposition(const htd::IMultiHypergraph & graph, const ht
     return ret;
 }
 
+/**
+ *  Set-cover algorithm which waits until the time limit of its management instance is reached before it solves the first set-cover problem.
+ */
+class DelayedSetCoverAlgorithm : public htd::ISetCoverAlgorithm
+{
+    public:
+        DelayedSetCoverAlgorithm(const htd::LibraryInstance * const manager) : baseAlgorithm_(manager)
+        {
+
+        }
+
+        virtual ~DelayedSetCoverAlgorithm()
+        {
+
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.managementInstance();
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            baseAlgorithm_.setManagementInstance(manager);
+        }
+
+        void computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE
+        {
+            while (managementInstance()->remainingTime() > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(managementInstance()->remainingTime()));
+            }
+
+            baseAlgorithm_.computeSetCover(elements, containers, target);
+        }
+
+        void computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE
+        {
+            computeSetCover(std::vector<htd::id_t>(elements.begin(), elements.end()), std::vector<std::vector<htd::id_t>>(containers.begin(), containers.end()), target);
+        }
+
+        DelayedSetCoverAlgorithm * clone(void) const HTD_OVERRIDE
+        {
+            return new DelayedSetCoverAlgorithm(managementInstance());
+        }
+
+    private:
+        htd::GreedySetCoverAlgorithm baseAlgorithm_;
+};
+
 TEST(HypertreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -466,6 +519,119 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultSimpleGraphWithLabelingFunc
     delete libraryInstance;
 }
 
+TEST(HypertreeDecompositionAlgorithmTest, CheckResultRandomHypergraphIsIndependentOfThreadCount)
+{
+    std::vector<std::vector<std::vector<htd::id_t>>> coveringEdges;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+        htd::MultiHypergraph graph(libraryInstance);
+
+        graph.addVertices(60);
+
+        std::mt19937 generator(1234);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, 60);
+
+        for (std::size_t index = 0; index < 90; ++index)
+        {
+            std::vector<htd::vertex_t> elements;
+
+            for (std::size_t position = 0; position < 2 + index % 4; ++position)
+            {
+                elements.push_back(vertexDistribution(generator));
+            }
+
+            graph.addEdge(elements);
+        }
+
+        htd::HypertreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(threadCount);
+
+        ASSERT_EQ(threadCount, algorithm.threadCount());
+
+        htd::IHypertreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition));
+
+        coveringEdges.emplace_back();
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            std::vector<htd::id_t> edgeIds;
+
+            for (const htd::Hyperedge & hyperedge : decomposition->coveringEdges(vertex))
+            {
+                edgeIds.push_back(hyperedge.id());
+            }
+
+            coveringEdges.back().push_back(edgeIds);
+        }
+
+        delete decomposition;
+
+        delete libraryInstance;
+    }
+
+    ASSERT_EQ(coveringEdges[0], coveringEdges[1]);
+}
+
+TEST(HypertreeDecompositionAlgorithmTest, CheckResultTimeLimitReachedWhileCoveringBags)
+{
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+        libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new DelayedSetCoverAlgorithm(libraryInstance));
+
+        htd::MultiHypergraph graph(libraryInstance);
+
+        graph.addVertices(30);
+
+        for (htd::vertex_t vertex = 1; vertex < 30; ++vertex)
+        {
+            graph.addEdge(vertex, vertex + 1);
+        }
+
+        htd::HypertreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        algorithm.setThreadCount(threadCount);
+
+        libraryInstance->setTimeLimit(100);
+
+        htd::IHypertreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_TRUE(libraryInstance->isTerminated());
+
+        ASSERT_EQ(decomposition, nullptr);
+
+        libraryInstance->setTimeLimit((std::size_t)-1);
+
+        libraryInstance->reset();
+
+        libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new htd::GreedySetCoverAlgorithm(libraryInstance));
+
+        decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_TRUE(isValidHypertreeDecomposition(graph, *decomposition));
+
+        delete decomposition;
+
+        delete libraryInstance;
+    }
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,287 @@
+/*
+ * File:   InducedHyperedgeIndexTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+class InducedHyperedgeIndexTest : public ::testing::Test
+{
+    public:
+        InducedHyperedgeIndexTest(void)
+        {
+
+        }
+
+        virtual ~InducedHyperedgeIndexTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+void addRandomHyperedges(htd::MultiHypergraph & graph, std::size_t vertexCount, std::size_t edgeCount)
+{
+    graph.addVertices(vertexCount);
+
+    std::mt19937 generator(4711);
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+    std::uniform_int_distribution<std::size_t> sizeDistribution(1, 4);
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        std::vector<htd::vertex_t> elements;
+
+        std::size_t size = sizeDistribution(generator);
+
+        for (std::size_t position = 0; position < size; ++position)
+        {
+            elements.push_back(vertexDistribution(generator));
+        }
+
+        graph.addEdge(elements);
+    }
+}
+
+std::vector<htd::id_t> expectedInducedHyperedges(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & bag)
+{
+    std::vector<htd::id_t> ret;
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        if (std::includes(bag.begin(), bag.end(), hyperedge.sortedElements().begin(), hyperedge.sortedElements().end()))
+        {
+            ret.push_back(hyperedge.id());
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+std::vector<htd::id_t> actualInducedHyperedges(const htd::FilteredHyperedgeCollection & inducedHyperedges)
+{
+    std::vector<htd::id_t> ret;
+
+    for (const htd::Hyperedge & hyperedge : inducedHyperedges)
+    {
+        ret.push_back(hyperedge.id());
+    }
+
+    std::sort(ret.begin(), ret.end());
+
+    return ret;
+}
+
+TEST(InducedHyperedgeIndexTest, CheckInducedHyperedges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomHyperedges(graph, 30, 80);
+
+    htd::InducedHyperedgeIndex index(graph);
+
+    std::mt19937 generator(42);
+
+    for (std::size_t iteration = 0; iteration < 50; ++iteration)
+    {
+        std::vector<htd::vertex_t> bag;
+
+        for (htd::vertex_t vertex : graph.vertices())
+        {
+            if (generator() % 3 != 0)
+            {
+                bag.push_back(vertex);
+            }
+        }
+
+        ASSERT_EQ(expectedInducedHyperedges(graph, bag), actualInducedHyperedges(index.inducedHyperedges(bag)));
+
+        std::reverse(bag.begin(), bag.end());
+
+        std::vector<htd::vertex_t> sortedBag(bag.rbegin(), bag.rend());
+
+        ASSERT_EQ(expectedInducedHyperedges(graph, sortedBag), actualInducedHyperedges(index.inducedHyperedges(bag)));
+    }
+
+    ASSERT_EQ((std::size_t)0, index.inducedHyperedges(std::vector<htd::vertex_t>()).size());
+
+    delete libraryInstance;
+}
+
+TEST(InducedHyperedgeIndexTest, CheckLazyTreeDecomposition)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomHyperedges(graph, 20, 40);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child = decomposition.addChild(root, std::vector<htd::vertex_t> { 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.setInducedHyperedgeIndex(std::make_shared<htd::InducedHyperedgeIndex>(graph));
+
+    ASSERT_EQ(expectedInducedHyperedges(graph, decomposition.bagContent(root)), actualInducedHyperedges(decomposition.inducedHyperedges(root)));
+    ASSERT_EQ(expectedInducedHyperedges(graph, decomposition.bagContent(child)), actualInducedHyperedges(decomposition.inducedHyperedges(child)));
+
+    decomposition.mutableBagContent(root) = std::vector<htd::vertex_t> { 1, 2, 3 };
+
+    decomposition.evictInducedHyperedges(root);
+
+    ASSERT_EQ(expectedInducedHyperedges(graph, decomposition.bagContent(root)), actualInducedHyperedges(decomposition.inducedHyperedges(root)));
+
+    decomposition.evictInducedHyperedges(child);
+
+    decomposition.setInducedHyperedgeIndex(nullptr);
+
+    ASSERT_EQ(expectedInducedHyperedges(graph, decomposition.bagContent(child)), actualInducedHyperedges(decomposition.inducedHyperedges(child)));
+
+    htd::TreeDecomposition copy(decomposition);
+
+    ASSERT_EQ(actualInducedHyperedges(decomposition.inducedHyperedges(root)), actualInducedHyperedges(copy.inducedHyperedges(root)));
+    ASSERT_EQ(actualInducedHyperedges(decomposition.inducedHyperedges(child)), actualInducedHyperedges(copy.inducedHyperedges(child)));
+
+    delete libraryInstance;
+}
+
+TEST(InducedHyperedgeIndexTest, CheckConcurrentAccess)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    addRandomHyperedges(graph, 100, 400);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setLazyInducedEdgeComputationEnabled(true);
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(decomposition, nullptr);
+
+    std::vector<bool> results(4, true);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 0; threadIndex < results.size(); ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            bool valid = true;
+
+            for (htd::vertex_t vertex : decomposition->vertices())
+            {
+                valid = valid && expectedInducedHyperedges(graph, decomposition->bagContent(vertex)) == actualInducedHyperedges(decomposition->inducedHyperedges(vertex));
+            }
+
+            results[threadIndex] = valid;
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    for (bool result : results)
+    {
+        ASSERT_TRUE(result);
+    }
+
+    decomposition.reset();
+
+    delete libraryInstance;
+}
+
+TEST(InducedHyperedgeIndexTest, CheckLazyAndEagerDecompositionsAgree)
+{
+    for (bool lazy : { false, true })
+    {
+        for (std::size_t threadCount : { 1, 3 })
+        {
+            htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+            htd::MultiHypergraph graph(libraryInstance);
+
+            addRandomHyperedges(graph, 60, 50);
+
+            htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+            algorithm.setThreadCount(threadCount);
+
+            algorithm.setLazyInducedEdgeComputationEnabled(lazy);
+
+            ASSERT_EQ(lazy, algorithm.isLazyInducedEdgeComputationEnabled());
+
+            htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+            ASSERT_NE(decomposition, nullptr);
+
+            htd::TreeDecompositionVerifier verifier;
+
+            ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+            for (htd::vertex_t vertex : decomposition->vertices())
+            {
+                ASSERT_EQ(expectedInducedHyperedges(graph, decomposition->bagContent(vertex)), actualInducedHyperedges(decomposition->inducedHyperedges(vertex)));
+            }
+
+            delete decomposition;
+
+            delete libraryInstance;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
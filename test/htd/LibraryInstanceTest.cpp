@@ -26,6 +26,11 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <thread>
 #include <vector>
 
 class LibraryInstanceTest : public ::testing::Test
@@ -52,6 +57,55 @@ class LibraryInstanceTest : public ::testing::Test
         }
 };
 
+/**
+ *  Set-cover algorithm which keeps track of the number of its instances which are alive.
+ */
+class CountingSetCoverAlgorithm : public htd::ISetCoverAlgorithm
+{
+    public:
+        CountingSetCoverAlgorithm(const htd::LibraryInstance * const manager) : baseAlgorithm_(manager)
+        {
+            ++instanceCount;
+        }
+
+        virtual ~CountingSetCoverAlgorithm()
+        {
+            --instanceCount;
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.managementInstance();
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            baseAlgorithm_.setManagementInstance(manager);
+        }
+
+        void computeSetCover(const std::vector<htd::id_t> & elements, const std::vector<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE
+        {
+            baseAlgorithm_.computeSetCover(elements, containers, target);
+        }
+
+        void computeSetCover(const htd::ConstCollection<htd::id_t> & elements, const htd::ConstCollection<std::vector<htd::id_t>> & containers, std::vector<htd::index_t> & target) const HTD_OVERRIDE
+        {
+            baseAlgorithm_.computeSetCover(elements, containers, target);
+        }
+
+        CountingSetCoverAlgorithm * clone(void) const HTD_OVERRIDE
+        {
+            return new CountingSetCoverAlgorithm(managementInstance());
+        }
+
+        static std::atomic<std::size_t> instanceCount;
+
+    private:
+        htd::GreedySetCoverAlgorithm baseAlgorithm_;
+};
+
+std::atomic<std::size_t> CountingSetCoverAlgorithm::instanceCount(0);
+
 class TestMultiHypergraph : public htd::MultiHypergraph
 {
     public:
@@ -97,6 +151,376 @@ TEST(LibraryInstanceTest, CheckTermination)
     delete libraryInstance;
 }
 
+TEST(LibraryInstanceTest, CheckTimeLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_EQ((std::size_t)-1, libraryInstance->timeLimit());
+    ASSERT_EQ((std::size_t)-1, libraryInstance->remainingTime());
+
+    libraryInstance->setTimeLimit(3600000);
+
+    ASSERT_EQ((std::size_t)3600000, libraryInstance->timeLimit());
+    ASSERT_LE(libraryInstance->remainingTime(), (std::size_t)3600000);
+    ASSERT_GT(libraryInstance->remainingTime(), (std::size_t)3000000);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_FALSE(libraryInstance->isTerminated());
+    }
+
+    htd::LibraryInstance * clone = htd::cloneManagementInstance(*libraryInstance);
+
+    ASSERT_LE(clone->remainingTime(), libraryInstance->remainingTime());
+    ASSERT_GT(clone->remainingTime(), (std::size_t)3000000);
+
+    libraryInstance->setTimeLimit(0);
+
+    ASSERT_EQ((std::size_t)0, libraryInstance->remainingTime());
+
+    ASSERT_TRUE(libraryInstance->isTerminated());
+    ASSERT_TRUE(libraryInstance->isBudgetExhausted());
+
+    ASSERT_FALSE(clone->isTerminated());
+
+    libraryInstance->reset();
+
+    ASSERT_FALSE(libraryInstance->isBudgetExhausted());
+
+    bool terminated = false;
+
+    for (std::size_t index = 0; index < 16 && !terminated; ++index)
+    {
+        terminated = libraryInstance->isTerminated();
+    }
+
+    ASSERT_TRUE(terminated);
+
+    libraryInstance->setTimeLimit((std::size_t)-1);
+
+    libraryInstance->reset();
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_FALSE(libraryInstance->isTerminated());
+    }
+
+    delete clone;
+    delete libraryInstance;
+}
+
+TEST(LibraryInstanceTest, CheckMemoryLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_EQ((std::size_t)-1, libraryInstance->memoryLimit());
+
+    if (htd::currentMemoryUsage() > 0)
+    {
+        libraryInstance->setMemoryLimit(htd::currentMemoryUsage() * 64);
+
+        for (std::size_t index = 0; index < 2048; ++index)
+        {
+            ASSERT_FALSE(libraryInstance->isTerminated());
+        }
+
+        libraryInstance->setMemoryLimit(1);
+
+        ASSERT_EQ((std::size_t)1, libraryInstance->memoryLimit());
+
+        ASSERT_TRUE(libraryInstance->isTerminated());
+        ASSERT_TRUE(libraryInstance->isBudgetExhausted());
+    }
+
+    delete libraryInstance;
+}
+
+TEST(LibraryInstanceTest, CheckMemoryLimitAfterMemorySpike)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    if (htd::currentMemoryUsage() > 0)
+    {
+        const std::size_t spikeSize = 256 * 1024 * 1024;
+
+        {
+            /* Value-initialization touches every page of the spike, hence it becomes resident. */
+            std::vector<char> spike(spikeSize);
+
+            /* Storing the address in a volatile variable prevents the compiler from eliding the allocation. */
+            char * volatile spikeData = spike.data();
+
+            ASSERT_NE(spikeData, nullptr);
+
+            ASSERT_GE(htd::currentMemoryUsage(), spikeSize);
+        }
+
+        ASSERT_GE(htd::peakMemoryUsage(), spikeSize);
+
+        /* The limit is below the peak memory usage caused by the spike, but the spike was released already. */
+        libraryInstance->setMemoryLimit(htd::currentMemoryUsage() + spikeSize / 2);
+
+        for (std::size_t index = 0; index < 2048; ++index)
+        {
+            ASSERT_FALSE(libraryInstance->isTerminated());
+        }
+
+        ASSERT_FALSE(libraryInstance->isBudgetExhausted());
+    }
+
+    delete libraryInstance;
+}
+
+TEST(LibraryInstanceTest, CheckFactoryConfigurationCopy)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST + 1);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance1);
+
+    treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+
+    libraryInstance1->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+
+    libraryInstance2->copyFactoryConfiguration(*libraryInstance1);
+
+    htd::ITreeDecompositionAlgorithm * algorithm = libraryInstance2->treeDecompositionAlgorithmFactory().createInstance();
+
+    ASSERT_FALSE(algorithm->isComputeInducedEdgesEnabled());
+    ASSERT_EQ(libraryInstance2, algorithm->managementInstance());
+
+    htd::IMutableMultiHypergraph * graph = libraryInstance2->multiHypergraphFactory().createInstance();
+
+    ASSERT_EQ(libraryInstance2, graph->managementInstance());
+
+    libraryInstance1->terminate();
+
+    ASSERT_FALSE(libraryInstance2->isTerminated());
+
+    delete graph;
+    delete algorithm;
+    delete libraryInstance1;
+    delete libraryInstance2;
+}
+
+TEST(LibraryInstanceTest, CheckCloneFunction)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST + 3);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * treeDecompositionAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance1);
+
+    treeDecompositionAlgorithm->setComputeInducedEdgesEnabled(false);
+
+    libraryInstance1->treeDecompositionAlgorithmFactory().setConstructionTemplate(treeDecompositionAlgorithm);
+
+    libraryInstance1->randomNumberGenerator().seed(1234);
+
+    libraryInstance1->terminate();
+
+    htd::LibraryInstance * libraryInstance2 = htd::cloneManagementInstance(*libraryInstance1);
+
+    ASSERT_EQ(libraryInstance1->id(), libraryInstance2->id());
+    ASSERT_FALSE(libraryInstance2->isTerminated());
+
+    htd::ITreeDecompositionAlgorithm * algorithm = libraryInstance2->treeDecompositionAlgorithmFactory().createInstance();
+
+    ASSERT_FALSE(algorithm->isComputeInducedEdgesEnabled());
+    ASSERT_EQ(libraryInstance2, algorithm->managementInstance());
+
+    for (std::size_t index = 0; index < 10; ++index)
+    {
+        ASSERT_EQ(libraryInstance1->randomNumberGenerator()(), libraryInstance2->randomNumberGenerator()());
+    }
+
+    delete algorithm;
+    delete libraryInstance1;
+    delete libraryInstance2;
+}
+
+TEST(LibraryInstanceTest, CheckReplacedConstructionTemplatesAreReleased)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new CountingSetCoverAlgorithm(libraryInstance));
+
+        ASSERT_EQ((std::size_t)1, CountingSetCoverAlgorithm::instanceCount.load());
+    }
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        htd::LibraryInstance * clone = htd::cloneManagementInstance(*libraryInstance);
+
+        ASSERT_EQ((std::size_t)2, CountingSetCoverAlgorithm::instanceCount.load());
+
+        delete clone;
+    }
+
+    ASSERT_EQ((std::size_t)1, CountingSetCoverAlgorithm::instanceCount.load());
+
+    delete libraryInstance;
+
+    ASSERT_EQ((std::size_t)0, CountingSetCoverAlgorithm::instanceCount.load());
+}
+
+TEST(LibraryInstanceTest, CheckConcurrentlyReplacedConstructionTemplatesAreBounded)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new CountingSetCoverAlgorithm(libraryInstance));
+
+    std::size_t readerCount = 4;
+
+    std::size_t retiredInstanceLimit = htd::ConcurrentConstructionTemplate<htd::ISetCoverAlgorithm>::RETIRED_INSTANCE_LIMIT;
+
+    std::size_t maximumInstanceCount = 0;
+
+    std::atomic<bool> finished(false);
+
+    std::vector<std::thread> readers;
+
+    for (std::size_t readerIndex = 0; readerIndex < readerCount; ++readerIndex)
+    {
+        readers.emplace_back([&](void)
+        {
+            while (!finished)
+            {
+                std::unique_ptr<htd::ISetCoverAlgorithm> algorithm(libraryInstance->setCoverAlgorithmFactory().createInstance());
+            }
+        });
+    }
+
+    for (std::size_t index = 0; index < 1000; ++index)
+    {
+        libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new CountingSetCoverAlgorithm(libraryInstance));
+
+        maximumInstanceCount = std::max(maximumInstanceCount, CountingSetCoverAlgorithm::instanceCount.load());
+    }
+
+    finished = true;
+
+    for (std::thread & reader : readers)
+    {
+        reader.join();
+    }
+
+    /* Besides the current construction template, only the retired ones and one clone per reader may be alive. */
+    ASSERT_LE(maximumInstanceCount, 1 + retiredInstanceLimit + readerCount);
+
+    libraryInstance->setCoverAlgorithmFactory().setConstructionTemplate(new CountingSetCoverAlgorithm(libraryInstance));
+
+    ASSERT_EQ((std::size_t)1, CountingSetCoverAlgorithm::instanceCount.load());
+
+    delete libraryInstance;
+
+    ASSERT_EQ((std::size_t)0, CountingSetCoverAlgorithm::instanceCount.load());
+}
+
+TEST(LibraryInstanceTest, CheckConcurrentDecompositions)
+{
+    htd::LibraryInstance * sharedInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    sharedInstance->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(sharedInstance));
+
+    std::atomic<bool> finished(false);
+
+    std::atomic<std::size_t> failureCount(0);
+
+    std::atomic<std::size_t> decompositionCount(0);
+
+    std::thread reconfigurationThread([&](void)
+    {
+        std::size_t round = 0;
+
+        while (!finished)
+        {
+            if (round % 2 == 0)
+            {
+                sharedInstance->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinFillOrderingAlgorithm(sharedInstance));
+            }
+            else
+            {
+                sharedInstance->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(sharedInstance));
+            }
+
+            sharedInstance->terminate();
+
+            sharedInstance->reset();
+
+            ++round;
+
+            std::this_thread::yield();
+        }
+    });
+
+    std::vector<std::thread> workers;
+
+    for (std::size_t workerIndex = 0; workerIndex < 8; ++workerIndex)
+    {
+        workers.emplace_back([&, workerIndex](void)
+        {
+            std::unique_ptr<htd::LibraryInstance> workerInstance(htd::cloneManagementInstance(*sharedInstance));
+
+            workerInstance->randomNumberGenerator().seed(workerIndex);
+
+            std::mt19937 generator(static_cast<std::mt19937::result_type>(workerIndex));
+
+            for (std::size_t iteration = 0; iteration < 25; ++iteration)
+            {
+                std::unique_ptr<htd::IMutableMultiHypergraph> graph(workerInstance->multiHypergraphFactory().createInstance());
+
+                graph->addVertices(30);
+
+                for (std::size_t index = 0; index < 60; ++index)
+                {
+                    htd::vertex_t vertex1 = static_cast<htd::vertex_t>(generator() % 30 + 1);
+                    htd::vertex_t vertex2 = static_cast<htd::vertex_t>(generator() % 30 + 1);
+
+                    if (vertex1 != vertex2)
+                    {
+                        graph->addEdge(vertex1, vertex2);
+                    }
+                }
+
+                htd::IOrderingAlgorithm * orderingAlgorithm = sharedInstance->orderingAlgorithmFactory().createInstance();
+
+                orderingAlgorithm->setManagementInstance(workerInstance.get());
+
+                htd::BucketEliminationTreeDecompositionAlgorithm algorithm(workerInstance.get());
+
+                algorithm.setOrderingAlgorithm(orderingAlgorithm);
+
+                std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(*graph));
+
+                htd::TreeDecompositionVerifier verifier;
+
+                if (decomposition == nullptr || !verifier.verify(*graph, *decomposition))
+                {
+                    ++failureCount;
+                }
+
+                ++decompositionCount;
+            }
+        });
+    }
+
+    for (std::thread & worker : workers)
+    {
+        worker.join();
+    }
+
+    finished = true;
+
+    reconfigurationThread.join();
+
+    EXPECT_EQ((std::size_t)0, failureCount.load());
+    EXPECT_EQ((std::size_t)200, decompositionCount.load());
+
+    delete sharedInstance;
+}
+
 TEST(LibraryInstanceTest, CheckMultiHypergraphFactory1)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
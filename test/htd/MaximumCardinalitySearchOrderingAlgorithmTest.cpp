@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <deque>
+#include <random>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -103,6 +106,78 @@ bool isValidOrdering(htd::MultiHypergraph & graph, const std::vector<htd::vertex
     return ret;
 }
 
+bool isValidEnhancedOrdering(const htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    bool ret = ordering.size() == graph.vertexCount();
+
+    std::unordered_map<htd::vertex_t, std::size_t> weights;
+
+    std::unordered_set<htd::vertex_t> unnumbered;
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        weights[vertex] = 0;
+
+        unnumbered.insert(vertex);
+    }
+
+    for (auto it = ordering.rbegin(); ret && it != ordering.rend(); ++it)
+    {
+        htd::vertex_t selectedVertex = *it;
+
+        ret = unnumbered.count(selectedVertex) == 1;
+
+        for (htd::vertex_t vertex : unnumbered)
+        {
+            ret = ret && weights.at(vertex) <= weights.at(selectedVertex);
+        }
+
+        unnumbered.erase(selectedVertex);
+
+        std::vector<htd::vertex_t> reachableVertices;
+
+        for (htd::vertex_t vertex : unnumbered)
+        {
+            std::unordered_set<htd::vertex_t> visited { vertex };
+
+            std::deque<htd::vertex_t> queue { vertex };
+
+            bool found = false;
+
+            while (!found && !queue.empty())
+            {
+                htd::vertex_t current = queue.front();
+
+                queue.pop_front();
+
+                for (htd::vertex_t neighbor : graph.neighbors(current))
+                {
+                    if (neighbor == selectedVertex)
+                    {
+                        found = true;
+                    }
+                    else if (unnumbered.count(neighbor) == 1 && weights.at(neighbor) < weights.at(vertex) && visited.insert(neighbor).second)
+                    {
+                        queue.push_back(neighbor);
+                    }
+                }
+            }
+
+            if (found)
+            {
+                reachableVertices.push_back(vertex);
+            }
+        }
+
+        for (htd::vertex_t vertex : reachableVertices)
+        {
+            ++(weights[vertex]);
+        }
+    }
+
+    return ret;
+}
+
 TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckEmptyGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -771,6 +846,43 @@ TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckSize50Graph)
     delete libraryInstance;
 }
 
+TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckEnhancedOrderingRandomGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    for (std::size_t iteration = 0; iteration < 10; ++iteration)
+    {
+        htd::MultiHypergraph graph(libraryInstance, 40);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, 40);
+
+        for (std::size_t index = 0; index < 20 + 10 * iteration; ++index)
+        {
+            htd::vertex_t vertex1 = vertexDistribution(generator);
+            htd::vertex_t vertex2 = vertexDistribution(generator);
+
+            if (vertex1 != vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+        ASSERT_NE(ordering, nullptr);
+
+        ASSERT_TRUE(isValidEnhancedOrdering(graph, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -26,6 +26,8 @@
 
 #include <htd/main.hpp>
 
+#include <cstdlib>
+#include <random>
 #include <vector>
 
 class MinFillOrderingAlgorithmTest : public ::testing::Test
@@ -149,6 +151,23 @@ TEST(MinFillOrderingAlgorithmTest, CheckCloneMethod)
     delete clonedAlgorithm;
 }
 
+TEST(MinFillOrderingAlgorithmTest, CheckDensityThreshold)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setDensityThreshold(0.5);
+
+    htd::MinFillOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(0.5, algorithm.densityThreshold());
+    ASSERT_EQ(0.5, clonedAlgorithm->densityThreshold());
+
+    delete libraryInstance;
+    delete clonedAlgorithm;
+}
+
 TEST(MinFillOrderingAlgorithmTest, CheckEmptyGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1296,6 +1315,62 @@ TEST(MinFillOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinFillOrderingAlgorithmTest, CheckBitsetBasedOrderingOnDenseGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    for (std::size_t vertexCount : { 20, 65, 130 })
+    {
+        for (double density : { 0.1, 0.3, 0.6 })
+        {
+            htd::MultiHypergraph graph(libraryInstance, vertexCount);
+
+            std::bernoulli_distribution edgeDistribution(density);
+
+            for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+            {
+                for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+                {
+                    if (edgeDistribution(generator))
+                    {
+                        graph.addEdge(vertex1, vertex2);
+                    }
+                }
+            }
+
+            htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+            algorithm.setDensityThreshold(2.0);
+
+            libraryInstance->randomNumberGenerator().seed(42);
+
+            const htd::IVertexOrdering * expectedOrdering = algorithm.computeOrdering(graph);
+
+            algorithm.setDensityThreshold(0.0);
+
+            libraryInstance->randomNumberGenerator().seed(42);
+
+            const htd::IVertexOrdering * actualOrdering = algorithm.computeOrdering(graph);
+
+            ASSERT_EQ(graph.vertexCount(), actualOrdering->sequence().size());
+
+            ASSERT_EQ(expectedOrdering->sequence(), actualOrdering->sequence());
+
+            if (vertexCount <= 65)
+            {
+                ASSERT_TRUE(isValidOrdering(graph, actualOrdering->sequence()));
+            }
+
+            delete expectedOrdering;
+            delete actualOrdering;
+        }
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,466 @@
+/*
+ * File:   MinimumSeparatorAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class MinimumSeparatorAlgorithmTest : public ::testing::Test
+{
+    public:
+        MinimumSeparatorAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~MinimumSeparatorAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Compute a separator by running a full maximum flow computation for each pair of non-adjacent vertices and taking the minimum cut closest to the first vertex of the pair.
+ *
+ *  htd::MinimumSeparatorAlgorithm must reproduce this separator unless computeReferenceSeparator() finds a separator of the same size.
+ */
+std::vector<htd::vertex_t> computeMinimumCutSeparator(const htd::LibraryInstance * const manager, const htd::IGraphStructure & graph)
+{
+    std::vector<htd::vertex_t> ret;
+
+    std::size_t n = graph.vertexCount();
+
+    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+
+    for (htd::index_t index = 0; index < n; ++index)
+    {
+        indices.emplace(graph.vertexAtPosition(index), index);
+    }
+
+    htd::FlowNetworkStructure flowNetwork(n * 2);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        htd::index_t vertexIndex = indices.at(vertex);
+
+        flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
+
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            htd::index_t neighborIndex = indices.at(neighbor);
+
+            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
+            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+        }
+    }
+
+    graph.copyVerticesTo(ret);
+
+    for (htd::index_t i = 0; i < n; ++i)
+    {
+        for (htd::index_t j = i + 1; j < n; ++j)
+        {
+            if (!graph.isNeighbor(graph.vertexAtPosition(i), graph.vertexAtPosition(j)))
+            {
+                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(manager);
+
+                std::unique_ptr<htd::IFlow> flow(maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j));
+
+                /* The candidate consists of the vertices whose in-node but not out-node is reachable from the source in the residual network. */
+                std::vector<bool> reachable(n * 2, false);
+
+                std::vector<htd::index_t> queue(1, i + n);
+
+                reachable[i + n] = true;
+
+                for (htd::index_t index = 0; index < queue.size(); ++index)
+                {
+                    for (htd::index_t node = 0; node < n * 2; ++node)
+                    {
+                        std::size_t capacity = flowNetwork.capacity(queue[index], node);
+
+                        if (!reachable[node] && (capacity == (std::size_t)-1 || static_cast<long long>(capacity) > flow->flow(queue[index], node)))
+                        {
+                            reachable[node] = true;
+
+                            queue.push_back(node);
+                        }
+                    }
+                }
+
+                std::unordered_set<htd::vertex_t> candidate;
+
+                for (htd::index_t k = 0; k < n; ++k)
+                {
+                    if (reachable[k] && !reachable[k + n])
+                    {
+                        candidate.insert(graph.vertexAtPosition(k));
+                    }
+                }
+
+                EXPECT_EQ(flow->value(), candidate.size());
+
+                if (candidate.size() < ret.size())
+                {
+                    ret.assign(candidate.begin(), candidate.end());
+
+                    std::sort(ret.begin(), ret.end());
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Compute a separator by running a full maximum flow computation for each pair of non-adjacent vertices.
+ *
+ *  This is the reference implementation of the previous algorithm, whose candidates consist of the vertices carrying
+ *  flow. Whenever its result is a minimum separator, htd::MinimumSeparatorAlgorithm must reproduce it.
+ */
+std::vector<htd::vertex_t> computeReferenceSeparator(const htd::LibraryInstance * const manager, const htd::IGraphStructure & graph)
+{
+    std::vector<htd::vertex_t> ret;
+
+    std::size_t n = graph.vertexCount();
+
+    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+
+    for (htd::index_t index = 0; index < n; ++index)
+    {
+        indices.emplace(graph.vertexAtPosition(index), index);
+    }
+
+    htd::FlowNetworkStructure flowNetwork(n * 2);
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        htd::index_t vertexIndex = indices.at(vertex);
+
+        flowNetwork.updateCapacity(vertexIndex, vertexIndex + n, 1);
+
+        for (htd::vertex_t neighbor : graph.neighbors(vertex))
+        {
+            htd::index_t neighborIndex = indices.at(neighbor);
+
+            flowNetwork.updateCapacity(vertexIndex + n, neighborIndex, (std::size_t)-1);
+            flowNetwork.updateCapacity(neighborIndex + n, vertexIndex, (std::size_t)-1);
+        }
+    }
+
+    graph.copyVerticesTo(ret);
+
+    for (htd::index_t i = 0; i < n; ++i)
+    {
+        for (htd::index_t j = i + 1; j < n; ++j)
+        {
+            if (!graph.isNeighbor(graph.vertexAtPosition(i), graph.vertexAtPosition(j)))
+            {
+                htd::DinitzMaxFlowAlgorithm maxFlowAlgorithm(manager);
+
+                std::unique_ptr<htd::IFlow> flow(maxFlowAlgorithm.determineMaximumFlow(flowNetwork, i + n, j));
+
+                std::unordered_set<htd::vertex_t> candidate;
+
+                for (htd::index_t k = 0; k < n; ++k)
+                {
+                    if (k != i && k != j && flow->flow(k, k + n) == 1)
+                    {
+                        candidate.insert(graph.vertexAtPosition(k));
+                    }
+                }
+
+                if (candidate.size() < ret.size())
+                {
+                    ret.assign(candidate.begin(), candidate.end());
+
+                    std::sort(ret.begin(), ret.end());
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckSeparatorOfPath)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(5);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2 }), *separator);
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckSeparatorOfCompleteGraph)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::Graph graph(libraryInstance.get());
+
+    graph.addVertices(4);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 4; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 4; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4 }), *separator);
+}
+
+/**
+ *  Compute the size of a smallest set of vertices whose removal disconnects the given graph by enumerating all vertex subsets.
+ *
+ *  @return The size of a smallest set of vertices whose removal disconnects the given graph or the number of vertices if no such set exists.
+ */
+std::size_t computeMinimumSeparatorSize(const htd::IGraphStructure & graph)
+{
+    std::size_t n = graph.vertexCount();
+
+    std::size_t ret = n;
+
+    for (std::size_t subset = 0; subset < ((std::size_t)1 << n); ++subset)
+    {
+        std::size_t size = 0;
+
+        std::vector<bool> removed(n, false);
+
+        for (htd::index_t index = 0; index < n; ++index)
+        {
+            if ((subset >> index) & 1)
+            {
+                removed[index] = true;
+
+                ++size;
+            }
+        }
+
+        if (size + 2 > n || size >= ret)
+        {
+            continue;
+        }
+
+        htd::index_t start = 0;
+
+        while (removed[start])
+        {
+            ++start;
+        }
+
+        std::vector<bool> reached(removed);
+
+        std::vector<htd::index_t> queue(1, start);
+
+        reached[start] = true;
+
+        for (htd::index_t index = 0; index < queue.size(); ++index)
+        {
+            for (htd::index_t other = 0; other < n; ++other)
+            {
+                if (!reached[other] && graph.isNeighbor(graph.vertexAtPosition(queue[index]), graph.vertexAtPosition(other)))
+                {
+                    reached[other] = true;
+
+                    queue.push_back(other);
+                }
+            }
+        }
+
+        if (std::find(reached.begin(), reached.end(), false) != reached.end())
+        {
+            ret = size;
+        }
+    }
+
+    return ret;
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckSeparatorsOfRandomGraphsAreMinimum)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::mt19937 generator(4321);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 8 + round % 5;
+
+        htd::Graph graph(libraryInstance.get());
+
+        graph.addVertices(vertexCount);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+        for (std::size_t index = 0; index < vertexCount * (1 + round % 3); ++index)
+        {
+            htd::vertex_t vertex1 = vertexDistribution(generator);
+            htd::vertex_t vertex2 = vertexDistribution(generator);
+
+            if (vertex1 != vertex2 && !graph.isNeighbor(vertex1, vertex2))
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+        ASSERT_EQ(computeMinimumSeparatorSize(graph), separator->size());
+    }
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckResultsOfRandomGraphsMatchReference)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::mt19937 generator(1234);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 10 + round;
+
+        htd::Graph graph(libraryInstance.get());
+
+        graph.addVertices(vertexCount);
+
+        std::uniform_int_distribution<htd::vertex_t> vertexDistribution(1, static_cast<htd::vertex_t>(vertexCount));
+
+        for (std::size_t index = 0; index < vertexCount * (1 + round % 4); ++index)
+        {
+            htd::vertex_t vertex1 = vertexDistribution(generator);
+            htd::vertex_t vertex2 = vertexDistribution(generator);
+
+            if (vertex1 != vertex2 && !graph.isNeighbor(vertex1, vertex2))
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+
+        std::vector<htd::vertex_t> expectedSeparator = computeMinimumCutSeparator(libraryInstance.get(), graph);
+
+        std::vector<htd::vertex_t> previousSeparator = computeReferenceSeparator(libraryInstance.get(), graph);
+
+        /* Where the previous algorithm found a minimum separator, its result is kept. */
+        if (previousSeparator.size() == expectedSeparator.size())
+        {
+            expectedSeparator = previousSeparator;
+        }
+
+        htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+        ASSERT_EQ(expectedSeparator, *separator);
+
+        algorithm.setThreadCount(3);
+
+        std::unique_ptr<htd::MinimumSeparatorAlgorithm> clonedAlgorithm(algorithm.clone());
+
+        ASSERT_EQ((std::size_t)3, clonedAlgorithm->threadCount());
+
+        std::unique_ptr<std::vector<htd::vertex_t>> parallelSeparator(clonedAlgorithm->computeSeparator(graph));
+
+        ASSERT_EQ(expectedSeparator, *parallelSeparator);
+    }
+}
+
+TEST(MinimumSeparatorAlgorithmTest, CheckSeparatorsOfPreviousAlgorithm)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    /* Both graphs have several minimum separators. The expected ones were returned by the previous algorithm. */
+    std::vector<std::pair<std::size_t, std::vector<std::pair<htd::vertex_t, htd::vertex_t>>>> graphs
+    {
+        { 10, { { 9, 1 }, { 9, 6 }, { 7, 6 }, { 4, 6 }, { 6, 5 }, { 3, 7 }, { 2, 4 }, { 4, 1 }, { 8, 7 }, { 4, 7 }, { 7, 10 }, { 9, 2 },
+                { 7, 2 }, { 3, 9 }, { 9, 4 }, { 1, 3 }, { 3, 4 } } },
+        { 14, { { 13, 11 }, { 7, 9 }, { 10, 5 }, { 12, 11 }, { 4, 10 }, { 4, 11 }, { 6, 1 }, { 6, 7 }, { 14, 8 }, { 13, 14 }, { 7, 3 },
+                { 1, 8 }, { 2, 8 }, { 3, 10 }, { 13, 9 }, { 1, 9 }, { 12, 13 }, { 6, 5 }, { 8, 6 }, { 5, 11 }, { 10, 13 }, { 2, 11 },
+                { 12, 9 }, { 12, 5 } } }
+    };
+
+    std::vector<std::vector<htd::vertex_t>> expectedSeparators { { 7 }, { 10, 11 } };
+
+    for (htd::index_t index = 0; index < graphs.size(); ++index)
+    {
+        htd::Graph graph(libraryInstance.get());
+
+        graph.addVertices(graphs[index].first);
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : graphs[index].second)
+        {
+            graph.addEdge(edge.first, edge.second);
+        }
+
+        htd::MinimumSeparatorAlgorithm algorithm(libraryInstance.get());
+
+        std::unique_ptr<std::vector<htd::vertex_t>> separator(algorithm.computeSeparator(graph));
+
+        ASSERT_EQ(expectedSeparators[index], *separator);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -584,6 +584,44 @@ TEST(MultiGraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiGraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 3, 1 }, { 1, 2 }, { 2, 2 }, { 4, 1 }, { 1, 3 }, { 2, 4 } };
+
+    htd::MultiGraph expectedGraph(libraryInstance, 5);
+    htd::MultiGraph actualGraph(libraryInstance, 5);
+
+    expectedGraph.addEdge(1, 5);
+    actualGraph.addEdge(1, 5);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        expectedGraph.addEdge(edge.first, edge.second);
+    }
+
+    actualGraph.addEdges(edges);
+
+    ASSERT_EQ(expectedGraph.edgeCount(), actualGraph.edgeCount());
+    ASSERT_EQ(expectedGraph.nextEdgeId(), actualGraph.nextEdgeId());
+
+    for (htd::index_t index = 0; index < expectedGraph.edgeCount(); ++index)
+    {
+        ASSERT_EQ(expectedGraph.hyperedgeAtPosition(index).id(), actualGraph.hyperedgeAtPosition(index).id());
+        ASSERT_EQ(expectedGraph.hyperedgeAtPosition(index), actualGraph.hyperedgeAtPosition(index));
+    }
+
+    for (htd::vertex_t vertex : expectedGraph.vertices())
+    {
+        ASSERT_EQ(expectedGraph.neighbors(vertex), actualGraph.neighbors(vertex));
+    }
+
+    ASSERT_TRUE(actualGraph.isNeighbor(2, 2));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -804,6 +804,54 @@ TEST(MultiHypergraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiHypergraphTest, CheckBulkEdgeInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::vector<std::vector<htd::vertex_t>> edges { { 3, 1, 4 }, { 2 }, { 2, 2 }, { 5, 1 }, { 1, 3, 1 }, { 4, 5, 2, 4 }, { 3, 2, 1 } };
+
+    htd::MultiHypergraph expectedGraph(libraryInstance, 6);
+    htd::MultiHypergraph actualGraph(libraryInstance, 6);
+
+    expectedGraph.addEdge(1, 6);
+    actualGraph.addEdge(1, 6);
+
+    for (const std::vector<htd::vertex_t> & edge : edges)
+    {
+        expectedGraph.addEdge(edge);
+    }
+
+    actualGraph.addEdges(std::vector<std::vector<htd::vertex_t>>(edges));
+
+    actualGraph.addEdges(std::vector<std::pair<htd::vertex_t, htd::vertex_t>> { { 6, 5 }, { 6, 6 } });
+
+    expectedGraph.addEdge(6, 5);
+    expectedGraph.addEdge(6, 6);
+
+    ASSERT_EQ(expectedGraph.edgeCount(), actualGraph.edgeCount());
+    ASSERT_EQ(expectedGraph.nextEdgeId(), actualGraph.nextEdgeId());
+
+    for (htd::index_t index = 0; index < expectedGraph.edgeCount(); ++index)
+    {
+        const htd::Hyperedge & expectedHyperedge = expectedGraph.hyperedgeAtPosition(index);
+        const htd::Hyperedge & actualHyperedge = actualGraph.hyperedgeAtPosition(index);
+
+        ASSERT_EQ(expectedHyperedge.id(), actualHyperedge.id());
+        ASSERT_EQ(expectedHyperedge, actualHyperedge);
+        ASSERT_EQ(expectedHyperedge.sortedElements(), actualHyperedge.sortedElements());
+    }
+
+    for (htd::vertex_t vertex : expectedGraph.vertices())
+    {
+        ASSERT_EQ(expectedGraph.neighbors(vertex), actualGraph.neighbors(vertex));
+    }
+
+    ASSERT_TRUE(actualGraph.isNeighbor(1, 1));
+    ASSERT_FALSE(actualGraph.isNeighbor(3, 3));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,245 @@
+/*
+ * File:   PriorityQueueTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <vector>
+
+class PriorityQueueTest : public ::testing::Test
+{
+    public:
+        PriorityQueueTest(void)
+        {
+
+        }
+
+        virtual ~PriorityQueueTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+template < typename Compare >
+void compareWithHeapBasedPriorityQueue(std::size_t maximumPriority)
+{
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, Compare> priorityQueue;
+
+    htd::PriorityQueue<htd::vertex_t, std::size_t, Compare, std::equal_to<std::size_t>, false> heapBasedPriorityQueue;
+
+    std::vector<std::size_t> priorities;
+
+    std::vector<htd::vertex_t> vertices;
+
+    std::mt19937 generator(1234);
+
+    std::uniform_int_distribution<std::size_t> priorityDistribution(0, maximumPriority);
+
+    for (htd::vertex_t vertex = 1; vertex <= 500; ++vertex)
+    {
+        std::size_t priority = priorityDistribution(generator);
+
+        priorityQueue.push(vertex, priority);
+
+        heapBasedPriorityQueue.push(vertex, priority);
+
+        vertices.push_back(vertex);
+
+        priorities.push_back(priority);
+    }
+
+    while (!heapBasedPriorityQueue.empty())
+    {
+        ASSERT_EQ(heapBasedPriorityQueue.size(), priorityQueue.size());
+
+        ASSERT_EQ(heapBasedPriorityQueue.topPriority(), priorityQueue.topPriority());
+
+        std::vector<htd::vertex_t> expectedTopCollection(heapBasedPriorityQueue.topCollection());
+        std::vector<htd::vertex_t> actualTopCollection(priorityQueue.topCollection());
+
+        std::sort(expectedTopCollection.begin(), expectedTopCollection.end());
+        std::sort(actualTopCollection.begin(), actualTopCollection.end());
+
+        ASSERT_EQ(expectedTopCollection, actualTopCollection);
+
+        std::size_t operation = generator() % 4;
+
+        if (operation == 0)
+        {
+            htd::vertex_t vertex = priorityQueue.top();
+
+            ASSERT_TRUE(heapBasedPriorityQueue.eraseFromTopCollection(vertex));
+
+            priorityQueue.pop();
+
+            std::size_t index = std::distance(vertices.begin(), std::find(vertices.begin(), vertices.end(), vertex));
+
+            vertices.erase(vertices.begin() + index);
+
+            priorities.erase(priorities.begin() + index);
+        }
+        else if (operation == 1 && generator() % 8 == 0)
+        {
+            std::size_t index = generator() % vertices.size();
+
+            ASSERT_TRUE(heapBasedPriorityQueue.erase(vertices[index], priorities[index]));
+
+            ASSERT_TRUE(priorityQueue.erase(vertices[index], priorities[index]));
+
+            ASSERT_FALSE(priorityQueue.erase(vertices[index], priorities[index]));
+
+            vertices.erase(vertices.begin() + index);
+
+            priorities.erase(priorities.begin() + index);
+        }
+        else
+        {
+            std::size_t index = generator() % vertices.size();
+
+            std::size_t newPriority = priorityDistribution(generator);
+
+            heapBasedPriorityQueue.updatePriority(vertices[index], priorities[index], newPriority);
+
+            priorityQueue.updatePriority(vertices[index], priorities[index], newPriority);
+
+            priorities[index] = newPriority;
+        }
+    }
+
+    ASSERT_TRUE(priorityQueue.empty());
+}
+
+TEST(PriorityQueueTest, CheckSmallestPriorityOnTop)
+{
+    compareWithHeapBasedPriorityQueue<std::greater<std::size_t>>(50);
+}
+
+TEST(PriorityQueueTest, CheckLargestPriorityOnTop)
+{
+    compareWithHeapBasedPriorityQueue<std::less<std::size_t>>(50);
+}
+
+TEST(PriorityQueueTest, CheckSmallestPriorityOnTopWithLargePriorities)
+{
+    compareWithHeapBasedPriorityQueue<std::greater<std::size_t>>(2 * htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>>::denseLimit());
+}
+
+TEST(PriorityQueueTest, CheckLargestPriorityOnTopWithLargePriorities)
+{
+    compareWithHeapBasedPriorityQueue<std::less<std::size_t>>(2 * htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>>::denseLimit());
+}
+
+TEST(PriorityQueueTest, CheckEraseFromTopCollection)
+{
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    priorityQueue.push(1, 3);
+    priorityQueue.push(2, 1);
+    priorityQueue.push(3, 1);
+    priorityQueue.push(4, 100000);
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3 }), priorityQueue.topCollection());
+
+    ASSERT_FALSE(priorityQueue.eraseFromTopCollection(1));
+    ASSERT_TRUE(priorityQueue.eraseFromTopCollection(2));
+    ASSERT_TRUE(priorityQueue.eraseFromTopCollection(3));
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+    ASSERT_TRUE(priorityQueue.erase(1));
+
+    ASSERT_EQ((std::size_t)100000, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)4, priorityQueue.top());
+
+    priorityQueue.updatePriority(4, 100000, 7);
+
+    ASSERT_EQ((std::size_t)7, priorityQueue.topPriority());
+    ASSERT_EQ((std::size_t)1, priorityQueue.size());
+
+    priorityQueue.pop();
+
+    ASSERT_TRUE(priorityQueue.empty());
+}
+
+TEST(PriorityQueueTest, CheckDefaultPriorityQueueAcceptsDuplicateElements)
+{
+    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+
+    priorityQueue.push(5, 2);
+    priorityQueue.push(5, 1);
+    priorityQueue.push(5, 1);
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.size());
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 5, 5 }), priorityQueue.topCollection());
+}
+
+TEST(PriorityQueueTest, CheckReinsertionIntoBucketPriorityQueue)
+{
+    htd::BucketPriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+
+    for (std::size_t round = 0; round < 3; ++round)
+    {
+        priorityQueue.push(0, 4);
+        priorityQueue.push(1, 4);
+        priorityQueue.push(2, 9);
+
+        priorityQueue.updatePriority(0, 4, 10);
+        priorityQueue.updatePriority(1, 4, 2);
+
+        ASSERT_EQ((htd::vertex_t)0, priorityQueue.top());
+
+        priorityQueue.pop();
+
+        ASSERT_EQ((htd::vertex_t)2, priorityQueue.top());
+
+        ASSERT_TRUE(priorityQueue.erase(2, 9));
+        ASSERT_TRUE(priorityQueue.erase(1, 2));
+
+        ASSERT_TRUE(priorityQueue.empty());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,194 @@
+/*
+ * File:   RandomNumberGeneratorTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class RandomNumberGeneratorTest : public ::testing::Test
+{
+    public:
+        RandomNumberGeneratorTest(void)
+        {
+
+        }
+
+        virtual ~RandomNumberGeneratorTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(RandomNumberGeneratorTest, CheckReferenceSequence)
+{
+    htd::RandomNumberGenerator generator(0);
+
+    ASSERT_EQ((std::uint64_t)0x99EC5F36CB75F2B4ULL, generator());
+    ASSERT_EQ((std::uint64_t)0xBF6E1F784956452AULL, generator());
+    ASSERT_EQ((std::uint64_t)0x1A5F849D4933E6E0ULL, generator());
+
+    generator.seed(42);
+
+    generator.jump();
+
+    ASSERT_EQ((std::uint64_t)0x50086EF83CBF4F4AULL, generator());
+    ASSERT_EQ((std::uint64_t)0xBA285EC21347D703ULL, generator());
+}
+
+TEST(RandomNumberGeneratorTest, CheckSeed)
+{
+    htd::RandomNumberGenerator generator1(1234);
+    htd::RandomNumberGenerator generator2(1235);
+
+    std::vector<std::uint64_t> sequence1;
+    std::vector<std::uint64_t> sequence2;
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        sequence1.push_back(generator1());
+        sequence2.push_back(generator2());
+    }
+
+    ASSERT_NE(sequence1, sequence2);
+
+    generator2.seed(1234);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_EQ(sequence1[index], generator2());
+    }
+}
+
+TEST(RandomNumberGeneratorTest, CheckSplit)
+{
+    htd::RandomNumberGenerator generator(7);
+
+    htd::RandomNumberGenerator reference(7);
+
+    htd::RandomNumberGenerator stream = generator.split();
+
+    reference.jump();
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_EQ(reference(), generator());
+    }
+
+    reference.seed(7);
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_EQ(reference(), stream());
+    }
+}
+
+TEST(RandomNumberGeneratorTest, CheckNextIndex)
+{
+    htd::RandomNumberGenerator generator(99);
+
+    std::vector<std::size_t> counts(10, 0);
+
+    for (std::size_t index = 0; index < 100000; ++index)
+    {
+        std::size_t value = generator.nextIndex(counts.size());
+
+        ASSERT_LT(value, counts.size());
+
+        ++counts[value];
+    }
+
+    for (std::size_t count : counts)
+    {
+        EXPECT_GT(count, (std::size_t)9000);
+        EXPECT_LT(count, (std::size_t)11000);
+    }
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        ASSERT_EQ((std::size_t)0, generator.nextIndex(1));
+    }
+}
+
+TEST(RandomNumberGeneratorTest, CheckConcurrentLibraryInstancesAreReproducible)
+{
+    std::vector<std::vector<htd::vertex_t>> orderings(4);
+
+    std::vector<std::thread> threads;
+
+    for (std::size_t index = 0; index < orderings.size(); ++index)
+    {
+        threads.emplace_back([&, index](void)
+        {
+            std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+            libraryInstance->randomNumberGenerator().seed(index % 2);
+
+            htd::MultiHypergraph graph(libraryInstance.get(), 200);
+
+            for (htd::vertex_t vertex = 1; vertex < 200; ++vertex)
+            {
+                graph.addEdge(vertex, vertex + 1);
+                graph.addEdge(vertex, (vertex * 7) % 200 + 1);
+            }
+
+            htd::MinFillOrderingAlgorithm algorithm(libraryInstance.get());
+
+            std::unique_ptr<htd::IVertexOrdering> ordering(algorithm.computeOrdering(graph));
+
+            orderings[index] = ordering->sequence();
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(orderings[0], orderings[2]);
+    EXPECT_EQ(orderings[1], orderings[3]);
+    EXPECT_NE(orderings[0], orderings[1]);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -402,6 +402,71 @@ TEST(SetCoverAlgorithmTest, CheckGreedySetCoverAlgorithm5)
     delete values;
 }
 
+TEST(SetCoverAlgorithmTest, CheckSetCoverAlgorithmOptimality)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::SetCoverAlgorithm algorithm(libraryInstance);
+
+    std::srand(4711);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        std::vector<htd::id_t> * values = createContainer(1, 80, 10, 70);
+
+        std::vector<std::vector<htd::id_t>> * containers = createContainers(1, 80, 14, 5, 30);
+
+        std::vector<htd::index_t> result;
+
+        algorithm.computeSetCover(*values, *containers, result);
+
+        ASSERT_TRUE(isValidSetCover(*values, *containers, result));
+
+        ASSERT_TRUE(std::is_sorted(result.begin(), result.end()));
+
+        std::size_t optimum = (std::size_t)-1;
+
+        for (std::size_t subset = 0; subset < ((std::size_t)1 << containers->size()); ++subset)
+        {
+            std::vector<htd::index_t> selection;
+
+            for (htd::index_t index = 0; index < containers->size(); ++index)
+            {
+                if ((subset >> index) & 1)
+                {
+                    selection.push_back(index);
+                }
+            }
+
+            if (selection.size() < optimum)
+            {
+                std::vector<htd::id_t> * coveredValues = set_union(*containers, selection);
+
+                if (std::includes(coveredValues->begin(), coveredValues->end(), values->begin(), values->end()))
+                {
+                    optimum = selection.size();
+                }
+
+                delete coveredValues;
+            }
+        }
+
+        if (optimum != (std::size_t)-1)
+        {
+            ASSERT_EQ(optimum, result.size());
+        }
+        else
+        {
+            ASSERT_TRUE(result.empty());
+        }
+
+        delete containers;
+        delete values;
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
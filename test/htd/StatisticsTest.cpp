@@ -0,0 +1,202 @@
+/*
+ * File:   StatisticsTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+class StatisticsTest : public ::testing::Test
+{
+    public:
+        StatisticsTest(void)
+        {
+
+        }
+
+        virtual ~StatisticsTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+#ifdef HTD_ENABLE_STATISTICS
+TEST(StatisticsTest, CheckBucketEliminationWithStatistics)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Statistics statistics;
+
+    libraryInstance->setStatistics(&statistics);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+    htd::vertex_t vertex3 = graph.addVertex();
+    htd::vertex_t vertex4 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+    graph.addEdge(vertex2, vertex3);
+    graph.addEdge(vertex3, vertex4);
+    graph.addEdge(vertex4, vertex1);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    EXPECT_EQ(decomposition->maximumBagSize(), (std::size_t)3);
+
+    EXPECT_GE(statistics.invocationCount(htd::Statistics::ORDERING_PHASE), (std::size_t)1);
+    EXPECT_GE(statistics.invocationCount(htd::Statistics::BUCKET_ELIMINATION_PHASE), (std::size_t)1);
+    EXPECT_EQ(statistics.invocationCount(htd::Statistics::IMPORT_PHASE), (std::size_t)0);
+
+    EXPECT_GE(statistics.wallTime(htd::Statistics::BUCKET_ELIMINATION_PHASE), 0.0);
+    EXPECT_GE(statistics.cpuTime(htd::Statistics::BUCKET_ELIMINATION_PHASE), 0.0);
+
+    EXPECT_EQ(statistics.counter(htd::Statistics::ELIMINATED_VERTICES), (std::size_t)4);
+    EXPECT_EQ(statistics.counter(htd::Statistics::FILL_EDGES), (std::size_t)1);
+    EXPECT_GE(statistics.counter(htd::Statistics::PRIORITY_QUEUE_UPDATES), (std::size_t)1);
+
+    std::ostringstream stream;
+
+    statistics.writeJson(stream);
+
+    EXPECT_NE(stream.str().find("\"fill_edges\": 1"), std::string::npos);
+    EXPECT_NE(stream.str().find("\"bucket_elimination\""), std::string::npos);
+
+    statistics.reset();
+
+    EXPECT_EQ(statistics.invocationCount(htd::Statistics::ORDERING_PHASE), (std::size_t)0);
+    EXPECT_EQ(statistics.counter(htd::Statistics::FILL_EDGES), (std::size_t)0);
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(StatisticsTest, CheckNestedPhaseTimers)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Statistics statistics;
+
+    libraryInstance->setStatistics(&statistics);
+
+    {
+        htd::PhaseTimer outerTimer(*libraryInstance, htd::Statistics::MANIPULATION_PHASE);
+
+        {
+            htd::PhaseTimer innerTimer(*libraryInstance, htd::Statistics::EXPORT_PHASE);
+        }
+
+        htd::PhaseTimer secondInnerTimer(*libraryInstance, htd::Statistics::EXPORT_PHASE);
+
+        secondInnerTimer.stop();
+        secondInnerTimer.stop();
+    }
+
+    EXPECT_EQ(statistics.invocationCount(htd::Statistics::MANIPULATION_PHASE), (std::size_t)1);
+    EXPECT_EQ(statistics.invocationCount(htd::Statistics::EXPORT_PHASE), (std::size_t)2);
+
+    delete libraryInstance;
+}
+#endif
+
+TEST(StatisticsTest, CheckBucketEliminationWithoutStatistics)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    ASSERT_EQ(libraryInstance->statistics(), nullptr);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::vertex_t vertex1 = graph.addVertex();
+    htd::vertex_t vertex2 = graph.addVertex();
+
+    graph.addEdge(vertex1, vertex2);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::Statistics::increment(*libraryInstance, htd::Statistics::FILL_EDGES, 1);
+
+    htd::PhaseTimer phaseTimer(*libraryInstance, htd::Statistics::EXPORT_PHASE);
+
+    phaseTimer.stop();
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(StatisticsTest, CheckAllocationCountIsPerThread)
+{
+    std::size_t allocationCount = htd::Statistics::totalAllocationCount();
+
+    std::thread worker([]()
+    {
+        std::size_t workerAllocationCount = htd::Statistics::totalAllocationCount();
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            htd::Statistics::recordAllocation();
+        }
+
+        EXPECT_EQ(workerAllocationCount + 100, htd::Statistics::totalAllocationCount());
+    });
+
+    worker.join();
+
+    ASSERT_EQ(allocationCount, htd::Statistics::totalAllocationCount());
+
+    htd::Statistics::recordAllocation();
+
+    ASSERT_EQ(allocationCount + 1, htd::Statistics::totalAllocationCount());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -26,6 +26,14 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class TreeDecompositionOptimizationTest : public ::testing::Test
@@ -991,6 +999,166 @@ TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraph)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckResultComplexGraphWithTimeLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    for (std::size_t threadCount : { 1, 4 })
+    {
+        algorithm.setIterationCount(0);
+
+        algorithm.setThreadCount(threadCount);
+
+        libraryInstance->reset();
+
+        std::size_t iterationCount = 0;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        libraryInstance->setTimeLimit(200);
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(*graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){
+            ++iterationCount;
+        });
+
+        double duration = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        ASSERT_GE(duration, 200.0);
+        ASSERT_LT(duration, 5000.0);
+
+        ASSERT_GE(iterationCount, (std::size_t)1);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+        delete decomposition;
+    }
+
+    libraryInstance->setTimeLimit((std::size_t)-1);
+
+    libraryInstance->reset();
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    ASSERT_EQ((std::size_t)1, algorithm.threadCount());
+
+    std::vector<std::vector<std::size_t>> heightSequences;
+
+    std::vector<std::size_t> resultHeights;
+
+    for (std::size_t threadCount : { 4, 4, 2, 1 })
+    {
+        algorithm.setThreadCount(threadCount);
+
+        ASSERT_EQ(threadCount, algorithm.threadCount());
+
+        libraryInstance->randomNumberGenerator().seed(42);
+
+        std::vector<std::size_t> heights;
+
+        htd::ITreeDecomposition * decomposition =
+            algorithm.computeDecomposition(*graph,
+                                           [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+            ASSERT_EQ(graph, &currentGraph);
+
+            ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+            ASSERT_EQ(currentDecomposition.height(), (std::size_t)(-fitness.at(0)));
+
+            heights.push_back(currentDecomposition.height());
+        });
+
+        ASSERT_EQ((std::size_t)25, heights.size());
+
+        ASSERT_NE(decomposition, nullptr);
+
+        ASSERT_EQ(libraryInstance, decomposition->managementInstance());
+
+        ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+        ASSERT_EQ(*std::min_element(heights.begin(), heights.end()), decomposition->height());
+
+        heightSequences.push_back(heights);
+
+        resultHeights.push_back(decomposition->height());
+
+        delete decomposition;
+    }
+
+    EXPECT_EQ(heightSequences[0], heightSequences[1]);
+    EXPECT_EQ(heightSequences[0], heightSequences[2]);
+    EXPECT_EQ(heightSequences[0], heightSequences[3]);
+
+    EXPECT_EQ(resultHeights[0], resultHeights[1]);
+    EXPECT_EQ(resultHeights[0], resultHeights[2]);
+    EXPECT_EQ(resultHeights[0], resultHeights[3]);
+
+    delete graph;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelResultNonImprovementLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::IterativeImprovementTreeDecompositionAlgorithm algorithm(libraryInstance, new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance), new FitnessFunction());
+
+    algorithm.setIterationCount(0);
+    algorithm.setNonImprovementLimit(0);
+    algorithm.setThreadCount(3);
+
+    std::vector<std::size_t> heights;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation &){
+        heights.push_back(currentDecomposition.height());
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(heights.size(), (std::size_t)2);
+
+    for (htd::index_t index = 1; index < heights.size() - 1; ++index)
+    {
+        ASSERT_LT(heights[index], heights[index - 1]);
+    }
+
+    ASSERT_GE(heights[heights.size() - 1], heights[heights.size() - 2]);
+
+    ASSERT_EQ(heights[heights.size() - 2], decomposition->height());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1048,6 +1216,253 @@ TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraph
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultComplexGraphWithSharedMaximumBagSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    algorithm.setIterationCount(25);
+
+    std::atomic<std::size_t> sharedMaxBagSize((std::size_t)-1);
+
+    ASSERT_EQ(nullptr, algorithm.sharedMaximumBagSize());
+
+    algorithm.setSharedMaximumBagSize(&sharedMaxBagSize);
+
+    ASSERT_EQ(&sharedMaxBagSize, algorithm.sharedMaximumBagSize());
+
+    std::unique_ptr<htd::WidthMinimizingTreeDecompositionAlgorithm> clonedAlgorithm(algorithm.clone());
+
+    ASSERT_EQ(nullptr, clonedAlgorithm->sharedMaximumBagSize());
+
+    std::size_t callbackCount = 0;
+
+    /* Each decomposition reported by the callback must be strictly smaller than the bound published before the respective iteration. */
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        HTD_UNUSED(fitness)
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        ASSERT_LT(currentDecomposition.maximumBagSize(), sharedMaxBagSize.load());
+
+        sharedMaxBagSize = currentDecomposition.maximumBagSize();
+
+        ++callbackCount;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(callbackCount, (std::size_t)1);
+
+    ASSERT_EQ(sharedMaxBagSize.load(), decomposition->maximumBagSize());
+
+    /* A bound which is already optimal for this run cannot be improved, hence no decomposition is returned. */
+    htd::ITreeDecomposition * boundedDecomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_TRUE(boundedDecomposition == nullptr || boundedDecomposition->maximumBagSize() < decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete boundedDecomposition;
+    delete libraryInstance;
+}
+
+/**
+ *  The smallest maximum bag size reported so far in the test CheckParallelAdaptiveWidthMinimizationWithSharedMaximumBagSize.
+ */
+static std::atomic<std::size_t> reportedMaxBagSize((std::size_t)-1);
+
+/**
+ *  A boolean flag indicating whether the delayed ordering algorithm has been called for the first time.
+ */
+static std::atomic<bool> delayedOrderingStarted(false);
+
+/**
+ *  A boolean flag indicating whether the delayed ordering algorithm has returned from its first call.
+ */
+static std::atomic<bool> delayedOrderingReleased(false);
+
+/**
+ *  The mutex protecting the bag size limits received by the delayed ordering algorithm.
+ */
+static std::mutex delayedOrderingMutex;
+
+/**
+ *  The bag size limits received by the delayed ordering algorithm after returning from its first call.
+ */
+static std::vector<std::size_t> delayedOrderingLimits;
+
+/**
+ *  Wait until the given condition holds or ten seconds have passed.
+ */
+static void waitFor(const std::function<bool(void)> & condition)
+{
+    for (std::size_t remainingSteps = 10000; remainingSteps > 0 && !condition(); --remainingSteps)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+/**
+ *  Min-fill ordering algorithm which fixes the order in which two concurrently running algorithms proceed.
+ *
+ *  The first call of the delayed instance returns no ordering and it does not return before the leading instance has
+ *  reported a decomposition. The leading instance does not compute an ordering before the delayed instance has
+ *  started. The delayed instance records the bag size limits of all subsequent calls.
+ */
+class ScheduledOrderingAlgorithm : public htd::IWidthLimitableOrderingAlgorithm
+{
+    public:
+        ScheduledOrderingAlgorithm(const htd::LibraryInstance * const manager, bool delayed) : baseAlgorithm_(manager), delayed_(delayed)
+        {
+
+        }
+
+        virtual ~ScheduledOrderingAlgorithm()
+        {
+
+        }
+
+        const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.managementInstance();
+        }
+
+        void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+        {
+            baseAlgorithm_.setManagementInstance(manager);
+        }
+
+        htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph);
+        }
+
+        htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph, preprocessedGraph);
+        }
+
+        htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            return baseAlgorithm_.computeOrdering(graph, maxBagSize, maxIterationCount);
+        }
+
+        htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE
+        {
+            if (delayed_)
+            {
+                if (!delayedOrderingReleased.load())
+                {
+                    delayedOrderingStarted = true;
+
+                    waitFor([](void){ return reportedMaxBagSize.load() != (std::size_t)-1; });
+
+                    delayedOrderingReleased = true;
+
+                    return nullptr;
+                }
+
+                std::lock_guard<std::mutex> lock(delayedOrderingMutex);
+
+                delayedOrderingLimits.push_back(maxBagSize);
+            }
+            else
+            {
+                waitFor([](void){ return delayedOrderingStarted.load(); });
+            }
+
+            return baseAlgorithm_.computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        }
+
+        ScheduledOrderingAlgorithm * clone(void) const HTD_OVERRIDE
+        {
+            return new ScheduledOrderingAlgorithm(managementInstance(), delayed_);
+        }
+
+    private:
+        htd::MinFillOrderingAlgorithm baseAlgorithm_;
+
+        bool delayed_;
+};
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelAdaptiveWidthMinimizationWithSharedMaximumBagSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    reportedMaxBagSize = (std::size_t)-1;
+
+    delayedOrderingStarted = false;
+
+    delayedOrderingReleased = false;
+
+    delayedOrderingLimits.clear();
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    for (bool delayed : { false, true })
+    {
+        htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+        baseAlgorithm->setOrderingAlgorithm(new ScheduledOrderingAlgorithm(libraryInstance, delayed));
+
+        htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm * adaptiveAlgorithm = new htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+
+        adaptiveAlgorithm->addDecompositionAlgorithm(baseAlgorithm);
+
+        adaptiveAlgorithm->setIterationCount(10);
+
+        ASSERT_EQ(nullptr, adaptiveAlgorithm->sharedMaximumBagSize());
+
+        algorithm.addDecompositionAlgorithm(adaptiveAlgorithm);
+    }
+
+    algorithm.setParallelExecutionEnabled(true);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    /* The delayed worker only starts improving after the leading worker reported its first decomposition, so all of its limits must lie below that decomposition. */
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        HTD_UNUSED(fitness)
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t expected = (std::size_t)-1;
+
+        reportedMaxBagSize.compare_exchange_strong(expected, currentDecomposition.maximumBagSize());
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_TRUE(delayedOrderingReleased.load());
+
+    ASSERT_NE(reportedMaxBagSize.load(), (std::size_t)-1);
+
+    ASSERT_FALSE(delayedOrderingLimits.empty());
+
+    for (std::size_t limit : delayedOrderingLimits)
+    {
+        ASSERT_LT(limit, reportedMaxBagSize.load());
+    }
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComplexGraph)
 {
     htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
@@ -1115,6 +1530,125 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComp
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelCombinedWidthMinimizationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm1 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm2 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * baseAlgorithm3 =
+        new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    baseAlgorithm1->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+    baseAlgorithm2->setOrderingAlgorithm(new htd::MinDegreeOrderingAlgorithm(libraryInstance));
+    baseAlgorithm3->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(baseAlgorithm1);
+    algorithm.addDecompositionAlgorithm(baseAlgorithm2);
+    algorithm.addDecompositionAlgorithm(baseAlgorithm3);
+
+    algorithm.addDecompositionAlgorithm(new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance));
+
+    ASSERT_FALSE(algorithm.isParallelExecutionEnabled());
+
+    algorithm.setParallelExecutionEnabled(true);
+
+    ASSERT_TRUE(algorithm.isParallelExecutionEnabled());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    std::size_t callbackCount = 0;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph,
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        if (currentWidth < minimalWidth)
+        {
+            minimalWidth = currentWidth;
+        }
+
+        ++callbackCount;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(callbackCount, (std::size_t)1);
+
+    ASSERT_EQ(decomposition->managementInstance(), libraryInstance);
+
+    ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelCombinedWidthMinimizationTargetMaximumBagSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::CombinedWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm1 =
+        new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm * baseAlgorithm2 =
+        new htd::WidthMinimizingTreeDecompositionAlgorithm(libraryInstance);
+
+    baseAlgorithm1->setIterationCount(0);
+    baseAlgorithm2->setIterationCount(0);
+
+    algorithm.addDecompositionAlgorithm(new htd::TrivialTreeDecompositionAlgorithm(libraryInstance));
+    algorithm.addDecompositionAlgorithm(baseAlgorithm1);
+    algorithm.addDecompositionAlgorithm(baseAlgorithm2);
+
+    algorithm.setParallelExecutionEnabled(true);
+
+    algorithm.setTargetMaximumBagSize(graph->vertexCount());
+
+    ASSERT_EQ(graph->vertexCount(), algorithm.targetMaximumBagSize());
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_FALSE(libraryInstance->isTerminated());
+
+    ASSERT_LE(decomposition->maximumBagSize(), graph->vertexCount());
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
 class BagSizeLabelingFunction : public htd::ILabelingFunction
 {
     public:
@@ -692,6 +692,72 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckTreeManipulationsWithRemovedNodes)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+    htd::vertex_t node5 = tree.addChild(node4);
+
+    tree.removeVertex(node2);
+
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+
+    ASSERT_FALSE(tree.isVertex(node2));
+    ASSERT_TRUE(tree.isParent(node4, node1));
+    ASSERT_TRUE(tree.isChild(node1, node4));
+    const htd::ConstCollection<htd::vertex_t> & children = tree.children(node1);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ node3, node4 }), std::vector<htd::vertex_t>(children.begin(), children.end()));
+
+    tree.removeSubtree(node4);
+
+    ASSERT_EQ((std::size_t)2, tree.vertexCount());
+    ASSERT_EQ((std::size_t)1, tree.edgeCount());
+
+    ASSERT_FALSE(tree.isVertex(node4));
+    ASSERT_FALSE(tree.isVertex(node5));
+
+    htd::vertex_t node6 = tree.addChild(node3);
+    htd::vertex_t node7 = tree.addChild(node3);
+    htd::vertex_t node8 = tree.addParent(node3);
+
+    ASSERT_EQ((htd::vertex_t)6, node6);
+    ASSERT_EQ((htd::vertex_t)7, node7);
+    ASSERT_EQ((htd::vertex_t)8, node8);
+
+    ASSERT_EQ((std::size_t)5, tree.vertexCount());
+    ASSERT_EQ((std::size_t)4, tree.edgeCount());
+
+    ASSERT_TRUE(tree.isParent(node8, node1));
+    ASSERT_TRUE(tree.isParent(node3, node8));
+    ASSERT_TRUE(tree.isParent(node6, node3));
+    ASSERT_TRUE(tree.isParent(node7, node3));
+
+    ASSERT_EQ((std::size_t)2, tree.leafCount());
+    ASSERT_EQ((std::size_t)3, tree.edgeCount(node3));
+    ASSERT_EQ((std::size_t)1, tree.edgeCount(node6));
+
+    htd::Tree copy(tree);
+
+    tree.removeVertex(node3);
+
+    ASSERT_EQ((std::size_t)5, copy.vertexCount());
+    ASSERT_TRUE(copy.isParent(node6, node3));
+
+    ASSERT_EQ((std::size_t)4, tree.vertexCount());
+    ASSERT_TRUE(tree.isParent(node6, node8));
+    ASSERT_TRUE(tree.isParent(node7, node8));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,301 @@
+/*
+ * File:   BinaryDecompositionViewTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+class BinaryDecompositionViewTest : public ::testing::Test
+{
+    public:
+        BinaryDecompositionViewTest(void)
+        {
+
+        }
+
+        virtual ~BinaryDecompositionViewTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  The path of the file to which the tests write the binary decompositions.
+ */
+const char * const DECOMPOSITION_FILE = "BinaryDecompositionViewTest.htdb";
+
+/**
+ *  Create the content of a binary file storing a labeled tree decomposition with induced hyperedges.
+ *
+ *  @return The content of the binary file.
+ */
+std::string createDecompositionFile(void)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::MultiHypergraph graph(libraryInstance.get());
+
+    graph.addVertices(6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 4);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> computedDecomposition(algorithm.computeDecomposition(graph));
+
+    htd::TreeDecomposition decomposition(*computedDecomposition);
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        decomposition.setVertexLabel("Size", node, new htd::Label<std::size_t>(decomposition.bagSize(node)));
+    }
+
+    htd_io::BinaryFormatExporter exporter;
+
+    std::ostringstream stream;
+
+    exporter.write(decomposition, graph, stream);
+
+    return stream.str();
+}
+
+/**
+ *  Write the given content to the file used by the tests.
+ *
+ *  @param[in] content  The content of the file.
+ */
+void writeDecompositionFile(const std::string & content)
+{
+    std::ofstream stream(DECOMPOSITION_FILE, std::ios::out | std::ios::binary | std::ios::trunc);
+
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+/**
+ *  Access every part of the given view and of the decomposition created from it.
+ *
+ *  @param[in] view The view which shall be accessed.
+ */
+void accessView(const htd_io::BinaryDecompositionView & view)
+{
+    for (htd::vertex_t node : view.vertices())
+    {
+        ASSERT_TRUE(view.isVertex(node));
+
+        if (node != view.root())
+        {
+            ASSERT_TRUE(view.isVertex(view.parent(node)));
+        }
+
+        for (htd::vertex_t child : view.children(node))
+        {
+            ASSERT_EQ(node, view.parent(child));
+        }
+
+        ASSERT_EQ(view.bagSize(node), view.bagContent(node).size());
+
+        for (htd::index_t index = 0; index < view.inducedHyperedgeCount(node); ++index)
+        {
+            view.inducedHyperedgeAtPosition(node, index);
+        }
+
+        for (htd::index_t index = 0; index < view.labelCount(); ++index)
+        {
+            std::string labelName = view.labelNameAtPosition(index);
+
+            if (view.isLabeledVertex(labelName, node))
+            {
+                view.vertexLabel(labelName, node);
+            }
+        }
+    }
+
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    std::unique_ptr<htd::IMutableTreeDecomposition> decomposition(view.createTreeDecomposition(libraryInstance.get()));
+
+    ASSERT_EQ(view.vertexCount(), decomposition->vertexCount());
+}
+
+TEST(BinaryDecompositionViewTest, CheckValidFile)
+{
+    std::string content = createDecompositionFile();
+
+    writeDecompositionFile(content);
+
+    {
+        htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+        ASSERT_TRUE(view.isOpen());
+        ASSERT_EQ((std::size_t)6, view.graphVertexCount());
+        ASSERT_EQ((std::size_t)1, view.labelCount());
+
+        accessView(view);
+    }
+
+    std::remove(DECOMPOSITION_FILE);
+}
+
+TEST(BinaryDecompositionViewTest, CheckTruncatedFile)
+{
+    std::string content = createDecompositionFile();
+
+    /* Sections are padded to multiples of eight bytes, so removing eight bytes always cuts into the last non-empty section. */
+    for (std::size_t length = 0; length + 8 <= content.size(); ++length)
+    {
+        writeDecompositionFile(content.substr(0, length));
+
+        htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+        ASSERT_FALSE(view.isOpen()) << "length " << length;
+    }
+
+    std::remove(DECOMPOSITION_FILE);
+}
+
+TEST(BinaryDecompositionViewTest, CheckBitFlippedFile)
+{
+    std::string content = createDecompositionFile();
+
+    for (std::size_t position = 0; position < content.size(); ++position)
+    {
+        for (std::size_t bit = 0; bit < 8; ++bit)
+        {
+            std::string corruptedContent = content;
+
+            corruptedContent[position] = static_cast<char>(corruptedContent[position] ^ (1 << bit));
+
+            writeDecompositionFile(corruptedContent);
+
+            htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+            /* Flips in bag contents, hyperedges, label texts or padding leave a consistent file, every other flip has to be
+               rejected. Whatever is accepted must be safe to access. */
+            if (view.isOpen())
+            {
+                accessView(view);
+            }
+        }
+    }
+
+    std::remove(DECOMPOSITION_FILE);
+}
+
+TEST(BinaryDecompositionViewTest, CheckInconsistentSections)
+{
+    std::string content = createDecompositionFile();
+
+    htd_io::BinaryDecompositionView::Header header;
+
+    std::memcpy(&header, content.data(), sizeof(header));
+
+    ASSERT_TRUE(header.nodeCount > 1);
+
+    std::size_t nodesOffset = sizeof(header);
+    std::size_t positionsOffset = nodesOffset + (header.nodeCount * sizeof(std::uint32_t) + 7) / 8 * 8;
+    std::size_t parentsOffset = positionsOffset + ((header.maximumNodeId + 1) * sizeof(std::uint32_t) + 7) / 8 * 8;
+    std::size_t childOffsetsOffset = parentsOffset + (header.nodeCount * sizeof(std::uint32_t) + 7) / 8 * 8;
+
+    std::uint32_t firstNode = 0;
+
+    std::memcpy(&firstNode, content.data() + nodesOffset, sizeof(firstNode));
+
+    {
+        /* A position beyond the number of nodes. */
+        std::string corruptedContent = content;
+
+        std::uint32_t position = static_cast<std::uint32_t>(header.nodeCount);
+
+        std::memcpy(&corruptedContent[positionsOffset + firstNode * sizeof(std::uint32_t)], &position, sizeof(position));
+
+        writeDecompositionFile(corruptedContent);
+
+        htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+        ASSERT_FALSE(view.isOpen());
+    }
+
+    {
+        /* Child offsets which are not monotone. */
+        std::string corruptedContent = content;
+
+        std::uint64_t offset = header.nodeCount;
+
+        std::memcpy(&corruptedContent[childOffsetsOffset + sizeof(std::uint64_t)], &offset, sizeof(offset));
+
+        writeDecompositionFile(corruptedContent);
+
+        htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+        ASSERT_FALSE(view.isOpen());
+    }
+
+    {
+        /* A largest node identifier whose successor overflows. */
+        std::string corruptedContent = content;
+
+        header.maximumNodeId = (std::uint64_t)-1;
+
+        std::memcpy(&corruptedContent[0], &header, sizeof(header));
+
+        writeDecompositionFile(corruptedContent);
+
+        htd_io::BinaryDecompositionView view(DECOMPOSITION_FILE);
+
+        ASSERT_FALSE(view.isOpen());
+    }
+
+    std::remove(DECOMPOSITION_FILE);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+/*
+ * File:   TdFormatExporterTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+#include <htd_io/main.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+class TdFormatExporterTest : public ::testing::Test
+{
+    public:
+        TdFormatExporterTest(void)
+        {
+
+        }
+
+        virtual ~TdFormatExporterTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+/**
+ *  Write the given tree decomposition in format 'td' the way the exporter did before it used a streaming writer.
+ *
+ *  @param[in] decomposition    The tree decomposition which shall be written.
+ *  @param[in] graph            The graph which was decomposed.
+ *  @param[in] outputStream     The output stream to which the decomposition shall be written.
+ */
+void writeReference(const htd::ITreeDecomposition & decomposition, const htd::IMultiHypergraph & graph, std::ostream & outputStream)
+{
+    std::size_t edgeCount = decomposition.edgeCount();
+
+    outputStream << "s td " << decomposition.vertexCount() << " " << decomposition.maximumBagSize() << " " << graph.vertexCount() << "\n";
+
+    std::unordered_map<htd::vertex_t, htd::index_t> indices;
+
+    htd::index_t index = 1;
+
+    for (htd::vertex_t node : decomposition.vertices())
+    {
+        std::stringstream bagContent;
+
+        for (htd::vertex_t vertex : decomposition.bagContent(node))
+        {
+            bagContent << vertex << " ";
+        }
+
+        outputStream << "b " << index << " " << bagContent.str() << "\n";
+
+        indices[node] = index;
+
+        ++index;
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = decomposition.hyperedges();
+
+    auto it = hyperedgeCollection.begin();
+
+    for (index = 0; index < edgeCount; ++index)
+    {
+        outputStream << indices.at((*it)[0]) << " " << indices.at((*it)[1]) << "\n";
+
+        ++it;
+    }
+}
+
+TEST(TdFormatExporterTest, CheckEmptyDecomposition)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::MultiHypergraph graph(libraryInstance.get());
+
+    graph.addVertices(3);
+
+    htd::TreeDecomposition decomposition(libraryInstance.get());
+
+    htd_io::TdFormatExporter exporter;
+
+    std::ostringstream expectedOutput;
+    std::ostringstream actualOutput;
+
+    writeReference(decomposition, graph, expectedOutput);
+
+    exporter.write(decomposition, graph, actualOutput);
+
+    ASSERT_EQ(std::string("s td 0 0 3\n"), actualOutput.str());
+    ASSERT_EQ(expectedOutput.str(), actualOutput.str());
+}
+
+TEST(TdFormatExporterTest, CheckComputedDecomposition)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::MultiHypergraph graph(libraryInstance.get());
+
+    graph.addVertices(6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 3);
+    graph.addEdge(3, 1);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 4);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance.get());
+
+    std::unique_ptr<htd::ITreeDecomposition> decomposition(algorithm.computeDecomposition(graph));
+
+    ASSERT_NE(nullptr, decomposition.get());
+
+    htd_io::TdFormatExporter exporter;
+
+    std::ostringstream expectedOutput;
+    std::ostringstream actualOutput;
+
+    writeReference(*decomposition, graph, expectedOutput);
+
+    exporter.write(*decomposition, graph, actualOutput);
+
+    ASSERT_EQ(expectedOutput.str(), actualOutput.str());
+}
+
+TEST(TdFormatExporterTest, CheckDecompositionWithGapsInNodeIdentifiers)
+{
+    std::unique_ptr<htd::LibraryInstance> libraryInstance(htd::createManagementInstance(htd::Id::FIRST));
+
+    htd::MultiHypergraph graph(libraryInstance.get());
+
+    graph.addVertices(4);
+
+    htd::TreeDecomposition decomposition(libraryInstance.get());
+
+    htd::vertex_t root = decomposition.insertRoot(std::vector<htd::vertex_t> { 1, 2 }, htd::FilteredHyperedgeCollection());
+
+    htd::vertex_t child1 = decomposition.addChild(root, std::vector<htd::vertex_t> { 2, 3 }, htd::FilteredHyperedgeCollection());
+    htd::vertex_t child2 = decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.addChild(child2, std::vector<htd::vertex_t> { 4 }, htd::FilteredHyperedgeCollection());
+
+    decomposition.removeVertex(child1);
+
+    decomposition.addChild(root, std::vector<htd::vertex_t> { 2, 3, 4 }, htd::FilteredHyperedgeCollection());
+
+    htd_io::TdFormatExporter exporter;
+
+    std::ostringstream expectedOutput;
+    std::ostringstream actualOutput;
+
+    writeReference(decomposition, graph, expectedOutput);
+
+    exporter.write(decomposition, graph, actualOutput);
+
+    ASSERT_EQ(expectedOutput.str(), actualOutput.str());
+
+    std::ostringstream writerOutput;
+
+    {
+        htd_io::StreamingWriter writer(writerOutput);
+
+        exporter.write(decomposition, graph, writer);
+    }
+
+    ASSERT_EQ(expectedOutput.str(), writerOutput.str());
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}